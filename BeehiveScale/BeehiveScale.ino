@@ -224,7 +224,10 @@ void setup() {
     // ArduinoOTA — обновление прошивки по воздуху
     ArduinoOTA.setHostname("beehivescale");
     ArduinoOTA.setPassword("ota_beehive");
-    ArduinoOTA.onStart([]() { lastActivityTime = millis(); });
+    ArduinoOTA.onStart([]() {
+      lastActivityTime = millis();
+      log_flush();  // после прошивки — перезагрузка: буфер строк в RAM не переживёт её
+    });
     ArduinoOTA.onProgress([](unsigned int, unsigned int) { lastActivityTime = millis(); });
     ArduinoOTA.begin();
   } else {
@@ -318,6 +321,7 @@ void loop() {
     }
     lastTempRead = now;
     sys.needsRedraw = true;
+    webserver_notify(WEB_EV_TEMP);
   }
 
   if (now - lastBatRead >= BAT_READ_INTERVAL_MS) {
@@ -325,10 +329,12 @@ void loop() {
     sys.batPercent  = bat_percent();
     lastBatRead = now;
     sys.needsRedraw = true;
+    webserver_notify(WEB_EV_BAT);
   }
 
   handle_buttons();
   process_weight();
+  webserver_notify(WEB_EV_WEIGHT);  // изменилось ли — решает webserver_handle()
   update_interface();
 
   // ── Фича 14: Watchdog HX711 — авто-перезапуск датчика при зависании ──
@@ -391,6 +397,7 @@ void loop() {
                  sys.tempData.temperature, sys.tempData.humidity, sys.batVoltage, sys.batPercent);
       lastLogWrite = now;
     }
+    log_tick();
   }
 #endif
 
@@ -451,9 +458,11 @@ void loop() {
   check_auto_sleep();
 
 #ifdef SLEEP_MODE_DEEP_SLEEP
+  tg_send_flush();  // отчёт/оповещение этого пробуждения ещё в очереди Telegram
   {
     log_append(sys.datetimeStr, sys.smoothedWeight,
                sys.tempData.temperature, sys.tempData.humidity, sys.batVoltage, sys.batPercent);
+    log_flush();  // буфер в RAM не переживёт deep sleep
   }
   persist.lastWeight = sys.smoothedWeight;
   persist.lastTempC = sys.tempData.temperature;
@@ -1318,7 +1327,8 @@ void check_auto_sleep() {
   lcd.noBacklight();
   lcd.clear();
 
-  // Отключаем WiFi
+  // Отключаем WiFi — после отправки очереди Telegram
+  tg_send_flush();
 #if defined(ESP32)
   WiFi.disconnect(true);
   WiFi.mode(WIFI_OFF);
@@ -1333,6 +1343,7 @@ void check_auto_sleep() {
   {
     log_append(sys.datetimeStr, sys.smoothedWeight,
                sys.tempData.temperature, sys.tempData.humidity, sys.batVoltage, sys.batPercent);
+    log_flush();
   }
 
   // Сохраняем данные
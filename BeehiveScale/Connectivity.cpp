@@ -2,11 +2,13 @@
 #include "Memory.h"
 #include <ArduinoJson.h>
 #include <time.h>
+#include <new>
 #include <RTClib.h>
 #if defined(ESP8266)
 #include <ESP8266WiFi.h>
 #include <ESP8266HTTPClient.h>
 #include <WiFiClientSecureBearSSL.h>
+#include <bearssl/bearssl.h>
 #include <ESP8266mDNS.h>
 #else
 #include <WiFi.h>
@@ -288,55 +290,60 @@ void queue_process() {
   Serial.println(F("[Queue] Done"));
 }
 
-static bool _tg_post(const char* message) {
-  if (!_wifi_active()) return false;
-
-  // Приоритет: EEPROM-настройки → хардкод из Connectivity.h
-  char tgToken[50] = {0};
-  char tgChatId[16] = {0};
-  get_tg_token(tgToken, sizeof(tgToken));
-  get_tg_chatid(tgChatId, sizeof(tgChatId));
-
-  const char* useToken  = (tgToken[0]  != '\0') ? tgToken  : TG_BOT_TOKEN;
-  const char* useChatId = (tgChatId[0] != '\0') ? tgChatId : TG_CHAT_ID;
+// Токен и chat_id: приоритет — EEPROM-настройки, затем хардкод из Connectivity.h.
+// false — не задан или недопустимые символы
+static bool _tg_target(char *token, size_t tokLen, char *chatId, size_t chatLen) {
+  get_tg_token(token, tokLen);
+  get_tg_chatid(chatId, chatLen);
+  if (token[0] == '\0')  snprintf(token, tokLen, "%s", TG_BOT_TOKEN);
+  if (chatId[0] == '\0') snprintf(chatId, chatLen, "%s", TG_CHAT_ID);
 
-  if (strncmp(useToken, "YOUR_", 5) == 0) return false;
+  if (strncmp(token, "YOUR_", 5) == 0) return false;
 
   // Validate token contains only safe URL characters
-  for (const char *p = useToken; *p; p++) {
+  for (const char *p = token; *p; p++) {
     char c = *p;
     if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == ':' || c == '_' || c == '-')) {
       Serial.println(F("[TG] Invalid token characters"));
       return false;
     }
   }
+  return true;
+}
+
+// Тело sendMessage (JSON) в body
+static void _tg_body(char *body, size_t len, const char *chatId, const char *message) {
+  StaticJsonDocument<256> doc;
+  doc["chat_id"] = chatId;
+  doc["text"] = message;
+  doc["parse_mode"] = "HTML";
+  serializeJson(doc, body, len);
+}
+
+#if defined(ESP32)
+// Синхронная отправка — только из задачи FreeRTOS (_tg_task), на ESP8266
+// обмен ведёт TgSend
+static bool _tg_post(const char* message) {
+  if (!_wifi_active()) return false;
+
+  char tgToken[50] = {0};
+  char tgChatId[16] = {0};
+  if (!_tg_target(tgToken, sizeof(tgToken), tgChatId, sizeof(tgChatId))) return false;
 
-#if defined(ESP8266)
-  BearSSL::WiFiClientSecure client;
-#else
   WiFiClientSecure client;
-#endif
   client.setInsecure();
 
   HTTPClient http;
   http.setTimeout(HTTP_TIMEOUT_MS);
 
   char url[160];
-  snprintf(url, sizeof(url), "https://%s/bot%s/sendMessage", TG_HOST, useToken);
+  snprintf(url, sizeof(url), "https://%s/bot%s/sendMessage", TG_HOST, tgToken);
 
-#if defined(ESP8266)
-  if (!http.begin(client, url)) return false;
-#else
   http.begin(client, url);
-#endif
   http.addHeader("Content-Type", "application/json");
 
-  StaticJsonDocument<256> doc;
-  doc["chat_id"] = useChatId;
-  doc["text"] = message;
-  doc["parse_mode"] = "HTML";
   char body[384];
-  serializeJson(doc, body, sizeof(body));
+  _tg_body(body, sizeof(body), tgChatId, message);
 
   int code = http.POST(body);
   http.end();
@@ -348,9 +355,37 @@ static bool _tg_post(const char* message) {
   Serial.print(F("[TG] Error code: ")); Serial.println(code);
   return false;
 }
+#endif
+
+// ─── Очередь сообщений Telegram ──────────────────────────────────────────
+// Оповещения и отчёты не отправляются на месте: TLS-контекст (~22 КБ) держит
+// только одна фоновая отправка, остальные ждут здесь. tg_send_poll() берёт
+// следующее, когда предыдущее завершилось
+static char    _tgQueue[TG_QUEUE_LEN][TG_MSG_MAX];
+static uint8_t _tgQHead = 0, _tgQCount = 0;
+
+static void _tg_queue_next() {
+  if (_tgQCount == 0 || tg_send_state() == TG_SEND_BUSY) return;
+  const char *msg = _tgQueue[_tgQHead];
+  _tgQHead = (_tgQHead + 1) % TG_QUEUE_LEN;
+  _tgQCount--;
+  if (!tg_send_begin(msg)) Serial.println(F("[TG] Send not started"));
+}
+
+// false — очередь полна, сообщение отброшено
+static bool _tg_enqueue(const char *msg) {
+  if (_tgQCount >= TG_QUEUE_LEN) {
+    Serial.println(F("[TG] Queue full, message dropped"));
+    return false;
+  }
+  snprintf(_tgQueue[(_tgQHead + _tgQCount) % TG_QUEUE_LEN], TG_MSG_MAX, "%s", msg);
+  _tgQCount++;
+  _tg_queue_next();
+  return true;
+}
 
 bool tg_send_message(const String &text) {
-  return _tg_post(text.c_str());
+  return _tg_enqueue(text.c_str());
 }
 
 bool tg_send_alert(float weight, float tempC, const String &datetime) {
@@ -367,11 +402,11 @@ bool tg_send_alert(float weight, float tempC, const String &datetime) {
     "Ves: <b>%.2f kg</b>\n"
     "Temp: %s",
     datetime.c_str(), weight, tempStr);
-  return _tg_post(msg);
+  return _tg_enqueue(msg);
 }
 
 bool tg_send_report(float weight, float tempC, float humidity, const String &datetime) {
-  char msg[320];
+  char msg[TG_MSG_MAX];
   int pos = 0;
   pos += snprintf(msg + pos, sizeof(msg) - pos,
     "<b>Otchet: uley</b>\nVremya: %s\nVes: %.2f kg\n",
@@ -382,7 +417,249 @@ bool tg_send_report(float weight, float tempC, float humidity, const String &dat
   if (humidity > -90) {
     pos += snprintf(msg + pos, sizeof(msg) - pos, "Vlazhn: %.1f %%\n", humidity);
   }
-  return _tg_post(msg);
+  return _tg_enqueue(msg);
+}
+
+// ─── Telegram без блокировки loop() ──────────────────────────────────────
+// tg_send_begin() только ставит сообщение; tg_send_poll() из loop() ведёт
+// обмен шагами не дольше TG_SLICE_MS за вызов. ESP8266: движок BearSSL
+// крутится вручную поверх неблокирующего WiFiClient — ожидание ответов сети
+// (рукопожатие, ответ API) loop() не держит. Неделимы только соединение TCP
+// (DNS + один RTT) и отдельные шаги криптографии рукопожатия.
+// ESP32: та же _tg_post() в задаче FreeRTOS.
+static volatile uint8_t _tgState = TG_SEND_IDLE;
+
+uint8_t tg_send_state() {
+  return _tgState;
+}
+
+#if defined(ESP8266)
+// Сертификат сервера не проверяется (как setInsecure() в ts_send):
+// из первого сертификата цепочки берётся только открытый ключ
+struct TgX509 {
+  const br_x509_class *vt;
+  br_x509_decoder_context dec;
+  uint8_t certN;
+};
+
+static void _tgx_dn(void *, const void *, size_t) {}
+static void _tgx_start_chain(const br_x509_class **ctx, const char *) {
+  ((TgX509*)ctx)->certN = 0;
+}
+static void _tgx_start_cert(const br_x509_class **ctx, uint32_t) {
+  TgX509 *x = (TgX509*)ctx;
+  if (x->certN == 0) br_x509_decoder_init(&x->dec, _tgx_dn, nullptr);
+}
+static void _tgx_append(const br_x509_class **ctx, const unsigned char *buf, size_t len) {
+  TgX509 *x = (TgX509*)ctx;
+  if (x->certN == 0) br_x509_decoder_push(&x->dec, buf, len);
+}
+static void _tgx_end_cert(const br_x509_class **ctx) {
+  ((TgX509*)ctx)->certN++;
+}
+static unsigned _tgx_end_chain(const br_x509_class **ctx) {
+  return br_x509_decoder_get_pkey(&((TgX509*)ctx)->dec) ? 0 : BR_ERR_X509_NOT_TRUSTED;
+}
+static const br_x509_pkey *_tgx_get_pkey(const br_x509_class *const *ctx, unsigned *usages) {
+  if (usages) *usages = BR_KEYTYPE_KEYX | BR_KEYTYPE_SIGN;
+  return br_x509_decoder_get_pkey(&((TgX509*)ctx)->dec);
+}
+static const br_x509_class _tgX509 = {
+  sizeof(TgX509), _tgx_start_chain, _tgx_start_cert, _tgx_append,
+  _tgx_end_cert, _tgx_end_chain, _tgx_get_pkey
+};
+
+#define TG_OBUF  837   // запись наружу — как у WiFiClientSecure по умолчанию
+
+// Всё состояние отправки — в heap только на время обмена (~22 КБ, почти всё —
+// входной буфер записи TLS)
+struct TgSend {
+  br_ssl_client_context sc;
+  TgX509        x509;
+  WiFiClient    tcp;
+  unsigned long startAt;
+  bool          connected;
+  char          req[600];       // HTTP-запрос целиком
+  uint16_t      reqLen, reqOff;
+  char          status[13];     // "HTTP/1.1 200"
+  uint8_t       statusLen;
+  unsigned char obuf[TG_OBUF];
+  unsigned char ibuf[BR_SSL_BUFSIZE_INPUT];
+};
+static TgSend *_tgs = nullptr;
+
+static void _tg_finish(bool ok) {
+  if (_tgs) {
+    _tgs->tcp.stop();
+    delete _tgs;
+    _tgs = nullptr;
+  }
+  _tgState = ok ? TG_SEND_OK : TG_SEND_FAIL;
+  if (ok) Serial.println(F("[TG] Message sent OK"));
+  else    Serial.println(F("[TG] Async send failed"));
+}
+
+// Соединение и настройка движка; false — не удалось
+static bool _tg_connect(TgSend &t) {
+  t.tcp.setTimeout(HTTP_TIMEOUT_MS);
+  if (!t.tcp.connect(TG_HOST, 443)) return false;
+  t.tcp.setNoDelay(true);
+  // init_full нужен минимальный x509 только на время инициализации
+  br_x509_minimal_context *xm = new (std::nothrow) br_x509_minimal_context;
+  if (!xm) return false;
+  br_ssl_client_init_full(&t.sc, xm, nullptr, 0);
+  delete xm;
+  t.x509.vt = &_tgX509;
+  br_ssl_engine_set_x509(&t.sc.eng, &t.x509.vt);
+  br_ssl_engine_set_buffers_bidi(&t.sc.eng, t.ibuf, sizeof(t.ibuf), t.obuf, sizeof(t.obuf));
+  return br_ssl_client_reset(&t.sc, TG_HOST, 0) != 0;
+}
+
+// Один шаг обмена; false — ждать сети (или обмен завершён)
+static bool _tg_step(TgSend &t) {
+  if (!t.connected) {
+    t.connected = true;
+    if (!_tg_connect(t)) { _tg_finish(false); return false; }
+    return true;
+  }
+  br_ssl_engine_context *eng = &t.sc.eng;
+  unsigned st = br_ssl_engine_current_state(eng);
+  if (st & BR_SSL_CLOSED) {
+    if (br_ssl_engine_last_error(eng)) {
+      Serial.print(F("[TG] TLS error: ")); Serial.println(br_ssl_engine_last_error(eng));
+    }
+    _tg_finish(false);
+    return false;
+  }
+  size_t len;
+  if (st & BR_SSL_SENDREC) {
+    unsigned char *buf = br_ssl_engine_sendrec_buf(eng, &len);
+    size_t room = t.tcp.availableForWrite();
+    if (room) {
+      size_t n = t.tcp.write(buf, len < room ? len : room);
+      if (n) { br_ssl_engine_sendrec_ack(eng, n); return true; }
+    }
+  }
+  if (st & BR_SSL_RECVREC) {
+    int av = t.tcp.available();
+    if (av > 0) {
+      unsigned char *buf = br_ssl_engine_recvrec_buf(eng, &len);
+      int n = t.tcp.read(buf, len < (size_t)av ? len : (size_t)av);
+      if (n > 0) { br_ssl_engine_recvrec_ack(eng, n); return true; }
+    } else if (!t.tcp.connected()) {
+      _tg_finish(false);
+      return false;
+    }
+  }
+  if ((st & BR_SSL_SENDAPP) && t.reqOff < t.reqLen) {
+    unsigned char *buf = br_ssl_engine_sendapp_buf(eng, &len);
+    size_t n = t.reqLen - t.reqOff;
+    if (n > len) n = len;
+    memcpy(buf, t.req + t.reqOff, n);
+    br_ssl_engine_sendapp_ack(eng, n);
+    t.reqOff += n;
+    if (t.reqOff == t.reqLen) br_ssl_engine_flush(eng, 0);
+    return true;
+  }
+  if (st & BR_SSL_RECVAPP) {
+    // Нужна только строка статуса ответа
+    unsigned char *buf = br_ssl_engine_recvapp_buf(eng, &len);
+    size_t n = sizeof(t.status) - 1 - t.statusLen;
+    if (n > len) n = len;
+    memcpy(t.status + t.statusLen, buf, n);
+    t.statusLen += n;
+    br_ssl_engine_recvapp_ack(eng, len);
+    if (t.statusLen == sizeof(t.status) - 1) {
+      t.status[t.statusLen] = '\0';
+      int code = atoi(t.status + 9);
+      if (code != 200) { Serial.print(F("[TG] Error code: ")); Serial.println(code); }
+      _tg_finish(code == 200);
+      return false;
+    }
+    return true;
+  }
+  return false;
+}
+
+bool tg_send_begin(const char *text) {
+  if (_tgState == TG_SEND_BUSY) return false;
+  char tgToken[50] = {0};
+  char tgChatId[16] = {0};
+  if (!_wifi_active() || !_tg_target(tgToken, sizeof(tgToken), tgChatId, sizeof(tgChatId))) {
+    _tgState = TG_SEND_FAIL;
+    return false;
+  }
+  _tgs = new (std::nothrow) TgSend();
+  if (!_tgs) { _tgState = TG_SEND_FAIL; return false; }
+  char body[384];
+  _tg_body(body, sizeof(body), tgChatId, text);
+  int n = snprintf(_tgs->req, sizeof(_tgs->req),
+                   "POST /bot%s/sendMessage HTTP/1.1\r\nHost: %s\r\n"
+                   "Content-Type: application/json\r\nContent-Length: %u\r\n"
+                   "Connection: close\r\n\r\n%s",
+                   tgToken, TG_HOST, (unsigned)strlen(body), body);
+  if (n <= 0 || n >= (int)sizeof(_tgs->req)) { _tg_finish(false); return false; }
+  _tgs->reqLen  = n;
+  _tgs->startAt = millis();
+  _tgState = TG_SEND_BUSY;
+  return true;
+}
+
+uint8_t tg_send_poll() {
+  unsigned long t0 = millis();
+  while (_tgs && millis() - t0 < TG_SLICE_MS) {
+    if (millis() - _tgs->startAt > TG_TIMEOUT_MS) {
+      Serial.println(F("[TG] Timeout"));
+      _tg_finish(false);
+      break;
+    }
+    if (!_tg_step(*_tgs)) break;
+  }
+  _tg_queue_next();
+  return _tgState;
+}
+
+#else
+static char *_tgMsg = nullptr;
+
+static void _tg_task(void *) {
+  bool ok = _tg_post(_tgMsg);
+  free(_tgMsg);
+  _tgMsg = nullptr;
+  _tgState = ok ? TG_SEND_OK : TG_SEND_FAIL;
+  vTaskDelete(NULL);
+}
+
+bool tg_send_begin(const char *text) {
+  if (_tgState == TG_SEND_BUSY) return false;
+  _tgMsg = strdup(text);
+  if (!_tgMsg) { _tgState = TG_SEND_FAIL; return false; }
+  _tgState = TG_SEND_BUSY;
+  if (xTaskCreate(_tg_task, "tg", 8192, nullptr, 1, nullptr) != pdPASS) {
+    free(_tgMsg);
+    _tgMsg = nullptr;
+    _tgState = TG_SEND_FAIL;
+    return false;
+  }
+  return true;
+}
+
+uint8_t tg_send_poll() {
+  _tg_queue_next();
+  return _tgState;
+}
+#endif
+
+void tg_send_flush() {
+  while (tg_send_poll() == TG_SEND_BUSY || _tgQCount > 0) {
+#if defined(ESP32)
+    esp_task_wdt_reset();
+#elif defined(ESP8266)
+    ESP.wdtFeed();
+#endif
+    yield();
+    delay(10);
+  }
 }
 
 bool ts_send(float weight, float tempC, float humidity, float rtcTempC) {
@@ -423,6 +700,30 @@ static bool _ntpInitialized = false;
 
 extern bool rtc_set(uint16_t y, uint8_t mo, uint8_t d, uint8_t h, uint8_t mi, uint8_t s);
 
+// Записать полученное от SNTP время в RTC
+static bool _ntp_apply(const struct tm *timeinfo) {
+  char timeStr[64];
+  strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", timeinfo);
+  Serial.print(F("[NTP] Got time: "));
+  Serial.println(timeStr);
+
+  if (rtc_set(
+    timeinfo->tm_year + 1900,
+    timeinfo->tm_mon + 1,
+    timeinfo->tm_mday,
+    timeinfo->tm_hour,
+    timeinfo->tm_min,
+    timeinfo->tm_sec
+  )) {
+    Serial.println(F("[NTP] Time set to RTC!"));
+    _lastNtpSync = millis();
+    _ntpInitialized = true;
+    return true;
+  }
+  Serial.println(F("[NTP] RTC error"));
+  return false;
+}
+
 bool ntp_sync_time() {
   if (!_wifi_active()) {
     Serial.println(F("[NTP] Error: no WiFi"));
@@ -454,27 +755,7 @@ bool ntp_sync_time() {
     return false;
   }
 
-  char timeStr[64];
-  strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", &timeinfo);
-  Serial.print(F("[NTP] Got time: "));
-  Serial.println(timeStr);
-
-  if (rtc_set(
-    timeinfo.tm_year + 1900,
-    timeinfo.tm_mon + 1,
-    timeinfo.tm_mday,
-    timeinfo.tm_hour,
-    timeinfo.tm_min,
-    timeinfo.tm_sec
-  )) {
-    Serial.println(F("[NTP] Time set to RTC!"));
-    _lastNtpSync = millis();
-    _ntpInitialized = true;
-    return true;
-  } else {
-    Serial.println(F("[NTP] RTC error"));
-    return false;
-  }
+  return _ntp_apply(&timeinfo);
 
 #elif defined(ESP8266)
   configTime(NTP_TIMEZONE * 3600, 0, NTP_SERVER_1, NTP_SERVER_2);
@@ -497,31 +778,55 @@ bool ntp_sync_time() {
     return false;
   }
 
-  struct tm *timeinfo = localtime(&now);
-  char timeStr[64];
-  strftime(timeStr, sizeof(timeStr), "%Y-%m-%d %H:%M:%S", timeinfo);
-  Serial.print(F("[NTP] Got time: "));
-  Serial.println(timeStr);
+  return _ntp_apply(localtime(&now));
+#endif
+}
 
-  if (rtc_set(
-    timeinfo->tm_year + 1900,
-    timeinfo->tm_mon + 1,
-    timeinfo->tm_mday,
-    timeinfo->tm_hour,
-    timeinfo->tm_min,
-    timeinfo->tm_sec
-  )) {
-    Serial.println(F("[NTP] Time set to RTC!"));
-    _lastNtpSync = millis();
-    _ntpInitialized = true;
-    return true;
-  } else {
-    Serial.println(F("[NTP] RTC error"));
+// ─── NTP без блокировки (для /api/ntp) ───────────────────────────────────
+// ntp_sync_time() ждёт ответа до 15 с прямо в loop(). Здесь begin только
+// запускает SNTP, а poll (из webserver_handle) проверяет, пришло ли время
+static uint8_t       _ntpState = NTP_SYNC_IDLE;
+static unsigned long _ntpStart = 0;
+
+bool ntp_sync_begin() {
+  if (_ntpState == NTP_SYNC_BUSY) return true;
+  if (!_wifi_active()) {
+    Serial.println(F("[NTP] Error: no WiFi"));
+    _ntpState = NTP_SYNC_FAIL;
     return false;
   }
+  Serial.print(F("[NTP] Async sync, server: "));
+  Serial.println(NTP_SERVER_1);
+  configTime(NTP_TIMEZONE * 3600, 0, NTP_SERVER_1, NTP_SERVER_2);
+  _ntpStart = millis();
+  _ntpState = NTP_SYNC_BUSY;
+  return true;
+}
+
+uint8_t ntp_sync_poll() {
+  if (_ntpState != NTP_SYNC_BUSY) return _ntpState;
+#if defined(ESP32)
+  struct tm timeinfo;
+  if (getLocalTime(&timeinfo, 0)) {
+    _ntpState = _ntp_apply(&timeinfo) ? NTP_SYNC_OK : NTP_SYNC_FAIL;
+    return _ntpState;
+  }
+#elif defined(ESP8266)
+  time_t now = time(nullptr);
+  if (now >= 100000) {
+    _ntpState = _ntp_apply(localtime(&now)) ? NTP_SYNC_OK : NTP_SYNC_FAIL;
+    return _ntpState;
+  }
 #endif
+  if (millis() - _ntpStart >= NTP_TIMEOUT_MS) {
+    Serial.println(F("[NTP] Sync failed!"));
+    _ntpState = NTP_SYNC_FAIL;
+  }
+  return _ntpState;
 }
 
+uint8_t ntp_sync_state() { return _ntpState; }
+
 void ntp_loop() {
   if (!_ntpInitialized) {
     _ntpInitialized = true;
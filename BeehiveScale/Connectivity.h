@@ -22,12 +22,19 @@
 #define NTP_SERVER_1         "pool.ntp.org"
 #define NTP_SERVER_2         "time.nist.gov"
 #define NTP_SYNC_INTERVAL    3600000UL
+#define NTP_TIMEOUT_MS       15000UL    // ntp_sync_poll(): ожидание ответа SNTP
+enum { NTP_SYNC_IDLE, NTP_SYNC_BUSY, NTP_SYNC_OK, NTP_SYNC_FAIL };
 
 // ─── Настройки Telegram ───────────────────────────────────────────────────
 #define TG_BOT_TOKEN     "YOUR_BOT_TOKEN"
 #define TG_CHAT_ID       "YOUR_CHAT_ID"
 #define TG_ALERT_DELTA_KG   1.0f
 #define TG_REPORT_INTERVAL  21600000UL
+#define TG_SLICE_MS         20         // tg_send_poll(): время на один вызов
+#define TG_TIMEOUT_MS       20000UL    // вся фоновая отправка
+#define TG_QUEUE_LEN        2          // оповещения/отчёты, ждущие своей очереди
+#define TG_MSG_MAX          320        // длина сообщения в очереди
+enum { TG_SEND_IDLE, TG_SEND_BUSY, TG_SEND_OK, TG_SEND_FAIL };
 
 // ─── Настройки ThingSpeak ─────────────────────────────────────────────────
 #define USE_THINGSPEAK   1
@@ -55,7 +62,21 @@ void       wifi_ensure_connected();
 
 bool       ntp_sync_time();
 void       ntp_loop();
+// Синхронизация без ожидания: begin запускает SNTP (false — нет WiFi),
+// poll проверяет, пришло ли время, и возвращает NTP_SYNC_*
+bool       ntp_sync_begin();
+uint8_t    ntp_sync_poll();
+uint8_t    ntp_sync_state();  // NTP_SYNC_* без проверки
 
+// Отправка без блокировки loop(): begin ставит сообщение (false — не задан
+// токен/нет WiFi/уже идёт отправка), poll из loop() ведёт обмен порциями
+// не дольше TG_SLICE_MS, запускает следующее из очереди и возвращает TG_SEND_*
+bool    tg_send_begin(const char *text);
+uint8_t tg_send_poll();
+uint8_t tg_send_state();   // TG_SEND_* без шага обмена
+void    tg_send_flush();   // дождаться отправки очереди (перед сном, WiFi ещё включён)
+// message/alert/report встают в очередь (TG_QUEUE_LEN), отправляет их
+// tg_send_poll(); false — очередь полна
 bool tg_send_message(const String &text);
 bool tg_send_alert(float weight, float tempC, const String &datetime);
 bool tg_send_report(float weight, float tempC, float humidity, const String &datetime);
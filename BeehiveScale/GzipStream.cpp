@@ -0,0 +1,184 @@
+#include "GzipStream.h"
+
+// ─── Таблицы deflate (RFC 1951, 3.2.5) ────────────────────────────────────
+static const uint16_t LEN_BASE[29] = {
+  3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+  35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+static const uint8_t  LEN_EXTRA[29] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+static const uint16_t DIST_BASE[30] = {
+  1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+  257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+static const uint8_t  DIST_EXTRA[30] = {
+  0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+// CRC-32 gzip по полубайтам: таблица 64 байта вместо 1 КБ
+static const uint32_t CRC_NIB[16] = {
+  0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+  0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+
+static const uint16_t GZ_MIN_MATCH = 3;
+static const uint16_t GZ_MAX_MATCH = 258;
+static const uint32_t GZ_NONE      = 0xFFFFFFFFUL;
+
+static inline uint16_t _gz_hash(const uint8_t *p) {
+  return (uint16_t)(((p[0] << 6) ^ (p[1] << 3) ^ p[2] ^ (p[0] >> 3)) & ((1 << GZ_HASH_BITS) - 1));
+}
+
+// Код Хаффмана пишется старшим битом вперёд — в поток младшими битами он разворачивается
+static inline uint32_t _gz_rev(uint32_t code, uint8_t n) {
+  uint32_t r = 0;
+  while (n--) { r = (r << 1) | (code & 1); code >>= 1; }
+  return r;
+}
+
+GzipStream::~GzipStream() {
+  free(_buf);
+  free(_head);
+}
+
+uint32_t gz_crc32(uint32_t crc, const uint8_t *p, size_t n) {
+  crc = ~crc;
+  for (size_t i = 0; i < n; i++) {
+    crc ^= p[i];
+    crc = (crc >> 4) ^ CRC_NIB[crc & 15];
+    crc = (crc >> 4) ^ CRC_NIB[crc & 15];
+  }
+  return ~crc;
+}
+
+bool GzipStream::begin(bool raw) {
+  _raw = raw;
+  _len = _pos = 0;
+  _base = 0;
+  _bits = 0; _nbits = 0; _on = 0;
+  _crc = 0xFFFFFFFFUL;
+  _size = 0;
+  _buf  = (uint8_t*)malloc(GZ_BUF);
+  _head = (uint32_t*)malloc(sizeof(uint32_t) << GZ_HASH_BITS);
+  if (!_buf || !_head) {
+    free(_buf); free(_head);
+    _buf = nullptr; _head = nullptr;
+    return false;
+  }
+  for (int i = 0; i < (1 << GZ_HASH_BITS); i++) _head[i] = GZ_NONE;
+  // Заголовок gzip: deflate, без имени и времени, ОС — «неизвестна»
+  static const uint8_t hdr[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+  if (!raw) for (uint8_t b : hdr) _putByte(b);
+  // Один блок с фиксированными кодами до конца потока: BFINAL=1, BTYPE=01
+  _putBits(1, 1);
+  _putBits(1, 2);
+  return true;
+}
+
+size_t GzipStream::write(const uint8_t *b, size_t n) {
+  if (!_buf) return 0;
+  _crc = ~gz_crc32(~_crc, b, n);
+  _size += n;
+  size_t done = 0;
+  while (done < n) {
+    size_t take = GZ_BUF - _len;
+    if (take > n - done) take = n - done;
+    memcpy(_buf + _len, b + done, take);
+    _len += take;
+    done += take;
+    if (_len < GZ_BUF) break;
+    // Буфер полон: кодируем всё, кроме запаса под самое длинное совпадение,
+    // и сдвигаем — в начале остаётся окно GZ_WINDOW уже закодированных байт
+    _compress(false);
+    uint16_t shift = (_pos > GZ_WINDOW) ? _pos - GZ_WINDOW : 0;
+    memmove(_buf, _buf + shift, _len - shift);
+    _len  -= shift;
+    _pos  -= shift;
+    _base += shift;
+    yield();
+  }
+  return n;
+}
+
+void GzipStream::end() {
+  if (!_buf) return;
+  _compress(true);
+  _putSym(256);                             // конец блока
+  if (_nbits > 0) _putBits(0, 8 - _nbits);  // добивка до байта
+  if (!_raw) {
+    uint32_t crc = ~_crc;
+    for (int i = 0; i < 4; i++) _putByte((uint8_t)(crc >> (8 * i)));
+    for (int i = 0; i < 4; i++) _putByte((uint8_t)(_size >> (8 * i)));
+  }
+  _flushOut();
+  free(_buf); free(_head);
+  _buf = nullptr; _head = nullptr;
+}
+
+// Жадный LZ77: одна позиция-кандидат на хэш, без цепочек — быстро и в 2 КБ таблицы
+void GzipStream::_compress(bool final) {
+  uint16_t limit = final ? _len : (_len > GZ_MAX_MATCH ? _len - GZ_MAX_MATCH : 0);
+  while (_pos < limit) {
+    uint16_t best = 0, dist = 0;
+    if (_len - _pos >= GZ_MIN_MATCH) {
+      uint16_t h = _gz_hash(_buf + _pos);
+      uint32_t cand = _head[h];
+      uint32_t abs = _base + _pos;
+      _head[h] = abs;
+      if (cand != GZ_NONE && cand >= _base && cand < abs && abs - cand <= GZ_WINDOW) {
+        const uint8_t *a = _buf + (cand - _base), *p = _buf + _pos;
+        uint16_t maxLen = _len - _pos;
+        if (maxLen > GZ_MAX_MATCH) maxLen = GZ_MAX_MATCH;
+        while (best < maxLen && a[best] == p[best]) best++;
+        dist = abs - cand;
+      }
+    }
+    if (best >= GZ_MIN_MATCH) {
+      _putMatch(best, dist);
+      // Позиции внутри совпадения — в хэш, чтобы следующие ссылки их находили
+      for (uint16_t i = 1; i < best && _pos + i + GZ_MIN_MATCH <= _len; i++)
+        _head[_gz_hash(_buf + _pos + i)] = _base + _pos + i;
+      _pos += best;
+    } else {
+      _putSym(_buf[_pos]);
+      _pos++;
+    }
+  }
+}
+
+// Фиксированные коды литералов/длин (RFC 1951, 3.2.6)
+void GzipStream::_putSym(uint16_t sym) {
+  if (sym < 144)      _putBits(_gz_rev(0x30 + sym, 8), 8);
+  else if (sym < 256) _putBits(_gz_rev(0x190 + sym - 144, 9), 9);
+  else if (sym < 280) _putBits(_gz_rev(sym - 256, 7), 7);
+  else                _putBits(_gz_rev(0xC0 + sym - 280, 8), 8);
+}
+
+void GzipStream::_putMatch(uint16_t len, uint16_t dist) {
+  int lc = 28;
+  while (LEN_BASE[lc] > len) lc--;
+  _putSym(257 + lc);
+  if (LEN_EXTRA[lc]) _putBits(len - LEN_BASE[lc], LEN_EXTRA[lc]);
+  int dc = 29;
+  while (DIST_BASE[dc] > dist) dc--;
+  _putBits(_gz_rev(dc, 5), 5);
+  if (DIST_EXTRA[dc]) _putBits(dist - DIST_BASE[dc], DIST_EXTRA[dc]);
+}
+
+void GzipStream::_putBits(uint32_t v, uint8_t n) {
+  _bits |= v << _nbits;
+  _nbits += n;
+  while (_nbits >= 8) {
+    _putByte((uint8_t)_bits);
+    _bits >>= 8;
+    _nbits -= 8;
+  }
+}
+
+void GzipStream::_putByte(uint8_t b) {
+  _ob[_on++] = b;
+  if (_on == sizeof(_ob)) _flushOut();
+}
+
+void GzipStream::_flushOut() {
+  if (_on > 0) _out.write(_ob, _on);
+  _on = 0;
+}
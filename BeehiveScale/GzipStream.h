@@ -0,0 +1,60 @@
+#ifndef GZIP_STREAM_H
+#define GZIP_STREAM_H
+
+#include <Arduino.h>
+
+// ─── Потоковое сжатие gzip для HTTP-ответов ───────────────────────────────
+// LZ77 с маленьким окном + фиксированные коды Хаффмана (deflate, RFC 1951/1952).
+// Память — буфер GZ_BUF и хэш-таблица, ~5 КБ из кучи на время ответа.
+// CSV лога сжимается в 5–8 раз: во столько же короче передача по AP и
+// блокировка однопоточного сервера.
+#define GZ_WINDOW     1024           // окно: ссылки не дальше 1 КБ назад
+#define GZ_BUF        (3 * GZ_WINDOW) // окно + новые данные
+#define GZ_HASH_BITS  9              // 512 ячеек по 4 байта
+
+class GzipStream : public Stream {
+public:
+  explicit GzipStream(Stream &out) : _out(out) {}
+  ~GzipStream();
+  // Выделить память и записать заголовок gzip; false — не хватило heap.
+  // raw — голый deflate без заголовка и хвоста (для записей ZIP).
+  // После end() поток можно начать заново.
+  bool   begin(bool raw = false);
+  // Дожать остаток, закрыть блок и (кроме raw) записать CRC-32 и длину
+  void   end();
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) override;
+  int    available() override { return 0; }
+  int    read()      override { return -1; }
+  int    peek()      override { return -1; }
+  void   flush()     override {}  // deflate дописывается только в end()
+  uint32_t inBytes() const { return _size; }  // сколько записано до сжатия
+  uint32_t crc32()   const { return ~_crc; }  // CRC-32 записанного до сжатия
+
+private:
+  Stream   &_out;
+  uint8_t  *_buf  = nullptr;  // [0, _len): окно + несжатые данные
+  uint32_t *_head = nullptr;  // хэш 3 байт → абсолютная позиция
+  uint16_t  _len  = 0;
+  uint16_t  _pos  = 0;        // первая ещё не закодированная позиция в _buf
+  uint32_t  _base = 0;        // абсолютная позиция _buf[0]
+  uint32_t  _bits = 0;        // битовый накопитель (младшие биты — первыми)
+  uint8_t   _nbits = 0;
+  uint8_t   _ob[128];         // выходные байты до записи в _out
+  uint8_t   _on = 0;
+  uint32_t  _crc  = 0xFFFFFFFFUL;
+  uint32_t  _size = 0;
+  bool      _raw  = false;
+
+  void _compress(bool final);
+  void _putBits(uint32_t v, uint8_t n);
+  void _putSym(uint16_t sym);
+  void _putMatch(uint16_t len, uint16_t dist);
+  void _putByte(uint8_t b);
+  void _flushOut();
+};
+
+// CRC-32 (gzip/ZIP): продолжить crc по n байтам; начальное значение — 0
+uint32_t gz_crc32(uint32_t crc, const uint8_t *p, size_t n);
+
+#endif
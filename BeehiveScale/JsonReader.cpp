@@ -0,0 +1,212 @@
+#include "JsonReader.h"
+
+static inline bool _ws(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+void JsonReader::begin(Handler fn, void *ctx) {
+  _fn = fn;
+  _ctx = ctx;
+  _st = S_ROOT;
+  _depth = 0;
+  _arr = 0;
+  _key[0] = '\0';
+  _keyOver = false;
+  _hi = 0;
+}
+
+bool JsonReader::feed(const char *p, size_t n) {
+  if (_st == S_IDLE || _st == S_ERR) return false;
+  for (size_t i = 0; i < n; i++) {
+    if (!_step(p[i])) { _st = S_ERR; return false; }
+  }
+  return true;
+}
+
+bool JsonReader::_step(char c) {
+  // Внутри строки и литерала пробелы значимы
+  switch (_st) {
+    case S_STR:
+      if (c == '"') { _endString(); return true; }
+      if (c == '\\') { _st = S_ESC; return true; }
+      if ((uint8_t)c < 0x20) return false;
+      if (_hi) { _put('?'); _hi = 0; }
+      _put(c);
+      return true;
+    case S_ESC: {
+      _st = S_STR;
+      char r;
+      switch (c) {
+        case '"': case '\\': case '/': r = c; break;
+        case 'b': r = '\b'; break;
+        case 'f': r = '\f'; break;
+        case 'n': r = '\n'; break;
+        case 'r': r = '\r'; break;
+        case 't': r = '\t'; break;
+        case 'u': _st = S_HEX; _hexN = 0; _hex = 0; return true;
+        default:  return false;
+      }
+      if (_hi) { _put('?'); _hi = 0; }
+      _put(r);
+      return true;
+    }
+    case S_HEX: {
+      int d = (c >= '0' && c <= '9') ? c - '0'
+            : (c >= 'a' && c <= 'f') ? c - 'a' + 10
+            : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+      if (d < 0) return false;
+      _hex = (_hex << 4) | d;
+      if (++_hexN < 4) return true;
+      _st = S_STR;
+      if (_hex >= 0xD800 && _hex < 0xDC00) {           // старшая половина пары
+        if (_hi) _put('?');
+        _hi = _hex;
+      } else if (_hex >= 0xDC00 && _hex < 0xE000) {    // младшая
+        if (_hi) _putCode(0x10000 + ((uint32_t)(_hi - 0xD800) << 10) + (_hex - 0xDC00));
+        else     _put('?');
+        _hi = 0;
+      } else {
+        if (_hi) { _put('?'); _hi = 0; }
+        _putCode(_hex ? _hex : '?');                   // \u0000 в строку C не ляжет
+      }
+      return true;
+    }
+    case S_LIT:
+      if (isalnum((uint8_t)c) || c == '+' || c == '-' || c == '.') { _put(c); return true; }
+      if (!_endLiteral()) return false;
+      _st = S_AFTER;
+      break;                                           // c — уже после литерала
+    default:
+      break;
+  }
+
+  if (_ws(c)) return true;
+  switch (_st) {
+    case S_ROOT:
+      return c == '{' && _open(c);
+    case S_KEY_OR_END:
+      if (c == '}') return _close(c);
+      if (c != '"') return false;
+      _isKey = true; _len = 0; _over = false; _st = S_STR;
+      return true;
+    case S_KEY:
+      if (c != '"') return false;
+      _isKey = true; _len = 0; _over = false; _st = S_STR;
+      return true;
+    case S_COLON:
+      if (c != ':') return false;
+      _st = S_VALUE;
+      return true;
+    case S_VALUE_OR_END:
+      if (c == ']') return _close(c);
+      return _value(c);
+    case S_VALUE:
+      return _value(c);
+    case S_AFTER:
+      if (c == ',') {
+        _st = (_arr & (1u << (_depth - 1))) ? S_VALUE : S_KEY;
+        return true;
+      }
+      return (c == '}' || c == ']') && _close(c);
+    default:                                           // S_DONE: после корня — только пробелы
+      return false;
+  }
+}
+
+bool JsonReader::_value(char c) {
+  _len = 0;
+  _over = false;
+  if (c == '{' || c == '[') {
+    _buf[0] = '\0';
+    _emit(c == '{' ? JSON_OBJECT : JSON_ARRAY);
+    return _open(c);
+  }
+  if (c == '"') {
+    _isKey = false;
+    _st = S_STR;
+    return true;
+  }
+  if (c == '-' || isalnum((uint8_t)c)) {
+    _put(c);
+    _st = S_LIT;
+    return true;
+  }
+  return false;
+}
+
+bool JsonReader::_open(char c) {
+  if (_depth >= JSON_READ_DEPTH) return false;
+  uint16_t bit = 1u << _depth;
+  _depth++;
+  if (c == '[') { _arr |= bit;  _st = S_VALUE_OR_END; }
+  else          { _arr &= ~bit; _st = S_KEY_OR_END; }
+  return true;
+}
+
+bool JsonReader::_close(char c) {
+  bool isArr = _arr & (1u << (_depth - 1));
+  if ((c == ']') != isArr) return false;
+  _depth--;
+  _st = _depth ? S_AFTER : S_DONE;
+  return true;
+}
+
+void JsonReader::_emit(uint8_t type) {
+  if (!_fn) return;
+  JsonField f = { _key, _buf, type, _depth, (bool)(_over || _keyOver) };
+  _fn(f, _ctx);
+}
+
+void JsonReader::_endString() {
+  if (_hi) { _put('?'); _hi = 0; }
+  _buf[_len] = '\0';
+  if (!_isKey) {
+    _emit(JSON_STRING);
+    _st = S_AFTER;
+    return;
+  }
+  if (_depth == 1) {                                   // ключи вложенных объектов не нужны
+    strncpy(_key, _buf, sizeof(_key) - 1);
+    _key[sizeof(_key) - 1] = '\0';
+    _keyOver = _over || _len >= sizeof(_key);
+  }
+  _st = S_COLON;
+}
+
+// true/false/null или число по грамматике JSON (strtod принял бы и inf, 0x1…)
+bool JsonReader::_endLiteral() {
+  _buf[_len] = '\0';
+  if (_over) return false;
+  if (!strcmp(_buf, "true") || !strcmp(_buf, "false")) { _emit(JSON_BOOL); return true; }
+  if (!strcmp(_buf, "null")) { _emit(JSON_NULL); return true; }
+  if (strspn(_buf, "0123456789+-.eE") != _len) return false;
+  char *end;
+  strtod(_buf, &end);
+  if (end != _buf + _len || !(_buf[0] == '-' || isdigit((uint8_t)_buf[0]))) return false;
+  _emit(JSON_NUMBER);
+  return true;
+}
+
+void JsonReader::_put(char c) {
+  if (_len < sizeof(_buf) - 1) _buf[_len++] = c;
+  else _over = true;
+}
+
+// Кодовая точка → UTF-8
+void JsonReader::_putCode(uint32_t cp) {
+  if (cp < 0x80) {
+    _put((char)cp);
+  } else if (cp < 0x800) {
+    _put((char)(0xC0 | (cp >> 6)));
+    _put((char)(0x80 | (cp & 0x3F)));
+  } else if (cp < 0x10000) {
+    _put((char)(0xE0 | (cp >> 12)));
+    _put((char)(0x80 | ((cp >> 6) & 0x3F)));
+    _put((char)(0x80 | (cp & 0x3F)));
+  } else {
+    _put((char)(0xF0 | (cp >> 18)));
+    _put((char)(0x80 | ((cp >> 12) & 0x3F)));
+    _put((char)(0x80 | ((cp >> 6) & 0x3F)));
+    _put((char)(0x80 | (cp & 0x3F)));
+  }
+}
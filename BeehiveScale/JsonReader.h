@@ -0,0 +1,67 @@
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <Arduino.h>
+
+// ─── Потоковый разбор JSON ───────────────────────────────────────────────
+// Пара к JsonWriter: документ подаётся кусками любого размера (feed), по мере
+// прихода тела запроса, и поля корневого объекта сразу отдаются обработчику.
+// Документ в памяти не собирается — только буфер одного значения, сколько бы
+// полей ни пришло. Вложенные объекты и массивы проходятся насквозь: их
+// значения приходят с depth > 1 и ключом поля корня, которому они принадлежат.
+#define JSON_READ_BUF    64   // самая длинная строка-значение; длиннее — overflow
+#define JSON_READ_KEY    24   // ключ поля корня
+#define JSON_READ_DEPTH  16   // вложенность; глубже — ошибка разбора
+
+enum { JSON_STRING, JSON_NUMBER, JSON_BOOL, JSON_NULL, JSON_OBJECT, JSON_ARRAY };
+
+struct JsonField {
+  const char *key;       // ключ поля корневого объекта
+  const char *val;       // значение: строка — без кавычек и раскодирована; число,
+                         // true/false/null — как в тексте; OBJECT/ARRAY — "" (начало)
+  uint8_t     type;      // JSON_*
+  uint8_t     depth;     // 1 — значение поля корня, 2 — элемент его массива/объекта…
+  bool        overflow;  // значение или ключ не поместились в буфер — обрезаны
+};
+
+class JsonReader {
+public:
+  typedef void (*Handler)(const JsonField &f, void *ctx);
+
+  void begin(Handler fn, void *ctx);
+  // false — синтаксическая ошибка; дальнейшие данные игнорируются
+  bool feed(const char *p, size_t n);
+  // Документ пришёл целиком и без ошибок (корень — объект)
+  bool finish() const { return _st == S_DONE; }
+  void reset() { _st = S_IDLE; }
+
+private:
+  enum : uint8_t {
+    S_IDLE, S_ROOT, S_KEY_OR_END, S_KEY, S_COLON, S_VALUE, S_VALUE_OR_END,
+    S_AFTER, S_STR, S_ESC, S_HEX, S_LIT, S_DONE, S_ERR
+  };
+  Handler  _fn  = nullptr;
+  void    *_ctx = nullptr;
+  uint8_t  _st  = S_IDLE;
+  uint8_t  _depth = 0;
+  uint16_t _arr = 0;        // бит уровня: контейнер — массив
+  bool     _isKey = false;  // разбирается ключ, а не значение
+  bool     _over = false, _keyOver = false;
+  uint8_t  _len = 0;
+  uint8_t  _hexN = 0;
+  uint16_t _hex = 0, _hi = 0;  // \uXXXX и старшая половина суррогатной пары
+  char     _buf[JSON_READ_BUF];
+  char     _key[JSON_READ_KEY];
+
+  bool _step(char c);
+  bool _value(char c);
+  bool _open(char c);
+  bool _close(char c);
+  void _emit(uint8_t type);
+  void _endString();
+  bool _endLiteral();
+  void _put(char c);
+  void _putCode(uint32_t cp);
+};
+
+#endif
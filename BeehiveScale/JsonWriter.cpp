@@ -0,0 +1,97 @@
+#include "JsonWriter.h"
+#include <math.h>
+
+// Запятая перед элементом и "ключ": (внутри объекта)
+void JsonWriter::_key(const char *key) {
+  uint16_t bit = 1u << _depth;
+  if (_more & bit) _out.print(',');
+  _more |= bit;
+  if (key) {
+    _str(key);
+    _out.print(':');
+  }
+}
+
+void JsonWriter::_open(const char *key, char c) {
+  if (_depth > 0) _key(key);
+  _out.print(c);
+  if (_depth < JSON_MAX_DEPTH) _depth++;
+  _more &= ~(1u << _depth);
+}
+
+void JsonWriter::_close(char c) {
+  _out.print(c);
+  if (_depth > 0) _depth--;
+}
+
+// Строка в кавычках: управляющие символы, '"' и '\' экранируются; UTF-8 — как есть
+void JsonWriter::_str(const char *s) {
+  static const char HEX_DIGITS[] = "0123456789abcdef";
+  _out.print('"');
+  const char *run = s;
+  for (; *s; s++) {
+    uint8_t ch = (uint8_t)*s;
+    if (ch >= 0x20 && ch != '"' && ch != '\\') continue;
+    _out.write((const uint8_t*)run, s - run);
+    run = s + 1;
+    char esc[7] = { '\\', 0, 0, 0, 0, 0, 0 };
+    switch (ch) {
+      case '"':  esc[1] = '"';  break;
+      case '\\': esc[1] = '\\'; break;
+      case '\n': esc[1] = 'n';  break;
+      case '\r': esc[1] = 'r';  break;
+      case '\t': esc[1] = 't';  break;
+      default:
+        esc[1] = 'u'; esc[2] = '0'; esc[3] = '0';
+        esc[4] = HEX_DIGITS[ch >> 4]; esc[5] = HEX_DIGITS[ch & 0x0F];
+        break;
+    }
+    _out.print(esc);
+  }
+  _out.write((const uint8_t*)run, s - run);
+  _out.print('"');
+}
+
+void JsonWriter::add(const char *key, const char *v) {
+  _key(key);
+  _str(v ? v : "");
+}
+
+void JsonWriter::add(const char *key, bool v) {
+  _key(key);
+  _out.print(v ? "true" : "false");
+}
+
+void JsonWriter::add(const char *key, long v) {
+  char b[12];
+  snprintf(b, sizeof(b), "%ld", v);
+  _key(key);
+  _out.print(b);
+}
+
+void JsonWriter::add(const char *key, unsigned long v) {
+  char b[12];
+  snprintf(b, sizeof(b), "%lu", v);
+  _key(key);
+  _out.print(b);
+}
+
+void JsonWriter::add(const char *key, double v, uint8_t digits) {
+  if (isnan(v) || isinf(v)) { addNull(key); return; }
+  char b[24];
+  int n = snprintf(b, sizeof(b), "%.*f", digits, v);
+  if (n <= 0 || n >= (int)sizeof(b)) { addNull(key); return; }
+  if (digits > 0) {                       // 4.100 → 4.1, 20.0 → 20
+    while (n > 1 && b[n - 1] == '0') n--;
+    if (b[n - 1] == '.') n--;
+    b[n] = '\0';
+  }
+  if (strcmp(b, "-0") == 0) strcpy(b, "0");
+  _key(key);
+  _out.print(b);
+}
+
+void JsonWriter::addNull(const char *key) {
+  _key(key);
+  _out.print("null");
+}
@@ -0,0 +1,44 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <Arduino.h>
+
+// ─── Потоковая запись JSON ───────────────────────────────────────────────
+// Поля пишутся сразу в out (для ответа — ChunkStream с буфером фиксированного
+// размера), без документа в памяти и без String: ни одного выделения heap.
+// Порядок полей — порядок вызовов; запятые и экранирование — здесь.
+// key == nullptr — элемент массива.
+#define JSON_MAX_DEPTH 8
+
+class JsonWriter {
+public:
+  explicit JsonWriter(Print &out) : _out(out) {}
+  void beginObject(const char *key = nullptr) { _open(key, '{'); }
+  void endObject()                            { _close('}'); }
+  void beginArray(const char *key = nullptr)  { _open(key, '['); }
+  void endArray()                             { _close(']'); }
+  void add(const char *key, const char *v);
+  void add(const char *key, const String &v) { add(key, v.c_str()); }
+  void add(const char *key, bool v);
+  void add(const char *key, int v)           { add(key, (long)v); }
+  void add(const char *key, unsigned int v)  { add(key, (unsigned long)v); }
+  void add(const char *key, long v);
+  void add(const char *key, unsigned long v);
+  // digits — знаков после точки, хвостовые нули отбрасываются; NaN/inf — null
+  void add(const char *key, double v, uint8_t digits = 3);
+  void addNull(const char *key);
+  // Только ключ: значение (готовый JSON) допишет вызывающий в out
+  void key(const char *key) { _key(key); }
+
+private:
+  Print   &_out;
+  uint8_t  _depth = 0;
+  uint16_t _more  = 0;  // бит уровня: в контейнере уже есть элементы
+
+  void _key(const char *key);
+  void _open(const char *key, char c);
+  void _close(char c);
+  void _str(const char *s);
+};
+
+#endif
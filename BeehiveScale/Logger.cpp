@@ -1,4 +1,5 @@
 #include "Logger.h"
+#include "ZipStream.h"
 #include <math.h>
 
 // ─── Файловая система ─────────────────────────────────────────────────────
@@ -17,6 +18,116 @@
 // UTF-8 BOM (\xEF\xBB\xBF) + разделитель ";" для корректного открытия в Excel
 // (русская локаль Excel использует ";" как разделитель столбцов)
 static const char CSV_HEADER[] = "\xEF\xBB\xBF" "datetime;weight_kg;temp_c;humidity_pct;bat_v\n";
+// Файл партиции: те же столбцы + контрольная сумма строки (в /api/log не выдаётся)
+static const char CSV_FILE_HEADER[] = "\xEF\xBB\xBF" "datetime;weight_kg;temp_c;humidity_pct;bat_v;crc\n";
+
+// ─── Формат файла лога ────────────────────────────────────────────────────
+// LOG_LEGACY_* — единый лог прежних версий; его архивы — /log_*
+#if defined(LOG_FORMAT_BINARY) && defined(LOG_FORMAT_PACKED)
+  #error "LOG_FORMAT_BINARY и LOG_FORMAT_PACKED — выберите один формат"
+#endif
+#ifdef LOG_FORMAT_BINARY
+  #define LOG_PART_EXT    ".bin"
+  #define LOG_LEGACY_FILE LOG_BIN_FILE
+  #define LOG_ARC_EXT     ".bin"
+#elif defined(LOG_FORMAT_PACKED)
+  #define LOG_PART_EXT    ".pak"
+  #define LOG_LEGACY_FILE LOG_FILE     // прежние версии писали только CSV/бинарный
+  #define LOG_ARC_EXT     ".csv"
+#else
+  #define LOG_FORMAT_CSV                // строки на диске — текст
+  #define LOG_PART_EXT    ".csv"
+  #define LOG_LEGACY_FILE LOG_FILE
+  #define LOG_ARC_EXT     ".csv"
+#endif
+#define LOG_LEGACY_IDX    "/log.idx"
+
+// Бинарная запись: 16 байт, поля в фиксированной точке.
+// Смещение записи i = LOG_BIN_HDR + i * 16 — доступ по номеру без чтения файла.
+struct LogBinRec {
+  uint32_t ts;      // секунды с 01.01.1970
+  int32_t  w10g;    // вес, 0.01 кг
+  int16_t  t10;     // температура, 0.1 °C (LOG_BIN_NODATA — нет данных)
+  int16_t  h10;     // влажность, 0.1 %    (LOG_BIN_NODATA — нет данных)
+  uint16_t batMv;   // батарея, мВ
+  uint16_t crc;     // CRC-16/CCITT первых 14 байт (см. _rec_crc)
+};
+static_assert(sizeof(LogBinRec) == 16, "LogBinRec must be 16 bytes");
+static const uint32_t LOG_BIN_MAGIC  = 0x31474C42UL;  // "BLG1"
+static const uint32_t LOG_BIN_HDR    = 16;            // magic + размер записи + резерв
+static const int16_t  LOG_BIN_NODATA = -32768;
+
+static uint16_t _crc16(const uint8_t *p, size_t n, uint16_t crc = 0xFFFF) {
+  while (n--) {
+    crc ^= (uint16_t)(*p++) << 8;
+    for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+// CRC записи с затравкой из её смещения в файле. Смещение служит порядковым
+// номером записи, не занимая места: запись не на своём месте (чужие данные
+// в кластере после сбоя FAT, сдвиг после обрыва) не сходится.
+static uint16_t _rec_crc(uint32_t off, const uint8_t *p, size_t n) {
+  return _crc16(p, n, _crc16((const uint8_t*)&off, sizeof(off)));
+}
+
+// ─── Дата/время ↔ секунды (без time.h: RTC хранит местное время) ─────────
+// Номер дня от 01.03.0000 (алгоритм days_from_civil)
+static int32_t _days_from_civil(int y, int m, int d) {
+  if (m <= 2) y--;
+  int era = y / 400;
+  int yoe = y - era * 400;
+  int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + doe;
+}
+static const int32_t DAYS_1970 = 719468;  // _days_from_civil(1970, 1, 1)
+
+static int32_t _day_number(uint32_t ymd) {
+  return _days_from_civil(ymd / 10000, ymd / 100 % 100, ymd % 100);
+}
+
+// Номер дня → YYYYMMDD (обратный алгоритм civil_from_days)
+static uint32_t _ymd_from_days(int32_t z) {
+  int era = z / 146097;
+  int doe = z - era * 146097;
+  int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  int y   = yoe + era * 400;
+  int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  int mp  = (5 * doy + 2) / 153;
+  int d   = doy - (153 * mp + 2) / 5 + 1;
+  int m   = mp + (mp < 10 ? 3 : -9);
+  if (m <= 2) y++;
+  return (uint32_t)y * 10000UL + (uint32_t)m * 100UL + (uint32_t)d;
+}
+
+static uint32_t _ts_day(uint32_t ts) {
+  return _ymd_from_days((int32_t)(ts / 86400UL) + DAYS_1970);
+}
+
+// "DD.MM.YYYY HH:MM:SS" (время можно опустить) → секунды; 0 если не дата
+static uint32_t _dt_to_ts(const char *s, size_t len, uint32_t ymd) {
+  if (ymd == 0) return 0;
+  int32_t days = _day_number(ymd) - DAYS_1970;
+  if (days < 0) return 0;
+  uint32_t sec = 0;
+  if (len >= 16 && s[13] == ':') {
+    int hh = atoi(s + 11), mm = atoi(s + 14);
+    int ss = (len >= 19 && s[16] == ':') ? atoi(s + 17) : 0;
+    sec = (uint32_t)(hh * 3600 + mm * 60 + ss);
+  }
+  return (uint32_t)days * 86400UL + sec;
+}
+
+// Секунды → "DD.MM.YYYY HH:MM:SS" (buf ≥ 20)
+static void _ts_to_dt(uint32_t ts, char *buf, size_t bufLen) {
+  uint32_t ymd = _ts_day(ts);
+  uint32_t sec = ts % 86400UL;
+  snprintf(buf, bufLen, "%02u.%02u.%04u %02u:%02u:%02u",
+           (unsigned)(ymd % 100), (unsigned)(ymd / 100 % 100), (unsigned)(ymd / 10000),
+           (unsigned)(sec / 3600), (unsigned)(sec / 60 % 60), (unsigned)(sec % 60));
+}
 
 // ─── Хелпер: запятая→точка для парсинга CSV с десятичной запятой ─────────
 // Без heap-аллокаций: работает на стековом буфере
@@ -31,19 +142,6 @@ static float commaToFloat(const char *src, size_t len) {
 static float commaToFloat(const String &s) {
   return commaToFloat(s.c_str(), s.length());
 }
-// Замена запятой на точку in-place (без heap-аллокации) для вставки в JSON
-// Записывает результат в buf (maxLen включая '\0'), возвращает buf
-static char* commaToPoint(const char *src, size_t srcLen, char *buf, size_t maxLen) {
-  size_t len = srcLen;
-  if (len >= maxLen) len = maxLen - 1;
-  for (size_t i = 0; i < len; i++) buf[i] = (src[i] == ',') ? '.' : src[i];
-  buf[len] = '\0';
-  return buf;
-}
-// Обёртка для String (обратная совместимость)
-static char* commaToPoint(const String &s, char *buf, size_t maxLen) {
-  return commaToPoint(s.c_str(), s.length(), buf, maxLen);
-}
 
 // ─── Внутренние хелперы (абстракция над SD / LittleFS) ──────────────────
 
@@ -65,37 +163,53 @@ static bool _fs_remove(const char *path) {
 #endif
 }
 
-static bool _fs_rename(const char *from, const char *to) {
+static bool _fs_mkdir(const char *path) {
+#ifdef USE_SD_CARD
+  if (!_fallback) return SD.mkdir(path);
+  return LittleFS.mkdir(path);
+#else
+  return LittleFS.mkdir(path);
+#endif
+}
+
+static bool _fs_rmdir(const char *path) {
+#ifdef USE_SD_CARD
+  if (!_fallback) return SD.rmdir(path);
+  return LittleFS.rmdir(path);
+#else
+  return LittleFS.rmdir(path);
+#endif
+}
+
+// Обход каталога: cb(name, isDir, size) — имя без пути.
+// Каталог во время обхода не менять (на SD — собрать имена, потом удалять).
+template <typename F>
+static void _fs_list_dir(const char *path, F cb) {
 #ifdef USE_SD_CARD
   if (!_fallback) {
-    // ESP8266 SD нет rename — эмулируем копированием
-    File src = SD.open(from, FILE_READ);
-    if (!src) return false;
-    File dst = SD.open(to, FILE_WRITE);
-    if (!dst) { src.close(); return false; }
-    uint8_t buf[256];
-    size_t totalRead = 0, totalWritten = 0;
-    while (src.available()) {
-      int n = src.read(buf, sizeof(buf));
-      if (n > 0) {
-        totalRead += n;
-        totalWritten += dst.write(buf, n);
-      }
-      yield();
-      ESP.wdtFeed();
-    }
-    src.close(); dst.close();
-    if (totalRead != totalWritten) {
-      SD.remove(to);  // удалить неполную копию, сохранить оригинал
-      return false;
+    File dir = SD.open(path);
+    if (!dir) return;
+    File e;
+    while ((e = dir.openNextFile())) {
+      char name[32];
+      const char *n = e.name();
+      const char *base = (n && strrchr(n, '/')) ? strrchr(n, '/') + 1 : n;
+      strncpy(name, base ? base : "", sizeof(name) - 1);
+      name[sizeof(name) - 1] = '\0';
+      bool isDir = e.isDirectory();
+      size_t sz = isDir ? 0 : e.size();
+      e.close();
+      cb((const char*)name, isDir, sz);
     }
-    SD.remove(from);
-    return true;
+    dir.close();
+    return;
   }
-  return LittleFS.rename(from, to);
-#else
-  return LittleFS.rename(from, to);
 #endif
+  Dir d = LittleFS.openDir(path);
+  while (d.next()) {
+    String n = d.fileName();
+    cb(n.c_str(), d.isDirectory(), d.isDirectory() ? (size_t)0 : d.fileSize());
+  }
 }
 
 static File _fs_open_read(const char *path) {
@@ -146,659 +260,2998 @@ static bool _fs_ok() {
 #endif
 }
 
-// ─── Инициализация ────────────────────────────────────────────────────────
-
-bool log_init() {
-#ifdef USE_SD_CARD
-  _sdOk = SD.begin(SD_CS_PIN);
-  if (!_sdOk) {
-    Serial.println(F("[Log] SD FAILED — trying LittleFS fallback"));
-    _fallback = LittleFS.begin();
-    if (!_fallback) {
-      Serial.println(F("[Log] LittleFS not formatted, formatting..."));
-      LittleFS.format();
-      _fallback = LittleFS.begin();
-    }
-    if (!_fallback) {
-      Serial.println(F("[Log] LittleFS fallback FAILED too"));
-      return false;
+// ─── Построчный обход диапазона файла ────────────────────────────────────
+// Читает [start, end) блоками по 256 байт (один File::read() на блок вместо
+// одного на байт). cb(ln, len, lnStart, lnEnd) получает строку без '\r'/'\n';
+// lnEnd — смещение за переводом строки. Вернуть false из cb — прервать обход.
+// Последняя строка без '\n' (оборванная запись) не отдаётся.
+template <typename F>
+static void _scan_lines(File &f, uint32_t start, uint32_t end, F cb) {
+  if (start >= end || !f.seek(start)) return;
+  uint8_t blk[256];
+  char ln[128];
+  size_t pos = 0;
+  uint32_t off = start, lnStart = start;
+  while (off < end) {
+    size_t want = end - off;
+    if (want > sizeof(blk)) want = sizeof(blk);
+    int n = f.read(blk, want);
+    if (n <= 0) break;
+    for (int i = 0; i < n; i++) {
+      char c = (char)blk[i];
+      off++;
+      if (c == '\n' || c == '\r') {
+        if (pos > 0) {
+          ln[pos] = '\0';
+          if (!cb((const char*)ln, pos, lnStart, off)) return;
+          pos = 0;
+        }
+        lnStart = off;
+      } else if (pos < sizeof(ln) - 1) {
+        ln[pos++] = c;
+      }
     }
-    Serial.println(F("[Log] Using LittleFS as fallback"));
-  } else {
-    _fallback = false;
-    Serial.println(F("[Log] SD OK"));
-  }
-#else
-  _flashOk = LittleFS.begin();
-  if (!_flashOk) {
-    Serial.println(F("[Log] LittleFS FAILED"));
-    return false;
+    yield();
   }
-  Serial.println(F("[Log] LittleFS OK"));
-#endif
+}
 
-  // Создать файл с заголовком если не существует
-  if (!_fs_exists(LOG_FILE)) {
-    File f = _fs_open_write(LOG_FILE);
-    if (f) { f.print(CSV_HEADER); f.close(); }
-  } else {
-    // Проверяем заголовок: должен содержать "datetime" и ";" (новый формат).
-    // Читаем через char-буфер (без readStringUntil — защита от OOM при отсутствии '\n').
-    File f = _fs_open_read(LOG_FILE);
-    if (f) {
-      char hdr[80];
-      int hpos = 0;
-      while (f.available() && hpos < (int)sizeof(hdr) - 1) {
-        int c = f.read();
-        if (c == '\n' || c == '\r' || c < 0) break;
-        hdr[hpos++] = (char)c;
-      }
-      hdr[hpos] = '\0';
-      f.close();
-      bool hdrOk = (strstr(hdr, "datetime") != NULL) && (strchr(hdr, ';') != NULL);
-      if (!hdrOk) {
-        Serial.println(F("[Log] Header outdated/invalid — recreating log"));
-        File fw = _fs_open_write(LOG_FILE);
-        if (fw) { fw.print(CSV_HEADER); fw.close(); }
+// Обход строк [start, end) с конца: блоки по 256 байт читаются в обратном
+// порядке, строки отдаются от последней к первой. cb(ln, len, lnStart) —
+// строка без '\r'/'\n' и её смещение; false из cb прерывает обход.
+// Строка длиннее буфера обрезается слева (сохраняется её конец).
+template <typename F>
+static void _scan_lines_reverse(File &f, uint32_t start, uint32_t end, F cb) {
+  uint8_t blk[256];
+  char ln[128];
+  size_t len = 0;            // строка собирается с конца буфера: ln[sizeof - len ..)
+  uint32_t pos = end;
+  while (pos > start) {
+    size_t n = pos - start;
+    if (n > sizeof(blk)) n = sizeof(blk);
+    pos -= n;
+    if (!f.seek(pos) || f.read(blk, n) != n) return;
+    for (int i = (int)n - 1; i >= 0; i--) {
+      char c = (char)blk[i];
+      if (c == '\n' || c == '\r') {
+        if (len > 0 && !cb((const char*)ln + sizeof(ln) - len, len, pos + i + 1)) return;
+        len = 0;
+      } else if (len < sizeof(ln)) {
+        ln[sizeof(ln) - 1 - len++] = c;
       }
     }
+    yield();
   }
+  if (len > 0) cb((const char*)ln + sizeof(ln) - len, len, start);
+}
 
-  // Проверяем что append реально работает
-  File testF = _fs_open_append(LOG_FILE);
-  if (!testF) {
-    Serial.println(F("[Log] WARNING: append test FAILED!"));
-#ifdef USE_SD_CARD
-    if (!_fallback) {
-      Serial.println(F("[Log] SD append broken — switching to LittleFS"));
-      _sdOk = false;
-      _fallback = LittleFS.begin();
-      if (!_fallback) {
-        LittleFS.format();
-        _fallback = LittleFS.begin();
-      }
-      if (_fallback) {
-        if (!LittleFS.exists(LOG_FILE)) {
-          File fw = LittleFS.open(LOG_FILE, "w");
-          if (fw) { fw.print(CSV_HEADER); fw.close(); }
-        }
-      }
-    }
-#endif
+// Заголовок CSV (в т.ч. повторный внутри файла, с BOM или без)
+static bool _is_header_line(const char *ln, size_t len) {
+  if (len > 8 && memcmp(ln, "datetime", 8) == 0) return true;
+  if (len > 11 && memcmp(ln, "\xEF\xBB\xBF" "datetime", 11) == 0) return true;
+  return false;
+}
+
+static int _parse_digits(const char *s, int n) {
+  int v = 0;
+  for (int i = 0; i < n; i++) {
+    if (s[i] < '0' || s[i] > '9') return -1;
+    v = v * 10 + (s[i] - '0');
+  }
+  return v;
+}
+
+// "DD.MM.YYYY..." или "YYYY-MM-DD" → YYYYMMDD; 0 если это не дата
+static uint32_t _day_key(const char *s, size_t len) {
+  if (len < 10) return 0;
+  int d, m, y;
+  if (s[4] == '-' && s[7] == '-') {
+    y = _parse_digits(s, 4); m = _parse_digits(s + 5, 2); d = _parse_digits(s + 8, 2);
+  } else if (s[2] == '.' && s[5] == '.') {
+    d = _parse_digits(s, 2); m = _parse_digits(s + 3, 2); y = _parse_digits(s + 6, 4);
   } else {
-    testF.close();
+    return 0;
   }
+  if (y < 0 || m < 1 || m > 12 || d < 1 || d > 31) return 0;
+  return (uint32_t)y * 10000UL + (uint32_t)m * 100UL + (uint32_t)d;
+}
 
-  Serial.print(F("[Log] Ready"));
-  if (_fallback) Serial.print(F(" [fallback:LittleFS]"));
-  Serial.print(F(", size="));
-  Serial.println(log_size());
+// ─── Записи лога: разбор и формирование ──────────────────────────────────
+
+// Длина строки без столбца crc — то, что выдаётся наружу как CSV
+static size_t _csv_data_len(const char *ln, size_t len) {
+  int ns = 0;
+  for (size_t i = 0; i < len; i++) if (ln[i] == ';' && ++ns == 5) return i;
+  return len;
+}
+
+// CSV-строка "datetime;w;t;h;b[;crc]" → LogRecord; false если это не запись
+static bool _parse_csv_line(const char *ln, size_t len, LogRecord &r) {
+  uint32_t day = _day_key(ln, len);
+  if (day == 0) return false;
+  len = _csv_data_len(ln, len);
+  int sep[4];
+  int ns = 0;
+  for (int i = 0; i < (int)len && ns < 4; i++) if (ln[i] == ';') sep[ns++] = i;
+  if (ns < 2) return false;
+  int tLen = (ns >= 3) ? sep[2] - sep[1] - 1 : 0;
+  int hLen = (ns >= 4) ? sep[3] - sep[2] - 1 : 0;
+  int bLen = (ns >= 4) ? (int)len - sep[3] - 1 : 0;
+  r.ts       = _dt_to_ts(ln, sep[0], day);
+  r.weight   = commaToFloat(ln + sep[0] + 1, sep[1] - sep[0] - 1);
+  r.tempC    = (tLen <= 0) ? -99.0f : commaToFloat(ln + sep[1] + 1, tLen);
+  r.humidity = (hLen <= 0) ? -99.0f : commaToFloat(ln + sep[2] + 1, hLen);
+  r.batV     = (bLen <= 0) ? 0.0f   : commaToFloat(ln + sep[3] + 1, bLen);
   return true;
 }
 
-// ─── Пункт 6: Валидация данных перед записью ─────────────────────────────
+static void _bin_decode(const LogBinRec &b, LogRecord &r) {
+  r.ts       = b.ts;
+  r.weight   = b.w10g / 100.0f;
+  r.tempC    = (b.t10 == LOG_BIN_NODATA) ? -99.0f : b.t10 / 10.0f;
+  r.humidity = (b.h10 == LOG_BIN_NODATA) ? -99.0f : b.h10 / 10.0f;
+  r.batV     = b.batMv / 1000.0f;
+}
 
-static bool _validate_row(const String &datetime, float weight, float tempC,
-                           float humidity, float batV) {
-  if (datetime.length() == 0)         return false;  // совсем пустая дата
-  if (isnan(weight) || isinf(weight)) return false;
-  if (weight < -5.0f || weight > 500.0f) return false;  // физически невозможный вес
-  // Значения ≤ -90 — это сентинел ошибки датчика (-99 = TEMP_ERROR_VALUE).
-  // Пропускаем валидацию диапазона для них; реальные физические значения проверяем.
-  if (!isnan(tempC) && !isinf(tempC) && tempC > -90.0f) {
-    if (tempC < -50.0f || tempC > 100.0f) return false;
-  }
-  if (!isnan(humidity) && !isinf(humidity) && humidity > -90.0f) {
-    if (humidity < 0.0f || humidity > 100.0f) return false;
-  }
-  if (!isnan(batV) && !isinf(batV)) {
-    if (batV < 0.0f || batV > 6.0f) return false;  // батарея не может быть > 6В
-  }
-  return true;
+static void _bin_encode(const LogRecord &r, LogBinRec &b) {
+  b.ts    = r.ts;
+  b.w10g  = (int32_t)lroundf(r.weight * 100.0f);
+  b.t10   = (isnan(r.tempC)    || r.tempC    <= -90.0f) ? LOG_BIN_NODATA : (int16_t)lroundf(r.tempC * 10.0f);
+  b.h10   = (isnan(r.humidity) || r.humidity <= -90.0f) ? LOG_BIN_NODATA : (int16_t)lroundf(r.humidity * 10.0f);
+  b.batMv = (isnan(r.batV) || r.batV < 0.1f) ? 0 : (uint16_t)lroundf(r.batV * 1000.0f);
+  b.crc   = 0;  // _seal_record() — когда известно смещение в файле
 }
 
-// ─── Форматирование и запись одной CSV-строки ─────────────────────────────
-static void _write_csv_row(File &f, const String &datetime, float weight,
-                           float tempC, float humidity, float batV) {
+// Значения так, как они попадают в CSV: нет данных → 0
+static void _csv_values(float &tempC, float &humidity, float &batV) {
   if (isnan(tempC)    || isinf(tempC)    || tempC    <= -90.0f) tempC    = 0.0f;
   if (isnan(humidity) || isinf(humidity) || humidity <= -90.0f) humidity = 0.0f;
-  if (batV < 0.1f) batV = 0.0f;
+  if (isnan(batV) || batV < 0.1f) batV = 0.0f;
+}
 
-  char wBuf[12], tBuf[12], hBuf[12], bBuf[12];
-  snprintf(wBuf, sizeof(wBuf), "%.2f", weight);
-  snprintf(tBuf, sizeof(tBuf), "%.1f", tempC);
-  snprintf(hBuf, sizeof(hBuf), "%.1f", humidity);
-  snprintf(bBuf, sizeof(bBuf), "%.2f", batV);
-  for (char *p = wBuf; *p; p++) if (*p == '.') *p = ',';
-  for (char *p = tBuf; *p; p++) if (*p == '.') *p = ',';
-  for (char *p = hBuf; *p; p++) if (*p == '.') *p = ',';
-  for (char *p = bBuf; *p; p++) if (*p == '.') *p = ',';
+// Одна CSV-строка "datetime;w;t;h;b\n" с десятичной запятой; возвращает длину
+static size_t _format_csv_row(char *buf, size_t bufLen, const char *datetime, float weight,
+                              float tempC, float humidity, float batV) {
+  _csv_values(tempC, humidity, batV);
+  size_t dtLen = strlen(datetime);
+  int n = snprintf(buf, bufLen, "%s;%.2f;%.1f;%.1f;%.2f\n", datetime, weight, tempC, humidity, batV);
+  if (n <= 0) return 0;
+  if ((size_t)n >= bufLen) n = bufLen - 1;
+  for (char *p = buf + dtLen; *p; p++) if (*p == '.') *p = ',';
+  return (size_t)n;
+}
 
-  f.print(datetime); f.print(';');
-  f.print(wBuf);     f.print(';');
-  f.print(tBuf);     f.print(';');
-  f.print(hBuf);     f.print(';');
-  f.print(bBuf);     f.print('\n');
+static size_t _format_record_csv(const LogRecord &r, char *buf, size_t bufLen) {
+  char dt[24];
+  _ts_to_dt(r.ts, dt, sizeof(dt));
+  return _format_csv_row(buf, bufLen, dt, r.weight, r.tempC, r.humidity, r.batV);
 }
 
-// ─── Запись строки ────────────────────────────────────────────────────────
+// JSON-объект точки графика {"dt":…,"w":…,"t":…,"h":…,"b":…}; возвращает длину
+static size_t _format_record_json(const LogRecord &r, char *buf, size_t bufLen) {
+  float t = r.tempC, h = r.humidity, b = r.batV;
+  _csv_values(t, h, b);
+  char dt[24];
+  _ts_to_dt(r.ts, dt, sizeof(dt));
+  int n = snprintf(buf, bufLen, "{\"dt\":\"%s\",\"w\":%.2f,\"t\":%.1f,\"h\":%.1f,\"b\":%.2f}",
+                   dt, r.weight, t, h, b);
+  if (n <= 0) return 0;
+  return ((size_t)n >= bufLen) ? bufLen - 1 : (size_t)n;
+}
 
-void log_append(const String &datetime, float weight, float tempC,
-                float humidity, float batV, int batPct) {
-  if (!_fs_ok()) return;
+// ─── Контрольные суммы записей ───────────────────────────────────────────
 
-  // Защита от записи при критически низком заряде батареи.
-  // batV < 1.0V — батарея не подключена (питание от USB) → не пропускать.
-  if (batPct < 5 && batV > 1.0f) {
-    Serial.println(F("[Log] Skip: low battery"));
-    return;
-  }
+// Место под столбец crc в конце CSV-строки: "...\n" → "...;0000\n"
+static size_t _csv_add_crc_slot(char *buf, size_t n, size_t bufLen) {
+  if (n == 0 || buf[n - 1] != '\n' || n + 5 >= bufLen) return 0;
+  memcpy(buf + n - 1, ";0000\n", 7);
+  return n + 5;
+}
 
-  // Пункт 6: Валидация данных
-  if (!_validate_row(datetime, weight, tempC, humidity, batV)) {
-    Serial.println(F("[Log] Skip: invalid data"));
-    return;
-  }
+// Вписать CRC в готовую запись длиной len, которая ляжет в файл по смещению off.
+// CSV: строка кончается на ";XXXX\n", CRC считается по тексту до ';'.
+static void _seal_record(uint8_t *rec, size_t len, uint32_t off) {
+#ifdef LOG_FORMAT_BINARY
+  if (len != sizeof(LogBinRec)) return;
+  uint16_t crc = _rec_crc(off, rec, offsetof(LogBinRec, crc));
+  memcpy(rec + offsetof(LogBinRec, crc), &crc, sizeof(crc));
+#elif defined(LOG_FORMAT_PACKED)
+  (void)rec; (void)len; (void)off;  // CRC у кадра целиком (_pk_append)
+#else
+  static const char DIGITS[] = "0123456789ABCDEF";
+  if (len < 6) return;
+  uint16_t crc = _rec_crc(off, rec, len - 6);
+  for (int i = 0; i < 4; i++) rec[len - 5 + i] = DIGITS[(crc >> (12 - 4 * i)) & 0xF];
+#endif
+}
 
-  // Ротация: если файл > LOG_MAX_SIZE — архивировать с датой
-  if (log_size() >= LOG_MAX_SIZE) {
-    // Формируем имя архива: /log_YYMMDD_HHMM.csv
-    // datetime передаётся в формате "DD.MM.YYYY HH:MM:SS"
-    char arcName[32];
-    if (datetime.length() >= 16) {
-      // "DD.MM.YYYY HH:MM" → "YYMMDD_HHMM"
-      snprintf(arcName, sizeof(arcName), "/log_%c%c%c%c%c%c_%c%c%c%c.csv",
-        datetime[8], datetime[9],  // YY (последние 2 цифры года)
-        datetime[3], datetime[4],  // MM
-        datetime[0], datetime[1],  // DD
-        datetime[11], datetime[12], // HH
-        datetime[14], datetime[15]  // MM
-      );
-    } else {
-      // Фоллбэк — перезаписать log_old.csv
-      strncpy(arcName, LOG_FILE_OLD, sizeof(arcName));
-    }
-    if (_fs_exists(arcName)) _fs_remove(arcName);
-    if (!_fs_rename(LOG_FILE, arcName)) {
-      Serial.println(F("[Log] Rename FAILED, skip rotation"));
-    } else {
-      File fn = _fs_open_write(LOG_FILE);
-      if (!fn) {
-        // New file creation failed — rename archive back to preserve data
-        _fs_rename(arcName, LOG_FILE);
-        Serial.println(F("[Log] New file creation FAILED, restored from archive"));
-      } else {
-        fn.print(CSV_HEADER); fn.close();
-      }
-      Serial.print(F("[Log] Rotated → "));
-      Serial.println(arcName);
-    }
+#ifdef LOG_FORMAT_BINARY
+// Запись по смещению off цела? Записи прежних версий — CRC без затравки
+static bool _bin_check(const LogBinRec &b, uint32_t off) {
+  const uint8_t *p = (const uint8_t*)&b;
+  return b.crc == _rec_crc(off, p, offsetof(LogBinRec, crc)) ||
+         b.crc == _crc16(p, offsetof(LogBinRec, crc));
+}
+#elif defined(LOG_FORMAT_CSV)
+// Строка ln (без '\n') по смещению off цела? Строки прежних версий — без
+// столбца crc — проверяются только разбором
+static bool _csv_check(const char *ln, size_t len, uint32_t off) {
+  int ns = 0;
+  for (size_t i = 0; i < len; i++) if (ln[i] == ';') ns++;
+  if (ns == 4) {
+    LogRecord r;
+    return _parse_csv_line(ln, len, r);
   }
-
-  File f = _fs_open_append(LOG_FILE);
-  if (!f) {
-    Serial.println(F("[Log] Open FAILED for append"));
-#ifdef USE_SD_CARD
-    // Пункт 7: если запись на SD провалилась — переключаемся на LittleFS
-    if (!_fallback) {
-      Serial.println(F("[Log] Switching to LittleFS fallback"));
-      _sdOk = false;
-      _fallback = LittleFS.begin();
-      if (_fallback) {
-        File ff = LittleFS.open(LOG_FILE, "a");
-        if (!ff) {
-          File fw = LittleFS.open(LOG_FILE, "w");
-          if (fw) { fw.print(CSV_HEADER); fw.close(); }
-          ff = LittleFS.open(LOG_FILE, "a");
-        }
-        if (ff) {
-          _write_csv_row(ff, datetime, weight, tempC, humidity, batV);
-          ff.close();
-        }
-      }
-    }
+  if (ns != 5 || len < 6 || ln[len - 5] != ';') return false;
+  uint16_t crc = 0;
+  for (size_t i = len - 4; i < len; i++) {
+    char c = ln[i];
+    int v = (c >= '0' && c <= '9') ? c - '0' : (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+    if (v < 0) return false;
+    crc = (crc << 4) | v;
+  }
+  return crc == _rec_crc(off, (const uint8_t*)ln, len - 5);
+}
 #endif
-    return;
+
+// ─── Сжатый формат (LOG_FORMAT_PACKED) ───────────────────────────────────
+// Файл: заголовок 16 байт, далее блоки по LOG_PK_BLOCK байт. Блок — кадры
+// [длина payload (2), CRC (2), записи одного дня]; кадр не пересекает границу
+// блока, остаток блока заполняется нулями. Запись — байт флагов и zigzag-varint
+// только ненулевых разностей: время — разность разностей (при постоянном
+// интервале 0), вес/темп/влажн/батарея — разность с предыдущей записью в
+// фиксированной точке (как LogBinRec). В начале блока состояние обнуляется:
+// первая запись блока хранит абсолютные значения, блок декодируется сам по себе.
+// Типичная минутная запись — 2–3 байта вместо 16 (бинарный) и ~45 (CSV).
+#ifdef LOG_FORMAT_PACKED
+static const uint32_t LOG_PK_MAGIC     = 0x31474C50UL;  // "PLG1"
+static const uint32_t LOG_PK_HDR       = 16;
+static const uint32_t LOG_PK_BLOCK     = 4096;
+static const size_t   LOG_PK_REC_MAX   = 20;   // флаги + 5 varint в худшем случае
+static const size_t   LOG_PK_FRAME_MAX = 240;  // payload кадра, байт
+
+struct PkState {
+  uint32_t ts;
+  int64_t  dts;   // предыдущий интервал времени
+  int32_t  w;
+  int16_t  t, h;
+  uint16_t b;
+};
+
+static uint32_t _pk_block(uint32_t off) {
+  return LOG_PK_HDR + (off - LOG_PK_HDR) / LOG_PK_BLOCK * LOG_PK_BLOCK;
+}
+
+static uint16_t _pk_crc(uint32_t off, uint16_t len, const uint8_t *payload) {
+  return _crc16(payload, len, _rec_crc(off, (const uint8_t*)&len, sizeof(len)));
+}
+
+static size_t _pk_put(uint8_t *p, int64_t v) {
+  uint64_t z = ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+  size_t n = 0;
+  while (z >= 0x80) { p[n++] = (uint8_t)(z | 0x80); z >>= 7; }
+  p[n++] = (uint8_t)z;
+  return n;
+}
+
+static bool _pk_get(const uint8_t *&p, const uint8_t *end, int64_t &v) {
+  uint64_t z = 0;
+  for (int sh = 0; p < end && sh < 64; sh += 7) {
+    uint8_t c = *p++;
+    z |= (uint64_t)(c & 0x7F) << sh;
+    if (!(c & 0x80)) { v = (int64_t)(z >> 1) ^ -(int64_t)(z & 1); return true; }
   }
+  return false;
+}
 
-  _write_csv_row(f, datetime, weight, tempC, humidity, batV);
-  f.close();
+// Запись → байты (не больше LOG_PK_REC_MAX); st — состояние, обновляется
+static size_t _pk_encode(const LogBinRec &b, PkState &st, uint8_t *out) {
+  int64_t dts = (int64_t)b.ts - st.ts;
+  int64_t d[5] = { dts - st.dts, (int64_t)b.w10g - st.w, (int64_t)b.t10 - st.t,
+                   (int64_t)b.h10 - st.h, (int64_t)b.batMv - st.b };
+  uint8_t flags = 0;
+  size_t n = 1;
+  for (uint8_t i = 0; i < 5; i++)
+    if (d[i] != 0) { flags |= 1 << i; n += _pk_put(out + n, d[i]); }
+  out[0] = flags;
+  st.ts = b.ts; st.dts = dts; st.w = b.w10g; st.t = b.t10; st.h = b.h10; st.b = b.batMv;
+  return n;
 }
 
-void log_clear() {
-  if (!_fs_ok()) return;
-  if (_fs_exists(LOG_FILE))     _fs_remove(LOG_FILE);
-  if (_fs_exists(LOG_FILE_OLD)) _fs_remove(LOG_FILE_OLD);
-  // Удаляем ротированные архивы /log_YYMMDD_HHMM.csv
-#ifdef USE_SD_CARD
-  if (!_fallback) {
-    // Collect filenames first, then delete (can't modify dir during iteration)
-    char toDelete[10][32];
-    int delCount = 0;
-    File root = SD.open("/");
-    if (root) {
-      File entry;
-      while ((entry = root.openNextFile()) && delCount < 10) {
-        const char* n = entry.name();
-        const char* base = (n && n[0] == '/') ? n+1 : n;
-        if (base && strncmp(base, "log_", 4) == 0) {
-          int len = strlen(base);
-          if (len > 4 && strcmp(base + len - 4, ".csv") == 0) {
-            snprintf(toDelete[delCount], 32, "/%s", base);
-            delCount++;
-          }
-        }
-        entry.close();
-      }
-      root.close();
-    }
-    for (int i = 0; i < delCount; i++) {
-      SD.remove(toDelete[i]);
-    }
-  } else
-#endif
-  {
-    // Собираем имена файлов перед удалением (итерация + удаление одновременно небезопасна)
-    String delFiles[8];
-    int delCnt = 0;
-    Dir dir = LittleFS.openDir("/");
-    while (dir.next() && delCnt < 8) {
-      String fn = dir.fileName();
-      if (fn.startsWith("log_") && fn.endsWith(".csv")) {
-        delFiles[delCnt++] = "/" + fn;
-      }
-    }
-    for (int i = 0; i < delCnt; i++) {
-      LittleFS.remove(delFiles[i]);
+static bool _pk_decode(const uint8_t *&p, const uint8_t *end, PkState &st, LogRecord &r) {
+  uint8_t flags = *p++;
+  if (flags & 0xE0) return false;
+  int64_t d[5] = {0, 0, 0, 0, 0};
+  for (uint8_t i = 0; i < 5; i++)
+    if ((flags & (1 << i)) && !_pk_get(p, end, d[i])) return false;
+  st.dts += d[0];
+  st.ts  = (uint32_t)(st.ts + st.dts);
+  st.w  += (int32_t)d[1]; st.t += (int16_t)d[2]; st.h += (int16_t)d[3]; st.b += (uint16_t)d[4];
+  LogBinRec b;
+  b.ts = st.ts; b.w10g = st.w; b.t10 = st.t; b.h10 = st.h; b.batMv = st.b; b.crc = 0;
+  _bin_decode(b, r);
+  return true;
+}
+
+// Обход кадров с начала блока bs до end; на границе блока состояние
+// обнуляется. cb(rec, frameStart, frameEnd) — для записей кадров, начатых
+// не раньше from; false из cb прерывает. check — сверять CRC кадров.
+// st — состояние после последнего целого кадра; возвращает его конец.
+template <typename F>
+static uint32_t _pk_walk(File &f, uint32_t bs, uint32_t from, uint32_t end, bool check,
+                         PkState &st, F cb) {
+  memset(&st, 0, sizeof(st));
+  uint32_t off = bs, good = bs, blk = bs;
+  uint8_t buf[LOG_PK_FRAME_MAX];
+  while (off + 4 <= end) {
+    if (_pk_block(off) != blk) { blk = _pk_block(off); memset(&st, 0, sizeof(st)); }
+    uint32_t blkEnd = blk + LOG_PK_BLOCK;
+    uint16_t hdr[2];
+    if (blkEnd - off < 4) { off = blkEnd; continue; }
+    if (!f.seek(off) || f.read((uint8_t*)hdr, 4) != 4) break;
+    if (hdr[0] == 0) { off = blkEnd; continue; }  // заполнитель до конца блока
+    uint32_t fEnd = off + 4 + hdr[0];
+    if (hdr[0] > LOG_PK_FRAME_MAX || fEnd > blkEnd || fEnd > end) break;
+    if (f.read(buf, hdr[0]) != hdr[0]) break;
+    if (check && hdr[1] != _pk_crc(off, hdr[0], buf)) break;
+    PkState s = st;
+    const uint8_t *p = buf, *pe = buf + hdr[0];
+    bool ok = true;
+    while (p < pe) {
+      LogRecord r;
+      if (!_pk_decode(p, pe, s, r)) { ok = false; break; }
+      if (off >= from && !cb((const LogRecord&)r, off, fEnd)) return fEnd;
     }
+    if (!ok && check) break;
+    st = s;
+    good = off = fEnd;
+    yield();
   }
-  File f = _fs_open_write(LOG_FILE);
-  if (f) { f.print(CSV_HEADER); f.close(); }
-  Serial.println(F("[Log] Cleared"));
+  return good;
 }
 
-size_t log_size() {
-  if (!_fs_ok()) return 0;
-  if (!_fs_exists(LOG_FILE)) return 0;
-  File f = _fs_open_read(LOG_FILE);
-  if (!f) return 0;
-  size_t sz = f.size();
-  f.close();
-  return sz;
+// Состояние кодера для дозаписи в файл длиной sz: декодируется только
+// последний блок; на границе блока — начальное
+static void _pk_state_at(File &f, uint32_t sz, PkState &st) {
+  memset(&st, 0, sizeof(st));
+  if (sz <= LOG_PK_HDR || (sz - LOG_PK_HDR) % LOG_PK_BLOCK == 0) return;
+  _pk_walk(f, _pk_block(sz), sz, sz, false, st, [](const LogRecord&, uint32_t, uint32_t) { return true; });
 }
 
-bool log_exists() {
-  if (!_fs_ok()) return false;
-  return _fs_exists(LOG_FILE);
+// Состояние кодера для дозаписи в партицию _pkYm длиной _pkOff. Файл
+// открыт на дозапись (на LittleFS — без чтения), поэтому состояние готовит
+// _pk_prepare() до открытия; любое изменение файла помимо _pk_append сбрасывает _pkYm.
+static PkState  _pkSt;
+static uint32_t _pkYm  = 0;
+static uint32_t _pkOff = 0;
+
+// Дописать n записей raw (LogBinRec подряд, без выравнивания) в конец партиции ym: кадрами
+// по дням, не длиннее LOG_PK_FRAME_MAX. cb(day, frameStart, frameEnd) —
+// на каждую записанную запись (для индекса дат). false — запись не удалась.
+template <typename F>
+static bool _pk_append(File &f, uint32_t ym, const uint8_t *raw, size_t n, F cb) {
+  uint32_t off = f.size();
+  if (_pkYm != ym || _pkOff != off) return false;  // нужен _pk_prepare()
+  _pkYm = 0;  // до успешной записи кэш недействителен
+  size_t i = 0;
+  while (i < n) {
+    uint8_t frame[4 + LOG_PK_FRAME_MAX];
+    uint32_t room = _pk_block(off) + LOG_PK_BLOCK - off;
+    if (room == LOG_PK_BLOCK) memset(&_pkSt, 0, sizeof(_pkSt));  // новый блок
+    PkState st = _pkSt;
+    uint16_t len = 0;
+    uint32_t day = 0;
+    size_t j = i;
+    while (j < n) {
+      LogBinRec b;
+      memcpy(&b, raw + j * sizeof(LogBinRec), sizeof(b));
+      uint32_t d = _ts_day(b.ts);
+      if (j > i && d != day) break;
+      PkState s = st;
+      uint8_t rec[LOG_PK_REC_MAX];
+      size_t rl = _pk_encode(b, s, rec);
+      if (len + rl > LOG_PK_FRAME_MAX || 4 + len + rl > room) break;
+      memcpy(frame + 4 + len, rec, rl);
+      len += rl; st = s; day = d; j++;
+    }
+    if (j == i) {
+      // Запись не влезает в остаток блока — добить его нулями, новый блок
+      uint8_t zero[4 + LOG_PK_REC_MAX];
+      memset(zero, 0, sizeof(zero));
+      if (room > sizeof(zero) || f.write(zero, room) != room) return false;
+      off += room;
+      continue;
+    }
+    uint16_t hdr[2] = {len, _pk_crc(off, len, frame + 4)};
+    memcpy(frame, hdr, sizeof(hdr));
+    if (f.write(frame, 4 + len) != 4u + len) return false;
+    for (size_t k = i; k < j; k++) cb(day, off, off + 4 + len);
+    _pkSt = st;
+    off += 4 + len;
+    i = j;
+  }
+  _pkYm = ym; _pkOff = off;
+  return true;
 }
-
-uint32_t log_free_space() {
-#ifdef USE_SD_CARD
-  if (_fallback) {
-#if defined(ESP8266)
-    FSInfo info;
-    if (LittleFS.info(info)) return (uint32_t)(info.totalBytes - info.usedBytes);
-#elif defined(ESP32)
-    return (uint32_t)(LittleFS.totalBytes() - LittleFS.usedBytes());
 #endif
-    return 0;
+
+// Обход записей [start, end) файла лога. cb(rec, recStart, recEnd) → false прерывает.
+// CSV: построчно с разбором; бинарный формат: блоками по 16 записей; сжатый —
+// с начала блока, содержащего start (recStart/recEnd — границы кадра).
+// CRC здесь не проверяется: оборванный хвост отрезан при открытии партиции.
+template <typename F>
+static void _read_records(File &f, uint32_t start, uint32_t end, F cb) {
+#ifdef LOG_FORMAT_BINARY
+  if (start < LOG_BIN_HDR) start = LOG_BIN_HDR;
+  uint32_t rem = (start - LOG_BIN_HDR) % sizeof(LogBinRec);
+  if (rem) start += sizeof(LogBinRec) - rem;
+  if (start >= end || !f.seek(start)) return;
+  LogBinRec blk[16];
+  uint32_t off = start;
+  while (off + sizeof(LogBinRec) <= end) {
+    size_t want = (end - off) / sizeof(LogBinRec);
+    if (want > 16) want = 16;
+    int n = f.read((uint8_t*)blk, want * sizeof(LogBinRec));
+    if (n < (int)sizeof(LogBinRec)) break;
+    for (int i = 0; i < n / (int)sizeof(LogBinRec); i++, off += sizeof(LogBinRec)) {
+      LogRecord r;
+      _bin_decode(blk[i], r);
+      if (!cb((const LogRecord&)r, off, (uint32_t)(off + sizeof(LogBinRec)))) return;
+    }
+    yield();
   }
-  return 0;  // ESP8266 SD library does not expose free space
-#else
-  if (!_flashOk) return 0;
-#if defined(ESP8266)
-  FSInfo info;
-  if (LittleFS.info(info)) return (uint32_t)(info.totalBytes - info.usedBytes);
-  return 0;
-#elif defined(ESP32)
-  return (uint32_t)(LittleFS.totalBytes() - LittleFS.usedBytes());
+#elif defined(LOG_FORMAT_PACKED)
+  if (start < LOG_PK_HDR) start = LOG_PK_HDR;
+  if (start >= end) return;
+  PkState st;
+  _pk_walk(f, _pk_block(start), start, end, false, st, cb);
 #else
-  return 0;
-#endif
+  _scan_lines(f, start, end,
+    [&](const char *ln, size_t len, uint32_t s, uint32_t e) {
+      LogRecord r;
+      if (!_parse_csv_line(ln, len, r)) return true;
+      return (bool)cb((const LogRecord&)r, s, e);
+    });
 #endif
 }
 
-// Возвращает true если активен резервный LittleFS (SD недоступна)
-bool log_using_fallback() {
-  return _fallback;
+// Заголовок нового файла лога
+static void _write_header(File &f) {
+#ifdef LOG_FORMAT_BINARY
+  uint32_t hdr[4] = {LOG_BIN_MAGIC, sizeof(LogBinRec), 0, 0};
+  f.write((const uint8_t*)hdr, sizeof(hdr));
+#elif defined(LOG_FORMAT_PACKED)
+  uint32_t hdr[4] = {LOG_PK_MAGIC, LOG_PK_BLOCK, 0, 0};
+  f.write((const uint8_t*)hdr, sizeof(hdr));
+#else
+  f.print(CSV_FILE_HEADER);
+#endif
 }
 
-bool log_fs_ok() {
-  return _fs_ok();
+static bool _create_log(const char *path) {
+  File f = _fs_open_write(path);
+  if (!f) return false;
+  _write_header(f);
+  f.close();
+  return true;
 }
 
-// ─── Фича 11: стрим CSV за указанную дату ────────────────────────────────
-// date — строка вида "DD.MM.YYYY"; если пустая — отдаём весь файл
-size_t log_stream_csv_date(Stream &out, const String &date) {
-  if (!_fs_ok() || !_fs_exists(LOG_FILE)) return 0;
-  File f = _fs_open_read(LOG_FILE);
-  if (!f) return 0;
+// ─── Партиции лога: файл на месяц ────────────────────────────────────────
+// LOG_DIR/YYYY/MM.csv (.bin) и рядом MM.idx. Запись идёт в партицию месяца
+// даты строки; новый месяц — новый файл, без копирования старого (у ESP8266 SD
+// нет rename, прежняя ротация переписывала весь лог). Читатели по дате
+// открывают только партицию нужного месяца.
+struct LogPart {
+  uint32_t ym;        // YYYYMM; 0 — партиция не выбрана
+  char     log[24];   // /logs/YYYY/MM.csv
+  char     idx[24];   // /logs/YYYY/MM.idx
+};
+
+static LogPart _cur = {0, "", ""};  // текущая партиция (последняя по дате записи)
+
+static void _part_make(uint32_t ym, LogPart &p) {
+  p.ym = ym;
+  snprintf(p.log, sizeof(p.log), LOG_DIR "/%04u/%02u" LOG_PART_EXT,
+           (unsigned)(ym / 100), (unsigned)(ym % 100));
+  snprintf(p.idx, sizeof(p.idx), LOG_DIR "/%04u/%02u.idx",
+           (unsigned)(ym / 100), (unsigned)(ym % 100));
+}
 
-  // Нормализуем date к "DD.MM.YYYY" один раз (без повторных String-аллокаций)
-  char cmpDate[12] = {0};
-  bool hasFilter = (date.length() == 10);
-  if (hasFilter) {
-    if (date.charAt(4) == '-') {
-      // "YYYY-MM-DD" → "DD.MM.YYYY"
-      snprintf(cmpDate, sizeof(cmpDate), "%.2s.%.2s.%.4s",
-               date.c_str()+8, date.c_str()+5, date.c_str());
-    } else {
-      memcpy(cmpDate, date.c_str(), 10);
-      cmpDate[10] = '\0';
-    }
+// Обход партиций в каталоге (порядок не гарантирован): cb(ym, size).
+// ext — расширение файлов месяца (по умолчанию — лог партиции)
+template <typename F>
+static void _part_walk(F cb, const char *ext = LOG_PART_EXT) {
+  if (!_fs_exists(LOG_DIR)) return;
+  uint16_t years[32];
+  int ny = 0;
+  _fs_list_dir(LOG_DIR, [&](const char *name, bool isDir, size_t) {
+    int y = (strlen(name) == 4) ? _parse_digits(name, 4) : -1;
+    if (isDir && y > 0 && ny < 32) years[ny++] = (uint16_t)y;
+  });
+  for (int i = 0; i < ny; i++) {
+    char dir[16];
+    snprintf(dir, sizeof(dir), LOG_DIR "/%04u", (unsigned)years[i]);
+    _fs_list_dir(dir, [&](const char *name, bool isDir, size_t sz) {
+      int m = _parse_digits(name, 2);
+      if (isDir || m < 1 || m > 12 || strcmp(name + 2, ext) != 0) return;
+      cb((uint32_t)years[i] * 100UL + (uint32_t)m, sz);
+    });
+    yield();
   }
+}
 
-  // Всегда печатаем заголовок
-  out.print(CSV_HEADER);
-  size_t count = 0;
+// Месяц самой новой партиции в LOG_DIR; 0 если партиций нет
+static uint32_t _part_newest() {
+  uint32_t newest = 0;
+  _part_walk([&](uint32_t ym, size_t) { if (ym > newest) newest = ym; });
+  return newest;
+}
 
-  // Читаем построчно через char-буфер (без readStringUntil / String)
-  char buf[128];
-  int pos = 0;
-  bool headerSkipped = false;
+// ─── Индекс дат партиции (MM.idx) ────────────────────────────────────────
+// Для каждого непрерывного участка строк одной даты хранит смещение первой
+// строки, конец участка и число строк — читатели по дате прыгают сразу
+// в нужный диапазон байт вместо чтения всей партиции.
+// В файле лежат только закрытые участки (дата сменилась), текущий участок
+// текущей партиции — в RAM. При загрузке хвост лога после последнего участка
+// досканируется, поэтому отсутствующий или отставший индекс восстанавливается сам.
+struct LogIdxEntry {
+  uint32_t day;    // YYYYMMDD
+  uint32_t start;  // смещение первой строки участка
+  uint32_t end;    // смещение за последней строкой (после '\n')
+  uint32_t rows;   // строк данных в участке
+};
+static const uint32_t LOG_IDX_MAGIC = 0x3158494CUL;  // "LIX1"
+
+static LogIdxEntry _idxOpen   = {0, 0, 0, 0};  // незакрытый участок _cur
+static bool        _idxSynced = false;
+
+static bool _idx_read_entry(File &fi, uint32_t i, LogIdxEntry &e) {
+  if (!fi.seek(4 + i * sizeof(LogIdxEntry))) return false;
+  return fi.read((uint8_t*)&e, sizeof(e)) == sizeof(e);
+}
 
-  while (f.available()) {
-    int c = f.read();
-    if (c < 0) break;
-    if (c == '\n' || c == '\r') {
-      if (pos == 0) continue;  // пустая строка
-      buf[pos] = '\0';
-      if (!headerSkipped) {
-        headerSkipped = true;
-        pos = 0;
-        continue;
+static void _idx_append(const char *path, const LogIdxEntry &e) {
+  File fi = _fs_open_append(path);
+  if (!fi) return;
+  if (fi.size() == 0) fi.write((const uint8_t*)&LOG_IDX_MAGIC, sizeof(LOG_IDX_MAGIC));
+  fi.write((const uint8_t*)&e, sizeof(e));
+  fi.close();
+}
+
+// Учесть строку [start, end) с датой day (вызывается по порядку следования строк).
+// open — незакрытый участок партиции, закрытые дописываются в её индекс path.
+static void _idx_add(LogIdxEntry &open, const char *path, uint32_t day,
+                     uint32_t start, uint32_t end) {
+  if (day == 0) return;  // заголовок или мусор — не индексируем
+  if (open.rows > 0 && open.day == day) {
+    open.end = end;
+    open.rows++;
+    return;
+  }
+  if (open.rows > 0) _idx_append(path, open);
+  open.day = day; open.start = start; open.end = end; open.rows = 1;
+}
+
+// Забыть текущую партицию (очистка лога, смена ФС)
+static void _part_forget() {
+  _cur.ym = 0; _cur.log[0] = '\0'; _cur.idx[0] = '\0';
+  _idxOpen.day = 0; _idxOpen.start = 0; _idxOpen.end = 0; _idxOpen.rows = 0;
+  _idxSynced = false;
+#ifdef LOG_FORMAT_PACKED
+  _pkYm = 0;
+#endif
+}
+
+#ifdef LOG_FORMAT_PACKED
+// Состояние кодера для дозаписи в партицию p (последний блок декодируется
+// один раз на партицию — дальше его ведёт _pk_append)
+static void _pk_prepare(const LogPart &p) {
+  if (_pkYm == p.ym) return;
+  File f = _fs_open_read(p.log);
+  if (!f) return;
+  _pkOff = f.size();
+  _pk_state_at(f, _pkOff, _pkSt);
+  _pkYm = p.ym;
+  f.close();
+}
+#endif
+
+// Проверить индекс партиции p и досканировать хвост её лога.
+// seal — в партицию больше не пишут: последний участок тоже закрывается в файл.
+// false если лог партиции не открылся.
+static bool _idx_load(const LogPart &p, LogIdxEntry &open, bool seal) {
+  open.day = 0; open.start = 0; open.end = 0; open.rows = 0;
+  if (!_fs_exists(p.log)) return false;
+  File fl = _fs_open_read(p.log);
+  if (!fl) return false;
+
+  uint32_t tail = 0;
+  bool ok = false;
+  if (_fs_exists(p.idx)) {
+    File fi = _fs_open_read(p.idx);
+    if (fi) {
+      size_t sz = fi.size();
+      uint32_t magic = 0;
+      if (sz >= 4 && (sz - 4) % sizeof(LogIdxEntry) == 0 &&
+          fi.read((uint8_t*)&magic, 4) == 4 && magic == LOG_IDX_MAGIC) {
+        uint32_t cnt = (sz - 4) / sizeof(LogIdxEntry);
+        ok = true;
+        if (cnt > 0) {
+          LogIdxEntry last;
+          ok = _idx_read_entry(fi, cnt - 1, last);
+          // Последний участок должен лежать внутри лога и кончаться на границе записи
+          if (ok && last.end > fl.size()) ok = false;
+#ifdef LOG_FORMAT_BINARY
+          if (ok && (last.end < LOG_BIN_HDR ||
+                     (last.end - LOG_BIN_HDR) % sizeof(LogBinRec) != 0)) ok = false;
+#elif defined(LOG_FORMAT_PACKED)
+          if (ok && last.end < LOG_PK_HDR) ok = false;
+#else
+          if (ok && last.end > 0) {
+            fl.seek(last.end - 1);
+            int c = fl.read();
+            if (c != '\n' && c != '\r') ok = false;
+          }
+#endif
+          if (ok) tail = last.end;
+        }
       }
-      // Skip duplicate headers from log rotation
-      if (pos > 8 && memcmp(buf, "datetime", 8) == 0) { pos = 0; continue; }
-      if (pos > 11 && memcmp(buf, "\xEF\xBB\xBF" "datetime", 11) == 0) { pos = 0; continue; }
-      // Фильтр по дате: первые 10 символов строки
-      if (hasFilter && (pos < 10 || memcmp(buf, cmpDate, 10) != 0)) {
-        pos = 0;
-        continue;
+      fi.close();
+    }
+    if (!ok) {
+      Serial.print(F("[Log] Index stale — rebuilding "));
+      Serial.println(p.idx);
+      _fs_remove(p.idx);
+    }
+  }
+
+#ifndef LOG_FORMAT_CSV
+  _read_records(fl, tail, fl.size(),
+    [&](const LogRecord &r, uint32_t s, uint32_t e) {
+      _idx_add(open, p.idx, _ts_day(r.ts), s, e);
+      return true;
+    });
+#else
+  _scan_lines(fl, tail, fl.size(),
+    [&](const char *ln, size_t len, uint32_t s, uint32_t e) {
+      _idx_add(open, p.idx, _day_key(ln, len), s, e);
+      return true;
+    });
+#endif
+  fl.close();
+  if (seal && open.rows > 0) {
+    _idx_append(p.idx, open);
+    open.rows = 0;
+  }
+  return true;
+}
+
+// Загрузить индекс текущей партиции (один раз после загрузки/смены партиции)
+static void _idx_sync() {
+  if (_idxSynced || !_fs_ok() || _cur.ym == 0) return;
+  _idxSynced = _idx_load(_cur, _idxOpen, false);
+}
+
+// Обход всех участков партиции по порядку: закрытые из её индекса + незакрытый.
+// Прошлые партиции при первом обращении «запечатываются» — их индекс полный.
+template <typename F>
+static void _idx_for_each(const LogPart &p, F cb) {
+  LogIdxEntry open = {0, 0, 0, 0};
+  if (p.ym == _cur.ym) {
+    _idx_sync();
+    open = _idxOpen;
+  } else {
+    _idx_load(p, open, true);
+  }
+  if (_fs_exists(p.idx)) {
+    File fi = _fs_open_read(p.idx);
+    if (fi && fi.seek(4)) {
+      LogIdxEntry blk[16];
+      int n;
+      while ((n = fi.read((uint8_t*)blk, sizeof(blk))) >= (int)sizeof(LogIdxEntry)) {
+        for (int i = 0; i < n / (int)sizeof(LogIdxEntry); i++) cb(blk[i]);
+        yield();
       }
-      out.write((const uint8_t*)buf, pos);
-      out.print('\n');
-      count++;
-      pos = 0;
-    } else {
-      if (pos < (int)sizeof(buf) - 1) buf[pos++] = (char)c;
     }
+    if (fi) fi.close();
   }
-  // Последняя строка без '\n'
-  if (pos > 0) {
-    buf[pos] = '\0';
-    if (!headerSkipped) { /* only header, no data */ }
-    else if (!hasFilter || (pos >= 10 && memcmp(buf, cmpDate, 10) == 0)) {
-      out.write((const uint8_t*)buf, pos);
-      out.print('\n');
-      count++;
+  if (open.rows > 0) cb(open);
+}
+
+// Обход участков с датой day (в партиции её месяца)
+template <typename F>
+static void _idx_for_day(const LogPart &p, uint32_t day, F cb) {
+  _idx_for_each(p, [&](const LogIdxEntry &e) { if (e.day == day) cb(e); });
+}
+
+// ─── Каталог партиций (LOG_CAT_FILE) ─────────────────────────────────────
+// По записи на закрытую партицию: месяц, время первой и последней записи,
+// число записей и размер. Запись добавляется при переходе на новый месяц.
+// Читатели по дате и диапазону выбирают партиции по каталогу, не обходя
+// каталоги ФС; память не зависит от числа партиций.
+// Записи идут строго по возрастанию месяца без повторов: если месяц закрывается
+// повторно или не по порядку (часы шли назад) — каталог пересобирается.
+// Отсутствующий, битый или не совпадающий с LOG_DIR каталог пересобирается при старте.
+struct LogCatEntry {
+  uint32_t ym;       // YYYYMM
+  uint32_t firstTs;  // время первой записи (0 — записей нет)
+  uint32_t lastTs;   // время последней записи
+  uint32_t rows;     // записей
+  uint32_t size;     // размер файла партиции, байт
+};
+static const uint32_t LOG_CAT_MAGIC = 0x3154434CUL;  // "LCT1"
+
+// Обход записей каталога по возрастанию месяца
+template <typename F>
+static void _cat_for_each(F cb) {
+  if (!_fs_exists(LOG_CAT_FILE)) return;
+  File f = _fs_open_read(LOG_CAT_FILE);
+  if (!f) return;
+  if (f.seek(4)) {
+    LogCatEntry blk[8];
+    int n;
+    while ((n = f.read((uint8_t*)blk, sizeof(blk))) >= (int)sizeof(LogCatEntry)) {
+      for (int i = 0; i < n / (int)sizeof(LogCatEntry); i++) cb((const LogCatEntry&)blk[i]);
+      yield();
     }
   }
   f.close();
-  return count;
 }
 
-// ─── Первая дата в логе (DD.MM.YYYY) для подсчёта дней наблюдений ────────
-// Возвращает true и заполняет buf (минимум 11 символов) датой первой записи
-bool log_first_date(char *buf, size_t bufLen) {
-  if (bufLen < 11 || !_fs_ok() || !_fs_exists(LOG_FILE)) return false;
-  File f = _fs_open_read(LOG_FILE);
+static void _cat_append(const LogCatEntry &c) {
+  File f = _fs_open_append(LOG_CAT_FILE);
+  if (!f) return;
+  if (f.size() == 0) f.write((const uint8_t*)&LOG_CAT_MAGIC, sizeof(LOG_CAT_MAGIC));
+  f.write((const uint8_t*)&c, sizeof(c));
+  f.close();
+}
+
+// Время последней записи файла лога; 0 если записей нет
+static uint32_t _last_ts(File &f) {
+  uint32_t ts = 0;
+#ifdef LOG_FORMAT_BINARY
+  uint32_t cnt = (f.size() > LOG_BIN_HDR) ? (f.size() - LOG_BIN_HDR) / sizeof(LogBinRec) : 0;
+  if (cnt > 0)
+    _read_records(f, LOG_BIN_HDR + (cnt - 1) * sizeof(LogBinRec), f.size(),
+      [&](const LogRecord &r, uint32_t, uint32_t) { ts = r.ts; return false; });
+#elif defined(LOG_FORMAT_PACKED)
+  // Декодируется только последний блок
+  if (f.size() > LOG_PK_HDR)
+    _read_records(f, _pk_block(f.size() - 1), f.size(),
+      [&](const LogRecord &r, uint32_t, uint32_t) { ts = r.ts; return true; });
+#else
+  _scan_lines_reverse(f, 0, f.size(), [&](const char *ln, size_t len, uint32_t) {
+    LogRecord r;
+    if (!_parse_csv_line(ln, len, r)) return true;
+    ts = r.ts;
+    return false;
+  });
+#endif
+  return ts;
+}
+
+// Запись каталога для партиции p (её индекс при этом запечатывается)
+static bool _part_stat(const LogPart &p, LogCatEntry &c) {
+  c.ym = p.ym;
+  c.rows = 0;
+  _idx_for_each(p, [&](const LogIdxEntry &e) { c.rows += e.rows; });
+  File f = _fs_open_read(p.log);
   if (!f) return false;
-  // пропустить заголовок
-  int byteCount = 0;
-  while (f.available()) { int c = f.read(); if ((++byteCount & 1023) == 0) { yield(); ESP.wdtFeed(); } if (c == '\n' || c < 0) break; }
-  char ln[48];
-  while (f.available()) {
-    int pos = 0;
-    while (f.available()) {
-      int c = f.read();
-      if ((++byteCount & 1023) == 0) { yield(); ESP.wdtFeed(); }
-      if (c == '\n' || c == '\r' || c < 0) break;
-      if (pos < (int)sizeof(ln) - 1) ln[pos++] = (char)c;
-    }
-    ln[pos] = '\0';
-    // trim trailing spaces
-    while (pos > 0 && ln[pos - 1] == ' ') ln[--pos] = '\0';
-    if (pos < 10) continue;
-    if (strstr(ln, "datetime") || strstr(ln, "weight_kg")) continue;
-    // Первые 10 символов = "DD.MM.YYYY"
-    memcpy(buf, ln, 10);
-    buf[10] = '\0';
-    f.close();
-    return true;
+  c.size = f.size();
+  c.firstTs = 0;
+  _read_records(f, 0, f.size(), [&](const LogRecord &r, uint32_t, uint32_t) {
+    c.firstTs = r.ts;
+    return false;
+  });
+  c.lastTs = _last_ts(f);
+  f.close();
+  return true;
+}
+
+// Пересобрать каталог обходом LOG_DIR. Месяцы выбираются по одному
+// по возрастанию — без массива имён, при любом числе партиций.
+static void _cat_rebuild() {
+  Serial.println(F("[Log] Rebuilding partition catalog"));
+  if (_fs_exists(LOG_CAT_FILE)) _fs_remove(LOG_CAT_FILE);
+  uint32_t prev = 0;
+  for (;;) {
+    uint32_t next = 0;
+    _part_walk([&](uint32_t ym, size_t) {
+      if (ym > prev && (next == 0 || ym < next)) next = ym;
+    });
+    if (next == 0) break;
+    prev = next;
+    if (next == _cur.ym) continue;  // текущая партиция ещё пишется
+    LogPart p;
+    LogCatEntry c;
+    _part_make(next, p);
+    if (_part_stat(p, c)) _cat_append(c);
+  }
+}
+
+// Проверка при старте: формат, порядок и совпадение с партициями в LOG_DIR
+static void _cat_check() {
+  uint32_t onDisk = 0;
+  bool curOnDisk = false;
+  _part_walk([&](uint32_t ym, size_t) {
+    onDisk++;
+    if (ym == _cur.ym) curOnDisk = true;
+  });
+  bool ok = true;
+  uint32_t listed = 0, prevYm = 0;
+  bool curListed = false;
+  if (_fs_exists(LOG_CAT_FILE)) {
+    File f = _fs_open_read(LOG_CAT_FILE);
+    uint32_t magic = 0;
+    size_t sz = f ? f.size() : 0;
+    ok = f && sz >= 4 && (sz - 4) % sizeof(LogCatEntry) == 0 &&
+         f.read((uint8_t*)&magic, 4) == 4 && magic == LOG_CAT_MAGIC;
+    if (f) f.close();
+    if (ok) {
+      _cat_for_each([&](const LogCatEntry &c) {
+        if (c.ym <= prevYm) ok = false;
+        if (c.ym == _cur.ym) curListed = true;
+        prevYm = c.ym;
+        listed++;
+      });
+    }
+  } else if (onDisk == 0) {
+    return;
+  }
+  if (!ok || listed + ((curOnDisk && !curListed) ? 1 : 0) != onDisk) _cat_rebuild();
+}
+
+// Обход партиций по возрастанию месяца: закрытые из каталога + текущая.
+// [fromTs, toTs] — только партиции с записями в этом интервале (toTs = 0 — до конца).
+template <typename F>
+static void _part_for_each(uint32_t fromTs, uint32_t toTs, F cb) {
+  if (toTs == 0) toTs = 0xFFFFFFFFUL;
+  uint32_t fromYm = fromTs ? _ts_day(fromTs) / 100 : 0;
+  uint32_t toYm   = _ts_day(toTs) / 100;
+  bool curDone = (_cur.ym == 0 || _cur.ym < fromYm || _cur.ym > toYm);
+  LogPart p;
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (!curDone && _cur.ym < c.ym) { cb((const LogPart&)_cur); curDone = true; }
+    if (c.ym == _cur.ym) {                 // месяц открыт заново — сводка устарела
+      if (!curDone) { cb((const LogPart&)_cur); curDone = true; }
+      return;
+    }
+    if (c.lastTs < fromTs || c.firstTs > toTs) return;
+    _part_make(c.ym, p);
+    cb((const LogPart&)p);
+  });
+  if (!curDone) cb((const LogPart&)_cur);
+}
+
+// Месяц ближайшей партиции раньше ym; 0 если её нет
+static uint32_t _part_prev(uint32_t ym) {
+  uint32_t prev = (_cur.ym < ym) ? _cur.ym : 0;
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (c.ym < ym && c.ym > prev) prev = c.ym;
+  });
+  return prev;
+}
+
+// Месяц ближайшей партиции позже ym; 0 если её нет
+static uint32_t _part_next(uint32_t ym) {
+  uint32_t next = (_cur.ym > ym) ? _cur.ym : 0;
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (c.ym > ym && (next == 0 || c.ym < next)) next = c.ym;
+  });
+  return next;
+}
+
+// Партиция p перестала быть текущей — внести её в каталог
+static void _cat_close(const LogPart &p) {
+  uint32_t lastYm = 0;
+  bool dup = false;
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (c.ym == p.ym) dup = true;
+    lastYm = c.ym;
+  });
+  if (dup || p.ym < lastYm) { _cat_rebuild(); return; }
+  LogCatEntry c;
+  if (_part_stat(p, c)) _cat_append(c);
+}
+
+// ─── Восстановление после сбоя питания ───────────────────────────────────
+// Обрыв возможен только в последней пачке (один write() буфера не длиннее
+// LOG_WB_BYTES), поэтому проверяется лишь последний блок этого размера
+// (в сжатом формате — последний блок LOG_PK_BLOCK): всё после последней
+// записи с верной CRC отрезается. Время проверки не зависит от размера
+// партиции; пути чтения дальше доверяют данным.
+static void _log_recover(const LogPart &p) {
+  File f = _fs_open_read(p.log);
+  if (!f) return;
+  uint32_t sz = f.size();
+  uint32_t cut = sz;
+#ifdef LOG_FORMAT_BINARY
+  // Сигнатура; без неё файл не читается вовсе
+  uint32_t magic = 0;
+  bool hdrOk = sz >= LOG_BIN_HDR && f.read((uint8_t*)&magic, 4) == 4 && magic == LOG_BIN_MAGIC;
+  if (hdrOk) {
+    // Недописанная запись сместила бы все следующие относительно границы 16 байт
+    cut = sz - (sz - LOG_BIN_HDR) % sizeof(LogBinRec);
+    uint32_t win = (cut - LOG_BIN_HDR > LOG_WB_BYTES) ? cut - LOG_WB_BYTES : LOG_BIN_HDR;
+    uint32_t off = cut;
+    while (off > win) {
+      LogBinRec b;
+      if (!f.seek(off - sizeof(b)) || f.read((uint8_t*)&b, sizeof(b)) != sizeof(b)) break;
+      if (_bin_check(b, off - sizeof(b))) break;
+      off -= sizeof(b);
+    }
+    cut = off;
+  }
+#elif defined(LOG_FORMAT_PACKED)
+  // Кадры последнего блока сверяются по CRC; отрезается всё после последнего целого
+  uint32_t magic = 0;
+  bool hdrOk = sz >= LOG_PK_HDR && f.read((uint8_t*)&magic, 4) == 4 && magic == LOG_PK_MAGIC;
+  if (hdrOk && sz > LOG_PK_HDR) {
+    PkState st;
+    cut = _pk_walk(f, _pk_block(sz - 1), sz, sz, true, st,
+                   [](const LogRecord&, uint32_t, uint32_t) { return true; });
+  }
+#else
+  // Заголовок: должен содержать "datetime" и ";" (новый формат).
+  // Читаем через char-буфер (без readStringUntil — защита от OOM при отсутствии '\n').
+  char hdr[80];
+  int hpos = 0;
+  while (f.available() && hpos < (int)sizeof(hdr) - 1) {
+    int c = f.read();
+    if (c == '\n' || c == '\r' || c < 0) break;
+    hdr[hpos++] = (char)c;
+  }
+  hdr[hpos] = '\0';
+  bool hdrOk = (strstr(hdr, "datetime") != NULL) && (strchr(hdr, ';') != NULL);
+  if (hdrOk) {
+    // Первая строка окна может быть неполной — она лишь задаёт границу
+    uint32_t win = (sz > LOG_WB_BYTES) ? sz - LOG_WB_BYTES : 0;
+    bool first = (win > 0);
+    cut = first ? sz : 0;
+    _scan_lines(f, win, sz, [&](const char *ln, size_t len, uint32_t s, uint32_t e) {
+      if (first || _is_header_line(ln, len) || _csv_check(ln, len, s)) cut = e;
+      first = false;
+      return true;
+    });
   }
+#endif
   f.close();
-  return false;
+#ifdef LOG_FORMAT_PACKED
+  if (!hdrOk || cut < sz) _pkYm = 0;  // файл меняется — состояние кодера заново
+#endif
+  if (!hdrOk) {
+    Serial.print(F("[Log] Header invalid — recreating "));
+    Serial.println(p.log);
+    _create_log(p.log);
+    if (_fs_exists(p.idx)) _fs_remove(p.idx);
+    return;
+  }
+  if (cut < sz) {
+    File fw = _fs_open_append(p.log);
+    if (fw) { fw.truncate(cut); fw.close(); }
+    Serial.print(F("[Log] Torn tail truncated: "));
+    Serial.print(sz - cut);
+    Serial.println(F(" B"));
+  }
 }
 
-// ─── Фича 12: суточная статистика min/max вес и температура ──────────────
-// Парсинг CSV на char-буфере (без String аллокаций в цикле — защита от heap-фрагментации)
-DayStat log_day_stat(const String &todayDate) {
+// Сделать партицию месяца ym текущей: создать каталог года и файл
+// с заголовком, закрыть участок индекса прежней партиции и внести её в каталог.
+// У существующего файла проверяется хвост (_log_recover)
+static bool _part_open(uint32_t ym) {
+  if (_cur.ym == ym) return true;
+  if (_cur.ym != 0 && _idxSynced && _idxOpen.rows > 0) _idx_append(_cur.idx, _idxOpen);
+  LogPart old = _cur;
+  _part_forget();
+  LogPart p;
+  _part_make(ym, p);
+  bool ok = true;
+  if (!_fs_exists(p.log)) {
+    char dir[16];
+    snprintf(dir, sizeof(dir), LOG_DIR "/%04u", (unsigned)(ym / 100));
+    if (!_fs_exists(LOG_DIR)) _fs_mkdir(LOG_DIR);
+    if (!_fs_exists(dir))     _fs_mkdir(dir);
+    ok = _create_log(p.log);
+    if (ok) {
+      if (_fs_exists(p.idx)) _fs_remove(p.idx);  // индекс от удалённого файла
+      Serial.print(F("[Log] New partition "));
+      Serial.println(p.log);
+    }
+  } else {
+    _log_recover(p);
+  }
+  if (ok) _cur = p;
+  if (old.ym != 0) _cat_close(old);
+  return ok;
+}
+
+// ─── Суточные сводки (LOG_DAYS_FILE) ─────────────────────────────────────
+// Текущий день копится в RAM прямо из log_append(). Закрытые дни пишутся
+// в LOG_DAYS_FILE по записи фиксированного размера на календарный день:
+// запись дня d лежит по смещению 8 + (d - base) * 32 — чтение за O(1).
+// Дни идут по возрастанию, поэтому файл только дописывается (пропущенные
+// дни — пустые записи с day = 0). Сводки не зависят от партиций лога.
+struct DayRollup {
+  uint32_t day;                // YYYYMMDD; 0 = пустой слот
+  float    wMin, wMax, wMean;
+  float    tMin, tMax, tMean;
+  uint16_t count, tCount;
+};
+static const uint32_t DAYS_MAGIC = 0x31594144UL;  // "DAY1"
+static const uint32_t DAYS_HDR   = 8;             // magic + base (YYYYMMDD)
+
+// Накопитель одного дня
+struct RollAcc {
+  uint32_t day;
+  float    wMin, wMax, wSum;
+  float    tMin, tMax, tSum;
+  uint16_t count, tCount;
+};
+
+static RollAcc  _rollAcc;                 // текущий (незакрытый) день
+static uint32_t _rollBase     = 0;        // первый день в LOG_DAYS_FILE
+static uint32_t _rollLastDay  = 0;        // последний закрытый день
+static uint32_t _rollSlots    = 0;        // записей в LOG_DAYS_FILE
+static bool     _rollSynced   = false;
+
+static void _acc_reset(RollAcc &a, uint32_t day) {
+  a.day = day;
+  a.wMin = 1e9f; a.wMax = -1e9f; a.wSum = 0;
+  a.tMin = 1e9f; a.tMax = -1e9f; a.tSum = 0;
+  a.count = 0; a.tCount = 0;
+}
+
+static void _acc_add(RollAcc &a, float w, float t) {
+  if (isnan(w) || w < -5.0f || w > 500.0f) return;
+  if (a.count == 0xFFFF) return;
+  if (w < a.wMin) a.wMin = w;
+  if (w > a.wMax) a.wMax = w;
+  a.wSum += w;
+  if (!isnan(t) && t > -90.0f) {
+    if (t < a.tMin) a.tMin = t;
+    if (t > a.tMax) a.tMax = t;
+    a.tSum += t;
+    a.tCount++;
+  }
+  a.count++;
+}
+
+static DayStat _acc_to_stat(const RollAcc &a) {
   DayStat s;
-  s.wMin = 1e9f; s.wMax = -1e9f;
-  s.tMin = 1e9f; s.tMax = -1e9f;
-  s.count = 0; s.valid = false;
+  s.count = a.count;
+  s.valid = (a.count > 0);
+  if (!s.valid) {
+    s.wMin = s.wMax = s.wAvg = s.tMin = s.tMax = s.tAvg = 0;
+    return s;
+  }
+  s.wMin = a.wMin; s.wMax = a.wMax; s.wAvg = a.wSum / a.count;
+  if (a.tCount > 0) { s.tMin = a.tMin; s.tMax = a.tMax; s.tAvg = a.tSum / a.tCount; }
+  else              { s.tMin = 0; s.tMax = 0; s.tAvg = 0; }
+  return s;
+}
 
-  if (!_fs_ok() || !_fs_exists(LOG_FILE)) return s;
-  File f = _fs_open_read(LOG_FILE);
-  if (!f) return s;
+static void _roll_forget() {
+  _acc_reset(_rollAcc, 0);
+  _rollBase = 0; _rollLastDay = 0; _rollSlots = 0;
+  _rollSynced = false;
+}
 
-  // Нормализуем дату к "DD.MM.YYYY" один раз
-  char cmpDate[12] = {0};
-  bool hasFilter = (todayDate.length() >= 10);
-  if (hasFilter) {
-    if (todayDate.charAt(4) == '-') {
-      snprintf(cmpDate, sizeof(cmpDate), "%.2s.%.2s.%.4s",
-               todayDate.c_str()+8, todayDate.c_str()+5, todayDate.c_str());
-    } else {
-      memcpy(cmpDate, todayDate.c_str(), 10);
-      cmpDate[10] = '\0';
+// Прочитать заголовок и последнюю запись LOG_DAYS_FILE
+static void _roll_load() {
+  _rollBase = 0; _rollLastDay = 0; _rollSlots = 0;
+  if (!_fs_exists(LOG_DAYS_FILE)) return;
+  File f = _fs_open_read(LOG_DAYS_FILE);
+  if (!f) return;
+  uint32_t hdr[2] = {0, 0};
+  size_t sz = f.size();
+  bool ok = sz >= DAYS_HDR && (sz - DAYS_HDR) % sizeof(DayRollup) == 0 &&
+            f.read((uint8_t*)hdr, sizeof(hdr)) == sizeof(hdr) && hdr[0] == DAYS_MAGIC;
+  if (ok) {
+    _rollBase  = hdr[1];
+    _rollSlots = (sz - DAYS_HDR) / sizeof(DayRollup);
+    // Последний непустой слот — последний закрытый день
+    for (uint32_t i = _rollSlots; i > 0; i--) {
+      DayRollup r;
+      if (!f.seek(DAYS_HDR + (i - 1) * sizeof(DayRollup)) ||
+          f.read((uint8_t*)&r, sizeof(r)) != sizeof(r)) break;
+      if (r.day != 0) { _rollLastDay = r.day; break; }
     }
   }
+  f.close();
+  if (!ok) {
+    Serial.println(F("[Log] Day summaries invalid — recreating"));
+    _fs_remove(LOG_DAYS_FILE);
+  }
+}
+
+// Записать закрытый день в LOG_DAYS_FILE
+static void _roll_close(const RollAcc &a) {
+  if (a.count == 0 || a.day == 0) return;
+  int32_t idx = _rollBase ? _day_number(a.day) - _day_number(_rollBase) : 0;
+  if (_rollBase == 0 || idx < 0 || idx >= LOG_DAYS_MAX) {
+    // Первый день или скачок часов за пределы окна — начать файл заново
+    if (_rollBase != 0) Serial.println(F("[Log] Day summaries out of range — restarting"));
+    File fw = _fs_open_write(LOG_DAYS_FILE);
+    if (!fw) return;
+    uint32_t hdr[2] = {DAYS_MAGIC, a.day};
+    fw.write((const uint8_t*)hdr, sizeof(hdr));
+    fw.close();
+    _rollBase = a.day; _rollSlots = 0; _rollLastDay = 0;
+    idx = 0;
+  }
+  if ((uint32_t)idx < _rollSlots) {
+    Serial.println(F("[Log] Day summary already closed — skip"));
+    return;
+  }
+  File f = _fs_open_append(LOG_DAYS_FILE);
+  if (!f) return;
+  DayRollup r;
+  memset(&r, 0, sizeof(r));
+  while (_rollSlots < (uint32_t)idx) {          // пропущенные дни
+    f.write((const uint8_t*)&r, sizeof(r));
+    _rollSlots++;
+  }
+  DayStat s = _acc_to_stat(a);
+  r.day = a.day;
+  r.wMin = s.wMin; r.wMax = s.wMax; r.wMean = s.wAvg;
+  r.tMin = s.tMin; r.tMax = s.tMax; r.tMean = s.tAvg;
+  r.count = a.count; r.tCount = a.tCount;
+  if (f.write((const uint8_t*)&r, sizeof(r)) == sizeof(r)) {
+    _rollSlots++;
+    _rollLastDay = a.day;
+  }
+  f.close();
+}
 
-  // Побайтовое чтение — без readStringUntil / String в цикле
-  char buf[128];
-  int pos = 0;
-  bool headerSkipped = false;
-  int byteCount = 0;
+// Сводка закрытого дня; false если дня нет в файле
+static bool _roll_read(uint32_t day, DayRollup &r) {
+  if (_rollBase == 0) return false;
+  int32_t idx = _day_number(day) - _day_number(_rollBase);
+  if (idx < 0 || (uint32_t)idx >= _rollSlots) return false;
+  File f = _fs_open_read(LOG_DAYS_FILE);
+  if (!f) return false;
+  bool ok = f.seek(DAYS_HDR + idx * sizeof(DayRollup)) &&
+            f.read((uint8_t*)&r, sizeof(r)) == sizeof(r) && r.day == day;
+  f.close();
+  return ok;
+}
 
-  while (f.available()) {
-    int c = f.read();
-    if (c < 0) break;
-    if ((++byteCount & 1023) == 0) yield();
-    if (c == '\n' || c == '\r') {
-      if (pos == 0) continue;
-      buf[pos] = '\0';
-      if (!headerSkipped) { headerSkipped = true; pos = 0; continue; }
-
-      // Пропускаем повторные заголовки
-      if (pos > 8 && memcmp(buf, "datetime", 8) == 0) { pos = 0; continue; }
-
-      // Фильтр по дате: первые 10 символов
-      if (hasFilter && (pos < 10 || memcmp(buf, cmpDate, 10) != 0)) { pos = 0; continue; }
-
-      // Парсим поля: datetime;weight;temp;...
-      // Находим разделители ';'
-      int c1 = -1, c2 = -1, c3 = -1;
-      for (int i = 0; i < pos; i++) {
-        if (buf[i] == ';') {
-          if (c1 < 0) c1 = i;
-          else if (c2 < 0) c2 = i;
-          else if (c3 < 0) { c3 = i; break; }
-        }
+// Загрузить сводки и досчитать дни лога, которых в них ещё нет
+// (первый запуск, потеря питания до закрытия дня, текущий день после перезагрузки).
+// По каталогу читаются только партиции с записями после последнего закрытого дня.
+static void _roll_sync() {
+  if (_rollSynced || !_fs_ok()) return;
+  _rollSynced = true;
+  _roll_load();
+  _acc_reset(_rollAcc, 0);
+  uint32_t fromTs = _rollLastDay ? _dt_to_ts("", 0, _rollLastDay) : 0;
+  _part_for_each(fromTs, 0, [&](const LogPart &p) {
+    File fl = _fs_open_read(p.log);
+    if (!fl) return;
+    _idx_for_each(p, [&](const LogIdxEntry &e) {
+      if (e.day <= _rollLastDay) return;
+      if (e.day != _rollAcc.day) {
+        if (_rollAcc.day > e.day) return;  // часы шли назад — не смешиваем дни
+        _roll_close(_rollAcc);
+        _acc_reset(_rollAcc, e.day);
       }
-      if (c1 < 0 || c2 < 0 || c3 < 0) { pos = 0; continue; }
+      _read_records(fl, e.start, e.end,
+        [&](const LogRecord &r, uint32_t, uint32_t) {
+          if (_ts_day(r.ts) == e.day) _acc_add(_rollAcc, r.weight, r.tempC);
+          return true;
+        });
+    });
+    fl.close();
+  });
+}
 
-      float w = commaToFloat(buf + c1 + 1, c2 - c1 - 1);
-      int tLen = c3 - c2 - 1;
-      float t = (tLen <= 0) ? -99.0f : commaToFloat(buf + c2 + 1, tLen);
+// Учесть новую запись лога (вызывается из log_append после записи строки)
+static void _roll_add(uint32_t day, float weight, float tempC) {
+  if (day == 0) return;
+  if (day != _rollAcc.day) {
+    _roll_close(_rollAcc);
+    _acc_reset(_rollAcc, day);
+  }
+  _acc_add(_rollAcc, weight, tempC);
+}
 
-      if (isnan(w) || w < -5.0f || w > 500.0f) { pos = 0; continue; }
+// ─── Ярусы хранения: 15-минутные сводки и фоновое сворачивание ──────────
+// Закрытая партиция, все записи которой старше LOG_RAW_KEEP_DAYS дней,
+// сворачивается в LOG_DIR/YYYY/MM.q15: по записи на 15-минутный интервал
+// (min/max/среднее веса и температуры, средние влажности и батареи). После
+// переноса всего месяца лог партиции и её индекс удаляются, месяц уходит из
+// каталога. Файлы .q15 старше LOG_Q15_KEEP_DAYS удаляются — остаются суточные
+// сводки LOG_DAYS_FILE. Работа идёт из log_tick() шагами по LOG_COMPACT_SLICE
+// записей; при перезагрузке последний день в .q15 отрезается и сворачивается заново.
+#define LOG_Q_EXT ".q15"
+
+struct LogQRec {
+  uint32_t ts;                // начало интервала
+  int32_t  wMin, wMax, wAvg;  // вес, 0.01 кг
+  int16_t  tMin, tMax, tAvg;  // температура, 0.1 °C (LOG_BIN_NODATA — нет данных)
+  int16_t  hAvg;              // влажность, 0.1 %    (LOG_BIN_NODATA — нет данных)
+  uint16_t batMv;             // батарея, мВ (среднее)
+  uint16_t count;             // записей лога в интервале
+  uint16_t crc;               // CRC-16 первых 28 байт (см. _rec_crc)
+  uint16_t rsv;
+};
+static_assert(sizeof(LogQRec) == 32, "LogQRec must be 32 bytes");
+static const uint32_t LOG_Q_MAGIC  = 0x3531514CUL;  // "LQ15"
+static const uint32_t LOG_Q_HDR    = 8;             // magic + длина интервала, с
+static const uint32_t LOG_Q_BUCKET = 900;
+
+// Накопитель одного интервала
+struct QAcc {
+  uint32_t ts;
+  float    wMin, wMax, wSum;
+  float    tMin, tMax, tSum;
+  float    hSum, bSum;
+  uint16_t count, tCount, hCount, bCount;
+};
+
+static void _q_make(uint32_t ym, char *path, size_t len) {
+  snprintf(path, len, LOG_DIR "/%04u/%02u" LOG_Q_EXT, (unsigned)(ym / 100), (unsigned)(ym % 100));
+}
 
-      if (w < s.wMin) s.wMin = w;
-      if (w > s.wMax) s.wMax = w;
-      if (!isnan(t) && t > -90.0f) {
-        if (t < s.tMin) s.tMin = t;
-        if (t > s.tMax) s.tMax = t;
-      }
-      s.count++;
-      pos = 0;
-    } else {
-      if (pos < (int)sizeof(buf) - 1) buf[pos++] = (char)c;
-    }
-  }
-  // Process last line without trailing newline
-  if (pos > 0 && headerSkipped) {
-    buf[pos] = '\0';
-    // Skip repeated headers
-    if (!(pos > 8 && memcmp(buf, "datetime", 8) == 0)) {
-      if (!hasFilter || (pos >= 10 && memcmp(buf, cmpDate, 10) == 0)) {
-        int c1 = -1, c2 = -1, c3 = -1;
-        for (int i = 0; i < pos; i++) {
-          if (buf[i] == ';') {
-            if (c1 < 0) c1 = i;
-            else if (c2 < 0) c2 = i;
-            else if (c3 < 0) { c3 = i; break; }
-          }
-        }
-        if (c1 >= 0 && c2 >= 0 && c3 >= 0) {
-          float w = commaToFloat(buf + c1 + 1, c2 - c1 - 1);
-          int tLen = c3 - c2 - 1;
-          float t = (tLen <= 0) ? -99.0f : commaToFloat(buf + c2 + 1, tLen);
-          if (!isnan(w) && w >= -5.0f && w <= 500.0f) {
-            if (w < s.wMin) s.wMin = w;
-            if (w > s.wMax) s.wMax = w;
-            if (!isnan(t) && t > -90.0f) {
-              if (t < s.tMin) s.tMin = t;
-              if (t > s.tMax) s.tMax = t;
-            }
-            s.count++;
-          }
-        }
+static void _q_reset(QAcc &a, uint32_t ts) {
+  memset(&a, 0, sizeof(a));
+  a.ts = ts;
+  a.wMin = 1e9f; a.wMax = -1e9f;
+  a.tMin = 1e9f; a.tMax = -1e9f;
+}
+
+static void _q_add(QAcc &a, const LogRecord &r) {
+  if (isnan(r.weight) || a.count == 0xFFFF) return;
+  if (r.weight < a.wMin) a.wMin = r.weight;
+  if (r.weight > a.wMax) a.wMax = r.weight;
+  a.wSum += r.weight;
+  a.count++;
+  if (!isnan(r.tempC) && r.tempC > -90.0f) {
+    if (r.tempC < a.tMin) a.tMin = r.tempC;
+    if (r.tempC > a.tMax) a.tMax = r.tempC;
+    a.tSum += r.tempC;
+    a.tCount++;
+  }
+  if (!isnan(r.humidity) && r.humidity > 0.0f)   { a.hSum += r.humidity; a.hCount++; }
+  if (!isnan(r.batV) && r.batV >= 0.1f)          { a.bSum += r.batV;     a.bCount++; }
+}
+
+// Дописать интервал в конец файла .q15; false — запись не удалась
+static bool _q_write(File &f, const QAcc &a) {
+  if (a.count == 0) return true;
+  LogQRec q;
+  memset(&q, 0, sizeof(q));
+  q.ts   = a.ts;
+  q.wMin = (int32_t)lroundf(a.wMin * 100.0f);
+  q.wMax = (int32_t)lroundf(a.wMax * 100.0f);
+  q.wAvg = (int32_t)lroundf(a.wSum / a.count * 100.0f);
+  if (a.tCount > 0) {
+    q.tMin = (int16_t)lroundf(a.tMin * 10.0f);
+    q.tMax = (int16_t)lroundf(a.tMax * 10.0f);
+    q.tAvg = (int16_t)lroundf(a.tSum / a.tCount * 10.0f);
+  } else {
+    q.tMin = q.tMax = q.tAvg = LOG_BIN_NODATA;
+  }
+  q.hAvg  = a.hCount ? (int16_t)lroundf(a.hSum / a.hCount * 10.0f) : LOG_BIN_NODATA;
+  q.batMv = a.bCount ? (uint16_t)lroundf(a.bSum / a.bCount * 1000.0f) : 0;
+  q.count = a.count;
+  q.crc   = _rec_crc(f.size(), (const uint8_t*)&q, offsetof(LogQRec, crc));
+  return f.write((const uint8_t*)&q, sizeof(q)) == sizeof(q);
+}
+
+static bool _q_check(const LogQRec &q, uint32_t off) {
+  return q.crc == _rec_crc(off, (const uint8_t*)&q, offsetof(LogQRec, crc));
+}
+
+// Средние интервала как запись лога (для CSV и графиков)
+static void _q_to_record(const LogQRec &q, LogRecord &r) {
+  r.ts       = q.ts;
+  r.weight   = q.wAvg / 100.0f;
+  r.tempC    = (q.tAvg == LOG_BIN_NODATA) ? -99.0f : q.tAvg / 10.0f;
+  r.humidity = (q.hAvg == LOG_BIN_NODATA) ? -99.0f : q.hAvg / 10.0f;
+  r.batV     = q.batMv / 1000.0f;
+}
+
+// Интервалы файла .q15 с началом в [fromTs, toTs] (toTs = 0 — до конца)
+template <typename F>
+static void _q_for_each(const char *path, uint32_t fromTs, uint32_t toTs, F cb) {
+  File f = _fs_open_read(path);
+  if (!f) return;
+  if (toTs == 0) toTs = 0xFFFFFFFFUL;
+  LogQRec blk[8];
+  uint32_t off = LOG_Q_HDR;
+  int n;
+  if (f.seek(off)) {
+    while ((n = f.read((uint8_t*)blk, sizeof(blk))) >= (int)sizeof(LogQRec)) {
+      for (int i = 0; i < n / (int)sizeof(LogQRec); i++, off += sizeof(LogQRec)) {
+        if (!_q_check(blk[i], off) || blk[i].ts < fromTs || blk[i].ts > toTs) continue;
+        cb((const LogQRec&)blk[i]);
       }
+      yield();
     }
   }
   f.close();
+}
 
-  if (s.count > 0) {
-    s.valid = true;
-    // Reset temperature sentinels if no valid temps were found
-    if (s.tMin > 1e8f) s.tMin = 0;
-    if (s.tMax < -1e8f) s.tMax = 0;
-  } else { s.wMin=0; s.wMax=0; s.tMin=0; s.tMax=0; }
-  return s;
+// Месяцы 15-минутного яруса в [fromYm, toYm] по возрастанию: cb(ym, path).
+// Месяц, лог которого ещё не удалён (сворачивается), пропускается — его
+// записи отдаёт партиция. _q_month_next — ближайший такой месяц позже ym.
+static uint32_t _q_month_next(uint32_t ym, uint32_t toYm) {
+  for (;;) {
+    uint32_t next = 0;
+    _part_walk([&](uint32_t m, size_t) {
+      if (m > ym && m <= toYm && (next == 0 || m < next)) next = m;
+    }, LOG_Q_EXT);
+    if (next == 0) return 0;
+    LogPart p;
+    _part_make(next, p);
+    if (!_fs_exists(p.log)) return next;
+    ym = next;
+  }
 }
 
-// ─── Парсит CSV-лог и возвращает JSON-массив для графика/экспорта ────────
-// Формат CSV: datetime;weight_kg;temp_c;humidity_pct;bat_v
-// Парсинг на char-буфере (без String аллокаций в цикле — защита от heap-фрагментации)
-String log_to_json(int maxRows) {
-  // Ограничиваем максимум на ESP8266 — heap ~40 КБ, каждая строка ~80 байт JSON
-#if defined(ESP8266)
-  if (maxRows > 50) maxRows = 50;
+template <typename F>
+static void _q_for_each_month(uint32_t fromYm, uint32_t toYm, F cb) {
+  uint32_t ym = fromYm ? fromYm - 1 : 0;
+  while ((ym = _q_month_next(ym, toYm)) != 0) {
+    char path[24];
+    _q_make(ym, path, sizeof(path));
+    cb(ym, (const char*)path);
+  }
+}
+
+// Убрать месяц ym из каталога. Каталог переписывается через временный файл;
+// при сбое посередине его пересоберёт _cat_check() при старте.
+static void _cat_drop(uint32_t ym) {
+  static const char TMP[] = LOG_DIR "/catalog.tmp";
+  File t = _fs_open_write(TMP);
+  if (!t) return;
+  t.write((const uint8_t*)&LOG_CAT_MAGIC, sizeof(LOG_CAT_MAGIC));
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (c.ym != ym) t.write((const uint8_t*)&c, sizeof(c));
+  });
+  t.close();
+  File src = _fs_open_read(TMP);
+  File dst = _fs_open_write(LOG_CAT_FILE);
+  if (src && dst) {
+    uint8_t buf[64];
+    int n;
+    while ((n = src.read(buf, sizeof(buf))) > 0) dst.write(buf, n);
+  }
+  if (dst) dst.close();
+  if (src) src.close();
+  _fs_remove(TMP);
+}
+
+static uint32_t _cmpYm      = 0;  // сворачиваемая партиция; 0 — не выбрана
+static uint32_t _cmpOff     = 0;  // смещение следующей записи её лога
+static bool     _cmpErr     = false;
+static uint32_t _cmpIdleDay = 0;  // день, на который работы не нашлось
+static unsigned long _cmpLast = 0;
+static QAcc     _cmpAcc;          // незакрытый интервал
+
+static void _cmp_forget() {
+  _cmpYm = 0; _cmpOff = 0; _cmpErr = false; _cmpIdleDay = 0;
+}
+
+// Начать (продолжить после перезагрузки) сворачивание партиции ym:
+// хвост .q15 с последним днём отрезается, чтение лога — с начала этого дня
+static void _cmp_begin(uint32_t ym) {
+  LogPart p;
+  char path[24];
+  _part_make(ym, p);
+  _q_make(ym, path, sizeof(path));
+  _cmpYm = ym; _cmpOff = 0; _cmpErr = false;
+  _q_reset(_cmpAcc, 0);
+  uint32_t sz = 0, cut = 0, day = 0;
+  File f = _fs_open_read(path);
+  if (f) {
+    uint32_t magic = 0;
+    sz = f.size();
+    if (sz >= LOG_Q_HDR && f.read((uint8_t*)&magic, 4) == 4 && magic == LOG_Q_MAGIC) {
+      cut = LOG_Q_HDR;
+      for (uint32_t off = sz - (sz - LOG_Q_HDR) % sizeof(LogQRec); off > LOG_Q_HDR; off -= sizeof(LogQRec)) {
+        LogQRec q;
+        uint32_t at = off - sizeof(LogQRec);
+        if (!f.seek(at) || f.read((uint8_t*)&q, sizeof(q)) != sizeof(q)) break;
+        if (!_q_check(q, at)) continue;        // оборванный хвост
+        if (day != 0 && _ts_day(q.ts) != day) { cut = off; break; }
+        day = _ts_day(q.ts);
+      }
+    }
+    f.close();
+  }
+  if (day != 0) {
+    // Первый участок этого дня в индексе партиции; нет — всё заново
+    bool found = false;
+    _idx_for_each(p, [&](const LogIdxEntry &e) {
+      if (!found && e.day == day) { _cmpOff = e.start; found = true; }
+    });
+    if (!found) cut = LOG_Q_HDR;
+  }
+  if (cut == 0) {
+    File fw = _fs_open_write(path);
+    if (!fw) { _cmpErr = true; return; }
+    uint32_t hdr[2] = {LOG_Q_MAGIC, LOG_Q_BUCKET};
+    fw.write((const uint8_t*)hdr, sizeof(hdr));
+    fw.close();
+  } else if (cut < sz) {
+    File fw = _fs_open_append(path);
+    if (fw) { fw.truncate(cut); fw.close(); }
+  }
+  Serial.print(F("[Log] Compacting "));
+  Serial.println(p.log);
+}
+
+// Выбрать работу: старейшая закрытая партиция старше LOG_RAW_KEEP_DAYS,
+// иначе удалить один файл .q15 старше LOG_Q15_KEEP_DAYS. false — работы нет
+static bool _cmp_pick(uint32_t today) {
+  int32_t now = _day_number(today);
+  uint32_t ym = 0;
+  _cat_for_each([&](const LogCatEntry &c) {
+    if (ym != 0 || c.ym == _cur.ym || c.lastTs == 0) return;
+    if (now - _day_number(_ts_day(c.lastTs)) > LOG_RAW_KEEP_DAYS) ym = c.ym;
+  });
+  if (ym != 0) { _cmp_begin(ym); return true; }
+  _part_walk([&](uint32_t qym, size_t) {
+    // Последний день месяца: 0-е число следующего
+    uint32_t nextYm = (qym % 100 == 12) ? (qym / 100 + 1) * 100 + 1 : qym + 1;
+    if (now - (_day_number(nextYm * 100 + 1) - 1) > LOG_Q15_KEEP_DAYS && (ym == 0 || qym < ym)) ym = qym;
+  }, LOG_Q_EXT);
+  if (ym == 0) return false;
+  char path[24];
+  _q_make(ym, path, sizeof(path));
+  _fs_remove(path);
+  Serial.print(F("[Log] Expired "));
+  Serial.println(path);
+  return true;
+}
+
+// Один шаг сворачивания: до LOG_COMPACT_SLICE записей текущей партиции
+static void _cmp_step(uint32_t today) {
+  if (_cmpYm == _cur.ym) { _cmpYm = 0; return; }  // часы ушли назад — месяц снова пишется
+  LogPart p;
+  char path[24];
+  _part_make(_cmpYm, p);
+  _q_make(_cmpYm, path, sizeof(path));
+  File fl = _fs_open_read(p.log);
+  File fq = _cmpErr ? File() : _fs_open_append(path);
+  if (!fl || !fq) {
+    // Не открылось — отложить до следующего дня; .q15 подхватится заново
+    if (fl) fl.close();
+    if (fq) fq.close();
+    _cmpIdleDay = today;
+    _cmpYm = 0;
+    return;
+  }
+  // Первый участок индекса, не пройденный до конца
+  LogIdxEntry run = {0, 0, 0, 0};
+  _idx_for_each(p, [&](const LogIdxEntry &e) { if (run.rows == 0 && e.end > _cmpOff) run = e; });
+  if (run.rows > 0) {
+    uint32_t pos = (run.start > _cmpOff) ? run.start : _cmpOff;
+    uint16_t n = 0;
+    _read_records(fl, pos, run.end, [&](const LogRecord &r, uint32_t s, uint32_t e) {
+      // Граница шага — только между записями разных смещений (кадр сжатого
+      // формата дочитывается целиком)
+      if (n >= LOG_COMPACT_SLICE && s >= pos) return false;
+      uint32_t b = r.ts - r.ts % LOG_Q_BUCKET;
+      if (_cmpAcc.count > 0 && _cmpAcc.ts != b) {
+        if (!_q_write(fq, _cmpAcc)) _cmpErr = true;
+        _q_reset(_cmpAcc, b);
+      }
+      if (_cmpAcc.count == 0) _cmpAcc.ts = b;
+      _q_add(_cmpAcc, r);
+      pos = e;
+      n++;
+      return true;
+    });
+    _cmpOff = (n > 0) ? pos : run.end;
+    fq.close();
+    fl.close();
+    return;
+  }
+  // Месяц перенесён: последний интервал, затем лог партиции больше не нужен
+  if (!_q_write(fq, _cmpAcc)) _cmpErr = true;
+  fq.close();
+  fl.close();
+  if (_cmpErr) {
+    Serial.print(F("[Log] Compaction failed, raw log kept: "));
+    Serial.println(p.log);
+    _cmpIdleDay = today;
+  } else {
+    _fs_remove(p.log);
+    if (_fs_exists(p.idx)) _fs_remove(p.idx);
+    _cat_drop(p.ym);
+    Serial.print(F("[Log] Compacted "));
+    Serial.println(path);
+  }
+  _cmpYm = 0;
+}
+
+// ─── Перенос лога прежних версий в партиции ──────────────────────────────
+
+// Записать готовую запись в конец файла; возвращает число байт
+static size_t _write_record(File &f, const LogRecord &r) {
+#ifdef LOG_FORMAT_BINARY
+  LogBinRec b;
+  _bin_encode(r, b);
+  _seal_record((uint8_t*)&b, sizeof(b), f.size());
+  return (f.write((const uint8_t*)&b, sizeof(b)) == sizeof(b)) ? sizeof(b) : 0;
+#elif defined(LOG_FORMAT_PACKED)
+  LogBinRec b;
+  _bin_encode(r, b);
+  uint32_t sz = f.size();
+  if (!_pk_append(f, _cur.ym, (const uint8_t*)&b, 1, [](uint32_t, uint32_t, uint32_t) {})) return 0;
+  return f.size() - sz;
 #else
-  if (maxRows > 200) maxRows = 200;
+  char row[96];
+  size_t n = _csv_add_crc_slot(row, _format_record_csv(r, row, sizeof(row)), sizeof(row));
+  if (n == 0) return 0;
+  _seal_record((uint8_t*)row, n, f.size());
+  return f.write((const uint8_t*)row, n);
 #endif
-  if (!_fs_ok() || !_fs_exists(LOG_FILE)) return "[]";
-  File f = _fs_open_read(LOG_FILE);
-  if (!f) return "[]";
+}
 
-  // Считаем строки чтобы пропустить лишние
-  int totalLines = 0;
-  while (f.available()) {
-    int c = f.read();
-    if (c < 0) break;
-    if (c == '\n') {
-      totalLines++;
-      if ((totalLines & 63) == 0) yield();  // WDT safe: yield каждые 64 строки
-    }
-  }
-  f.seek(0);
-
-  int dataLines = totalLines - 1;
-  int skipLines = (dataLines > maxRows) ? (dataLines - maxRows) : 0;
-
-  String out = "[";
-  // Pre-allocate: ~80 байт JSON на строку, снижает фрагментацию heap на ESP8266
-  int rows = (dataLines < 0) ? 0 : (dataLines < maxRows ? dataLines : maxRows);
-  if (!out.reserve(2 + rows * 80)) { f.close(); return "[]"; }
-  bool first = true;
-  int lineIdx = 0;
-
-  // Побайтовое чтение — без readStringUntil / String в цикле
-  char buf[128];
-  int pos = 0;
-  bool headerSkipped = false;
-
-  while (f.available()) {
-    int ch = f.read();
-    if (ch < 0) break;
-    if (ch == '\n' || ch == '\r') {
-      if (pos == 0) continue;
-      buf[pos] = '\0';
-
-      if (!headerSkipped) { headerSkipped = true; pos = 0; continue; }
-
-      // Пропускаем повторные заголовки (до lineIdx, чтобы не влияли на skipLines)
-      if (pos > 8 && memcmp(buf, "datetime", 8) == 0) { pos = 0; continue; }
-      if (pos > 11 && memcmp(buf, "\xEF\xBB\xBF" "datetime", 11) == 0) { pos = 0; continue; }
-      if (lineIdx++ < skipLines) { pos = 0; continue; }
-
-      // Находим 4 разделителя ';'
-      int s1 = -1, s2 = -1, s3 = -1, s4 = -1;
-      for (int i = 0; i < pos; i++) {
-        if (buf[i] == ';') {
-          if      (s1 < 0) s1 = i;
-          else if (s2 < 0) s2 = i;
-          else if (s3 < 0) s3 = i;
-          else if (s4 < 0) { s4 = i; break; }
+// Самый старый архив прежней ротации /log_YYMMDD_HHMM.* (имена сортируются
+// по времени); false если архивов нет. Обход без списка имён — память
+// не зависит от числа архивов.
+static bool _legacy_oldest_archive(char *path, size_t pathLen) {
+  char best[32] = "";
+  _fs_list_dir("/", [&](const char *name, bool isDir, size_t) {
+    size_t len = strlen(name);
+    if (isDir || len < 8 || len >= sizeof(best) || strncmp(name, "log_", 4) != 0) return;
+    if (strcmp(name + len - 4, LOG_ARC_EXT) != 0) return;
+    if (best[0] == '\0' || strcmp(name, best) < 0) strcpy(best, name);
+  });
+  if (best[0] == '\0') return false;
+  snprintf(path, pathLen, "/%s", best);
+  return true;
+}
+
+// Записи лога прежних версий. Сжатого формата тогда не было — его
+// прежний лог в CSV
+template <typename F>
+static void _read_legacy(File &f, F cb) {
+#ifdef LOG_FORMAT_PACKED
+  _scan_lines(f, 0, f.size(), [&](const char *ln, size_t len, uint32_t s, uint32_t e) {
+    LogRecord r;
+    if (!_parse_csv_line(ln, len, r)) return true;
+    return (bool)cb((const LogRecord&)r, s, e);
+  });
+#else
+  _read_records(f, 0, f.size(), cb);
+#endif
+}
+
+// Каждая запись файла дописывается в партицию своего месяца. Записи не новее
+// последней записи партиции пропускаются — повторный перенос после сбоя
+// питания не дублирует строки. Файл удаляется после переноса.
+static bool _migrate_file(const char *path) {
+  File src = _fs_open_read(path);
+  if (!src) return false;
+  Serial.print(F("[Log] Migrating "));
+  Serial.print(path);
+  Serial.println(F(" → " LOG_DIR));
+  File dst;
+  uint32_t dstYm = 0, lastTs = 0, moved = 0;
+  bool ok = true;
+  _read_legacy(src, [&](const LogRecord &r, uint32_t, uint32_t) {
+    uint32_t ym = _ts_day(r.ts) / 100;
+    if (ym != dstYm) {
+      if (dst) dst.close();
+      dstYm = ym;
+      if (!_part_open(ym)) { ok = false; return false; }
+      File fl = _fs_open_read(_cur.log);
+      lastTs = fl ? _last_ts(fl) : 0;
+      if (fl) fl.close();
+#ifdef LOG_FORMAT_PACKED
+      _pk_prepare(_cur);
+#endif
+      dst = _fs_open_append(_cur.log);
+      if (!dst) { ok = false; return false; }
+    }
+    if (r.ts <= lastTs) return true;
+    if (_write_record(dst, r) == 0) { ok = false; return false; }
+    moved++;
+    return true;
+  });
+  if (dst) dst.close();
+  src.close();
+  if (!ok) {
+    Serial.println(F("[Log] Migration FAILED — legacy log kept"));
+    return false;
+  }
+  if (!_fs_remove(path)) return false;
+  Serial.print(F("[Log] Migrated rows: "));
+  Serial.println(moved);
+  return true;
+}
+
+// Архивы (и /log_old.*) по времени, затем единый лог — история попадает
+// в партиции по порядку, читатели по дате видят её целиком
+static void _migrate_legacy() {
+  char path[40];
+  while (_legacy_oldest_archive(path, sizeof(path)))
+    if (!_migrate_file(path)) return;
+  if (_fs_exists(LOG_LEGACY_FILE) && !_migrate_file(LOG_LEGACY_FILE)) return;
+  if (_fs_exists(LOG_LEGACY_IDX)) _fs_remove(LOG_LEGACY_IDX);
+}
+
+// ─── Запись одной строки/записи лога ─────────────────────────────────────
+// Формирует строку (запись) в buf; возвращает её длину в байтах.
+// CRC вписывается при сбросе буфера — только тогда известно смещение в файле.
+static size_t _encode_row(uint8_t *buf, size_t bufLen, const String &datetime, uint32_t day,
+                          float weight, float tempC, float humidity, float batV) {
+#ifndef LOG_FORMAT_CSV
+  // Сжатый формат: в буфере те же 16-байтные записи, кадры — при сбросе
+  if (bufLen < sizeof(LogBinRec)) return 0;
+  LogRecord r;
+  r.ts = _dt_to_ts(datetime.c_str(), datetime.length(), day);
+  r.weight = weight; r.tempC = tempC; r.humidity = humidity; r.batV = batV;
+  LogBinRec b;
+  _bin_encode(r, b);
+  memcpy(buf, &b, sizeof(b));
+  return sizeof(b);
+#else
+  (void)day;
+  size_t n = _format_csv_row((char*)buf, bufLen, datetime.c_str(), weight, tempC, humidity, batV);
+  return _csv_add_crc_slot((char*)buf, n, bufLen);
+#endif
+}
+
+// ─── Буфер отложенной записи ─────────────────────────────────────────────
+// log_append() складывает готовые строки в RAM; файл открывается один раз на
+// сброс и получает весь буфер одним write() — вместо open + seek(size) +
+// write + close (и обновления FAT) на каждую строку. Строки буфера всегда
+// относятся к одной партиции. Сводки дня обновляются сразу, индекс — при сбросе.
+static uint8_t       _wbBuf[LOG_WB_BYTES];
+static uint16_t      _wbLen   = 0;                     // байт в буфере
+static uint8_t       _wbRows  = 0;                     // строк в буфере
+static uint32_t      _wbDay[LOG_WB_MAX_ROWS];          // дата каждой строки (для индекса)
+static uint16_t      _wbRowLen[LOG_WB_MAX_ROWS];       // длина каждой строки
+static uint32_t      _wbYm    = 0;                     // партиция строк буфера
+static unsigned long _wbSince = 0;                     // millis() первой строки
+
+// Записать буфер в конец f (партиция _cur) и дополнить индекс дат.
+// false — запись не удалась целиком.
+static bool _wb_write(File &f) {
+#ifdef LOG_FORMAT_PACKED
+  return _pk_append(f, _cur.ym, _wbBuf, _wbRows, [](uint32_t day, uint32_t s, uint32_t e) {
+    _idx_add(_idxOpen, _cur.idx, day, s, e);
+  });
+#else
+  // CRC строк — по смещениям, с которых они лягут в файл
+  uint32_t start = f.size();
+  uint16_t pos = 0;
+  for (uint8_t i = 0; i < _wbRows; i++) {
+    _seal_record(_wbBuf + pos, _wbRowLen[i], start + pos);
+    pos += _wbRowLen[i];
+  }
+  if (f.write(_wbBuf, _wbLen) != _wbLen) return false;
+  for (uint8_t i = 0; i < _wbRows; i++) {
+    _idx_add(_idxOpen, _cur.idx, _wbDay[i], start, start + _wbRowLen[i]);
+    start += _wbRowLen[i];
+  }
+  return true;
+#endif
+}
+
+static void _wb_flush() {
+  if (_wbRows == 0 || !_fs_ok()) return;
+  // Новый месяц — новый файл; до открытия на запись — sync читает партицию
+  bool partOk = _part_open(_wbYm);
+  _idx_sync();
+#ifdef LOG_FORMAT_PACKED
+  if (partOk) _pk_prepare(_cur);
+#endif
+  File f;
+  if (partOk) f = _fs_open_append(_cur.log);
+  if (!f) {
+    Serial.println(F("[Log] Open FAILED for append"));
+#ifdef USE_SD_CARD
+    // Пункт 7: если запись на SD провалилась — переключаемся на LittleFS
+    if (!_fallback) {
+      Serial.println(F("[Log] Switching to LittleFS fallback"));
+      _sdOk = false;
+      _fallback = LittleFS.begin();
+      if (_fallback) {
+        // Индекс и сводки SD не относятся к логу LittleFS
+        _part_forget();
+        _roll_forget();
+        if (_part_open(_wbYm)) {
+          _idx_sync();
+#ifdef LOG_FORMAT_PACKED
+          _pk_prepare(_cur);
+#endif
+          File ff = _fs_open_append(_cur.log);
+          if (ff) {
+            _wb_write(ff);
+            ff.close();
+          }
         }
       }
-      if (s1 < 0 || s2 < 0 || s3 < 0 || s4 < 0) { pos = 0; continue; }
-
-      // Поля: dt=[0..s1), w=[s1+1..s2), t=[s2+1..s3), h=[s3+1..s4), b=[s4+1..pos)
-      int wLen = s2 - s1 - 1;
-      int tLen = s3 - s2 - 1;
-      int hLen = s4 - s3 - 1;
-      int bLen = pos - s4 - 1;
-
-      // Валидация веса
-      float w = commaToFloat(buf + s1 + 1, wLen);
-      if (isnan(w) || isinf(w) || w < -5.0f || w > 500.0f) { pos = 0; continue; }
-
-      // Строим JSON-объект
-      char cb[16];
-      if (!first) out += ',';
-      out += F("{\"dt\":\"");
-      // dt = buf[0..s1)
-      { char saveCh = buf[s1]; buf[s1] = '\0'; out += buf; buf[s1] = saveCh; }
-      out += F("\",\"w\":");
-      out += commaToPoint(buf + s1 + 1, wLen, cb, sizeof(cb));
-      out += F(",\"t\":");
-      if (tLen <= 0) out += F("-99"); else out += commaToPoint(buf + s2 + 1, tLen, cb, sizeof(cb));
-      out += F(",\"h\":");
-      if (hLen <= 0) out += F("-99"); else out += commaToPoint(buf + s3 + 1, hLen, cb, sizeof(cb));
-      out += F(",\"b\":");
-      if (bLen <= 0) out += F("0"); else out += commaToPoint(buf + s4 + 1, bLen, cb, sizeof(cb));
-      out += '}';
-      first = false;
-      pos = 0;
-    } else {
-      if (pos < (int)sizeof(buf) - 1) buf[pos++] = (char)ch;
     }
+#endif
+    _wbLen = 0; _wbRows = 0;
+    return;
   }
+
+  bool ok = _wb_write(f);
   f.close();
-  out += ']';
-  return out;
+  if (!ok) {
+    // Часть пачки могла лечь в файл — отрезать её, индекс перечитает хвост
+    Serial.println(F("[Log] Short write — index will rescan"));
+    _log_recover(_cur);
+    _idxSynced = false;
+  }
+  _wbLen = 0; _wbRows = 0;
+}
+
+// Строка буфера → LogRecord (CRC в ней ещё не вписан и не нужен)
+static bool _wb_decode(const uint8_t *row, uint16_t len, LogRecord &r) {
+#ifndef LOG_FORMAT_CSV
+  if (len != sizeof(LogBinRec)) return false;
+  LogBinRec b;
+  memcpy(&b, row, sizeof(b));
+  _bin_decode(b, r);
+  return true;
+#else
+  return _parse_csv_line((const char*)row, len, r);
+#endif
+}
+
+// ─── Инициализация ────────────────────────────────────────────────────────
+
+bool log_init() {
+  // Повторная инициализация: сначала дописать строки из буфера
+  _wb_flush();
+#ifdef USE_SD_CARD
+  _sdOk = SD.begin(SD_CS_PIN);
+  if (!_sdOk) {
+    Serial.println(F("[Log] SD FAILED — trying LittleFS fallback"));
+    _fallback = LittleFS.begin();
+    if (!_fallback) {
+      Serial.println(F("[Log] LittleFS not formatted, formatting..."));
+      LittleFS.format();
+      _fallback = LittleFS.begin();
+    }
+    if (!_fallback) {
+      Serial.println(F("[Log] LittleFS fallback FAILED too"));
+      return false;
+    }
+    Serial.println(F("[Log] Using LittleFS as fallback"));
+  } else {
+    _fallback = false;
+    Serial.println(F("[Log] SD OK"));
+  }
+#else
+  _flashOk = LittleFS.begin();
+  if (!_flashOk) {
+    Serial.println(F("[Log] LittleFS FAILED"));
+    return false;
+  }
+  Serial.println(F("[Log] LittleFS OK"));
+#endif
+
+  // Единый лог прежних версий → партиции; текущая партиция — последняя по дате.
+  // Её заголовок и хвост (обрыв записи при сбое питания) проверяет _part_open()
+  _part_forget();
+  _migrate_legacy();
+  _part_forget();
+  uint32_t lastYm = _part_newest();
+  if (lastYm != 0) _part_open(lastYm);
+  _cat_check();
+
+  // Проверяем что запись реально работает: дозапись в текущую партицию
+  // или (лог ещё пуст) создание каталога партиций
+  bool writable;
+  if (_cur.ym != 0) {
+    File testF = _fs_open_append(_cur.log);
+    writable = (bool)testF;
+    if (testF) testF.close();
+  } else {
+    writable = _fs_exists(LOG_DIR) || _fs_mkdir(LOG_DIR);
+  }
+  if (!writable) {
+    Serial.println(F("[Log] WARNING: append test FAILED!"));
+#ifdef USE_SD_CARD
+    if (!_fallback) {
+      Serial.println(F("[Log] SD append broken — switching to LittleFS"));
+      _sdOk = false;
+      _fallback = LittleFS.begin();
+      if (!_fallback) {
+        LittleFS.format();
+        _fallback = LittleFS.begin();
+      }
+      if (_fallback) {
+        // Партиции на LittleFS свои — выбрать последнюю из них
+        _part_forget();
+        lastYm = _part_newest();
+        if (lastYm != 0) _part_open(lastYm);
+        _cat_check();
+      }
+    }
+#endif
+  }
+
+  // Загрузить индекс дат текущей партиции (при отсутствии/устаревании —
+  // перестроить по логу) и суточные сводки (досчитать дни, которых в них нет)
+  _idxSynced = false;
+  _idx_sync();
+  _roll_forget();
+  _roll_sync();
+  _cmp_forget();
+
+  Serial.print(F("[Log] Ready"));
+  if (_fallback) Serial.print(F(" [fallback:LittleFS]"));
+  Serial.print(F(", size="));
+  Serial.println(log_size());
+  return true;
+}
+
+// ─── Пункт 6: Валидация данных перед записью ─────────────────────────────
+
+static bool _validate_row(const String &datetime, float weight, float tempC,
+                           float humidity, float batV) {
+  if (datetime.length() == 0)         return false;  // совсем пустая дата
+  if (isnan(weight) || isinf(weight)) return false;
+  if (weight < -5.0f || weight > 500.0f) return false;  // физически невозможный вес
+  // Значения ≤ -90 — это сентинел ошибки датчика (-99 = TEMP_ERROR_VALUE).
+  // Пропускаем валидацию диапазона для них; реальные физические значения проверяем.
+  if (!isnan(tempC) && !isinf(tempC) && tempC > -90.0f) {
+    if (tempC < -50.0f || tempC > 100.0f) return false;
+  }
+  if (!isnan(humidity) && !isinf(humidity) && humidity > -90.0f) {
+    if (humidity < 0.0f || humidity > 100.0f) return false;
+  }
+  if (!isnan(batV) && !isinf(batV)) {
+    if (batV < 0.0f || batV > 6.0f) return false;  // батарея не может быть > 6В
+  }
+  return true;
+}
+
+// ─── Запись строки ────────────────────────────────────────────────────────
+
+void log_append(const String &datetime, float weight, float tempC,
+                float humidity, float batV, int batPct) {
+  if (!_fs_ok()) return;
+
+  // Защита от записи при критически низком заряде батареи.
+  // batV < 1.0V — батарея не подключена (питание от USB) → не пропускать.
+  if (batPct < 5 && batV > 1.0f) {
+    Serial.println(F("[Log] Skip: low battery"));
+    return;
+  }
+
+  // Пункт 6: Валидация данных
+  if (!_validate_row(datetime, weight, tempC, humidity, batV)) {
+    Serial.println(F("[Log] Skip: invalid data"));
+    return;
+  }
+
+  // Дата строки выбирает партицию (месяц)
+  uint32_t day = _day_key(datetime.c_str(), datetime.length());
+  if (day == 0) {
+    Serial.println(F("[Log] Skip: bad datetime"));
+    return;
+  }
+
+  uint8_t row[96];
+  size_t n = _encode_row(row, sizeof(row), datetime, day, weight, tempC, humidity, batV);
+  if (n == 0) return;
+  // Буфер держит строки одной партиции и не больше LOG_WB_BYTES
+  if (_wbRows > 0 && (day / 100 != _wbYm || _wbLen + n > sizeof(_wbBuf))) _wb_flush();
+  _roll_sync();
+
+  if (_wbRows == 0) _wbSince = millis();
+  memcpy(_wbBuf + _wbLen, row, n);
+  _wbDay[_wbRows]    = day;
+  _wbRowLen[_wbRows] = (uint16_t)n;
+  _wbLen += n;
+  _wbRows++;
+  _wbYm = day / 100;
+  _roll_add(day, weight, tempC);
+
+  // Полный буфер или низкий заряд (внезапное отключение) — записать сразу
+  if (_wbRows >= LOG_WB_MAX_ROWS || (batPct < LOG_WB_LOW_BAT_PCT && batV > 1.0f)) _wb_flush();
+}
+
+void log_flush() {
+  _wb_flush();
+}
+
+void log_tick() {
+  if (_wbRows > 0 && millis() - _wbSince >= LOG_WB_MAX_AGE_MS) _wb_flush();
+  // Сворачивание старых партиций — шаг не чаще LOG_COMPACT_PERIOD_MS.
+  // «Сегодня» — день последней записи лога, а не часы RTC
+  if (!_fs_ok() || millis() - _cmpLast < LOG_COMPACT_PERIOD_MS) return;
+  _cmpLast = millis();
+  uint32_t today = _rollAcc.day ? _rollAcc.day : _rollLastDay;
+  if (_cmpYm != 0) _cmp_step(today);
+  else if (today != 0 && today != _cmpIdleDay && !_cmp_pick(today)) _cmpIdleDay = today;
+}
+
+void log_clear() {
+  if (!_fs_ok()) return;
+  _wbLen = 0; _wbRows = 0;  // незаписанные строки тоже удаляются
+  // Закрытые партиции — по каталогу, без обхода каталогов ФС
+  _cat_for_each([](const LogCatEntry &c) {
+    LogPart p;
+    _part_make(c.ym, p);
+    if (_fs_exists(p.log)) _fs_remove(p.log);
+    if (_fs_exists(p.idx)) _fs_remove(p.idx);
+  });
+  if (_fs_exists(LOG_CAT_FILE)) _fs_remove(LOG_CAT_FILE);
+  // Текущая и не попавшие в каталог партиции, затем пустые каталоги годов.
+  // Имена не накапливаются: за обход находится следующий по возрастанию
+  // месяц (год) — память не зависит от их числа.
+  uint32_t prev = 0;
+  for (;;) {
+    uint32_t next = 0;
+    _part_walk([&](uint32_t ym, size_t) {
+      if (ym > prev && (next == 0 || ym < next)) next = ym;
+    });
+    if (next == 0) break;
+    LogPart p;
+    _part_make(next, p);
+    _fs_remove(p.log);
+    if (_fs_exists(p.idx)) _fs_remove(p.idx);
+    prev = next;
+  }
+  prev = 0;
+  for (;;) {  // 15-минутный ярус
+    uint32_t next = 0;
+    _part_walk([&](uint32_t ym, size_t) {
+      if (ym > prev && (next == 0 || ym < next)) next = ym;
+    }, LOG_Q_EXT);
+    if (next == 0) break;
+    char path[24];
+    _q_make(next, path, sizeof(path));
+    _fs_remove(path);
+    prev = next;
+  }
+  int prevYear = 0;
+  for (;;) {
+    int nextYear = 0;
+    _fs_list_dir(LOG_DIR, [&](const char *name, bool isDir, size_t) {
+      int y = (strlen(name) == 4) ? _parse_digits(name, 4) : -1;
+      if (isDir && y > prevYear && (nextYear == 0 || y < nextYear)) nextYear = y;
+    });
+    if (nextYear == 0) break;
+    char dir[16];
+    snprintf(dir, sizeof(dir), LOG_DIR "/%04u", (unsigned)nextYear);
+    _fs_rmdir(dir);
+    prevYear = nextYear;
+  }
+  _fs_rmdir(LOG_DIR);
+  // Лог прежних версий и архивы его ротации /log_YYMMDD_HHMM.csv (.bin)
+  if (_fs_exists(LOG_LEGACY_FILE)) _fs_remove(LOG_LEGACY_FILE);
+  if (_fs_exists(LOG_LEGACY_IDX))  _fs_remove(LOG_LEGACY_IDX);
+  char arc[40];
+  while (_legacy_oldest_archive(arc, sizeof(arc)))
+    if (!_fs_remove(arc)) break;
+  if (_fs_exists(LOG_DAYS_FILE)) _fs_remove(LOG_DAYS_FILE);
+  _part_forget();
+  _roll_forget();
+  _cmp_forget();
+  Serial.println(F("[Log] Cleared"));
+}
+
+size_t log_size() {
+  if (!_fs_ok()) return 0;
+  // Закрытые партиции — из каталога, текущая — по файлу, плюс буфер записи
+  size_t total = _wbLen;
+  _cat_for_each([&](const LogCatEntry &c) { if (c.ym != _cur.ym) total += c.size; });
+  if (log_exists()) {
+    File f = _fs_open_read(_cur.log);
+    if (f) { total += f.size(); f.close(); }
+  }
+  return total;
+}
+
+bool log_stamp(uint32_t &size, uint32_t &lastTs) {
+  size = 0;
+  lastTs = 0;
+  if (!log_exists()) return false;
+  _wb_flush();
+  size = log_size();
+  // Последняя запись — только хвост текущей партиции (последний блок в сжатом формате)
+  File f = _fs_open_read(_cur.log);
+  if (f) { lastTs = _last_ts(f); f.close(); }
+  return true;
+}
+
+bool log_exists() {
+  if (!_fs_ok()) return false;
+  if (_wbRows > 0) return true;
+  if (_cur.ym == 0) return false;
+  return _fs_exists(_cur.log);
+}
+
+// ─── Доступ к записям по номеру (текущая партиция) ───────────────────────
+// Бинарный формат: номер → смещение, одно чтение 16 байт.
+// CSV: участок с нужным номером находится по индексу, затем строки внутри него.
+uint32_t log_record_count() {
+  _wb_flush();
+  if (!log_exists()) return 0;
+#ifdef LOG_FORMAT_BINARY
+  File f = _fs_open_read(_cur.log);
+  if (!f) return 0;
+  size_t sz = f.size();
+  f.close();
+  return (sz > LOG_BIN_HDR) ? (sz - LOG_BIN_HDR) / sizeof(LogBinRec) : 0;
+#else
+  uint32_t n = 0;
+  _idx_for_each(_cur, [&](const LogIdxEntry &e) { n += e.rows; });
+  return n;
+#endif
+}
+
+bool log_read_record(uint32_t index, LogRecord &rec) {
+  _wb_flush();
+  if (!log_exists()) return false;
+#ifdef LOG_FORMAT_BINARY
+  File f = _fs_open_read(_cur.log);
+  if (!f) return false;
+  LogBinRec b;
+  bool ok = f.seek(LOG_BIN_HDR + index * sizeof(LogBinRec)) &&
+            f.read((uint8_t*)&b, sizeof(b)) == sizeof(b);
+  if (ok) _bin_decode(b, rec);
+  f.close();
+  return ok;
+#else
+  uint32_t from = 0, to = 0, skip = 0;
+  bool found = false;
+  _idx_for_each(_cur, [&](const LogIdxEntry &e) {
+    if (found) return;
+    if (index < e.rows) { from = e.start; to = e.end; skip = index; found = true; }
+    else index -= e.rows;
+  });
+  if (!found) return false;
+  File f = _fs_open_read(_cur.log);
+  if (!f) return false;
+  bool ok = false;
+  _read_records(f, from, to, [&](const LogRecord &r, uint32_t, uint32_t) {
+    if (skip-- > 0) return true;
+    rec = r;
+    ok = true;
+    return false;
+  });
+  f.close();
+  return ok;
+#endif
+}
+
+uint32_t log_free_space() {
+#ifdef USE_SD_CARD
+  if (_fallback) {
+#if defined(ESP8266)
+    FSInfo info;
+    if (LittleFS.info(info)) return (uint32_t)(info.totalBytes - info.usedBytes);
+#elif defined(ESP32)
+    return (uint32_t)(LittleFS.totalBytes() - LittleFS.usedBytes());
+#endif
+    return 0;
+  }
+  return 0;  // ESP8266 SD library does not expose free space
+#else
+  if (!_flashOk) return 0;
+#if defined(ESP8266)
+  FSInfo info;
+  if (LittleFS.info(info)) return (uint32_t)(info.totalBytes - info.usedBytes);
+  return 0;
+#elif defined(ESP32)
+  return (uint32_t)(LittleFS.totalBytes() - LittleFS.usedBytes());
+#else
+  return 0;
+#endif
+#endif
+}
+
+// Возвращает true если активен резервный LittleFS (SD недоступна)
+bool log_using_fallback() {
+  return _fallback;
+}
+
+bool log_fs_ok() {
+  return _fs_ok();
+}
+
+// ─── Фича 11: стрим CSV за дату / диапазон дат ───────────────────────────
+// Выдача идёт порциями через LogCursor: всё состояние — месяц и непрочитанный
+// участок его файла, поэтому ответ можно прервать между порциями и продолжить
+// (неблокирующая отдача в WebServerModule). Свёрнутые месяцы (они всегда старше
+// партиций) идут первыми — средними 15-минутных интервалов, затем партиции по
+// каталогу; с фильтром дат — только участок нужных дней по индексу партиции.
+static void _cursor_init(LogCursor &c, uint32_t fromDay, uint32_t toDay) {
+  memset(&c, 0, sizeof(c));
+  c.fromDay = fromDay;
+  c.toDay   = toDay;
+  c.q15     = true;
+}
+
+// Следующий файл курсора с непустым участком [off, end); false — файлов больше нет
+static bool _cursor_next_file(LogCursor &c) {
+  uint32_t fromYm = c.fromDay / 100;
+  uint32_t toYm   = c.fromDay ? c.toDay / 100 : 999912UL;
+  for (;;) {
+    if (c.q15) {
+      uint32_t ym = _q_month_next(c.ym ? c.ym : (fromYm ? fromYm - 1 : 0), toYm);
+      if (ym == 0) { c.q15 = false; c.ym = 0; continue; }
+      c.ym = ym;
+      char path[24];
+      _q_make(ym, path, sizeof(path));
+      File f = _fs_open_read(path);
+      if (!f) continue;
+      c.off = LOG_Q_HDR;
+      c.end = f.size();
+      f.close();
+    } else {
+      _wb_flush();
+      uint32_t ym = _part_next(c.ym ? c.ym : (fromYm ? fromYm - 1 : 0));
+      if (ym == 0 || ym > toYm) return false;
+      c.ym = ym;
+      LogPart p;
+      _part_make(ym, p);
+      File f = _fs_open_read(p.log);
+      if (!f) continue;
+      c.off = 0;
+      c.end = f.size();
+      f.close();
+      if (c.fromDay) {
+        uint32_t s = 0xFFFFFFFFUL, e = 0;
+        _idx_for_each(p, [&](const LogIdxEntry &x) {
+          if (x.day < c.fromDay || x.day > c.toDay) return;
+          if (x.start < s) s = x.start;
+          if (x.end > e)   e = x.end;
+        });
+        if (e < c.end) c.end = e;
+        c.off = s;
+      }
+    }
+    if (c.off < c.end) return true;
+  }
+}
+
+bool log_cursor_begin(LogCursor &c, const String &from, const String &to) {
+  _cursor_init(c, _day_key(from.c_str(), from.length()), _day_key(to.c_str(), to.length()));
+  bool whole = (from.length() == 0 && to.length() == 0);
+  c.done = !log_exists() ||
+           (!whole && (c.fromDay == 0 || c.toDay == 0 || c.fromDay > c.toDay));
+  return !c.done;
+}
+
+size_t log_cursor_csv(LogCursor &c, Stream &out, uint16_t maxRows) {
+  size_t count = 0;
+  char row[96];
+  // Строка за дату day; false — onDay велел закончить
+  auto put = [&](uint32_t day, const char *s, size_t n, bool nl) {
+    if (c.onDay && day != c.day && !c.onDay(day, c.ctx)) { c.done = true; return false; }
+    c.day = day;
+    out.write((const uint8_t*)s, n);
+    if (nl) out.print('\n');
+    count++;
+    return true;
+  };
+
+  while (!c.done && count < maxRows) {
+    if (c.off >= c.end && !_cursor_next_file(c)) { c.done = true; break; }
+    if (c.q15) {
+      uint32_t fromTs = c.fromDay ? _dt_to_ts("", 0, c.fromDay) : 0;
+      uint32_t toTs   = c.fromDay ? _dt_to_ts("", 0, c.toDay) + 86399UL : 0xFFFFFFFFUL;
+      char path[24];
+      _q_make(c.ym, path, sizeof(path));
+      File f = _fs_open_read(path);
+      if (!f || !f.seek(c.off)) { if (f) f.close(); c.off = c.end; continue; }
+      LogQRec q;
+      while (c.off + sizeof(q) <= c.end && count < maxRows && !c.done) {
+        if (f.read((uint8_t*)&q, sizeof(q)) != (int)sizeof(q)) { c.off = c.end; break; }
+        uint32_t off = c.off;
+        c.off += sizeof(q);
+        if (!_q_check(q, off) || q.ts < fromTs || q.ts > toTs) continue;
+        LogRecord r;
+        _q_to_record(q, r);
+        put(_ts_day(r.ts), row, _format_record_csv(r, row, sizeof(row)), false);
+      }
+      if (c.off + sizeof(q) > c.end) c.off = c.end;  // хвост короче записи
+      f.close();
+      continue;
+    }
+
+    LogPart p;
+    _part_make(c.ym, p);
+    File f = _fs_open_read(p.log);
+    if (!f) { c.off = c.end; continue; }
+    uint32_t last = c.off;
+    bool full = false;
+#ifdef LOG_FORMAT_CSV
+    _scan_lines(f, c.off, c.end, [&](const char *ln, size_t len, uint32_t, uint32_t e) {
+      if (count >= maxRows) { full = true; return false; }
+      last = e;
+      if (_is_header_line(ln, len)) return true;
+      uint32_t day = (c.fromDay || c.onDay) ? _day_key(ln, len) : 0;
+      if (c.fromDay && (day < c.fromDay || day > c.toDay)) return true;
+      return put(day, ln, _csv_data_len(ln, len), true);
+    });
+#else
+    // CSV собирается из записей на лету; записи одного кадра сжатого формата
+    // не разрываются — порция кончается только на границе кадра
+    _read_records(f, c.off, c.end, [&](const LogRecord &r, uint32_t rs, uint32_t re) {
+      if (count >= maxRows && rs >= last) { full = true; return false; }
+      last = re;
+      uint32_t day = _ts_day(r.ts);
+      if (c.fromDay && (day < c.fromDay || day > c.toDay)) return true;
+      return put(day, row, _format_record_csv(r, row, sizeof(row)), false);
+    });
+#endif
+    f.close();
+    c.off = (full || c.done) ? last : c.end;
+    yield();
+  }
+  return count;
+}
+
+// Следующие ~maxRows записей курсора в разобранном виде: cb(const LogRecord &r,
+// const LogQRec *q), q — исходная 15-минутная запись (nullptr — запись лога).
+// Порядок и фильтр дат — как у log_cursor_csv, onDay не вызывается
+template <typename F>
+static size_t _cursor_each(LogCursor &c, uint16_t maxRows, F cb) {
+  size_t count = 0;
+  while (!c.done && count < maxRows) {
+    if (c.off >= c.end && !_cursor_next_file(c)) { c.done = true; break; }
+    if (c.q15) {
+      uint32_t fromTs = c.fromDay ? _dt_to_ts("", 0, c.fromDay) : 0;
+      uint32_t toTs   = c.fromDay ? _dt_to_ts("", 0, c.toDay) + 86399UL : 0xFFFFFFFFUL;
+      char path[24];
+      _q_make(c.ym, path, sizeof(path));
+      File f = _fs_open_read(path);
+      if (!f || !f.seek(c.off)) { if (f) f.close(); c.off = c.end; continue; }
+      LogQRec q;
+      while (c.off + sizeof(q) <= c.end && count < maxRows) {
+        if (f.read((uint8_t*)&q, sizeof(q)) != (int)sizeof(q)) { c.off = c.end; break; }
+        uint32_t off = c.off;
+        c.off += sizeof(q);
+        if (!_q_check(q, off) || q.ts < fromTs || q.ts > toTs) continue;
+        LogRecord r;
+        _q_to_record(q, r);
+        cb((const LogRecord&)r, (const LogQRec*)&q);
+        count++;
+      }
+      if (c.off + sizeof(q) > c.end) c.off = c.end;
+      f.close();
+      continue;
+    }
+
+    LogPart p;
+    _part_make(c.ym, p);
+    File f = _fs_open_read(p.log);
+    if (!f) { c.off = c.end; continue; }
+    uint32_t last = c.off;
+    bool full = false;
+    _read_records(f, c.off, c.end, [&](const LogRecord &r, uint32_t rs, uint32_t re) {
+      if (count >= maxRows && rs >= last) { full = true; return false; }
+      last = re;
+      uint32_t day = _ts_day(r.ts);
+      if (c.fromDay && (day < c.fromDay || day > c.toDay)) return true;
+      cb(r, (const LogQRec*)nullptr);
+      count++;
+      return true;
+    });
+    f.close();
+    c.off = full ? last : c.end;
+    yield();
+  }
+  return count;
+}
+
+const char *log_csv_header() {
+  return CSV_HEADER;
+}
+
+// Дни [fromDay, toDay] (fromDay = 0 — весь лог) одним проходом курсора
+static size_t _stream_days(Stream &out, uint32_t fromDay, uint32_t toDay) {
+  LogCursor c;
+  _cursor_init(c, fromDay, toDay);
+  size_t count = 0;
+  while (!c.done) count += log_cursor_csv(c, out, 64);
+  return count;
+}
+
+// date — строка вида "DD.MM.YYYY" или "YYYY-MM-DD"; если пустая — все партиции
+// по порядку под одним заголовком. С фильтром читается только партиция
+// месяца этой даты.
+size_t log_stream_csv_date(Stream &out, const String &date) {
+  _wb_flush();
+  if (!log_exists()) return 0;
+  bool hasFilter = (date.length() == 10);
+  uint32_t day = hasFilter ? _day_key(date.c_str(), 10) : 0;
+
+  // Всегда печатаем заголовок
+  out.print(CSV_HEADER);
+  if (hasFilter && day == 0) return 0;
+  return _stream_days(out, day, day);
+}
+
+// Диапазон дат включительно, формат дат как у log_stream_csv_date
+size_t log_stream_csv_range(Stream &out, const String &from, const String &to) {
+  _wb_flush();
+  if (!log_exists()) return 0;
+  uint32_t fromDay = _day_key(from.c_str(), from.length());
+  uint32_t toDay   = _day_key(to.c_str(), to.length());
+  out.print(CSV_HEADER);
+  if (fromDay == 0 || toDay == 0 || fromDay > toDay) return 0;
+  return _stream_days(out, fromDay, toDay);
+}
+
+// ─── Агрегирующий запрос по ярусам лога ──────────────────────────────────
+// Значение поля записи; false — нет данных (сентинел датчика, пустая батарея).
+// В CSV «нет данных» записано нулём — нулевая влажность тоже не данные
+static bool _field_value(const LogRecord &r, LogField field, float &v) {
+  switch (field) {
+    case LOG_FIELD_WEIGHT: v = r.weight;   return !isnan(v);
+    case LOG_FIELD_TEMP:   v = r.tempC;    return !isnan(v) && v > -90.0f;
+    case LOG_FIELD_HUM:    v = r.humidity; return !isnan(v) && v > 0.0f;
+    default:               v = r.batV;     return !isnan(v) && v >= 0.1f;
+  }
+}
+
+// Отсчёт поля из 15-минутной записи: min, max и среднее; false — нет данных
+static bool _q_field(const LogQRec &q, LogField field, float &mn, float &mx, float &avg) {
+  switch (field) {
+    case LOG_FIELD_WEIGHT: mn = q.wMin / 100.0f; mx = q.wMax / 100.0f; avg = q.wAvg / 100.0f; return true;
+    case LOG_FIELD_TEMP:
+      if (q.tAvg == LOG_BIN_NODATA) return false;
+      mn = q.tMin / 10.0f; mx = q.tMax / 10.0f; avg = q.tAvg / 10.0f; return true;
+    case LOG_FIELD_HUM:
+      if (q.hAvg == LOG_BIN_NODATA) return false;
+      mn = mx = avg = q.hAvg / 10.0f; return true;
+    default:
+      if (q.batMv == 0) return false;
+      mn = mx = avg = q.batMv / 1000.0f; return true;
+  }
+}
+
+// Закрытый интервал — элементом массива в out
+static void _query_row(LogQuery &q, Stream &out) {
+  // Знаков после запятой — как в CSV (вес — тысячные для средних)
+  int dec = (q.field == LOG_FIELD_WEIGHT) ? 3 : (q.field == LOG_FIELD_BAT) ? 2 : 1;
+  char dt[24], row[128];
+  _ts_to_dt(q.cur, dt, sizeof(dt));
+  int len = snprintf(row, sizeof(row), "%s{\"dt\":\"%s\"", q.count ? "," : "", dt);
+  if (q.agg & LOG_AGG_MIN)   len += snprintf(row + len, sizeof(row) - len, ",\"min\":%.*f", dec, q.mn);
+  if (q.agg & LOG_AGG_MAX)   len += snprintf(row + len, sizeof(row) - len, ",\"max\":%.*f", dec, q.mx);
+  if (q.agg & LOG_AGG_MEAN)  len += snprintf(row + len, sizeof(row) - len, ",\"mean\":%.*f", dec, q.sum / q.n);
+  if (q.agg & LOG_AGG_COUNT) len += snprintf(row + len, sizeof(row) - len, ",\"n\":%u", (unsigned)q.n);
+  len += snprintf(row + len, sizeof(row) - len, "}");
+  out.write((const uint8_t*)row, len);
+  q.count++;
+}
+
+// Отсчёт (ts, min, max, сумма, число записей) в интервал запроса
+static void _query_add(LogQuery &q, Stream &out, uint32_t ts, float smn, float smx, float ssum, uint32_t sn) {
+  uint32_t b = ts - ts % q.bucket;
+  if (q.n > 0 && b != q.cur) { _query_row(q, out); q.n = 0; }
+  if (q.n == 0) { q.cur = b; q.mn = smn; q.mx = smx; q.sum = 0; }
+  if (smn < q.mn) q.mn = smn;
+  if (smx > q.mx) q.mx = smx;
+  q.sum += ssum;
+  q.n += sn;
+}
+
+// Этапы запроса: записи и 15-минутные сводки (курсор), суточные сводки, концовка
+enum { QUERY_FILES, QUERY_DAYS, QUERY_END };
+
+// Каждый источник отдаёт уже свёрнутое, насколько позволяет интервал bucketSec:
+// кратный суткам — суточные сводки (вес и температура), свёрнутые месяцы —
+// 15-минутные записи, остальное — записи лога
+void log_query_begin(LogQuery &q, Stream &out, LogField field, const String &from, const String &to,
+                     uint32_t bucketSec, uint8_t aggMask) {
+  memset(&q, 0, sizeof(q));
+  q.field   = field;
+  q.agg     = aggMask;
+  q.bucket  = bucketSec;
+  q.fromDay = _day_key(from.c_str(), from.length());
+  q.toDay   = _day_key(to.c_str(), to.length());
+  q.phase   = QUERY_END;
+  out.print('[');
+  if (!log_exists() || q.fromDay == 0 || q.toDay == 0 || q.fromDay > q.toDay || bucketSec == 0) return;
+  _roll_sync();
+  q.daily = (bucketSec % 86400UL == 0) && _rollBase != 0 &&
+            (field == LOG_FIELD_WEIGHT || field == LOG_FIELD_TEMP);
+  // Суточные сводки начинаются с _rollBase; дни раньше — из файлов
+  uint32_t fileTo = q.toDay;
+  if (q.daily) {
+    uint32_t d0 = (q.fromDay > _rollBase) ? q.fromDay : _rollBase;
+    if (d0 <= q.toDay) q.dOff = DAYS_HDR + (_day_number(d0) - _day_number(_rollBase)) * sizeof(DayRollup);
+    uint32_t prev = _ts_day(_dt_to_ts("", 0, _rollBase) - 1);
+    if (_rollBase <= q.fromDay) fileTo = 0;
+    else if (prev < fileTo)     fileTo = prev;
+    q.phase = QUERY_DAYS;
+  }
+  if (fileTo != 0) {
+    _cursor_init(q.c, q.fromDay, fileTo);
+    q.phase = QUERY_FILES;
+  }
+}
+
+bool log_query_step(LogQuery &q, Stream &out, uint16_t rows) {
+  if (q.phase == QUERY_FILES) {
+    _cursor_each(q.c, rows, [&](const LogRecord &r, const LogQRec *s) {
+      float mn, mx, avg;
+      if (s) {
+        if (_q_field(*s, q.field, mn, mx, avg)) _query_add(q, out, s->ts, mn, mx, avg * s->count, s->count);
+      } else if (_field_value(r, q.field, avg)) {
+        _query_add(q, out, r.ts, avg, avg, avg, 1u);
+      }
+    });
+    if (!q.c.done) return false;
+    q.phase = q.daily ? QUERY_DAYS : QUERY_END;
+  }
+
+  if (q.phase == QUERY_DAYS) {
+    // Закрытые дни — подряд из LOG_DAYS_FILE, текущий — из RAM
+    bool end = (q.dOff == 0);
+    File f = end ? File() : _fs_open_read(LOG_DAYS_FILE);
+    if (!end && (!f || !f.seek(q.dOff))) end = true;
+    DayRollup r;
+    for (uint16_t k = 0; !end && k < rows; k++) {
+      if (f.read((uint8_t*)&r, sizeof(r)) != sizeof(r) || r.day > q.toDay) { end = true; break; }
+      q.dOff += sizeof(r);
+      if (r.day == 0 || r.count == 0) continue;
+      uint32_t ts = _dt_to_ts("", 0, r.day);
+      if (q.field == LOG_FIELD_WEIGHT) _query_add(q, out, ts, r.wMin, r.wMax, r.wMean * r.count, (uint32_t)r.count);
+      else if (r.tCount > 0)           _query_add(q, out, ts, r.tMin, r.tMax, r.tMean * r.tCount, (uint32_t)r.tCount);
+    }
+    if (f) f.close();
+    if (!end) return false;
+    const RollAcc &a = _rollAcc;
+    if (a.day > _rollLastDay && a.day >= q.fromDay && a.day <= q.toDay && a.count > 0) {
+      uint32_t ts = _dt_to_ts("", 0, a.day);
+      if (q.field == LOG_FIELD_WEIGHT) _query_add(q, out, ts, a.wMin, a.wMax, a.wSum, (uint32_t)a.count);
+      else if (a.tCount > 0)           _query_add(q, out, ts, a.tMin, a.tMax, a.tSum, (uint32_t)a.tCount);
+    }
+    q.phase = QUERY_END;
+  }
+
+  if (q.n > 0) { _query_row(q, out); q.n = 0; }
+  out.print(']');
+  return true;
+}
+
+size_t log_query(Stream &out, LogField field, const String &from, const String &to,
+                 uint32_t bucketSec, uint8_t aggMask) {
+  LogQuery q;
+  log_query_begin(q, out, field, from, to, bucketSec, aggMask);
+  while (!log_query_step(q, out, 64)) {}
+  return q.count;
+}
+
+uint32_t log_day_key(const String &date) {
+  return _day_key(date.c_str(), date.length());
+}
+
+int32_t log_day_number(uint32_t day) {
+  return _day_number(day);
+}
+
+// ─── Первая дата в логе (DD.MM.YYYY) для подсчёта дней наблюдений ────────
+// Возвращает true и заполняет buf (минимум 11 символов) датой первой записи.
+// Дата берётся из суточных сводок — без чтения лога.
+bool log_first_date(char *buf, size_t bufLen) {
+  if (bufLen < 11 || !log_exists()) return false;
+  _roll_sync();
+  // Сводки покрывают все партиции — первая дата наблюдений берётся из них
+  uint32_t first = _rollBase ? _rollBase : _rollAcc.day;
+  if (first == 0) return false;
+  snprintf(buf, bufLen, "%02u.%02u.%04u",
+           (unsigned)(first % 100), (unsigned)(first / 100 % 100),
+           (unsigned)(first / 10000));
+  return true;
+}
+
+// ─── Фича 12: суточная статистика min/max/среднее веса и температуры ─────
+// Текущий день — из RAM, прошедшие — одна запись из LOG_DAYS_FILE.
+// Если сводки за дату нет — чтение партиции её месяца (по каталогу) по индексу;
+// без даты — все партиции.
+DayStat log_day_stat(const String &todayDate) {
+  RollAcc a;
+  _acc_reset(a, 0);
+  if (!log_exists()) return _acc_to_stat(a);
+  bool hasFilter = (todayDate.length() >= 10);
+  uint32_t day = hasFilter ? _day_key(todayDate.c_str(), 10) : 0;
+  if (hasFilter) {
+    if (day == 0) return _acc_to_stat(a);
+    _roll_sync();
+    if (_rollAcc.day == day && _rollAcc.count > 0) return _acc_to_stat(_rollAcc);
+    DayRollup r;
+    if (_roll_read(day, r)) {
+      DayStat s;
+      s.wMin = r.wMin; s.wMax = r.wMax; s.wAvg = r.wMean;
+      s.tMin = r.tMin; s.tMax = r.tMax; s.tAvg = r.tMean;
+      s.count = r.count; s.valid = (r.count > 0);
+      return s;
+    }
+  }
+
+  // Сводки нет — считаем по файлам, включая строки из буфера
+  _wb_flush();
+  auto add = [&](const LogRecord &r, uint32_t, uint32_t) {
+    if (!hasFilter || _ts_day(r.ts) == day) _acc_add(a, r.weight, r.tempC);
+    return true;
+  };
+  uint32_t fromTs = hasFilter ? _dt_to_ts("", 0, day) : 0;
+  _part_for_each(fromTs, hasFilter ? fromTs + 86399UL : 0, [&](const LogPart &p) {
+    File f = _fs_open_read(p.log);
+    if (!f) return;
+    if (hasFilter) {
+      _idx_for_day(p, day, [&](const LogIdxEntry &e) { _read_records(f, e.start, e.end, add); });
+    } else {
+      _read_records(f, 0, f.size(), add);
+    }
+    f.close();
+  });
+  return _acc_to_stat(a);
+}
+
+// ─── Хвост лога: последние записи ────────────────────────────────────────
+// Хвост ищется с конца: текущая партиция, а если в ней меньше maxRows
+// строк (начало месяца) — предыдущие. Стоимость зависит только от числа
+// запрошенных строк, а не от размера лога.
+struct LogTail {
+  uint32_t chain[8];  // партиции от новой к старой
+  int      nc;
+  int      rows;      // найдено записей (≤ maxRows)
+  uint32_t from;      // смещение первой нужной строки в самой старой из партиций
+  uint32_t skip;      // сжатый формат: записей участка до первой нужной
+};
+
+static void _tail_locate(int maxRows, LogTail &t) {
+  t.nc = 0; t.rows = 0; t.from = 0; t.skip = 0;
+  if (!log_exists()) return;
+  _wb_flush();
+  uint32_t ym = _cur.ym;
+  while (ym != 0 && t.nc < 8) {
+    LogPart p;
+    _part_make(ym, p);
+    t.chain[t.nc++] = ym;
+    File f = _fs_open_read(p.log);
+    if (f) {
+#ifdef LOG_FORMAT_BINARY
+      // Последние записи — прямой seek по номеру, без подсчёта строк
+      uint32_t cnt  = (f.size() > LOG_BIN_HDR) ? (f.size() - LOG_BIN_HDR) / sizeof(LogBinRec) : 0;
+      uint32_t take = ((uint32_t)(maxRows - t.rows) < cnt) ? (uint32_t)(maxRows - t.rows) : cnt;
+      t.rows += take;
+      t.from  = LOG_BIN_HDR + (cnt - take) * sizeof(LogBinRec);
+#elif defined(LOG_FORMAT_PACKED)
+      // По индексу дат: участок с первой нужной записью и сколько записей
+      // в нём пропустить — декодируются только блоки хвоста
+      uint32_t cnt = 0, seen = 0;
+      _idx_for_each(p, [&](const LogIdxEntry &e) { cnt += e.rows; });
+      uint32_t take = ((uint32_t)(maxRows - t.rows) < cnt) ? (uint32_t)(maxRows - t.rows) : cnt;
+      t.rows += take;
+      t.from = f.size(); t.skip = 0;
+      _idx_for_each(p, [&](const LogIdxEntry &e) {
+        if (t.from == f.size() && seen + e.rows > cnt - take) { t.from = e.start; t.skip = cnt - take - seen; }
+        seen += e.rows;
+      });
+#else
+      t.from = 0;
+      _scan_lines_reverse(f, 0, f.size(),
+        [&](const char *ln, size_t len, uint32_t lnStart) {
+          if (_is_header_line(ln, len)) return true;
+          t.from = lnStart;
+          return ++t.rows < maxRows;
+        });
+#endif
+      f.close();
+    }
+    if (t.rows >= maxRows) break;
+    ym = _part_prev(ym);  // предыдущая партиция — по каталогу
+  }
+}
+
+// Записи хвоста по возрастанию времени: cb(const LogRecord&)
+template <typename F>
+static void _tail_for_each(const LogTail &t, F cb) {
+  for (int k = t.nc - 1; k >= 0; k--) {
+    LogPart p;
+    _part_make(t.chain[k], p);
+    File f = _fs_open_read(p.log);
+    if (!f) continue;
+    uint32_t drop = (k == t.nc - 1) ? t.skip : 0;
+    _read_records(f, (k == t.nc - 1) ? t.from : 0, f.size(),
+      [&](const LogRecord &r, uint32_t, uint32_t) {
+        if (drop > 0) { drop--; return true; }
+        cb(r);
+        return true;
+      });
+    f.close();
+  }
+}
+
+// ─── Последние записи JSON-массивом для графика/экспорта ─────────────────
+// Строки пишутся в out по мере чтения хвоста — ответ в heap не собирается
+size_t log_stream_json_tail(Stream &out, int maxRows) {
+  // Хвост читается в обработчике целиком — число строк ограничено
+#if defined(ESP8266)
+  if (maxRows > 50) maxRows = 50;
+#else
+  if (maxRows > 200) maxRows = 200;
+#endif
+  size_t count = 0;
+  out.print('[');
+  if (log_exists() && maxRows > 0) {
+    LogTail tl;
+    _tail_locate(maxRows, tl);
+    _tail_for_each(tl, [&](const LogRecord &r) {
+      char row[96];
+      if (count) out.print(',');
+      out.write((const uint8_t*)row, _format_record_json(r, row, sizeof(row)));
+      count++;
+    });
+  }
+  out.print(']');
+  return count;
+}
+
+// ─── Прореживание LTTB для графиков за диапазон дат ──────────────────────
+// Число записей в [fromTs, toTs] (границы — начала суток): партиции — по индексу
+// дат без чтения лога, свёрнутые месяцы — по своим небольшим файлам
+static uint32_t _range_count(uint32_t fromTs, uint32_t toTs) {
+  uint32_t fromDay = _ts_day(fromTs), toDay = _ts_day(toTs), n = 0;
+  _q_for_each_month(fromDay / 100, toDay / 100, [&](uint32_t, const char *path) {
+    _q_for_each(path, fromTs, toTs, [&](const LogQRec &) { n++; });
+  });
+  _wb_flush();
+  _part_for_each(fromTs, toTs, [&](const LogPart &p) {
+    _idx_for_each(p, [&](const LogIdxEntry &e) {
+      if (e.day >= fromDay && e.day <= toDay) n += e.rows;
+    });
+  });
+  return n;
+}
+
+// Классический LTTB: записи между первой и последней делятся на points-2
+// корзины поровну (число записей — по индексу). Проход 1 — среднее время и вес
+// каждой корзины; проход 2 — в каждой корзине выбирается запись с наибольшей
+// площадью треугольника (выбранная точка прошлой корзины, запись, среднее
+// следующей) и сразу выдаётся. Первая и последняя запись — всегда.
+// Проходы идут курсором лога порциями (log_points_step).
+enum { POINTS_ALL, POINTS_AVG, POINTS_PICK, POINTS_END };
+
+// Корзина записи n (1 … total-2); первая и последняя — вне корзин
+static uint16_t _lttb_bucket(const LogPoints &p, uint32_t n) {
+  return (uint16_t)((uint64_t)(n - 1) * p.nb / (p.total - 2));
+}
+
+static uint32_t _lttb_size(const LogPoints &p, uint16_t i) {
+  return (uint32_t)(((uint64_t)(i + 1) * (p.total - 2) + p.nb - 1) / p.nb -
+                    ((uint64_t)i * (p.total - 2) + p.nb - 1) / p.nb);
+}
+
+// Точка ответа: JSON — сразу в out, двоичный — в столбцы mem (уходят в конце)
+static void _points_put(LogPoints &p, Stream &out, const LogRecord &r) {
+  if (!p.bin) {
+    char row[96];
+    if (p.n) out.print(',');
+    out.write((const uint8_t*)row, _format_record_json(r, row, sizeof(row)));
+    p.n++;
+    return;
+  }
+  if (!p.mem || p.n >= p.cap) return;
+  uint32_t *ts = (uint32_t*)p.mem;
+  int16_t  *w  = (int16_t*)(p.mem + p.cap * 4);
+  int16_t  *t  = (int16_t*)(p.mem + p.cap * 6);
+  uint16_t *b  = (uint16_t*)(p.mem + p.cap * 8);
+  float wv = roundf(r.weight * 100.0f);
+  ts[p.n] = r.ts;
+  w[p.n]  = (int16_t)(wv > 32767.0f ? 32767 : wv < -32767.0f ? -32767 : wv);
+  t[p.n]  = (isnan(r.tempC) || r.tempC <= -90.0f) ? LOG_BIN_NODATA : (int16_t)roundf(r.tempC * 10.0f);
+  b[p.n]  = (isnan(r.batV) || r.batV <= 0.0f) ? 0 : (uint16_t)roundf(r.batV * 1000.0f);
+  p.n++;
+}
+
+bool log_points_begin(LogPoints &p, Stream &out, const String &from, const String &to,
+                      uint16_t points, bool bin) {
+  memset(&p, 0, sizeof(p));
+  p.bin  = bin;
+  p.pass = POINTS_END;
+  if (points > LOG_LTTB_MAX) points = LOG_LTTB_MAX;
+  if (bin) {
+    // Точки собираются в четыре массива одного блока памяти
+    p.cap = points ? points : 1;
+    p.mem = (uint8_t*)malloc((size_t)p.cap * 10);
+    if (!p.mem) return false;
+    if (from.length() == 0 && to.length() == 0) {
+      LogTail tl;
+      _tail_locate(p.cap, tl);
+      _tail_for_each(tl, [&](const LogRecord &r) { _points_put(p, out, r); });
+      return true;
+    }
+  } else {
+    out.print('[');
+  }
+  uint32_t fromDay = _day_key(from.c_str(), from.length());
+  uint32_t toDay   = _day_key(to.c_str(), to.length());
+  if (!log_exists() || fromDay == 0 || toDay == 0 || fromDay > toDay) return false;
+  if (points < 3) points = 3;
+  p.t0    = _dt_to_ts("", 0, fromDay);
+  p.total = _range_count(p.t0, _dt_to_ts("", 0, toDay) + 86399UL);
+  _cursor_init(p.c, fromDay, toDay);
+  if (p.total <= points) {
+    p.pass = POINTS_ALL;
+    return true;
+  }
+  p.nb   = points - 2;
+  p.avgX = (float*)calloc(p.nb, sizeof(float));  // время от t0, с
+  p.avgY = (float*)calloc(p.nb, sizeof(float));  // вес
+  if (!p.avgX || !p.avgY) return false;
+  p.bestArea = -1;
+  p.bucket   = -1;
+  p.pass     = POINTS_AVG;
+  return true;
+}
+
+bool log_points_step(LogPoints &p, Stream &out, uint16_t rows) {
+  if (p.pass != POINTS_END) {
+    _cursor_each(p.c, rows, [&](const LogRecord &r, const LogQRec *) {
+      uint32_t n = p.k++;
+      if (p.pass == POINTS_ALL) { _points_put(p, out, r); return; }
+      if (n >= p.total) return;                   // дописано после подсчёта
+      if (p.pass == POINTS_AVG) {
+        p.last = r;
+        if (n == 0 || n + 1 == p.total) return;
+        uint16_t i = _lttb_bucket(p, n);
+        p.avgX[i] += (float)(r.ts - p.t0);
+        p.avgY[i] += r.weight;
+        return;
+      }
+      if (n == 0) { _points_put(p, out, r); p.a = r; return; }
+      if (n + 1 == p.total) return;               // последняя — после прохода
+      int i = _lttb_bucket(p, n);
+      if (i != p.bucket) {
+        if (p.bestArea >= 0) { _points_put(p, out, p.best); p.a = p.best; }
+        p.bucket   = i;
+        p.bestArea = -1;
+      }
+      float cx = (i + 1 < p.nb) ? p.avgX[i + 1] : (float)(p.last.ts - p.t0);
+      float cy = (i + 1 < p.nb) ? p.avgY[i + 1] : p.last.weight;
+      float ax = (float)(p.a.ts - p.t0), bx = (float)(r.ts - p.t0);
+      float area = fabsf((ax - cx) * (r.weight - p.a.weight) - (ax - bx) * (cy - p.a.weight));
+      if (area > p.bestArea) { p.bestArea = area; p.best = r; }
+    });
+    if (!p.c.done) return false;
+    if (p.pass == POINTS_AVG) {
+      for (uint16_t i = 0; i < p.nb; i++) {
+        uint32_t sz = _lttb_size(p, i);
+        if (sz) { p.avgX[i] /= sz; p.avgY[i] /= sz; }
+      }
+      _cursor_init(p.c, p.c.fromDay, p.c.toDay);
+      p.k    = 0;
+      p.pass = POINTS_PICK;
+      return false;
+    }
+    if (p.pass == POINTS_PICK) {
+      if (p.bestArea >= 0) _points_put(p, out, p.best);
+      _points_put(p, out, p.last);
+    }
+    p.pass = POINTS_END;
+  }
+
+  if (!p.bin) {
+    out.print(']');
+  } else {
+    // ESP8266 — little-endian, поэтому массивы пишутся как лежат в памяти
+    out.write((const uint8_t*)&p.n, 4);
+    if (p.n > 0) {
+      out.write(p.mem, p.n * 4);
+      out.write(p.mem + p.cap * 4, p.n * 2);
+      out.write(p.mem + p.cap * 6, p.n * 2);
+      out.write(p.mem + p.cap * 8, p.n * 2);
+    }
+  }
+  log_points_end(p);
+  return true;
+}
+
+void log_points_end(LogPoints &p) {
+  free(p.avgX);
+  free(p.avgY);
+  free(p.mem);
+  p.avgX = p.avgY = nullptr;
+  p.mem  = nullptr;
+}
+
+size_t log_stream_json_lttb(Stream &out, const String &from, const String &to, uint16_t points) {
+  LogPoints p;
+  log_points_begin(p, out, from, to, points, false);
+  while (!log_points_step(p, out, 64)) {}
+  return p.n;
+}
+
+// ─── Столбцы для графиков (двоичный ответ) ───────────────────────────────
+// Точки уходят четырьмя столбцами — в браузере каждый читается как
+// типизированный массив без разбора
+size_t log_stream_bin(Stream &out, const String &from, const String &to, uint16_t points) {
+  LogPoints p;
+  log_points_begin(p, out, from, to, points, true);
+  while (!log_points_step(p, out, 64)) {}
+  return p.n;
+}
+
+// ─── Экспорт диапазона дат одним ZIP-архивом ─────────────────────────────
+// Записи идут по возрастанию времени, поэтому смена даты — начало нового файла
+static bool _zip_day(uint32_t day, void *zip) {
+  ZipStream &z = *(ZipStream*)zip;
+  if (!z.open(day, ".csv")) return false;  // каталог полон — дальше не пишем
+  z.print(CSV_HEADER);
+  return true;
+}
+
+bool log_export_begin(LogCursor &c, ZipStream &zip, const String &from, const String &to, bool deflate) {
+  if (!log_cursor_begin(c, from, to) || c.fromDay == 0) { c.done = true; return false; }
+  int32_t days = _day_number(c.toDay) - _day_number(c.fromDay) + 1;
+  if (days > LOG_EXPORT_MAX_DAYS) days = LOG_EXPORT_MAX_DAYS;
+  if (!zip.begin((uint16_t)days, deflate)) { c.done = true; return false; }
+  c.onDay = _zip_day;
+  c.ctx   = &zip;
+  return true;
+}
+
+size_t log_export_zip(Stream &out, const String &from, const String &to, bool deflate) {
+  ZipStream zip(out);
+  LogCursor c;
+  if (log_export_begin(c, zip, from, to, deflate)) {
+    while (!c.done) log_cursor_csv(c, zip, 64);
+  }
+  zip.finish();  // без файлов — пустой, но корректный архив
+  return zip.files();
+}
+
+// ─── Инкрементальная выгрузка по курсору ─────────────────────────────────
+// Курсор — "YYYYMM.смещение[.n]": партиция, конец последней отданной записи в
+// её файле и n — сколько строк буфера записи после этого конца уже отдано.
+// Записи только дописываются, поэтому всё после смещения — новое. Буфер
+// не сбрасывается: его строки лягут в файл ровно с конца файла, и после
+// сброса первые n записей за смещением пропускаются.
+
+// Размер файла партиции; 0 — файла (ещё) нет
+static uint32_t _since_size(uint32_t ym) {
+  LogPart p;
+  _part_make(ym, p);
+  File f = _fs_open_read(p.log);
+  if (!f) return 0;
+  uint32_t n = f.size();
+  f.close();
+  return n;
+}
+
+static void _since_row(LogSince &s, Stream &out, const LogRecord &r) {
+  char row[96];
+  if (s.count) out.print(',');
+  out.write((const uint8_t*)row, _format_record_json(r, row, sizeof(row)));
+  s.count++;
+}
+
+// Строки буфера записи начиная с s.pend, пока s.count < lim
+static void _since_pending(LogSince &s, Stream &out, uint32_t lim) {
+  uint16_t pos = 0;
+  uint8_t i = 0;
+  for (; i < _wbRows; pos += _wbRowLen[i++]) {
+    if (i < s.pend) continue;
+    if (s.count >= lim) break;
+    LogRecord r;
+    if (_wb_decode(_wbBuf + pos, _wbRowLen[i], r)) _since_row(s, out, r);
+  }
+  if (i > s.pend) s.pend = i;
+}
+
+void log_since_begin(LogSince &s, Stream &out, const String &cursor, uint16_t maxRows) {
+  memset(&s, 0, sizeof(s));
+  s.maxRows = (maxRows < 1) ? 1 : (maxRows > LOG_SINCE_MAX) ? LOG_SINCE_MAX : maxRows;
+  s.done = true;
+  out.print(F("{\"rows\":["));
+  if (!log_exists()) return;
+  int dot = cursor.indexOf('.');
+  if (cursor == "end") {
+    // Только текущий конец лога (с буфером записи) — точка отсчёта для следующих запросов
+    s.ym   = (_wbRows > 0) ? _wbYm : _cur.ym;
+    s.off  = _since_size(s.ym);
+    s.pend = _wbRows;
+    return;
+  }
+  if (cursor.length() > 0) {
+    s.ym  = (dot == 6) ? (uint32_t)cursor.substring(0, 6).toInt() : 0;
+    s.off = (dot == 6) ? (uint32_t)cursor.substring(7).toInt() : 0;
+    int dot2 = (dot == 6) ? cursor.indexOf('.', 7) : -1;
+    long pend = (dot2 > 0) ? cursor.substring(dot2 + 1).toInt() : 0;
+    s.pend = (pend < 0) ? 0 : (pend > LOG_WB_MAX_ROWS) ? LOG_WB_MAX_ROWS : (uint8_t)pend;
+    LogPart p;
+    if (s.ym != 0) _part_make(s.ym, p);
+    File f = (s.ym != 0) ? _fs_open_read(p.log) : File();
+    if (!f) {
+      // Партиция пока только в буфере записи — файл появится при сбросе
+      if (s.ym != 0 && s.ym == _wbYm && _wbRows > 0 && s.off == 0) { s.done = false; return; }
+      // Месяц свёрнут в .q15 — с начала следующей партиции
+      // (ym == 0: курсор пустого лога или чужой — с самой старой)
+      s.reset = (s.ym != 0);
+      s.ym = _part_next(s.ym);
+      s.off = 0;
+      s.pend = 0;
+    } else {
+      if (s.off > f.size()) { s.reset = true; s.ym = _part_next(0); s.off = 0; s.pend = 0; }  // лог очищен
+      f.close();
+    }
+  } else {
+    s.ym = _part_next(0);  // без курсора — вся история с самой старой партиции
+  }
+  s.done = (s.ym == 0);
+}
+
+bool log_since_step(LogSince &s, Stream &out, uint16_t rows) {
+  if (!s.done) {
+    uint32_t lim = (uint32_t)s.count + rows;
+    if (lim > s.maxRows) lim = s.maxRows;
+    bool inWb = (_wbRows > 0 && s.ym == _wbYm);
+    LogPart p;
+    _part_make(s.ym, p);
+    File f = _fs_open_read(p.log);
+    if (!f && !inWb) {
+      s.done = true;
+    } else {
+      uint32_t size = f ? f.size() : 0, last = s.off;
+      bool full = false;
+      // Обрыв только между записями (в сжатом формате — между кадрами)
+      if (f) {
+        _read_records(f, s.off, size, [&](const LogRecord &r, uint32_t rs, uint32_t re) {
+          if (s.count >= lim && rs >= last) { full = true; return false; }
+          if (s.pend) s.pend--;  // уже отдана из буфера, с тех пор сброшена
+          else _since_row(s, out, r);
+          last = re;
+          return true;
+        });
+        f.close();
+      }
+      if (full) {
+        s.off  = last;
+        s.done = (s.count >= s.maxRows);
+      } else if (inWb) {
+        // Хвост партиции — в буфере записи: отдаётся из RAM, без сброса на диск
+        s.off = size;
+        _since_pending(s, out, lim);
+        s.done = (s.pend >= _wbRows || s.count >= s.maxRows);
+      } else {
+        s.off  = size;
+        s.pend = 0;
+        uint32_t next = (s.ym == _cur.ym) ? 0 : _part_next(s.ym);
+        if (next == 0 && _wbRows > 0 && _wbYm > s.ym) next = _wbYm;  // новый месяц пока только в буфере
+        if (next == 0) s.done = true;
+        else { s.ym = next; s.off = 0; }
+      }
+    }
+    if (!s.done) return false;
+  }
+  char tail[72];
+  int n = snprintf(tail, sizeof(tail), "],\"next\":\"%06lu.%lu", (unsigned long)s.ym, (unsigned long)s.off);
+  if (s.pend) n += snprintf(tail + n, sizeof(tail) - n, ".%u", (unsigned)s.pend);
+  snprintf(tail + n, sizeof(tail) - n, "\",\"reset\":%s}", s.reset ? "true" : "false");
+  out.print(tail);
+  return true;
+}
+
+size_t log_stream_since(Stream &out, const String &cursor, uint16_t maxRows) {
+  LogSince s;
+  log_since_begin(s, out, cursor, maxRows);
+  while (!log_since_step(s, out, 64)) {}
+  return s.count;
 }
 
 // ─── Бэкап/восстановление настроек на SD/LittleFS ─────────────────────
 
-bool log_save_backup(const String &json) {
+bool log_save_backup(void (*gen)(Print &out)) {
   if (!_fs_ok()) return false;
   File f = _fs_open_write(BACKUP_FILE);
   if (!f) return false;
-  f.print(json);
+  gen(f);
   f.close();
   Serial.println(F("[Log] Backup saved to SD/FS"));
   return true;
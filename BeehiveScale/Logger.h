@@ -5,9 +5,48 @@
 
 // ─── Конфигурация логгера ─────────────────────────────────────────────────
 #define LOG_INTERVAL_MS    60000UL   // 1 минута между записями
-#define LOG_MAX_SIZE      102400UL   // 100 КБ — ротация (переименовать → log_old.csv)
+// Лог разбит по месяцам: LOG_DIR/YYYY/MM.csv (+ MM.idx — индекс дат партиции).
+// Смена месяца — просто новый файл (копирующей ротации больше нет),
+// чтение за дату открывает ровно одну партицию.
+#define LOG_DIR           "/logs"
+// Каталог партиций: месяц, время первой/последней записи, записей, размер.
+// Дополняется при смене месяца; пересобирается сам, если удалён или не совпадает.
+#define LOG_CAT_FILE      LOG_DIR "/catalog.bin"
+// Единый лог прежних версий и его архивы /log_YYMMDD_HHMM.csv:
+// при log_init() переносятся в партиции и удаляются
 #define LOG_FILE          "/log.csv"
-#define LOG_FILE_OLD      "/log_old.csv"
+// Суточные сводки (min/max/среднее, число точек) — по записи на день.
+// Не зависят от партиций лога; окно LOG_DAYS_MAX дней от первого дня.
+#define LOG_DAYS_FILE     "/days.bin"
+#define LOG_DAYS_MAX      3660       // ~10 сезонов (≈115 КБ) — суточный ярус
+// Ярусы хранения: минутные записи хранятся LOG_RAW_KEEP_DAYS дней, затем
+// партиция месяца сворачивается в 15-минутные min/max/среднее (LOG_DIR/YYYY/MM.q15),
+// они хранятся LOG_Q15_KEEP_DAYS дней; дальше остаются суточные сводки.
+// Сворачивание идёт в фоне из log_tick() (в режиме deep sleep не выполняется).
+#define LOG_RAW_KEEP_DAYS     31
+#define LOG_Q15_KEEP_DAYS     730
+#define LOG_COMPACT_SLICE     120      // записей лога за один шаг
+#define LOG_COMPACT_PERIOD_MS 1000UL   // пауза между шагами
+
+// Формат хранения лога. По умолчанию — CSV (файл открывается в Excel прямо с SD).
+// LOG_FORMAT_BINARY — записи фиксированной длины по 16 байт (время + вес/темп/влажн/
+// батарея в фиксированной точке + CRC): ~2.5× больше истории на мегабайт, чтение без
+// разбора текста, доступ к записи по номеру за O(1). CSV для /api/log собирается на лету.
+// Партиции — LOG_DIR/YYYY/MM.bin.
+//#define LOG_FORMAT_BINARY
+// LOG_FORMAT_PACKED — сжатые блоки по 4 КБ: время как дельта дельт, показания как
+// дельты в varint (~2–4 байта на запись против ~45 в CSV). Блок декодируется сам по
+// себе, чтение за дату трогает только свои блоки; сезон помещается даже в LittleFS.
+// Партиции — LOG_DIR/YYYY/MM.pak. Не совместим с LOG_FORMAT_BINARY.
+//#define LOG_FORMAT_PACKED
+#define LOG_BIN_FILE      "/log.bin"  // единый бинарный лог прежних версий
+
+// Буфер отложенной записи: строки копятся в RAM и пишутся в файл одним write()
+// при заполнении, по возрасту, при низком заряде и перед сном/перезагрузкой (log_flush).
+#define LOG_WB_BYTES       512       // один сектор SD
+#define LOG_WB_MAX_ROWS    8         // строк в буфере до принудительной записи
+#define LOG_WB_MAX_AGE_MS  600000UL  // 10 минут — дольше строка в RAM не лежит
+#define LOG_WB_LOW_BAT_PCT 20        // ниже — каждая строка пишется сразу
 
 // DS18B20 перенесён на GPIO3 (D9/RX) — конфликт с SPI MOSI устранён.
 #define USE_SD_CARD
@@ -18,21 +57,164 @@ bool   log_init();
 // batPct: процент заряда батареи; если < 5 — запись пропускается (защита от разряда)
 void   log_append(const String &datetime, float weight, float tempC,
                   float humidity, float batV, int batPct);
+// Записать буфер строк в файл. Вызывать перед deep sleep и ESP.restart()
+void   log_flush();
+// Из loop(): сброс буфера, если первая строка в нём старше LOG_WB_MAX_AGE_MS,
+// и шаг фонового сворачивания старых партиций
+void   log_tick();
 void   log_clear();
+// Суммарный размер всех партиций лога (байт)
 size_t log_size();
+// Отпечаток содержимого лога для ETag/Last-Modified: суммарный размер и время
+// последней записи (растёт с каждой дозаписью). Буфер строк сначала пишется
+// в файл. false — лога нет.
+bool   log_stamp(uint32_t &size, uint32_t &lastTs);
 bool   log_exists();
 // Свободное место на SD (байт); 0 если SD недоступна
 uint32_t log_free_space();
-// Парсит CSV и возвращает JSON-массив последних maxRows строк
-String   log_to_json(int maxRows = 200);
+// JSON-массив последних maxRows записей [{"dt":…,"w":…,"t":…,"h":…,"b":…}]
+// стримится в out. Возвращает число записей
+size_t   log_stream_json_tail(Stream &out, int maxRows = 200);
+// Точки графика за даты from..to (формат как у log_stream_csv_date), прореженные
+// до ~points по весу методом LTTB (Largest-Triangle-Three-Buckets); JSON-массив
+// как у log_stream_json_tail стримится в out. Два прохода по логу (число записей — по
+// индексу), в памяти — 8 байт на корзину (points ≤ LOG_LTTB_MAX). Возвращает число точек.
+#define LOG_LTTB_MAX 600
+size_t   log_stream_json_lttb(Stream &out, const String &from, const String &to, uint16_t points);
+// Те же точки столбцами little-endian: uint32 n, затем uint32 время[n] (секунды
+// RTC, местное время), int16 вес[n] (10 г), int16 темп[n] (0.1 °C, -32768 — нет
+// данных), uint16 батарея[n] (мВ) — ~10 байт на точку против ~80 в JSON.
+// Без from/to — последние points записей. points ≤ LOG_LTTB_MAX. Возвращает n.
+size_t   log_stream_bin(Stream &out, const String &from, const String &to, uint16_t points);
+// Записи, дописанные после курсора — для сборщиков и обновления графика за
+// O(новых строк). Курсор непрозрачен ("YYYYMM.смещение[.n]" — партиция, байт
+// в её файле и число уже отданных строк буфера записи); пусто — вся история
+// с начала, "end" — только текущий конец. Буфер записи не сбрасывается.
+// В out: {"rows":[… как у log_stream_json_tail],"next":"курсор","reset":false}; не более
+// maxRows записей, остальное — следующим вызовом с next. reset:true — курсор
+// устарел (лог очищен или месяц свёрнут), выдача продолжена с ближайшей партиции.
+#define LOG_SINCE_MAX 500
+size_t   log_stream_since(Stream &out, const String &cursor, uint16_t maxRows);
+// Та же выдача порциями (неблокирующая отдача в WebServerModule): begin пишет
+// начало ответа, step — следующие ~rows записей; true — ответ дописан целиком
+// (после этого step не вызывать)
+struct LogSince {
+  uint32_t ym, off;         // следующая запись: партиция и смещение в её файле
+  uint16_t maxRows, count;
+  uint8_t  pend;            // строк буфера записи за off, уже отданных
+  bool     reset, done;
+};
+void     log_since_begin(LogSince &s, Stream &out, const String &cursor, uint16_t maxRows);
+bool     log_since_step(LogSince &s, Stream &out, uint16_t rows);
 // Стримит CSV только за указанную дату (формат: "DD.MM.YYYY") прямо в поток
-// Возвращает кол-во строк; если date пустая — возвращает весь файл
+// Возвращает кол-во строк; если date пустая — все партиции по порядку
 size_t   log_stream_csv_date(Stream &out, const String &date);
+// То же за диапазон дат from..to включительно; партиции выбираются по каталогу
+size_t   log_stream_csv_range(Stream &out, const String &from, const String &to);
+// Курсор выдачи CSV порциями (log_cursor_*): всё состояние — в нём, между
+// порциями лог может дописываться. Выдача — как у log_stream_csv_range, без заголовка
+struct LogCursor {
+  uint32_t fromDay, toDay;  // YYYYMMDD; 0 — весь лог
+  uint32_t ym;              // месяц текущего файла
+  uint32_t off, end;        // непрочитанный участок файла
+  uint32_t day;             // дата последней выданной строки
+  bool     q15;             // текущий файл — 15-минутный ярус
+  bool     done;
+  // Перед первой строкой каждой новой даты (ctx — свой); false — закончить выдачу
+  bool   (*onDay)(uint32_t day, void *ctx);
+  void    *ctx;
+};
+// Даты from..to (формат как у log_stream_csv_date; обе пустые — весь лог).
+// false — неверные даты или лога нет: курсор сразу done
+bool     log_cursor_begin(LogCursor &c, const String &from, const String &to);
+// Следующие ~maxRows строк в out (записи одного кадра сжатого формата не
+// разрываются). Возвращает число строк; конец выдачи — c.done
+size_t   log_cursor_csv(LogCursor &c, Stream &out, uint16_t maxRows);
+// Заголовок CSV (с BOM для Excel)
+const char *log_csv_header();
+// Даты from..to одним ZIP-архивом: файл YYYY-MM-DD.csv на каждый день с данными
+// (формат как у /api/log), за один последовательный проход по ярусам лога.
+// deflate — сжимать файлы; не более LOG_EXPORT_MAX_DAYS файлов (каталог архива
+// в RAM — 24 байта на файл), дальше архив обрезается. Возвращает число файлов.
+#define LOG_EXPORT_MAX_DAYS 400
+size_t   log_export_zip(Stream &out, const String &from, const String &to, bool deflate);
+// То же порциями: zip.begin() и курсор c, который пишет файлы архива через
+// log_cursor_csv(c, zip, …); после c.done — zip.finish(). false — выдавать нечего
+class ZipStream;
+bool     log_export_begin(LogCursor &c, ZipStream &zip, const String &from, const String &to, bool deflate);
+// Агрегаты одного поля по интервалам bucketSec (начала кратны bucketSec) за даты
+// from..to включительно (формат как у log_stream_csv_date). Один проход по ярусам
+// лога — суточные сводки, 15-минутные записи, минутные — с постоянной памятью.
+// В out — JSON-массив [{"dt":…,"min":…,"max":…,"mean":…,"n":…}] только с полями
+// из aggMask (LOG_AGG_*). Возвращает число интервалов.
+enum LogField { LOG_FIELD_WEIGHT, LOG_FIELD_TEMP, LOG_FIELD_HUM, LOG_FIELD_BAT };
+#define LOG_AGG_MIN    0x01
+#define LOG_AGG_MAX    0x02
+#define LOG_AGG_MEAN   0x04
+#define LOG_AGG_COUNT  0x08
+size_t   log_query(Stream &out, LogField field, const String &from, const String &to,
+                   uint32_t bucketSec, uint8_t aggMask);
+// Тот же запрос порциями — как log_since_begin/step; между порциями лог может
+// дописываться
+struct LogQuery {
+  LogCursor c;              // записи и 15-минутные сводки до суточных
+  LogField  field;
+  uint8_t   agg, phase;
+  bool      daily;          // интервал кратен суткам — закрытые дни из сводок
+  uint32_t  fromDay, toDay, bucket;
+  uint32_t  dOff;           // следующая суточная сводка в файле; 0 — не читать
+  uint32_t  cur, n;         // открытый интервал: начало и число записей
+  float     mn, mx;
+  double    sum;
+  size_t    count;
+};
+void     log_query_begin(LogQuery &q, Stream &out, LogField field, const String &from,
+                         const String &to, uint32_t bucketSec, uint8_t aggMask);
+bool     log_query_step(LogQuery &q, Stream &out, uint16_t rows);
+// Одна запись лога в разобранном виде (общая для CSV и бинарного формата)
+struct LogRecord {
+  uint32_t ts;        // секунды с 01.01.1970 по времени RTC
+  float    weight;    // кг
+  float    tempC;     // °C; ≤ -90 — датчик не ответил
+  float    humidity;  // %;  ≤ -90 — нет данных
+  float    batV;      // В
+};
+// Точки log_stream_json_lttb (bin = false) или log_stream_bin (bin = true)
+// порциями — как log_since_begin/step: каждый проход LTTB идёт курсором лога.
+// false из begin — выдавать нечего (step допишет пустой ответ). Память
+// освобождает последний step, при обрыве выдачи — log_points_end
+struct LogPoints {
+  LogCursor c;
+  LogRecord a, best, last;  // выбранная точка прошлой корзины, кандидат, последняя запись
+  float    *avgX, *avgY;    // средние корзин: время от t0, вес
+  uint8_t  *mem;            // bin: столбцы точек, уходят в конце
+  uint32_t  t0, total, k, n;  // k — номер записи в проходе, n — выдано точек
+  float     bestArea;
+  int32_t   bucket;         // корзина кандидата best
+  uint16_t  nb, cap;        // корзин LTTB; точек в mem
+  uint8_t   pass;
+  bool      bin;
+};
+bool     log_points_begin(LogPoints &p, Stream &out, const String &from, const String &to,
+                          uint16_t points, bool bin);
+bool     log_points_step(LogPoints &p, Stream &out, uint16_t rows);
+void     log_points_end(LogPoints &p);
+// Кол-во записей в текущей (последней) партиции лога
+uint32_t log_record_count();
+// Запись по номеру (0 — самая старая). В бинарном формате — одно чтение
+bool     log_read_record(uint32_t index, LogRecord &rec);
 // Первая дата в логе (DD.MM.YYYY) — для подсчёта дней наблюдений
 bool     log_first_date(char *buf, size_t bufLen);
-// Суточная статистика: min/max вес и температура за сегодня
+// Дата "DD.MM.YYYY" или "YYYY-MM-DD" → ключ YYYYMMDD (ключи сравниваются как
+// даты); 0 — не дата
+uint32_t log_day_key(const String &date);
+// Номер дня для ключа YYYYMMDD (days_from_civil): разность — число суток между датами
+int32_t  log_day_number(uint32_t day);
+// Суточная статистика: min/max/среднее вес и температура за день.
+// Текущий день считается в RAM, прошедшие читаются из LOG_DAYS_FILE.
 struct DayStat {
   float wMin, wMax, tMin, tMax;
+  float wAvg, tAvg;
   int   count;
   bool  valid;
 };
@@ -44,8 +226,9 @@ bool     log_fs_ok();
 
 // ─── Бэкап настроек на SD/LittleFS ─────────────────────────────────────
 #define BACKUP_FILE "/backup.json"
-// Сохраняет JSON-бэкап всех EEPROM-настроек на SD/LittleFS
-bool     log_save_backup(const String &json);
+// Сохраняет JSON-бэкап всех EEPROM-настроек на SD/LittleFS: gen пишет его
+// прямо в файл (без копии в heap)
+bool     log_save_backup(void (*gen)(Print &out));
 // Читает JSON-бэкап из файла; пустая строка при ошибке
 String   log_read_backup();
 
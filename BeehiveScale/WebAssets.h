@@ -0,0 +1,1464 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// Сгенерировано tools/gen_web_assets.py из BeehiveScale/web/ — не править вручную.
+// Файлы веб-интерфейса сжаты gzip; etag — хэш несжатого содержимого.
+
+#include <Arduino.h>
+
+struct WebAsset {
+  const char    *path;       // URL (без ?v=)
+  const char    *type;       // Content-Type
+  const uint8_t *gz;         // содержимое в gzip (PROGMEM)
+  uint32_t       len;        // длина gz
+  const char    *etag;       // "хэш" в кавычках, как в заголовке
+  bool           immutable;  // версия в URL — кэшировать без перепроверки
+};
+
+// app.css: 10241 байт, в gzip 2711
+static const uint8_t WEB_APP_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x5a, 0xdd, 0x8e, 0xa4, 0xba,
+  0x11, 0xbe, 0x9f, 0xa7, 0x40, 0x1a, 0xad, 0x76, 0x7a, 0xd5, 0xf4, 0x02, 0xfd, 0x0f, 0x8a, 0x94,
+  0x68, 0x95, 0x48, 0xe7, 0x26, 0x3a, 0x17, 0x91, 0x92, 0x28, 0x3a, 0x17, 0x06, 0x4c, 0xb7, 0x33,
+  0x34, 0x20, 0x9b, 0x9e, 0x9e, 0x59, 0xd4, 0x52, 0x1e, 0x22, 0x4f, 0x98, 0x27, 0x49, 0xf9, 0x0f,
+  0x0c, 0x98, 0x9e, 0x9e, 0x89, 0x14, 0xe9, 0xfc, 0x0c, 0x86, 0x2a, 0xdb, 0xe5, 0xaa, 0xaf, 0xbe,
+  0x2a, 0xf7, 0xb7, 0x26, 0x2e, 0x5f, 0x5d, 0x46, 0x7e, 0x92, 0xe2, 0x10, 0xc6, 0x25, 0x4d, 0x31,
+  0x75, 0x61, 0x24, 0x3a, 0x21, 0x7a, 0x20, 0x45, 0xe8, 0x45, 0x15, 0x4a, 0x53, 0xfe, 0xce, 0xbb,
+  0x3e, 0x84, 0xb4, 0x2c, 0xeb, 0xe6, 0xc1, 0x71, 0x5c, 0x37, 0x3e, 0x84, 0x8f, 0x5e, 0xea, 0x65,
+  0x5e, 0x1c, 0xb9, 0x6e, 0x85, 0x0a, 0x9c, 0x87, 0x8f, 0xfe, 0xca, 0xdf, 0xfa, 0x1e, 0x3c, 0x4b,
+  0x35, 0xe1, 0x63, 0x80, 0x97, 0xbb, 0x60, 0x1f, 0x09, 0x01, 0x74, 0x8a, 0xf9, 0x50, 0xb6, 0x46,
+  0x9b, 0x60, 0x19, 0xa9, 0xe7, 0x00, 0x06, 0xb2, 0xd4, 0xdf, 0x6c, 0x60, 0xe0, 0x40, 0x31, 0x2e,
+  0xc2, 0xc7, 0x4d, 0x96, 0x64, 0xfb, 0xad, 0x94, 0xa1, 0x38, 0x0d, 0x1f, 0x71, 0xbc, 0xde, 0xae,
+  0xb7, 0x5c, 0x6b, 0x7e, 0xc6, 0xe1, 0xe3, 0x7a, 0x93, 0x24, 0x59, 0x00, 0x8f, 0x35, 0x7e, 0xad,
+  0xc3, 0xc7, 0x64, 0x97, 0xae, 0xe2, 0x9d, 0x7a, 0x04, 0x75, 0x3b, 0xb4, 0xc7, 0x5b, 0xfd, 0xbc,
+  0x84, 0xcf, 0xbd, 0x8d, 0xb7, 0xf2, 0xa4, 0xba, 0x53, 0x59, 0x94, 0xe1, 0xd7, 0x1f, 0xe5, 0x99,
+  0x12, 0x4c, 0x9d, 0x3f, 0xe3, 0xcb, 0xd7, 0x39, 0x1f, 0x62, 0x15, 0x4a, 0x70, 0xf4, 0x70, 0x7d,
+  0x88, 0xcb, 0xf4, 0xad, 0x89, 0x51, 0xf2, 0x7c, 0xa0, 0xe5, 0xb9, 0x48, 0xc3, 0x17, 0x44, 0x9f,
+  0xf8, 0x4e, 0x67, 0x51, 0x52, 0xe6, 0x25, 0x55, 0xcf, 0x5c, 0xf1, 0x2c, 0xca, 0xca, 0xa2, 0x76,
+  0x33, 0x74, 0x22, 0xf9, 0x9b, 0x1a, 0xe7, 0xaa, 0xd4, 0x38, 0x58, 0x13, 0x87, 0xfe, 0xba, 0x02,
+  0x2b, 0x92, 0xc2, 0x3d, 0x62, 0x72, 0x38, 0xd6, 0xa1, 0xef, 0x79, 0x2f, 0xc7, 0xeb, 0x03, 0x6a,
+  0x4c, 0x65, 0xc2, 0x0a, 0xb3, 0x88, 0xeb, 0x74, 0x53, 0x9c, 0x94, 0x14, 0xd5, 0xa4, 0x2c, 0xc2,
+  0xa2, 0x2c, 0xf0, 0xf5, 0xe1, 0x61, 0x41, 0x71, 0x46, 0x31, 0x3b, 0xba, 0x31, 0xa2, 0x8d, 0x52,
+  0x13, 0x80, 0xd6, 0xf1, 0x1a, 0x85, 0xc1, 0x67, 0x51, 0x55, 0x32, 0x22, 0x14, 0x64, 0xe4, 0x15,
+  0xa7, 0x51, 0x5d, 0x56, 0x70, 0x80, 0x39, 0xce, 0x6a, 0xf8, 0x1f, 0x15, 0xe2, 0x5e, 0xf4, 0xd3,
+  0x25, 0x45, 0x8a, 0x5f, 0xc3, 0xc0, 0x83, 0x13, 0x6d, 0x67, 0xc8, 0x48, 0x9e, 0x37, 0xdd, 0x4a,
+  0xbf, 0x8c, 0xe7, 0xd0, 0x4b, 0xa5, 0xa8, 0x50, 0x93, 0x5c, 0x48, 0x5a, 0x1f, 0x1d, 0x6f, 0xb1,
+  0x66, 0x4e, 0x4e, 0x0a, 0x8c, 0x28, 0x5f, 0xf2, 0x31, 0xa5, 0xa6, 0x0d, 0xe9, 0x21, 0x46, 0x4f,
+  0x81, 0x37, 0x0f, 0x96, 0x73, 0x7f, 0x33, 0x5f, 0xec, 0xb7, 0xb3, 0xa8, 0x75, 0xb2, 0xba, 0x2e,
+  0x4f, 0xa1, 0x5f, 0xbd, 0x3a, 0xac, 0xcc, 0x49, 0xea, 0x0c, 0xb6, 0xa2, 0xdc, 0x6e, 0x07, 0xef,
+  0x83, 0x15, 0x6c, 0xba, 0xdd, 0x1b, 0xab, 0x49, 0xf2, 0xfc, 0xa6, 0x36, 0xa7, 0x77, 0xb3, 0xdf,
+  0x9b, 0xb6, 0x5e, 0x73, 0x2b, 0xa5, 0x84, 0x55, 0x39, 0x7a, 0x0b, 0xb3, 0x1c, 0xbf, 0x46, 0x28,
+  0x27, 0x87, 0xc2, 0x25, 0x35, 0x3e, 0xb1, 0x30, 0xc1, 0x45, 0x8d, 0x69, 0xf4, 0xcf, 0x33, 0x68,
+  0xca, 0xde, 0xdc, 0x04, 0x8e, 0x0c, 0x46, 0xd4, 0xf0, 0x55, 0x6c, 0x01, 0xb4, 0x16, 0x98, 0x36,
+  0x3d, 0x15, 0xfc, 0x3f, 0x6e, 0x4a, 0x28, 0x4e, 0xc4, 0x32, 0xe0, 0x18, 0xcf, 0xa7, 0xc2, 0xa6,
+  0xf8, 0x80, 0xf8, 0xca, 0xda, 0xf5, 0x52, 0x9c, 0xc3, 0xa9, 0xbe, 0xe0, 0x76, 0xad, 0xbe, 0x9a,
+  0x23, 0x2f, 0x0f, 0x65, 0x63, 0x38, 0x0c, 0x6c, 0x55, 0xfa, 0xcf, 0x45, 0xee, 0x62, 0xeb, 0xf1,
+  0xc3, 0xab, 0x41, 0xa5, 0xcb, 0x7d, 0x94, 0x5b, 0x63, 0x09, 0x9f, 0x4c, 0xf9, 0x8f, 0x58, 0x49,
+  0x7f, 0x17, 0xec, 0x1c, 0x9b, 0x13, 0x78, 0x03, 0x69, 0x11, 0x23, 0xb3, 0xe1, 0x1c, 0x60, 0x3b,
+  0x25, 0x2e, 0x5c, 0xa6, 0x69, 0x37, 0x82, 0x62, 0x38, 0xa8, 0x73, 0x8d, 0xa5, 0x47, 0x6d, 0x82,
+  0x2f, 0xe2, 0x0c, 0xd6, 0xe0, 0x2c, 0xc2, 0x29, 0xb2, 0x92, 0x9e, 0x42, 0xf1, 0x17, 0xec, 0x17,
+  0xff, 0xfd, 0xc9, 0x85, 0x37, 0x33, 0x1e, 0x79, 0xef, 0x1d, 0x04, 0xb7, 0x97, 0xbf, 0xd2, 0x9b,
+  0x97, 0x4b, 0x5d, 0x5a, 0x97, 0x0a, 0xeb, 0xca, 0xc1, 0x92, 0xed, 0xb9, 0x90, 0x82, 0x3b, 0x1e,
+  0x20, 0x43, 0x99, 0x3c, 0x47, 0xc2, 0x1d, 0xc3, 0x2d, 0x08, 0x2a, 0x2f, 0xe0, 0x7f, 0x2a, 0x67,
+  0xa3, 0x28, 0x25, 0x67, 0x26, 0xd6, 0x0a, 0x0b, 0x1a, 0xf9, 0xb6, 0xc0, 0x1e, 0xee, 0x99, 0x80,
+  0x84, 0x47, 0x94, 0x96, 0x97, 0xd0, 0x73, 0x3c, 0x07, 0x02, 0xd8, 0xe9, 0xbd, 0x47, 0x05, 0x39,
+  0xc9, 0x00, 0xad, 0xce, 0x39, 0xc3, 0x4e, 0xc0, 0x1c, 0x52, 0x64, 0xa4, 0x80, 0xdd, 0x28, 0xbc,
+  0x94, 0x26, 0x0b, 0xd7, 0xdc, 0x84, 0xbf, 0x7f, 0xc6, 0x6f, 0x19, 0x45, 0x27, 0xcc, 0x1c, 0xf1,
+  0x79, 0xe3, 0x7d, 0x99, 0xf3, 0xd0, 0x6a, 0x4a, 0x6e, 0xe8, 0xfa, 0x0d, 0xfc, 0x60, 0x6d, 0x3c,
+  0x2d, 0x96, 0x57, 0x1e, 0x3f, 0x35, 0x58, 0xb9, 0xef, 0x77, 0xf7, 0xc5, 0x4b, 0x7f, 0x5b, 0xc3,
+  0xb0, 0x9b, 0x59, 0xc3, 0x47, 0x84, 0x49, 0x1b, 0x41, 0xbb, 0xa8, 0x7c, 0xc1, 0x34, 0xcb, 0xcb,
+  0x8b, 0xfb, 0x1a, 0xa2, 0x73, 0x5d, 0x72, 0x9d, 0xf6, 0x20, 0x31, 0x93, 0x02, 0x5f, 0x71, 0xa3,
+  0x9f, 0xb9, 0x8b, 0x39, 0x9d, 0x23, 0x77, 0x67, 0x39, 0xf0, 0x31, 0xdf, 0xee, 0x89, 0x7c, 0x13,
+  0xbd, 0xdd, 0x06, 0xed, 0x6e, 0x85, 0x63, 0x55, 0x88, 0xc2, 0xfc, 0x51, 0x72, 0xa6, 0x0c, 0x44,
+  0xab, 0x92, 0x88, 0xc5, 0x5c, 0x8e, 0x70, 0x00, 0x42, 0x35, 0x06, 0xe4, 0xbc, 0x50, 0x54, 0xc9,
+  0x80, 0xe8, 0xbc, 0xf2, 0x5c, 0x55, 0x98, 0x26, 0x88, 0xe1, 0x81, 0x99, 0x38, 0xce, 0x6a, 0xfb,
+  0x72, 0x83, 0x98, 0xcf, 0xc2, 0xc9, 0xcd, 0x01, 0x79, 0xb4, 0x62, 0x64, 0x02, 0xfd, 0xa5, 0x31,
+  0xc2, 0x23, 0xb7, 0x63, 0x33, 0xdc, 0x5e, 0xa0, 0x5e, 0x2f, 0x50, 0xc2, 0xd1, 0xc0, 0x96, 0x06,
+  0x7a, 0x7b, 0x77, 0xc7, 0x1f, 0x70, 0xff, 0x60, 0x12, 0x7e, 0x5a, 0x17, 0x11, 0xeb, 0xd1, 0xe6,
+  0x0f, 0x3c, 0x8d, 0x96, 0x27, 0xf4, 0xea, 0xca, 0x80, 0xf0, 0xbd, 0x9d, 0x57, 0x75, 0xf9, 0xdc,
+  0x11, 0x27, 0xab, 0x5f, 0x79, 0x5f, 0xae, 0xad, 0x4a, 0xbd, 0x30, 0xad, 0x59, 0x44, 0x15, 0x9f,
+  0xf2, 0x40, 0x49, 0xda, 0x8e, 0xf2, 0x87, 0x88, 0xff, 0x07, 0x36, 0x75, 0xaa, 0x78, 0xa4, 0xbb,
+  0x12, 0x09, 0x59, 0xe8, 0x67, 0xd4, 0x81, 0x7f, 0x65, 0x3c, 0x4b, 0x14, 0x11, 0x1f, 0x2e, 0x3f,
+  0x20, 0xdc, 0x29, 0xf0, 0x3a, 0x05, 0x7c, 0xc9, 0xf7, 0xe8, 0xa0, 0xb8, 0xc2, 0xa8, 0x7e, 0xe2,
+  0x9f, 0x8b, 0x84, 0x36, 0x87, 0x94, 0x00, 0x86, 0x78, 0xf2, 0xb9, 0x05, 0xe6, 0xa0, 0x79, 0x36,
+  0x13, 0xba, 0x77, 0x22, 0x3c, 0x4f, 0x38, 0x25, 0xe8, 0xa9, 0x33, 0x14, 0xc0, 0x6d, 0xf5, 0x3a,
+  0x6b, 0xc4, 0x94, 0x73, 0xbd, 0xf2, 0xc9, 0xc5, 0x8a, 0x60, 0x4d, 0x10, 0x4d, 0xc7, 0x8c, 0x41,
+  0xd0, 0x21, 0x7d, 0x9a, 0xef, 0x26, 0x38, 0xbf, 0x97, 0xdc, 0xda, 0x64, 0xa1, 0x63, 0x31, 0x3c,
+  0x92, 0x34, 0xc5, 0xc5, 0x55, 0x4e, 0x16, 0x86, 0x31, 0x06, 0x8f, 0xe6, 0xde, 0x23, 0xe3, 0xf1,
+  0xeb, 0xd7, 0x68, 0x8c, 0xcf, 0xd6, 0xbc, 0x6f, 0xf0, 0x87, 0x7e, 0x10, 0xc8, 0xdc, 0x0d, 0x18,
+  0x07, 0x18, 0x09, 0x2a, 0x9f, 0xf6, 0x5e, 0x8a, 0x0f, 0x73, 0xd3, 0xef, 0xe6, 0x46, 0xf0, 0xcd,
+  0xd4, 0x4a, 0x16, 0x82, 0x8e, 0xe9, 0xe5, 0xdc, 0xa9, 0x8e, 0xcb, 0xd8, 0xb5, 0x49, 0xf6, 0xf7,
+  0x41, 0x75, 0x12, 0x96, 0xad, 0xfa, 0x38, 0x75, 0xfc, 0xa0, 0x36, 0x10, 0xb1, 0xeb, 0xca, 0xce,
+  0xc0, 0x8d, 0x84, 0x23, 0xc8, 0xf3, 0x0f, 0xfd, 0xef, 0xae, 0xaf, 0x5e, 0xba, 0x35, 0xa9, 0x73,
+  0x6c, 0x26, 0xd9, 0x60, 0x8c, 0x76, 0x81, 0x1d, 0xed, 0x26, 0x41, 0x4a, 0xe5, 0x12, 0x8d, 0xf8,
+  0x9f, 0x21, 0x33, 0x02, 0x0d, 0xdd, 0x18, 0xd7, 0x17, 0xdc, 0x3a, 0x8f, 0x5c, 0xab, 0x03, 0xaf,
+  0x8a, 0x66, 0x00, 0xa1, 0x96, 0xd5, 0x19, 0x5b, 0xf2, 0x45, 0x28, 0x0e, 0x54, 0x58, 0x60, 0xae,
+  0x43, 0xa9, 0x17, 0x94, 0xbb, 0x31, 0x39, 0x18, 0x76, 0x59, 0x05, 0x16, 0x76, 0x63, 0xc1, 0x40,
+  0x91, 0xd0, 0x35, 0x11, 0x1d, 0x1a, 0xd2, 0x95, 0x2b, 0xe1, 0xda, 0xcf, 0x90, 0x75, 0x87, 0xe4,
+  0x69, 0x0c, 0xb9, 0xda, 0x94, 0x22, 0x16, 0x96, 0xad, 0xf0, 0x80, 0x17, 0x4d, 0x9c, 0x8f, 0x92,
+  0xe5, 0xd1, 0xb4, 0xe1, 0x87, 0x6a, 0xae, 0x6c, 0xb1, 0x15, 0xc8, 0x88, 0xce, 0x07, 0xec, 0xf2,
+  0x8c, 0xd3, 0xdc, 0x43, 0x72, 0x76, 0x2d, 0x0e, 0x0b, 0xa5, 0x3b, 0x89, 0x70, 0x5c, 0x47, 0xc3,
+  0xc5, 0x60, 0xbf, 0x4a, 0xfd, 0xea, 0x06, 0xc9, 0xd7, 0x22, 0xff, 0x03, 0x65, 0x07, 0xc6, 0xde,
+  0x6a, 0xc9, 0xe3, 0xfc, 0x1e, 0x53, 0xc0, 0x92, 0x25, 0x4a, 0xae, 0x78, 0x32, 0x31, 0xf8, 0xa6,
+  0x80, 0x17, 0x91, 0x98, 0x6a, 0x54, 0x9f, 0x99, 0x4b, 0xcb, 0xcb, 0xdd, 0xb6, 0xd0, 0x10, 0x08,
+  0xd6, 0x75, 0xbc, 0x71, 0xf2, 0xef, 0x90, 0xf3, 0xd1, 0x4f, 0x02, 0xcf, 0xdf, 0x0d, 0x48, 0xc5,
+  0xd5, 0x9c, 0x34, 0xcc, 0x11, 0xab, 0xdd, 0xe4, 0x48, 0x72, 0x40, 0x64, 0x89, 0xbc, 0xb2, 0x8a,
+  0x5a, 0xa4, 0x50, 0xb3, 0xca, 0xb5, 0xef, 0x3a, 0x6e, 0xb8, 0xb3, 0x72, 0x43, 0x41, 0xf1, 0xd9,
+  0x91, 0x92, 0xe2, 0x59, 0x50, 0x1b, 0x10, 0x5d, 0x94, 0xcf, 0xcd, 0x9d, 0x7c, 0x71, 0x35, 0xe0,
+  0x8b, 0x4a, 0x01, 0xa6, 0x74, 0xac, 0x81, 0x83, 0xcd, 0xb4, 0x3c, 0x7f, 0xab, 0xa4, 0x2f, 0x88,
+  0x16, 0xcd, 0xd4, 0xc9, 0x4e, 0x2a, 0xd0, 0x91, 0xa8, 0x0d, 0x24, 0x4e, 0x59, 0xba, 0x98, 0x95,
+  0x97, 0xa8, 0xcf, 0x20, 0x36, 0x9a, 0x89, 0x5a, 0xb7, 0xa3, 0x72, 0xb6, 0xc3, 0x8f, 0xeb, 0x62,
+  0x48, 0xca, 0x3f, 0x56, 0x76, 0x4d, 0x16, 0xd4, 0xe0, 0x15, 0xb7, 0xc1, 0xd5, 0x37, 0x1c, 0x69,
+  0xcf, 0xd9, 0xe7, 0xa6, 0x3d, 0xda, 0xce, 0x83, 0x86, 0x94, 0xb1, 0x9f, 0x01, 0x4d, 0x6e, 0x69,
+  0x04, 0x0b, 0xca, 0x73, 0x67, 0xe1, 0xaf, 0xd9, 0x34, 0x50, 0x73, 0x47, 0xde, 0x08, 0x47, 0x04,
+  0x03, 0x48, 0xa3, 0x2b, 0xe7, 0xb3, 0xb0, 0xb7, 0xc8, 0x06, 0x95, 0x9d, 0xa0, 0xc2, 0xd3, 0xa9,
+  0xa3, 0x96, 0xc2, 0x8f, 0x9e, 0xa8, 0xda, 0xb9, 0x10, 0xf8, 0x88, 0x6d, 0x2e, 0xe1, 0x58, 0xc3,
+  0x81, 0x4e, 0x64, 0x6a, 0x16, 0x43, 0xec, 0x31, 0xcb, 0x32, 0x25, 0x20, 0xfc, 0xd8, 0x36, 0x8b,
+  0x0a, 0x80, 0xf1, 0x90, 0x29, 0x38, 0x35, 0x57, 0x4f, 0xd8, 0xd8, 0x11, 0x67, 0x07, 0xb6, 0xc9,
+  0x04, 0x6b, 0x88, 0x46, 0x23, 0x86, 0xd4, 0xd4, 0x4c, 0xa6, 0x64, 0x37, 0x51, 0x08, 0x9e, 0x8a,
+  0xe2, 0x1c, 0xec, 0xd7, 0xd6, 0x5e, 0x2b, 0xed, 0x20, 0x45, 0xc9, 0x7d, 0x1b, 0x78, 0x17, 0x4e,
+  0xd5, 0xc7, 0x8a, 0x15, 0x77, 0xc7, 0xcf, 0x12, 0x94, 0xe3, 0x27, 0x6f, 0xb1, 0xdf, 0xb4, 0x76,
+  0x1d, 0x62, 0x9e, 0x06, 0x38, 0x81, 0x27, 0x3c, 0x3d, 0x84, 0xa2, 0x2a, 0x31, 0xb0, 0x5f, 0xd2,
+  0xdb, 0x87, 0x05, 0xd7, 0x28, 0xe4, 0xc7, 0x39, 0xff, 0xda, 0xbd, 0x75, 0x72, 0x14, 0xe3, 0xbc,
+  0xcf, 0xcc, 0x07, 0x09, 0x7a, 0x14, 0x16, 0x8b, 0xf5, 0x64, 0x8d, 0x75, 0x27, 0xf1, 0x10, 0x55,
+  0x2c, 0x29, 0xaa, 0x73, 0x3d, 0x67, 0x38, 0x87, 0x22, 0xc1, 0x34, 0xb0, 0x86, 0xe4, 0x77, 0x58,
+  0xee, 0x18, 0x4d, 0x74, 0x40, 0xdf, 0x6e, 0x9e, 0x2d, 0x87, 0x51, 0xcd, 0x23, 0xbf, 0x3c, 0xd7,
+  0x1c, 0x5a, 0x64, 0xcd, 0x63, 0x96, 0x30, 0x62, 0x91, 0x61, 0x56, 0x26, 0x67, 0xa6, 0x96, 0x2a,
+  0x1f, 0xa6, 0x83, 0x51, 0xc9, 0xfc, 0xa3, 0x7e, 0xab, 0xf0, 0xef, 0x92, 0x23, 0x4e, 0x9e, 0x01,
+  0x4b, 0x7f, 0x53, 0x79, 0x82, 0x17, 0x10, 0x70, 0x38, 0xdf, 0xbf, 0x39, 0xff, 0xf9, 0xf7, 0xbf,
+  0xe0, 0x1f, 0xe7, 0xaf, 0xe4, 0x4f, 0xc4, 0x39, 0x95, 0x29, 0x76, 0x38, 0x09, 0x62, 0x7a, 0xf8,
+  0xdb, 0xf7, 0x87, 0xc5, 0xe5, 0xe4, 0x96, 0x55, 0xcd, 0xec, 0xe7, 0x6f, 0x3d, 0x54, 0x29, 0xa1,
+  0xe1, 0xf8, 0xe3, 0x26, 0x35, 0x0b, 0x07, 0x47, 0xf6, 0x74, 0x46, 0xe0, 0xf6, 0xb9, 0xc6, 0xd5,
+  0x04, 0x34, 0x8f, 0xba, 0x4b, 0xdd, 0xfe, 0x8c, 0xf6, 0xe6, 0x52, 0x10, 0x83, 0x0e, 0x3d, 0x4d,
+  0xd3, 0x0b, 0x18, 0x6d, 0xb7, 0xae, 0xa3, 0x75, 0x7c, 0x36, 0x6d, 0x97, 0x47, 0x7e, 0x08, 0x95,
+  0x69, 0x7e, 0xeb, 0x08, 0xd5, 0x67, 0x8e, 0x71, 0x94, 0x3c, 0x99, 0x97, 0xbf, 0x35, 0x28, 0xe1,
+  0x2b, 0xbd, 0x25, 0xe4, 0x8a, 0x6e, 0xef, 0xb0, 0x4b, 0xd1, 0xa3, 0x78, 0x3b, 0x1b, 0xa1, 0xb4,
+  0xb5, 0xda, 0x0c, 0x8d, 0x4e, 0x7c, 0x3b, 0x81, 0xae, 0x0c, 0x2e, 0x2f, 0xc3, 0xb8, 0xef, 0x23,
+  0x2b, 0xc3, 0x45, 0xa4, 0x42, 0x76, 0x02, 0x3c, 0x6a, 0x6e, 0x13, 0x74, 0xe1, 0x58, 0x86, 0xbf,
+  0xfe, 0x8a, 0x18, 0x73, 0x92, 0x23, 0x2a, 0x0e, 0xd8, 0xf4, 0xd5, 0x0a, 0x86, 0x5d, 0xdd, 0x40,
+  0x30, 0xda, 0x1e, 0xef, 0x78, 0x9a, 0xfc, 0x26, 0xe8, 0x93, 0x57, 0xe5, 0xcc, 0x42, 0xe5, 0x24,
+  0xfe, 0x99, 0x3e, 0x26, 0xbc, 0x10, 0x17, 0xa9, 0x21, 0xe4, 0x74, 0xf0, 0xa7, 0xa2, 0x41, 0x77,
+  0x29, 0xf4, 0x47, 0xac, 0x86, 0xa4, 0x7c, 0xa8, 0x8f, 0x9a, 0xe7, 0x2e, 0x6f, 0x75, 0xbf, 0x8d,
+  0xd5, 0xad, 0xfa, 0xbe, 0x28, 0x32, 0x79, 0xc0, 0x7a, 0x36, 0xfa, 0x71, 0x44, 0xb4, 0x36, 0xad,
+  0x93, 0xf0, 0x01, 0xe1, 0xfb, 0x88, 0xf0, 0xe6, 0xef, 0xb8, 0x26, 0x1f, 0x84, 0xb3, 0xec, 0x50,
+  0x48, 0x31, 0xf6, 0x72, 0x68, 0x3a, 0x44, 0x1a, 0x1c, 0x71, 0x5b, 0xcb, 0xbf, 0x10, 0x46, 0x20,
+  0xf1, 0xf0, 0xdd, 0x61, 0x4a, 0x4a, 0x28, 0xa7, 0x46, 0xdd, 0x3e, 0x6e, 0xba, 0xd5, 0x08, 0x3a,
+  0xc6, 0xc9, 0xa4, 0xd3, 0xc1, 0xb9, 0x97, 0xc6, 0x84, 0xb5, 0x86, 0xca, 0xf7, 0x39, 0xd3, 0x3b,
+  0x28, 0x33, 0xcd, 0x90, 0x2c, 0xae, 0x38, 0x00, 0xa0, 0x29, 0x7c, 0x9f, 0xca, 0x3b, 0xbd, 0xbd,
+  0xe8, 0x36, 0xd4, 0x07, 0x79, 0x14, 0x03, 0x05, 0x98, 0x71, 0x05, 0x13, 0x06, 0x1d, 0x99, 0x8f,
+  0xf1, 0x4a, 0xe3, 0x0e, 0xdb, 0xbd, 0x63, 0xa8, 0x09, 0x2b, 0x81, 0xfd, 0x3e, 0x6d, 0xa8, 0x6e,
+  0x71, 0xad, 0x31, 0x46, 0x59, 0xc2, 0xf8, 0x86, 0xb9, 0x97, 0xcf, 0x1b, 0x4d, 0x69, 0xa8, 0x6f,
+  0x68, 0x98, 0xe6, 0x5f, 0x9d, 0x7c, 0x7c, 0x43, 0xfe, 0x06, 0x59, 0x34, 0xe2, 0xf1, 0x2f, 0x65,
+  0x99, 0xd7, 0xa4, 0x32, 0x23, 0x12, 0x1e, 0x2d, 0xb7, 0x0f, 0xbd, 0xce, 0xe7, 0xb0, 0xe7, 0xed,
+  0x2f, 0xe7, 0xfe, 0x7a, 0xee, 0xfb, 0xf3, 0xc5, 0x7e, 0x3d, 0xbb, 0xc3, 0xc7, 0xcd, 0x12, 0x54,
+  0xe4, 0xd2, 0xc1, 0x75, 0x89, 0x3a, 0x29, 0x17, 0xbf, 0xc0, 0xa1, 0x32, 0x39, 0xa7, 0xee, 0x98,
+  0xaf, 0xbd, 0x41, 0xc2, 0xd8, 0x18, 0x75, 0xb2, 0x1f, 0x78, 0x03, 0x50, 0xfe, 0xe3, 0x6b, 0x55,
+  0x02, 0xe2, 0x88, 0xee, 0xa0, 0xb9, 0x4b, 0xfc, 0x5a, 0xc9, 0x96, 0x61, 0xef, 0x94, 0xbd, 0x0c,
+  0x34, 0xec, 0xef, 0xe6, 0x02, 0x43, 0x74, 0xf6, 0xac, 0x4d, 0xc5, 0xf6, 0x06, 0x8a, 0x03, 0x6c,
+  0x3b, 0xef, 0xff, 0xa3, 0x87, 0x25, 0xb1, 0x92, 0x4f, 0x09, 0x4a, 0xd8, 0x3d, 0x17, 0x6b, 0x2a,
+  0x6e, 0x3b, 0x29, 0x91, 0x47, 0xee, 0xee, 0x2d, 0xbc, 0x73, 0x97, 0x14, 0x0c, 0x63, 0x71, 0x30,
+  0x8f, 0xe4, 0x14, 0x3d, 0x3e, 0x28, 0xde, 0xa7, 0xbc, 0x0d, 0x3c, 0x99, 0xef, 0x26, 0x37, 0xad,
+  0xc5, 0x6e, 0x65, 0x3c, 0xc3, 0x55, 0xfe, 0xf0, 0xeb, 0x2f, 0xa6, 0x87, 0xa0, 0x8a, 0xb8, 0xf7,
+  0x36, 0xe1, 0xa7, 0x7a, 0xe0, 0x81, 0xd7, 0xef, 0x81, 0x6f, 0x6c, 0xbd, 0x28, 0x3e, 0x91, 0xb0,
+  0xb2, 0x85, 0x95, 0xf6, 0xaf, 0x78, 0xee, 0x00, 0xc6, 0x21, 0x3f, 0x11, 0xda, 0x4f, 0xb8, 0x3e,
+  0x96, 0x69, 0x33, 0x6c, 0x04, 0xf6, 0x0d, 0xd7, 0x7d, 0x9e, 0x62, 0x96, 0x34, 0x56, 0x86, 0x78,
+  0xc0, 0x75, 0x63, 0x41, 0x94, 0x05, 0x38, 0x7d, 0x6d, 0x6b, 0x4a, 0x2e, 0x52, 0xdc, 0x67, 0x51,
+  0xb2, 0x2e, 0x36, 0x8c, 0xfe, 0x4b, 0x91, 0x95, 0x4e, 0x4d, 0x72, 0xdc, 0xe3, 0xf7, 0x04, 0x46,
+  0x5d, 0x3e, 0xda, 0x7c, 0x9e, 0xa9, 0xef, 0x14, 0xb8, 0x5c, 0x0d, 0x75, 0xce, 0x62, 0xd0, 0x79,
+  0xf3, 0xef, 0xba, 0x9c, 0xf5, 0x47, 0x5e, 0xb6, 0xd2, 0x2d, 0x19, 0x7b, 0x62, 0x35, 0x26, 0xe4,
+  0xdd, 0x1d, 0x63, 0xc2, 0xed, 0x00, 0x9f, 0x7e, 0x40, 0x34, 0xc5, 0xf2, 0x07, 0x08, 0xce, 0x85,
+  0xfc, 0x84, 0x42, 0xa7, 0x57, 0xe7, 0x90, 0x9f, 0xc0, 0xc6, 0x70, 0x65, 0xc9, 0xae, 0xde, 0x44,
+  0x9d, 0xa3, 0x24, 0xb4, 0xa7, 0x8f, 0xcb, 0x08, 0x13, 0x7c, 0x97, 0xfd, 0x98, 0xb5, 0x54, 0xb4,
+  0xa2, 0xa0, 0xbd, 0x71, 0x43, 0x78, 0xbb, 0xf0, 0x5c, 0xde, 0xa4, 0x1f, 0x7a, 0xad, 0x9f, 0xcc,
+  0xa3, 0xad, 0x78, 0x0a, 0xf9, 0xe1, 0xa3, 0xfd, 0x12, 0x2e, 0x3c, 0xfc, 0xe9, 0xc9, 0x27, 0x4a,
+  0x41, 0xb3, 0x18, 0xdb, 0x79, 0x96, 0x1b, 0xd8, 0x7e, 0x6d, 0x33, 0xc8, 0xbd, 0x88, 0xf5, 0xb8,
+  0x70, 0xcd, 0x07, 0x9a, 0xc1, 0xcf, 0x49, 0xf4, 0xf1, 0x72, 0xe8, 0x90, 0xb7, 0x4a, 0xe2, 0xcf,
+  0x2e, 0x1d, 0x7a, 0xf7, 0xfc, 0x2c, 0xc6, 0x97, 0xa7, 0xd8, 0x87, 0x93, 0xcd, 0x34, 0x9c, 0xe8,
+  0x5e, 0xeb, 0x74, 0xa2, 0xdf, 0xda, 0x0c, 0xcb, 0xe7, 0xb0, 0xc4, 0x8e, 0xe5, 0x97, 0x0a, 0x7f,
+  0x7b, 0x0a, 0x02, 0xfe, 0x4b, 0x05, 0xa3, 0x5e, 0x68, 0xbf, 0x72, 0x16, 0x4b, 0x66, 0xdc, 0xa5,
+  0x06, 0x3b, 0x19, 0xc5, 0xc2, 0x3c, 0x0b, 0x76, 0x04, 0x18, 0xef, 0x14, 0xaa, 0x76, 0xb3, 0x7c,
+  0x27, 0x9a, 0xbe, 0x77, 0x77, 0xe7, 0xcc, 0xd2, 0x8d, 0xe2, 0x17, 0x82, 0x2f, 0x4e, 0xcd, 0x3b,
+  0x54, 0xbd, 0xe2, 0x0d, 0x5e, 0xc8, 0xab, 0x86, 0xe1, 0x35, 0xfd, 0xa8, 0xad, 0x24, 0xbf, 0x15,
+  0x1a, 0xcc, 0xa2, 0xa4, 0x5b, 0x4f, 0x8e, 0x2a, 0x86, 0x43, 0xfd, 0xc7, 0x18, 0xa9, 0x3b, 0x79,
+  0x07, 0x6a, 0x2f, 0x8b, 0x5f, 0x5a, 0xa2, 0x6b, 0xc4, 0xa4, 0xde, 0x27, 0x5f, 0x06, 0x22, 0xf0,
+  0x0b, 0x9a, 0xde, 0xf5, 0x50, 0x01, 0x26, 0x45, 0xb9, 0x0d, 0xfe, 0x26, 0x29, 0xc7, 0xe8, 0xc6,
+  0xca, 0xdc, 0x46, 0xda, 0xe7, 0xf9, 0x77, 0x2c, 0xd0, 0xda, 0x28, 0x37, 0x55, 0xaa, 0x96, 0x2d,
+  0xd7, 0xdd, 0x33, 0x11, 0xf2, 0xb1, 0xbf, 0x1e, 0xf4, 0x8f, 0x7e, 0x3a, 0x1c, 0x1f, 0xa0, 0xa4,
+  0xa2, 0x43, 0x50, 0x45, 0x82, 0xf5, 0xdc, 0x6e, 0x20, 0xb5, 0x94, 0x6e, 0x4c, 0x78, 0x14, 0x80,
+  0x00, 0x99, 0x71, 0x2f, 0xcd, 0xbb, 0x3f, 0xa0, 0xe9, 0xdd, 0x87, 0x49, 0x5a, 0xf3, 0x5f, 0xbc,
+  0x6a, 0xc7, 0x44, 0x01, 0x28, 0x00, 0x00,
+};
+
+// app.js: 38707 байт, в gzip 12324
+static const uint8_t WEB_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x7d, 0x7f, 0x73, 0xdb, 0xc6,
+  0xb5, 0xe8, 0xff, 0xfe, 0x14, 0xb0, 0x9a, 0x0a, 0x80, 0x09, 0xfe, 0x94, 0xa5, 0x38, 0xa4, 0x20,
+  0x8d, 0xed, 0xd8, 0xb5, 0x5f, 0x9c, 0xc4, 0xd7, 0xb2, 0xe3, 0xb4, 0x8a, 0xae, 0x03, 0x12, 0xa0,
+  0x88, 0x88, 0x04, 0x19, 0x00, 0x14, 0xa5, 0x50, 0x7c, 0xe3, 0xd8, 0x4d, 0xd3, 0xbe, 0xa4, 0xed,
+  0x4b, 0xda, 0xbe, 0xdb, 0xe9, 0x6b, 0x6f, 0x6f, 0xda, 0x7b, 0xdf, 0xbc, 0x99, 0xfb, 0x8f, 0xec,
+  0xd8, 0x89, 0x63, 0xc7, 0xce, 0x4c, 0x3e, 0x01, 0xf5, 0x15, 0xf2, 0x09, 0xde, 0x47, 0x78, 0xe7,
+  0x9c, 0xdd, 0x05, 0x76, 0x41, 0x52, 0xb2, 0xdb, 0xce, 0xdc, 0xba, 0x9d, 0xd4, 0x22, 0x16, 0xbb,
+  0x67, 0x17, 0x67, 0xcf, 0x9e, 0x3d, 0xbf, 0xf6, 0x6c, 0xb1, 0xa8, 0x7d, 0xf7, 0xeb, 0x9b, 0xf0,
+  0x9f, 0xf6, 0x83, 0x76, 0xb7, 0xee, 0xb4, 0x23, 0xfe, 0xf8, 0x5c, 0xfc, 0x77, 0xac, 0xd1, 0x0d,
+  0xa2, 0x58, 0xbb, 0x72, 0xee, 0xfc, 0x95, 0x73, 0x6b, 0x17, 0x34, 0x5b, 0x5b, 0x2c, 0x95, 0x4a,
+  0x35, 0xb5, 0xf4, 0xc6, 0xda, 0xda, 0x39, 0x78, 0xb3, 0x54, 0xc2, 0x57, 0x5a, 0xb1, 0xa8, 0x8d,
+  0xbf, 0x19, 0x3f, 0x19, 0x3f, 0x1c, 0xef, 0x8f, 0xbf, 0x84, 0xff, 0x3f, 0x1e, 0x3f, 0x38, 0xf8,
+  0xa5, 0x36, 0x7e, 0x30, 0xbe, 0x77, 0x70, 0xfb, 0xe0, 0x96, 0x76, 0xf0, 0xe1, 0xf8, 0xfe, 0xc1,
+  0xcd, 0xf1, 0xfd, 0xf1, 0x97, 0x5a, 0xd1, 0xe9, 0xf9, 0x45, 0x6f, 0xdb, 0x0b, 0x62, 0x40, 0xc9,
+  0xcd, 0x5f, 0x6b, 0xe3, 0x27, 0x07, 0xef, 0x1f, 0xdc, 0x82, 0x26, 0x8f, 0x0e, 0x3e, 0x86, 0x66,
+  0x4f, 0xc6, 0xf7, 0x35, 0xa8, 0x09, 0x50, 0xb4, 0xf1, 0x5d, 0x6d, 0xfc, 0x35, 0x80, 0x78, 0x8c,
+  0x20, 0x0e, 0x6e, 0x1f, 0x6b, 0x7b, 0xb1, 0x76, 0x23, 0x8a, 0x3c, 0xe8, 0x35, 0xe8, 0xb7, 0xdb,
+  0x35, 0x2d, 0xfd, 0x1f, 0x74, 0x7f, 0x0e, 0x41, 0xae, 0x75, 0xfb, 0x61, 0xc3, 0x93, 0xfb, 0x60,
+  0xad, 0xda, 0xfe, 0xf6, 0x94, 0x66, 0x7c, 0xd0, 0x07, 0xef, 0x8f, 0x1f, 0xc1, 0xd0, 0xee, 0xe1,
+  0xa0, 0xc7, 0x5f, 0xb1, 0xc6, 0xae, 0x13, 0x3b, 0xda, 0xc1, 0xfb, 0xf0, 0x1e, 0x06, 0xf3, 0x00,
+  0x86, 0x71, 0x1f, 0x86, 0xf1, 0x09, 0xd4, 0x78, 0x7c, 0xf0, 0x11, 0x0e, 0x0a, 0xde, 0xc1, 0x50,
+  0xef, 0x1c, 0x7c, 0x04, 0x43, 0x87, 0x2f, 0xc5, 0x22, 0x3e, 0xbe, 0xd8, 0x09, 0x63, 0xe8, 0xea,
+  0x65, 0x27, 0xf6, 0x0a, 0x41, 0x77, 0x60, 0x98, 0x35, 0xf6, 0xc2, 0x69, 0xb7, 0xa1, 0x78, 0x7d,
+  0x23, 0x33, 0xec, 0xf1, 0x5d, 0xc0, 0xcc, 0xfb, 0x07, 0x1f, 0x6b, 0x30, 0x86, 0x27, 0xe3, 0xcf,
+  0x59, 0xdd, 0x46, 0x3f, 0xbc, 0xee, 0xf9, 0x9b, 0x2d, 0x04, 0x54, 0xaa, 0x25, 0x75, 0xa1, 0xaf,
+  0xfb, 0xe3, 0x87, 0x80, 0x8d, 0x9f, 0xd1, 0x40, 0x59, 0x53, 0x0d, 0x06, 0xfe, 0x08, 0x71, 0x4d,
+  0xa8, 0x1a, 0x3f, 0xc8, 0x8f, 0x3f, 0x47, 0xfc, 0x1d, 0xfc, 0x18, 0x1e, 0x61, 0x36, 0x18, 0xc0,
+  0x9e, 0x17, 0xfa, 0x5d, 0x17, 0x67, 0xb2, 0xcc, 0x87, 0x13, 0x79, 0xe1, 0x1b, 0x7e, 0xe4, 0xd7,
+  0xdb, 0x88, 0x97, 0xe1, 0xa0, 0x1a, 0x87, 0x7d, 0xcf, 0xd2, 0x62, 0xfe, 0xb7, 0x4e, 0x7f, 0x47,
+  0xbc, 0xee, 0xc0, 0x7f, 0x6f, 0x2d, 0xf6, 0x7a, 0x34, 0x18, 0x51, 0xd2, 0xf4, 0x5f, 0xed, 0xba,
+  0x1e, 0x2b, 0xc2, 0xcf, 0xf8, 0x35, 0x4d, 0x3a, 0x62, 0xe7, 0xbe, 0x18, 0x11, 0x4e, 0x1a, 0xfc,
+  0x00, 0x04, 0x11, 0x69, 0xdc, 0xd5, 0x0c, 0xfc, 0x8b, 0x98, 0xbb, 0x4f, 0x48, 0x7d, 0x60, 0x32,
+  0x60, 0xb1, 0xdf, 0xbb, 0x0c, 0xc4, 0x00, 0xc3, 0x80, 0x0e, 0x9b, 0xfd, 0xa0, 0x11, 0xfb, 0xdd,
+  0x40, 0xf3, 0xa2, 0x86, 0x11, 0x99, 0xc3, 0x6d, 0x27, 0xd4, 0x5c, 0xdb, 0xed, 0x36, 0xfa, 0x1d,
+  0x98, 0xce, 0x42, 0x23, 0xf4, 0x00, 0xb1, 0xe7, 0xda, 0x1e, 0x3e, 0x19, 0xba, 0xeb, 0x6f, 0xeb,
+  0x66, 0xcd, 0x2d, 0xc4, 0xde, 0x4e, 0x7c, 0xb6, 0x1b, 0xc4, 0x50, 0x68, 0xaf, 0xc5, 0xa1, 0x1f,
+  0x6c, 0x42, 0xdb, 0x5a, 0xe8, 0xc5, 0xfd, 0x30, 0xd0, 0xdc, 0x82, 0x1f, 0x04, 0x5e, 0x78, 0xe1,
+  0xea, 0xab, 0x97, 0x6a, 0xa3, 0x63, 0x38, 0x5a, 0xbe, 0x32, 0x5f, 0x73, 0xb6, 0x9f, 0xa7, 0x55,
+  0x99, 0x5d, 0xa4, 0x09, 0xaa, 0x02, 0x67, 0xdb, 0xf0, 0x5d, 0x53, 0x1b, 0x1e, 0xd3, 0xb4, 0x04,
+  0x53, 0xef, 0xf6, 0xbd, 0x70, 0x77, 0xcd, 0x6b, 0x7b, 0x8d, 0xb8, 0x1b, 0x9e, 0x6e, 0xb7, 0x0d,
+  0xbd, 0x10, 0x79, 0x54, 0x5f, 0x37, 0x0b, 0xcd, 0x6e, 0x78, 0xce, 0x69, 0xb4, 0x8c, 0xc8, 0x5e,
+  0x89, 0x0a, 0x8d, 0xb6, 0x13, 0x45, 0x97, 0xfc, 0x28, 0x2e, 0x84, 0x5e, 0xa7, 0xbb, 0xed, 0x19,
+  0xba, 0x03, 0xf5, 0xb6, 0x3d, 0xdd, 0x04, 0xda, 0x3d, 0x1c, 0x62, 0xec, 0xd4, 0x25, 0x68, 0xb1,
+  0xbd, 0x12, 0x3f, 0x35, 0xb4, 0x4d, 0x2f, 0xe6, 0xd3, 0x78, 0x66, 0xf7, 0xa2, 0x6b, 0xe8, 0x30,
+  0xb8, 0xbc, 0x9e, 0x83, 0xcf, 0x90, 0x20, 0x38, 0xae, 0x9b, 0x36, 0xc7, 0xd6, 0x8c, 0x03, 0xf9,
+  0xee, 0x0e, 0x52, 0x4b, 0xc7, 0xf1, 0x83, 0x6a, 0xc9, 0x6a, 0xb4, 0x60, 0xc5, 0x55, 0xcb, 0x16,
+  0xd2, 0x64, 0xb5, 0x62, 0x45, 0x5e, 0x1c, 0xc3, 0xfc, 0x47, 0xd5, 0x05, 0xab, 0xe1, 0xb4, 0xfd,
+  0x7a, 0xf5, 0xa4, 0x15, 0x6f, 0x56, 0x17, 0x2d, 0x58, 0xd5, 0xd5, 0xa5, 0xd1, 0x53, 0x7d, 0xd0,
+  0x3a, 0x74, 0x00, 0xff, 0xdf, 0xd8, 0x38, 0x6c, 0x28, 0x7e, 0x53, 0x03, 0xa4, 0xdb, 0xb6, 0xad,
+  0xd3, 0x00, 0x74, 0x53, 0x0b, 0xbd, 0xc0, 0xf5, 0xc2, 0xb3, 0xf8, 0x14, 0x19, 0x99, 0x3a, 0xd0,
+  0x3b, 0xd4, 0xd0, 0xa0, 0x4e, 0x33, 0xf4, 0xa2, 0xd6, 0xe9, 0x9e, 0xff, 0x86, 0xef, 0x0d, 0xb2,
+  0xb5, 0xc4, 0xd8, 0xf5, 0xbd, 0x3d, 0x56, 0x10, 0x6f, 0x42, 0xab, 0x76, 0xd7, 0x71, 0x81, 0xb8,
+  0x9b, 0xfe, 0xe6, 0xcc, 0xfa, 0xa6, 0x36, 0x18, 0x0c, 0x2e, 0x41, 0xbd, 0x6c, 0x0d, 0x44, 0xca,
+  0xa1, 0x20, 0x08, 0x47, 0x50, 0x63, 0xa8, 0x35, 0xbd, 0xb8, 0xd1, 0x02, 0xb6, 0xe5, 0x40, 0x15,
+  0x6d, 0xc4, 0xb9, 0xd3, 0x63, 0xe0, 0x38, 0x5f, 0x13, 0x73, 0x44, 0x16, 0xf9, 0x18, 0x19, 0xb4,
+  0x86, 0x8c, 0x8f, 0x38, 0xf5, 0x5d, 0x60, 0x7d, 0xb7, 0x80, 0x75, 0x35, 0x9a, 0x79, 0x64, 0xb0,
+  0x96, 0xd6, 0x6d, 0x46, 0xfc, 0x17, 0xb0, 0x8c, 0xfc, 0xe0, 0x98, 0xb2, 0xda, 0xae, 0xb0, 0x4f,
+  0xd7, 0xea, 0xb0, 0xa2, 0x9f, 0xa7, 0x5d, 0x10, 0xc7, 0x6b, 0xcf, 0xa6, 0xdb, 0x10, 0xde, 0x23,
+  0x45, 0x24, 0xab, 0x31, 0xf6, 0x1b, 0x5b, 0x67, 0x9c, 0xd0, 0x60, 0xeb, 0x91, 0xc1, 0xe8, 0x35,
+  0x90, 0x95, 0xbf, 0xea, 0xc4, 0xad, 0x42, 0xc7, 0xd9, 0x31, 0x4a, 0x96, 0x56, 0x2e, 0x95, 0xf2,
+  0x46, 0xba, 0x49, 0xe4, 0xd9, 0xc6, 0x61, 0x16, 0x19, 0xa7, 0x36, 0xcc, 0x13, 0x50, 0x81, 0xa6,
+  0x0a, 0xc0, 0x17, 0xa2, 0x78, 0xb7, 0xed, 0x15, 0x06, 0xbe, 0x1b, 0xb7, 0x00, 0x0c, 0x00, 0xcb,
+  0xe9, 0xdf, 0xd7, 0xc5, 0x3c, 0x4e, 0x00, 0xd1, 0x96, 0x35, 0x01, 0x05, 0x89, 0x12, 0xa8, 0x3c,
+  0x8a, 0x4f, 0x07, 0x7e, 0xc7, 0xc1, 0xe1, 0x9d, 0x0f, 0x9d, 0x8e, 0x67, 0xf0, 0x31, 0x42, 0x07,
+  0xa3, 0x63, 0xc9, 0x78, 0x6b, 0xf2, 0x6c, 0x9d, 0x6d, 0x77, 0x1b, 0x5b, 0xcf, 0x2b, 0x77, 0x3c,
+  0x66, 0x28, 0xb3, 0xa1, 0x4c, 0x45, 0x6c, 0x07, 0xde, 0x80, 0xb6, 0x67, 0xc3, 0xb4, 0xb4, 0x9e,
+  0x1d, 0xd8, 0x2b, 0x7c, 0xc7, 0x08, 0xcc, 0x42, 0xcf, 0x71, 0xd7, 0x10, 0x85, 0x46, 0xc5, 0xd2,
+  0x4b, 0xfa, 0xe1, 0x0c, 0x0b, 0x36, 0xe9, 0x7c, 0xec, 0x77, 0x80, 0x1d, 0xc8, 0xdb, 0x0f, 0xce,
+  0x8f, 0x41, 0x95, 0x2f, 0x80, 0x2c, 0x02, 0x7c, 0xc0, 0xcc, 0xe9, 0x55, 0x3d, 0xc7, 0xcb, 0x5e,
+  0xf5, 0x83, 0x7e, 0xec, 0x65, 0x4b, 0xd7, 0x3c, 0x18, 0x9a, 0x8b, 0xa5, 0xd8, 0x21, 0x2c, 0xea,
+  0xab, 0x00, 0xb6, 0xdb, 0x8f, 0x69, 0x9a, 0x88, 0x54, 0x90, 0x14, 0x46, 0x66, 0x66, 0x8a, 0xae,
+  0x76, 0x1d, 0xf8, 0x9e, 0xe7, 0x7e, 0xf7, 0x8a, 0xf1, 0x33, 0x8c, 0x4e, 0xb4, 0x69, 0x69, 0x5e,
+  0x18, 0xca, 0x53, 0xe5, 0xb5, 0x0f, 0x5b, 0x78, 0xd4, 0x8e, 0xcd, 0x91, 0xd7, 0x56, 0x24, 0x00,
+  0x80, 0x55, 0xc3, 0x32, 0xe2, 0xde, 0xaf, 0x01, 0xbd, 0xdb, 0xbc, 0x72, 0xce, 0x80, 0x1e, 0x56,
+  0x75, 0xec, 0x07, 0xd0, 0xaf, 0xc3, 0x24, 0x68, 0x51, 0xab, 0x3b, 0xd0, 0x33, 0x68, 0x37, 0x4c,
+  0x7b, 0x45, 0x34, 0x57, 0x76, 0x32, 0xaa, 0x0c, 0x54, 0xb3, 0xb0, 0xc8, 0x66, 0x44, 0x9e, 0x8d,
+  0xd3, 0x97, 0x2f, 0x3e, 0xc7, 0xc2, 0x84, 0x32, 0x23, 0x6e, 0x17, 0xf6, 0x27, 0xa3, 0x1f, 0xb6,
+  0xe5, 0xc9, 0xe8, 0x78, 0x71, 0xab, 0xeb, 0xc2, 0x84, 0xe0, 0x0b, 0x90, 0xa8, 0x1a, 0xed, 0xbe,
+  0x0b, 0x94, 0xac, 0x93, 0xa8, 0xac, 0x9b, 0x7b, 0x7b, 0xd9, 0xf2, 0x76, 0x17, 0x36, 0xaf, 0xf9,
+  0xf9, 0xe3, 0x99, 0xe2, 0x46, 0xdb, 0x43, 0x86, 0x09, 0x0d, 0xb2, 0x2f, 0x68, 0x7f, 0xd2, 0x27,
+  0x5f, 0xb8, 0xce, 0x2e, 0xf0, 0xb5, 0x58, 0xbc, 0x81, 0x5d, 0x36, 0xba, 0xee, 0xc7, 0x2d, 0x78,
+  0x53, 0x77, 0x1a, 0x5b, 0xfd, 0x1e, 0x00, 0xd3, 0x56, 0x35, 0xfd, 0x07, 0xe7, 0xae, 0xea, 0x5a,
+  0x55, 0xd3, 0x2f, 0xbf, 0xbe, 0x76, 0x95, 0x66, 0x94, 0x8b, 0x7f, 0xb4, 0xaf, 0xe1, 0xe0, 0xac,
+  0x21, 0xfb, 0x86, 0x11, 0x2c, 0xd8, 0x96, 0x17, 0x18, 0xa1, 0xbd, 0x12, 0x16, 0xde, 0x89, 0xba,
+  0x01, 0x2c, 0x3c, 0x56, 0xe2, 0xda, 0x2b, 0xf8, 0xc1, 0x1a, 0xa7, 0x49, 0xb7, 0x00, 0x94, 0x04,
+  0x1f, 0xe6, 0x16, 0xba, 0x5b, 0xab, 0xfa, 0xeb, 0xaf, 0x00, 0xcd, 0x8c, 0xff, 0xf5, 0xe0, 0xa7,
+  0x20, 0xba, 0xde, 0x41, 0xd1, 0x1a, 0x29, 0xe1, 0x38, 0xbe, 0x83, 0xfd, 0x52, 0x88, 0x9a, 0xd8,
+  0x2f, 0xc0, 0x6f, 0x38, 0xd8, 0x27, 0xd2, 0x11, 0x83, 0xa4, 0x8f, 0xff, 0x00, 0x42, 0xef, 0x2d,
+  0x94, 0x7d, 0xef, 0x82, 0xb6, 0xf0, 0xe5, 0xf8, 0x81, 0x6e, 0xa1, 0x84, 0x6d, 0x12, 0x15, 0xe1,
+  0x46, 0xfb, 0xef, 0xb0, 0x9f, 0xd2, 0x9e, 0xca, 0x24, 0xe8, 0x27, 0x20, 0x2a, 0xdf, 0x27, 0x39,
+  0xfe, 0x27, 0x28, 0x29, 0x6b, 0x06, 0x69, 0x25, 0xf1, 0x66, 0x11, 0xb8, 0x47, 0x6c, 0x31, 0x1d,
+  0x25, 0x88, 0x7b, 0x66, 0x55, 0xc3, 0xcf, 0x45, 0x25, 0xea, 0x16, 0xa9, 0x03, 0x1f, 0x82, 0x18,
+  0x8e, 0x1d, 0xf5, 0x00, 0x4b, 0xc0, 0xd3, 0x2c, 0x82, 0x0d, 0xbb, 0x34, 0xea, 0x16, 0xac, 0xd6,
+  0x3d, 0x80, 0xf9, 0x09, 0xd4, 0x00, 0x74, 0x69, 0x4c, 0x1e, 0xc7, 0x97, 0x5f, 0x1f, 0xdc, 0xd6,
+  0xc6, 0x5f, 0x60, 0xcf, 0xfb, 0xa0, 0xb2, 0xdd, 0x24, 0x9d, 0xe4, 0x76, 0x86, 0x22, 0x2e, 0x77,
+  0x41, 0x44, 0x42, 0xaa, 0x60, 0x72, 0xa6, 0xa0, 0x91, 0x14, 0x75, 0x7e, 0xd3, 0x70, 0xe7, 0xe7,
+  0xdd, 0x02, 0xef, 0xdc, 0x94, 0x96, 0x94, 0xc3, 0x9a, 0x5b, 0x65, 0x58, 0x39, 0x16, 0xce, 0x45,
+  0x05, 0x16, 0xd0, 0x88, 0xbe, 0x3e, 0xe9, 0xc4, 0x49, 0xbb, 0xb0, 0x02, 0xea, 0x24, 0x99, 0xba,
+  0xa3, 0x67, 0x0c, 0xfb, 0x16, 0x1d, 0xcf, 0xcf, 0x07, 0x2b, 0xa5, 0xa9, 0xbd, 0x97, 0x78, 0xef,
+  0x41, 0xbe, 0x6c, 0xd6, 0xbc, 0x36, 0xe8, 0x92, 0xca, 0x4c, 0xab, 0xd3, 0x6b, 0xf1, 0xc9, 0xfd,
+  0x4b, 0xa6, 0x54, 0x62, 0x0c, 0xe7, 0xf1, 0x23, 0x84, 0x56, 0x19, 0xb5, 0xea, 0x5d, 0x27, 0x74,
+  0x99, 0x2a, 0x94, 0xd1, 0x96, 0x73, 0x1a, 0xd3, 0x84, 0x49, 0xa5, 0x7c, 0x9f, 0xf4, 0x26, 0xa8,
+  0x80, 0xda, 0xd4, 0x63, 0xd4, 0xef, 0x9e, 0x70, 0x0d, 0xf5, 0x6b, 0x8d, 0xda, 0xa0, 0x62, 0xfa,
+  0x84, 0xb4, 0xd0, 0xaf, 0x4d, 0x2d, 0xbb, 0x82, 0x25, 0x59, 0x4e, 0x4b, 0x11, 0xa9, 0xab, 0x83,
+  0x58, 0x6d, 0xfa, 0x5e, 0xdb, 0x8d, 0x6c, 0x5c, 0xc0, 0x16, 0x2c, 0x32, 0xfd, 0x68, 0x2c, 0x93,
+  0x22, 0x6d, 0xbb, 0x05, 0x6c, 0x52, 0xd3, 0xfa, 0x3d, 0xf7, 0x65, 0x00, 0x66, 0xb0, 0x67, 0x93,
+  0x0a, 0x2e, 0x40, 0x05, 0x2a, 0xd8, 0x9d, 0x44, 0xdc, 0x70, 0x44, 0x65, 0x28, 0x8c, 0x5e, 0xea,
+  0x92, 0x24, 0x0a, 0x88, 0x4a, 0xc6, 0x9c, 0x40, 0x93, 0xb9, 0xce, 0x00, 0xf7, 0x53, 0x27, 0x8c,
+  0xbc, 0xf3, 0xd0, 0x0a, 0xe7, 0x69, 0x40, 0x7a, 0x31, 0xb0, 0x82, 0x12, 0x82, 0x52, 0x34, 0xe5,
+  0x81, 0x60, 0xe3, 0xb0, 0x15, 0x18, 0xfa, 0x20, 0xbf, 0xed, 0xb4, 0x75, 0x90, 0x44, 0x0b, 0x71,
+  0xf7, 0xbc, 0xbf, 0xe3, 0xb9, 0xc6, 0x02, 0xf0, 0xfb, 0xe5, 0xa8, 0xe7, 0x04, 0x1a, 0x71, 0x76,
+  0x7b, 0x0e, 0x2a, 0xe4, 0xfb, 0x81, 0x1f, 0xcf, 0xad, 0x00, 0xa2, 0x3f, 0x5f, 0x2e, 0xe2, 0xbb,
+  0x15, 0x68, 0x42, 0xd3, 0x98, 0x01, 0x06, 0x82, 0x3b, 0xbc, 0x51, 0x86, 0x02, 0x45, 0x30, 0x0c,
+  0x53, 0x82, 0x2f, 0xe9, 0x28, 0x2e, 0x8e, 0x7c, 0x90, 0x9f, 0xd6, 0x40, 0xae, 0x74, 0xae, 0x6d,
+  0xcf, 0xdc, 0xe0, 0x06, 0x79, 0xd7, 0x6b, 0x23, 0x6f, 0x25, 0x31, 0x04, 0xaa, 0x2a, 0x9b, 0x9c,
+  0xe1, 0x0e, 0x56, 0xec, 0xd2, 0xaa, 0x9e, 0x63, 0x3b, 0x99, 0x2b, 0x7f, 0x67, 0xd2, 0x80, 0x09,
+  0x8e, 0x8d, 0x6e, 0xbb, 0x1b, 0xda, 0x50, 0x1f, 0xaa, 0x83, 0x3e, 0x6d, 0xe4, 0xf3, 0x9b, 0xa1,
+  0xe7, 0x05, 0xa6, 0x5e, 0x75, 0x07, 0xcb, 0x49, 0x59, 0xe8, 0xb9, 0x50, 0xc2, 0x1f, 0x9c, 0x4e,
+  0xdd, 0x0b, 0x2b, 0xa6, 0xd8, 0x19, 0x7f, 0xe0, 0xf4, 0x37, 0x3d, 0x1c, 0xd1, 0x26, 0xfe, 0xd0,
+  0x2d, 0xfc, 0x05, 0x62, 0x28, 0x60, 0x84, 0xc9, 0xb4, 0x7e, 0x60, 0xc0, 0xda, 0xb2, 0x06, 0xc5,
+  0x53, 0x25, 0x12, 0x5c, 0x2d, 0x4d, 0x87, 0x77, 0x20, 0xa4, 0xa2, 0xc4, 0x92, 0x4a, 0x5e, 0x0a,
+  0x36, 0x62, 0xaf, 0xd3, 0x83, 0x8a, 0x61, 0xdc, 0xb8, 0xaa, 0xbe, 0xc0, 0x12, 0x81, 0x27, 0x14,
+  0x70, 0x8f, 0xfb, 0xb0, 0x89, 0xbf, 0x66, 0xc4, 0xb0, 0x99, 0xc4, 0x2b, 0xf9, 0x97, 0x4a, 0x8c,
+  0x3e, 0xa4, 0xd9, 0x89, 0xd9, 0x54, 0xc7, 0x09, 0x06, 0xca, 0xb3, 0x67, 0xfa, 0xdb, 0xfd, 0xb3,
+  0xc9, 0x44, 0x27, 0xf3, 0x2c, 0x7f, 0x63, 0x9c, 0x7c, 0x63, 0x3c, 0xf5, 0x1b, 0x25, 0x21, 0xde,
+  0x88, 0x73, 0xc0, 0xc6, 0x8a, 0x2f, 0xb2, 0x6f, 0x86, 0x6f, 0x91, 0x47, 0x00, 0x9f, 0x0f, 0x7d,
+  0xb1, 0xc9, 0x1b, 0x69, 0xc4, 0x6b, 0xa6, 0x0f, 0x5b, 0xcf, 0xe7, 0xf3, 0x7f, 0xc3, 0xc1, 0x82,
+  0x6e, 0x81, 0x10, 0x75, 0xa5, 0x7f, 0x99, 0x96, 0x5b, 0x7c, 0x61, 0x28, 0x38, 0x6f, 0xf5, 0x3b,
+  0x0a, 0x2d, 0x97, 0x4c, 0x75, 0x01, 0xc0, 0x9c, 0xf0, 0x66, 0x38, 0x3b, 0xd2, 0x67, 0xca, 0x13,
+  0x5c, 0xdf, 0x56, 0x27, 0xb2, 0xee, 0xc4, 0x6f, 0x20, 0x54, 0x4b, 0xab, 0xf7, 0x26, 0xde, 0x5c,
+  0x6e, 0xc4, 0x62, 0x92, 0x93, 0x5e, 0xa0, 0x38, 0xbf, 0x9d, 0xaf, 0x83, 0x14, 0x60, 0xd5, 0xb7,
+  0x93, 0x4e, 0x2a, 0x87, 0xac, 0xdb, 0x4f, 0x27, 0xf1, 0xa3, 0x40, 0x03, 0x9c, 0xe4, 0xb7, 0x01,
+  0x5a, 0x4f, 0xfa, 0xb2, 0x1c, 0xa3, 0xcb, 0x64, 0xd4, 0x67, 0x69, 0x79, 0xd4, 0x7b, 0xcb, 0x95,
+  0xcc, 0x5a, 0x80, 0xa2, 0x93, 0x49, 0x11, 0xad, 0x88, 0x74, 0x81, 0xf0, 0x15, 0x74, 0xa8, 0x86,
+  0x80, 0x03, 0x60, 0xf3, 0x63, 0xf2, 0x95, 0x88, 0x02, 0xcb, 0x66, 0xd8, 0xed, 0x07, 0xae, 0xcd,
+  0xba, 0x55, 0xd7, 0x57, 0xda, 0xc0, 0x62, 0xbf, 0x69, 0x4a, 0xeb, 0x3d, 0x0b, 0x56, 0x53, 0xb2,
+  0x98, 0x60, 0x67, 0x01, 0x1d, 0x25, 0xee, 0x47, 0xac, 0xe9, 0xcb, 0x5d, 0xf8, 0xd4, 0x28, 0xcc,
+  0xbb, 0x5d, 0xa8, 0xea, 0x16, 0x22, 0x2f, 0x88, 0xba, 0xa1, 0xa5, 0x77, 0xb7, 0xa0, 0x09, 0xca,
+  0xb9, 0xc0, 0x96, 0x13, 0x8c, 0x40, 0x35, 0x9a, 0x44, 0x51, 0x6d, 0xaa, 0x50, 0x53, 0x93, 0xe0,
+  0x0e, 0x9a, 0x02, 0x2e, 0x1a, 0x12, 0x38, 0xd4, 0x81, 0x13, 0x06, 0x0a, 0x58, 0xa8, 0xc5, 0xc1,
+  0x62, 0xad, 0x55, 0x7d, 0xfc, 0x47, 0xda, 0xac, 0x1e, 0x8e, 0x1f, 0x1d, 0xfc, 0xe2, 0xe0, 0x43,
+  0x34, 0x9b, 0x42, 0x27, 0xa7, 0x2f, 0x6b, 0x64, 0x01, 0xfe, 0x02, 0xb7, 0x30, 0x3d, 0xc3, 0x5e,
+  0xb7, 0x1a, 0x09, 0x04, 0x67, 0xcb, 0xeb, 0xf7, 0xa2, 0x09, 0xd2, 0x68, 0xf0, 0x3e, 0x14, 0x32,
+  0x6a, 0x34, 0x0f, 0x25, 0x5a, 0x34, 0x47, 0x70, 0xb0, 0xdd, 0x66, 0x13, 0x8a, 0x27, 0xa0, 0xba,
+  0xb1, 0xa8, 0x00, 0x3b, 0x98, 0x87, 0xda, 0x1c, 0x08, 0x01, 0xb0, 0x78, 0xd4, 0x5a, 0xfd, 0x5e,
+  0x52, 0x0d, 0x7e, 0xaa, 0x95, 0x18, 0x0d, 0xb5, 0x3c, 0x87, 0x53, 0xf8, 0xc5, 0x80, 0x96, 0x13,
+  0x3c, 0x4f, 0x74, 0x86, 0x85, 0x0c, 0x8e, 0x81, 0x3f, 0x8b, 0xe5, 0x52, 0xe5, 0xa4, 0xa9, 0xf0,
+  0x2c, 0xed, 0x95, 0x33, 0x2a, 0xfe, 0xa9, 0x09, 0xcd, 0x00, 0xfe, 0x5a, 0x41, 0x33, 0xbc, 0x3a,
+  0x09, 0xc9, 0x08, 0x22, 0xf7, 0x95, 0xba, 0x4d, 0xbc, 0x89, 0xc8, 0xcb, 0x90, 0x06, 0x13, 0xe1,
+  0x6e, 0x8b, 0xa3, 0x61, 0x3d, 0xa6, 0x6d, 0x9a, 0x40, 0xc3, 0x87, 0xb4, 0x3a, 0x0f, 0xaf, 0xd5,
+  0x66, 0x28, 0x4c, 0x7e, 0x06, 0x72, 0x26, 0x1a, 0x80, 0x98, 0x38, 0x82, 0xe6, 0x7a, 0x34, 0x10,
+  0x91, 0xbc, 0xf2, 0x04, 0x0d, 0xfe, 0x5f, 0x72, 0x8b, 0xf6, 0x2d, 0xb2, 0x15, 0x91, 0x70, 0x89,
+  0x96, 0xfd, 0x87, 0xf8, 0x96, 0x8c, 0xe9, 0xda, 0x25, 0x3f, 0x8e, 0xdb, 0xde, 0xf9, 0x35, 0xcd,
+  0x68, 0x3a, 0xed, 0x36, 0x2e, 0x09, 0x20, 0xa6, 0xb5, 0x97, 0xf3, 0x00, 0x14, 0x89, 0xf0, 0x11,
+  0xfc, 0xfb, 0x84, 0x99, 0xba, 0x51, 0xfa, 0xb9, 0x3f, 0xfe, 0x1c, 0x9b, 0x3e, 0x26, 0xa9, 0x38,
+  0x95, 0x5f, 0xd5, 0x8f, 0x08, 0xba, 0x83, 0xc0, 0x3e, 0x7e, 0x9c, 0x46, 0xcd, 0x61, 0xa6, 0x9f,
+  0x19, 0x77, 0x63, 0xa7, 0x0d, 0xdf, 0x99, 0xd4, 0x5c, 0x45, 0x64, 0xe5, 0xd8, 0xd7, 0x57, 0x4b,
+  0x35, 0x49, 0xc5, 0xe9, 0x00, 0x57, 0xb2, 0x79, 0x7d, 0xd8, 0x2d, 0x15, 0xc6, 0x8f, 0x8d, 0x8a,
+  0xfc, 0x1d, 0x31, 0x7c, 0xd6, 0x14, 0x70, 0x42, 0xab, 0x17, 0x85, 0xe9, 0x7d, 0x90, 0xa3, 0x7f,
+  0x89, 0x82, 0x5b, 0x91, 0x59, 0xf3, 0xc7, 0xfb, 0x29, 0x6c, 0xc6, 0x65, 0x58, 0x17, 0x2b, 0x2f,
+  0x65, 0x38, 0x0d, 0x2f, 0x7e, 0xf1, 0x29, 0xb8, 0x4d, 0x32, 0x54, 0xea, 0x75, 0xb6, 0xf4, 0x00,
+  0x35, 0x04, 0xf3, 0x61, 0x1b, 0xa9, 0x21, 0xda, 0x98, 0x43, 0xf1, 0x6b, 0x92, 0x2b, 0xb1, 0x61,
+  0xd6, 0x52, 0x96, 0x94, 0x82, 0xb1, 0xd8, 0x6f, 0x62, 0x49, 0x6c, 0xbc, 0xfc, 0x8f, 0xb4, 0xfe,
+  0x18, 0x97, 0x52, 0xb6, 0x1b, 0x6c, 0xd4, 0x8f, 0x3c, 0x57, 0x27, 0x04, 0x9a, 0x35, 0xe5, 0x05,
+  0xa1, 0x53, 0xb7, 0xd2, 0x99, 0xe1, 0xf8, 0xad, 0xea, 0xab, 0x7a, 0x42, 0x71, 0x7f, 0x24, 0xbe,
+  0x71, 0xef, 0xe0, 0x36, 0xd1, 0x0f, 0x72, 0x90, 0x7b, 0x64, 0x8b, 0x7c, 0x30, 0xbe, 0x5f, 0x45,
+  0xc5, 0xe9, 0x33, 0x46, 0x1d, 0x20, 0x0b, 0x7f, 0x8d, 0x4a, 0x14, 0x89, 0xcf, 0x37, 0xc9, 0x3c,
+  0x89, 0x92, 0x75, 0x3a, 0x05, 0xcd, 0xe8, 0xf5, 0x2d, 0x4e, 0x24, 0xaf, 0x6f, 0xc9, 0x2b, 0x07,
+  0x96, 0xda, 0x6c, 0x3c, 0x46, 0x2e, 0x2d, 0x40, 0x81, 0x44, 0xaa, 0x6d, 0xb2, 0x46, 0xb2, 0x81,
+  0x01, 0xea, 0x68, 0x7a, 0xce, 0xc0, 0x3e, 0x56, 0x71, 0x85, 0x56, 0x39, 0xf3, 0x65, 0xad, 0xb0,
+  0xd8, 0x94, 0xf8, 0xb0, 0xcb, 0xf8, 0x00, 0xd1, 0x21, 0xae, 0x7a, 0xad, 0x48, 0x7a, 0x04, 0x2e,
+  0xac, 0x02, 0x81, 0x49, 0x10, 0xc2, 0xa8, 0x94, 0xb1, 0x06, 0xe0, 0xd4, 0x8f, 0x8b, 0xe3, 0x7b,
+  0xdc, 0x92, 0x4e, 0x22, 0xc5, 0x04, 0x48, 0xfd, 0xbb, 0xdf, 0xfd, 0x9b, 0x84, 0x14, 0x40, 0x15,
+  0xf9, 0xd7, 0x10, 0x79, 0x88, 0x8c, 0x74, 0x0f, 0x39, 0x8b, 0x86, 0x5f, 0x0d, 0xe5, 0x79, 0x2e,
+  0x66, 0xcd, 0x36, 0x74, 0x31, 0xf3, 0x2e, 0xaa, 0xd9, 0x32, 0x3b, 0xa6, 0xb2, 0xa7, 0xe1, 0xc7,
+  0x87, 0x02, 0x17, 0x26, 0x63, 0x05, 0x7a, 0x52, 0x38, 0xc1, 0xb9, 0x0f, 0x85, 0x45, 0x46, 0x67,
+  0x05, 0x10, 0x2b, 0xb1, 0xa6, 0x68, 0x10, 0xd3, 0x24, 0x77, 0x24, 0xb6, 0xff, 0x09, 0xda, 0x1c,
+  0xf2, 0x2c, 0x52, 0xb1, 0x90, 0x77, 0x91, 0x09, 0x9c, 0x88, 0x8d, 0x79, 0x38, 0xd1, 0xb3, 0x75,
+  0xf6, 0xbc, 0xea, 0x8b, 0x23, 0x95, 0x0c, 0xb0, 0x8b, 0x6e, 0x4e, 0x56, 0x77, 0xfc, 0xb5, 0xa5,
+  0x21, 0x1b, 0x44, 0x6e, 0x26, 0xda, 0x7d, 0x0c, 0x95, 0x88, 0x2a, 0xa9, 0xed, 0x23, 0xf4, 0xf9,
+  0xdd, 0x3f, 0xf8, 0xd9, 0xc1, 0x27, 0x7c, 0xa6, 0xee, 0xd2, 0xfc, 0xdf, 0x83, 0xd6, 0x8f, 0x38,
+  0x31, 0x1c, 0x7c, 0x02, 0x83, 0x42, 0x07, 0x58, 0xa3, 0x79, 0x31, 0xe8, 0xf5, 0x0f, 0x21, 0x52,
+  0xb2, 0xe2, 0xe7, 0x1b, 0xcd, 0x84, 0xe0, 0x78, 0x8b, 0xf9, 0x79, 0xfe, 0xa3, 0x00, 0xc4, 0xd1,
+  0xf7, 0xd0, 0xe0, 0xaf, 0xa3, 0x86, 0xde, 0x68, 0x9a, 0x9a, 0xfa, 0x26, 0xbb, 0x09, 0xa8, 0x53,
+  0x3a, 0xa9, 0xaa, 0x31, 0x3d, 0x8f, 0x89, 0xe2, 0x24, 0xa4, 0xbb, 0x26, 0x37, 0x82, 0x48, 0x2b,
+  0xcb, 0x1e, 0xbe, 0xe1, 0x45, 0x81, 0x53, 0xd5, 0xff, 0xdf, 0x1f, 0x3f, 0x06, 0x34, 0x7c, 0x4a,
+  0x18, 0x41, 0x2a, 0xb4, 0x2e, 0x79, 0x71, 0xb7, 0xaa, 0x7f, 0xf7, 0xdb, 0x9b, 0xda, 0xf8, 0x7f,
+  0xa3, 0x1a, 0x3d, 0x7e, 0xa2, 0x5b, 0xaf, 0x83, 0x50, 0x82, 0x55, 0x7f, 0x7e, 0x4b, 0x03, 0x89,
+  0xe4, 0x7d, 0x72, 0xb9, 0x7e, 0xac, 0x5b, 0x3f, 0xf2, 0x3b, 0x00, 0xe1, 0xbb, 0x3f, 0xfc, 0x58,
+  0x1b, 0xff, 0x0b, 0xb9, 0x62, 0xf7, 0xf5, 0x91, 0xba, 0xaf, 0xfa, 0xf9, 0xc8, 0x73, 0x40, 0x5f,
+  0x85, 0x05, 0xb5, 0x8e, 0xa2, 0x0d, 0xfe, 0xde, 0xd8, 0xdb, 0x13, 0x3f, 0xa5, 0xdd, 0x9a, 0xc8,
+  0x07, 0xbf, 0x58, 0xb8, 0xcb, 0x54, 0x30, 0x83, 0xd0, 0x09, 0x36, 0x89, 0xea, 0x06, 0xaf, 0xfa,
+  0x81, 0x22, 0x80, 0xc2, 0x0a, 0xd5, 0x73, 0x58, 0xee, 0xec, 0xa8, 0xe5, 0xa8, 0x3a, 0xea, 0x5c,
+  0x30, 0x97, 0xb4, 0x15, 0xd0, 0x6f, 0x00, 0x84, 0x4c, 0x8b, 0x00, 0x3f, 0x4e, 0xe0, 0xc7, 0x32,
+  0xfc, 0x72, 0x0a, 0x3f, 0x96, 0xe1, 0x53, 0x79, 0x22, 0xc4, 0x27, 0x4a, 0xe3, 0x96, 0x2a, 0x4b,
+  0x93, 0x92, 0xf8, 0xca, 0xa6, 0x58, 0x21, 0x49, 0xb5, 0x43, 0xf6, 0x06, 0x18, 0x8a, 0xa4, 0x5a,
+  0x82, 0x04, 0xeb, 0x65, 0x54, 0xcb, 0x2d, 0x45, 0xb5, 0xdc, 0x52, 0x54, 0x68, 0xf6, 0xc5, 0x49,
+  0x43, 0x45, 0xc5, 0xdc, 0x9a, 0xa2, 0x62, 0x6e, 0xcd, 0x50, 0x31, 0xb1, 0x47, 0xae, 0x61, 0xaa,
+  0xb3, 0xd0, 0x00, 0x2a, 0x24, 0x99, 0x93, 0x7e, 0xa4, 0xdf, 0x25, 0xd7, 0x41, 0x9b, 0x20, 0x13,
+  0xdb, 0x76, 0xa3, 0x35, 0x3f, 0x68, 0x78, 0x64, 0xb6, 0x17, 0x75, 0x47, 0x0a, 0xb5, 0x8a, 0x76,
+  0xbe, 0x6b, 0x6d, 0x5b, 0xad, 0xb8, 0xd3, 0x56, 0x6d, 0xcc, 0x33, 0xd1, 0x04, 0x34, 0xc2, 0x57,
+  0xd3, 0x71, 0xaf, 0x6d, 0xa6, 0xc4, 0x0d, 0x05, 0x0c, 0x8a, 0xd7, 0x4e, 0x3d, 0xcb, 0xf6, 0x76,
+  0x8d, 0x71, 0xe4, 0x8c, 0x2d, 0x7a, 0x5b, 0x31, 0x71, 0x25, 0xfb, 0xea, 0x26, 0x0c, 0x06, 0x88,
+  0xd0, 0x82, 0xdd, 0xd4, 0x02, 0x72, 0xb4, 0x50, 0x9d, 0x91, 0x87, 0xb5, 0x39, 0x73, 0x54, 0xd0,
+  0xd2, 0xb4, 0x66, 0x0f, 0xba, 0x9d, 0x8e, 0x7a, 0xd3, 0xd4, 0x36, 0x65, 0xd7, 0x91, 0xdd, 0x53,
+  0xf6, 0xea, 0xd4, 0x87, 0x64, 0xc0, 0xb7, 0x64, 0x46, 0xed, 0xb4, 0x73, 0x38, 0xa4, 0xec, 0xe0,
+  0x51, 0x28, 0x85, 0x51, 0x77, 0xb7, 0xac, 0xc6, 0xeb, 0xf0, 0xff, 0x33, 0x8e, 0xfb, 0xcc, 0xb8,
+  0xf4, 0x18, 0xe2, 0x26, 0xb7, 0xce, 0xee, 0xd6, 0x2a, 0x00, 0xad, 0x12, 0xd0, 0x8c, 0x09, 0x0d,
+  0x3d, 0x9b, 0x5a, 0xbb, 0xbb, 0xf9, 0x9c, 0x19, 0xd8, 0xc9, 0xf8, 0xfa, 0x27, 0xe0, 0xe3, 0x1f,
+  0xc2, 0x92, 0x79, 0xc0, 0xc5, 0xdf, 0x83, 0x0f, 0x90, 0xcb, 0xa3, 0x98, 0xc8, 0xcc, 0x7d, 0xb8,
+  0xc5, 0xdc, 0x39, 0xf8, 0x09, 0xca, 0x8e, 0x89, 0x9d, 0x17, 0x3e, 0xb5, 0x58, 0x07, 0xee, 0x51,
+  0x45, 0xd9, 0x7a, 0x1f, 0xaa, 0xbd, 0x0f, 0x8c, 0xef, 0xee, 0xc1, 0x47, 0x18, 0x47, 0xf3, 0x80,
+  0x4c, 0x84, 0xbf, 0x80, 0x2d, 0xfd, 0x7d, 0xb4, 0x0a, 0x02, 0x4c, 0x0a, 0x3f, 0x61, 0xb2, 0xb7,
+  0x06, 0xa0, 0x6e, 0x1f, 0xfc, 0x98, 0x99, 0x8e, 0x99, 0xf1, 0xf7, 0x0e, 0x45, 0xdd, 0xb0, 0x90,
+  0x1a, 0x14, 0xdb, 0xf1, 0x97, 0xf6, 0xdf, 0xd6, 0x5e, 0x7f, 0xad, 0x00, 0x0c, 0x99, 0xe4, 0x29,
+  0x90, 0x59, 0x29, 0x12, 0x87, 0x58, 0x2e, 0x6c, 0x69, 0xc0, 0xa1, 0xef, 0x41, 0x5f, 0x57, 0xae,
+  0x9e, 0xd5, 0x8c, 0x44, 0xb6, 0x27, 0x51, 0x1f, 0x34, 0x79, 0x0a, 0x98, 0xf9, 0x79, 0x62, 0x33,
+  0x86, 0x69, 0xbe, 0x76, 0xf5, 0xec, 0x89, 0x42, 0x4a, 0x25, 0xbd, 0x8a, 0x11, 0x98, 0x43, 0x6e,
+  0x0f, 0x9f, 0xed, 0x59, 0x93, 0xe8, 0x0a, 0xbe, 0xf4, 0x72, 0x1c, 0x19, 0xf5, 0x7e, 0xd3, 0x4c,
+  0x69, 0x29, 0xb0, 0xe1, 0xb9, 0x50, 0xdf, 0x8d, 0xbd, 0x4b, 0x5e, 0xb0, 0x19, 0xb7, 0x56, 0xec,
+  0x93, 0xab, 0xe8, 0xb8, 0xbb, 0xe6, 0x07, 0xf1, 0x42, 0xe5, 0x74, 0x18, 0x3a, 0xbb, 0xd8, 0xc2,
+  0x2a, 0x59, 0x65, 0x73, 0xbd, 0xb4, 0xc1, 0x64, 0x71, 0x20, 0x2f, 0xb5, 0xd5, 0xf2, 0xc9, 0x5c,
+  0x00, 0xb2, 0xba, 0xd8, 0x9a, 0x30, 0xfc, 0x26, 0x55, 0x0b, 0x22, 0x7b, 0x1a, 0xc0, 0x93, 0x56,
+  0x60, 0x5a, 0x03, 0x7a, 0x05, 0x8a, 0x50, 0x79, 0x49, 0x7a, 0x03, 0xb0, 0xe8, 0x6d, 0x3c, 0xeb,
+  0xed, 0x12, 0xbe, 0xad, 0x27, 0x60, 0xb3, 0xaf, 0x4f, 0xc1, 0xeb, 0xb4, 0xff, 0x1e, 0x1f, 0x00,
+  0xab, 0xc3, 0xde, 0x34, 0xbb, 0xa1, 0x81, 0x31, 0x31, 0xbe, 0x5d, 0xaa, 0xf9, 0xcb, 0x41, 0xcd,
+  0xcf, 0xe5, 0xcc, 0xa1, 0xcc, 0xd4, 0x53, 0xe7, 0x65, 0x1c, 0xad, 0xfb, 0x1b, 0x27, 0xb8, 0x6f,
+  0x10, 0x6b, 0xf4, 0xa8, 0xc4, 0x1e, 0xba, 0x71, 0x15, 0xe6, 0xc0, 0x2d, 0xb0, 0xa9, 0x61, 0x8e,
+  0x4e, 0x58, 0xec, 0x05, 0x3d, 0x27, 0x15, 0xbf, 0x0a, 0x0b, 0xbd, 0x65, 0x98, 0xb9, 0x32, 0x7b,
+  0x23, 0x8a, 0xcf, 0xf7, 0xdb, 0xed, 0x1f, 0x7a, 0xe8, 0x0c, 0x06, 0x3e, 0xaf, 0x34, 0x50, 0xbd,
+  0x99, 0x12, 0xa0, 0x8c, 0x47, 0x33, 0x7d, 0x93, 0x7a, 0x35, 0xad, 0x63, 0x2c, 0x84, 0x69, 0x50,
+  0x1d, 0xc0, 0x08, 0x8b, 0xa8, 0x4c, 0xc5, 0xd5, 0x18, 0x07, 0x6b, 0xdb, 0xf9, 0x85, 0xca, 0x8b,
+  0x4b, 0xa7, 0x56, 0xf3, 0x2f, 0xbd, 0x44, 0x25, 0xf0, 0xd2, 0xaa, 0x57, 0xeb, 0xbc, 0x5a, 0x69,
+  0x24, 0xac, 0x57, 0x7c, 0xfe, 0xe0, 0x1b, 0x15, 0x96, 0x04, 0x3d, 0x9d, 0x01, 0xf5, 0xec, 0xdd,
+  0x84, 0xe0, 0x64, 0x43, 0x37, 0x5f, 0x45, 0x7a, 0xee, 0x5d, 0xd9, 0xb0, 0x0d, 0x6c, 0x26, 0x2c,
+  0x38, 0x88, 0xf3, 0x33, 0xfd, 0x66, 0xd3, 0x83, 0x4f, 0xad, 0x5e, 0x0e, 0xbb, 0x1d, 0x3f, 0xf2,
+  0x0a, 0xa1, 0xf7, 0x8e, 0xd7, 0x88, 0x13, 0xab, 0x37, 0xa3, 0x4b, 0x93, 0xc7, 0x0c, 0x8d, 0xff,
+  0x48, 0xab, 0x0a, 0xfd, 0x33, 0x5f, 0x89, 0x08, 0x35, 0x5a, 0x35, 0x1f, 0x90, 0xa8, 0x06, 0x6b,
+  0x44, 0x13, 0x4a, 0xdf, 0x94, 0x85, 0x6d, 0xa1, 0x24, 0x4e, 0x31, 0x6e, 0x07, 0x3f, 0x05, 0x61,
+  0x8f, 0x1a, 0x2a, 0xaa, 0xf1, 0x3d, 0x72, 0xf9, 0x3c, 0x80, 0x35, 0x98, 0xc6, 0x51, 0x91, 0xe0,
+  0x7e, 0x93, 0xfc, 0x04, 0x0f, 0x8e, 0xf1, 0x60, 0x35, 0x8d, 0x84, 0xce, 0x9b, 0x68, 0xf8, 0x87,
+  0x7f, 0x6f, 0x4b, 0x0c, 0x23, 0xc2, 0x6d, 0x10, 0x59, 0x46, 0x1a, 0x9e, 0xf1, 0x28, 0x15, 0x5d,
+  0x49, 0x43, 0xba, 0x05, 0xac, 0xe2, 0x31, 0x79, 0x2d, 0xb8, 0xdb, 0x01, 0x2b, 0x3d, 0x49, 0x63,
+  0xd0, 0xd2, 0x6f, 0x49, 0xe2, 0xd0, 0x22, 0xd8, 0xd6, 0x75, 0x5d, 0x0a, 0x6f, 0x48, 0xac, 0xf7,
+  0x12, 0xe3, 0x77, 0xbb, 0x81, 0x67, 0x93, 0x85, 0x9f, 0x49, 0x05, 0xa1, 0x83, 0xf2, 0x93, 0x6f,
+  0x48, 0x62, 0xd1, 0xa1, 0x71, 0x3f, 0x3c, 0x82, 0x46, 0xf2, 0xb8, 0x02, 0xdc, 0xd8, 0xf1, 0x83,
+  0x48, 0x8a, 0x1e, 0x9a, 0x12, 0x5f, 0x33, 0x12, 0x32, 0x1d, 0x1f, 0xa9, 0x90, 0xe9, 0xb2, 0x54,
+  0x40, 0xa8, 0x59, 0x15, 0x5f, 0x93, 0x13, 0xb5, 0x8f, 0x74, 0x77, 0x08, 0x81, 0x31, 0xf4, 0x60,
+  0xef, 0xc3, 0x18, 0x19, 0x09, 0x23, 0x92, 0x1b, 0x43, 0x08, 0xbe, 0x44, 0xa9, 0xe4, 0x26, 0xe1,
+  0xd5, 0xdc, 0x42, 0x00, 0x9b, 0x6a, 0x8d, 0x97, 0x32, 0x5c, 0xc1, 0x27, 0xc6, 0x36, 0x46, 0x03,
+  0x16, 0xda, 0xc4, 0xa2, 0x56, 0xdd, 0xf8, 0x15, 0x6f, 0xd7, 0xc0, 0x92, 0x75, 0xa9, 0x38, 0x5f,
+  0xde, 0x28, 0xb8, 0xb1, 0x59, 0xd5, 0x75, 0xd1, 0x1c, 0x86, 0xd1, 0x1d, 0x44, 0x49, 0xb0, 0x15,
+  0x0c, 0x7b, 0x48, 0x5e, 0x2f, 0x6a, 0x1e, 0x62, 0xe5, 0x15, 0x84, 0x6d, 0x52, 0xa8, 0x61, 0xa1,
+  0xd7, 0x8f, 0xa0, 0x0e, 0x46, 0xf2, 0x98, 0x35, 0xe9, 0x5b, 0xa4, 0x1e, 0x56, 0x96, 0x80, 0x75,
+  0x50, 0x65, 0x36, 0x9c, 0xa8, 0xed, 0x37, 0x3c, 0x23, 0xbf, 0x94, 0x30, 0x14, 0x8d, 0xe6, 0x55,
+  0x4c, 0x62, 0xe2, 0xc9, 0xc1, 0x42, 0x5e, 0x96, 0xca, 0x44, 0x23, 0xae, 0x3e, 0xfd, 0x2e, 0x25,
+  0x4e, 0xda, 0x7a, 0xe0, 0xe1, 0x13, 0xb1, 0x55, 0xdd, 0x43, 0x7b, 0x50, 0x42, 0x61, 0xe3, 0xfd,
+  0xaa, 0x4c, 0xe0, 0xfb, 0x64, 0x46, 0x42, 0xdd, 0x1e, 0x3d, 0x91, 0xb2, 0x83, 0x8b, 0x6d, 0x8c,
+  0x3c, 0x10, 0xf3, 0x1e, 0xf9, 0x2e, 0x01, 0x14, 0x2a, 0xf7, 0x5f, 0xd0, 0x3e, 0x85, 0x2f, 0x9f,
+  0x60, 0x1f, 0xd0, 0xfc, 0x7e, 0xb2, 0x2d, 0x42, 0x5f, 0x6e, 0x7c, 0xec, 0x08, 0x52, 0x00, 0x82,
+  0x9a, 0xe6, 0xf4, 0xa2, 0x6f, 0x63, 0xc5, 0x0d, 0x7b, 0x85, 0xf3, 0x18, 0x7d, 0xb5, 0xd7, 0x05,
+  0x9e, 0x1e, 0xd9, 0x80, 0x20, 0xd1, 0x08, 0xdd, 0x5e, 0x38, 0x0d, 0x84, 0x44, 0xe6, 0x13, 0x13,
+  0x53, 0xdf, 0x60, 0x53, 0x2f, 0x50, 0x08, 0xe8, 0xe3, 0x60, 0x15, 0x24, 0x2a, 0x52, 0x0e, 0x2e,
+  0x19, 0x8d, 0x96, 0x82, 0xf6, 0x1c, 0xc6, 0x0c, 0x24, 0x6b, 0x5e, 0xe2, 0x0b, 0xd1, 0xf6, 0xe6,
+  0x21, 0x06, 0x2a, 0xa8, 0x9d, 0x87, 0x1a, 0xa9, 0x66, 0x76, 0x1c, 0xf1, 0xb8, 0xb7, 0x27, 0xd1,
+  0xe8, 0x72, 0x45, 0x2c, 0x69, 0xee, 0x0e, 0x84, 0xa5, 0x93, 0xb8, 0xfc, 0x40, 0xd7, 0x48, 0x1f,
+  0xa6, 0xa8, 0x28, 0x55, 0x54, 0xfb, 0xb8, 0xea, 0xb0, 0xbd, 0x29, 0x89, 0xea, 0xfa, 0x32, 0xca,
+  0xba, 0xda, 0x8e, 0x3d, 0x77, 0x72, 0xb1, 0x34, 0xa7, 0xed, 0xda, 0x73, 0xe5, 0x0a, 0xfc, 0xc5,
+  0xc2, 0xbc, 0x13, 0x34, 0x5a, 0x30, 0x7d, 0x73, 0x1d, 0xdf, 0x75, 0xdb, 0xde, 0x9c, 0xd6, 0xf4,
+  0x61, 0x6a, 0xe7, 0xbe, 0xd7, 0x5c, 0x74, 0x96, 0x2a, 0x0b, 0xf0, 0x08, 0x7c, 0x29, 0x1f, 0xf9,
+  0xef, 0x79, 0xf6, 0x5c, 0xe5, 0x14, 0x7f, 0x64, 0x06, 0x05, 0x7b, 0xae, 0xde, 0x6d, 0xbb, 0x73,
+  0x2b, 0x7a, 0x6e, 0x10, 0xe7, 0xf4, 0xe5, 0x22, 0x42, 0x83, 0x07, 0xbe, 0x92, 0xa6, 0x74, 0xb9,
+  0x78, 0x44, 0x97, 0x8b, 0xa5, 0xa5, 0xd2, 0xc9, 0x92, 0xd2, 0x65, 0x79, 0x61, 0x6e, 0x05, 0xf4,
+  0x65, 0xf2, 0xe5, 0x7f, 0x03, 0x2b, 0x0d, 0x37, 0x1d, 0x8a, 0xa1, 0xe6, 0x4c, 0xfd, 0x9e, 0xd8,
+  0x3c, 0x0e, 0x3e, 0x48, 0xc2, 0x82, 0x95, 0x68, 0x60, 0x31, 0xac, 0x69, 0xcb, 0x37, 0x95, 0x4a,
+  0x64, 0x76, 0x50, 0xae, 0x30, 0x76, 0xc0, 0xa3, 0x74, 0xd1, 0x1a, 0xea, 0xdb, 0xb4, 0x0d, 0x33,
+  0x3e, 0x7f, 0xc9, 0x0f, 0xbc, 0xb5, 0xed, 0x4d, 0x03, 0x30, 0x6c, 0x41, 0xb1, 0xa5, 0x0f, 0x74,
+  0x4b, 0xe7, 0xe8, 0xd2, 0xad, 0x97, 0x60, 0xab, 0x5f, 0x58, 0x2c, 0x59, 0x4b, 0x20, 0xa6, 0xc1,
+  0x7f, 0x15, 0x0b, 0x7e, 0x73, 0x47, 0x8d, 0x42, 0xfa, 0xc4, 0xd4, 0xb5, 0x9e, 0xb3, 0xe9, 0x3d,
+  0x87, 0xa4, 0x0f, 0x7b, 0xc3, 0x65, 0x16, 0x6f, 0xd7, 0xb2, 0xea, 0x71, 0xc0, 0x28, 0x56, 0x84,
+  0x5c, 0xdb, 0xad, 0xa3, 0x42, 0x4e, 0x59, 0xc5, 0x3c, 0xb4, 0x94, 0x42, 0x69, 0xeb, 0xf6, 0x4a,
+  0xfd, 0xa8, 0x50, 0x5a, 0x68, 0x71, 0x54, 0x80, 0xea, 0x3f, 0x5d, 0x3b, 0x77, 0xe5, 0x87, 0x37,
+  0xce, 0x5c, 0x3b, 0xfb, 0xca, 0xb9, 0xab, 0xeb, 0xad, 0x0d, 0x16, 0x08, 0xfa, 0x4f, 0x38, 0x06,
+  0xa3, 0x95, 0x54, 0x6a, 0x81, 0x18, 0x56, 0x62, 0xaf, 0x70, 0x44, 0x26, 0x8b, 0x9d, 0x51, 0xf7,
+  0x5a, 0x36, 0x5b, 0xdf, 0xfe, 0x27, 0xa8, 0x0c, 0xef, 0x1f, 0x7c, 0xf2, 0xed, 0x23, 0x46, 0x76,
+  0x77, 0x19, 0xb3, 0x65, 0xd1, 0x0a, 0x4f, 0x48, 0xbb, 0xf9, 0xa5, 0xa5, 0x71, 0xce, 0xcd, 0x4c,
+  0xb5, 0x2c, 0x68, 0x74, 0x1f, 0xab, 0x3d, 0x46, 0xc9, 0xe8, 0x76, 0xc2, 0xf3, 0xbf, 0xa2, 0x56,
+  0x77, 0xb9, 0x91, 0x52, 0xfb, 0xef, 0x0b, 0xa5, 0x12, 0xc9, 0x44, 0x64, 0x44, 0x7b, 0xa8, 0x19,
+  0x97, 0xae, 0x5e, 0x3d, 0x63, 0xaa, 0x72, 0x07, 0x0d, 0x0f, 0xb1, 0x9b, 0xf0, 0xe4, 0x26, 0x88,
+  0x6e, 0x76, 0x05, 0x24, 0xc5, 0x7c, 0xa9, 0x0c, 0xff, 0xcd, 0xc7, 0x5d, 0xd8, 0xdf, 0x77, 0x3b,
+  0xae, 0x14, 0x15, 0x99, 0x3b, 0xb5, 0x74, 0x12, 0x0f, 0x29, 0xa0, 0xc6, 0x3b, 0xcf, 0x79, 0xf8,
+  0x02, 0xf2, 0x70, 0x89, 0xcd, 0xe3, 0x8e, 0x7f, 0xe3, 0x5d, 0xa0, 0x6f, 0xdb, 0xad, 0xdd, 0x78,
+  0xf7, 0x02, 0x4a, 0xdf, 0x4d, 0x23, 0x99, 0x42, 0x44, 0x4f, 0x06, 0x21, 0x93, 0x71, 0x0d, 0x8a,
+  0x94, 0xf8, 0x80, 0x74, 0xbc, 0x8f, 0x68, 0x63, 0xd2, 0x16, 0x70, 0x9f, 0xbb, 0x4d, 0xe2, 0xde,
+  0x43, 0xae, 0x68, 0x31, 0x8b, 0xb6, 0x64, 0x56, 0xd4, 0xe8, 0x9c, 0xc3, 0x2d, 0x26, 0x62, 0xa2,
+  0xa0, 0x88, 0xdb, 0x1e, 0x1e, 0x40, 0x98, 0x82, 0xb0, 0x7d, 0x2e, 0xf4, 0x11, 0x2d, 0x99, 0x4c,
+  0xcb, 0xdb, 0xe7, 0x12, 0xde, 0xa4, 0x30, 0x5a, 0xd5, 0x44, 0xd4, 0x3d, 0xc2, 0xbc, 0x23, 0x62,
+  0x7d, 0x1e, 0x32, 0xe3, 0x38, 0xf0, 0x88, 0xdb, 0xda, 0xe9, 0xcb, 0xe9, 0x49, 0x0d, 0xb4, 0xad,
+  0xe3, 0xac, 0x42, 0x4f, 0xa8, 0xb3, 0x4a, 0x13, 0x02, 0x90, 0x53, 0x47, 0x0f, 0x0c, 0xe9, 0x23,
+  0xaa, 0xf6, 0xa1, 0xb4, 0x89, 0xf3, 0x80, 0x59, 0x99, 0xe8, 0xec, 0xe1, 0x8b, 0x95, 0xaa, 0x5e,
+  0x6e, 0xe9, 0x56, 0x79, 0xe9, 0x54, 0x55, 0xaf, 0xc0, 0x8f, 0x17, 0x2b, 0xa5, 0xaa, 0xbe, 0xd4,
+  0xd2, 0xc5, 0xe9, 0x02, 0x42, 0x3b, 0x9e, 0xcc, 0xb0, 0x34, 0x86, 0xfa, 0x74, 0xce, 0x71, 0x22,
+  0x63, 0x73, 0x38, 0xa9, 0xfb, 0x48, 0xb1, 0xfd, 0x40, 0x0a, 0xb2, 0xd6, 0x92, 0xd7, 0x73, 0x5c,
+  0xe9, 0xa4, 0x57, 0xa9, 0x9e, 0x93, 0xd5, 0x40, 0x27, 0xaa, 0x72, 0x4d, 0xe9, 0x30, 0x4d, 0x95,
+  0xc9, 0x5a, 0x20, 0x69, 0x09, 0x75, 0xc3, 0x8d, 0x0b, 0x51, 0xbf, 0x1e, 0x31, 0x28, 0x4b, 0xc0,
+  0xe3, 0xcc, 0x9c, 0x52, 0xb4, 0x60, 0x2d, 0x66, 0x4a, 0x4a, 0x56, 0x25, 0x53, 0x52, 0x2e, 0x2b,
+  0x7d, 0xc8, 0x2b, 0x34, 0xdd, 0x49, 0xdf, 0xb5, 0xf5, 0x79, 0xa2, 0xf5, 0x2c, 0x75, 0xe7, 0x5b,
+  0x27, 0x16, 0x96, 0x12, 0xf2, 0x9e, 0x42, 0xfe, 0x58, 0x5c, 0xef, 0x37, 0xb6, 0xbc, 0x18, 0x5e,
+  0x65, 0xf8, 0x01, 0xbc, 0x72, 0x36, 0x37, 0xed, 0x8e, 0xe7, 0x04, 0x92, 0x6f, 0x09, 0x70, 0x61,
+  0x37, 0xed, 0x15, 0x59, 0x72, 0x22, 0x52, 0x63, 0xf1, 0x42, 0x00, 0xa5, 0xa9, 0x6a, 0x54, 0x5c,
+  0x6a, 0x92, 0x9c, 0x53, 0xf6, 0x70, 0x24, 0xe9, 0xb9, 0xfd, 0xd8, 0x36, 0x50, 0x74, 0xb5, 0xb6,
+  0x60, 0xad, 0x4c, 0xc8, 0xb0, 0x46, 0x67, 0x1d, 0x85, 0xd7, 0x0d, 0x9b, 0xff, 0xdd, 0xdb, 0x43,
+  0x0d, 0x16, 0x7f, 0x8e, 0xcc, 0xf5, 0xad, 0x0d, 0x3b, 0x2c, 0xe0, 0xf0, 0x6a, 0xa3, 0xd4, 0x1d,
+  0x44, 0x21, 0xe8, 0xc9, 0x89, 0xa2, 0x7b, 0xe3, 0x07, 0x20, 0x48, 0xde, 0xd6, 0xce, 0xad, 0x5d,
+  0x3e, 0x55, 0x59, 0x5a, 0xd2, 0xb8, 0x0d, 0xfd, 0x31, 0xe9, 0x41, 0xa4, 0xa7, 0xdd, 0x21, 0xf1,
+  0xf0, 0x43, 0xdc, 0x01, 0xb3, 0xa1, 0x53, 0x77, 0x19, 0x2f, 0x31, 0x74, 0xb6, 0x87, 0x0b, 0xb9,
+  0x6e, 0x00, 0xe3, 0x82, 0x61, 0x1b, 0x03, 0xdc, 0xce, 0x12, 0x5a, 0xa3, 0x8a, 0x18, 0xb5, 0x82,
+  0x44, 0x21, 0x73, 0x8f, 0x98, 0x57, 0x8f, 0x2d, 0x3d, 0xce, 0x54, 0xaf, 0x63, 0xdc, 0xa2, 0x5a,
+  0xbb, 0x9e, 0x6a, 0x17, 0xd8, 0xa8, 0x6e, 0xe9, 0x75, 0x3d, 0x91, 0xb8, 0xd9, 0x6a, 0x78, 0xbd,
+  0x8e, 0x8a, 0x28, 0xb3, 0xcc, 0x47, 0x46, 0xc7, 0x2c, 0x80, 0x44, 0x19, 0x1b, 0x86, 0x63, 0xd5,
+  0x01, 0x83, 0x8c, 0x08, 0x1d, 0x14, 0xf8, 0x97, 0xd9, 0xef, 0x3a, 0xfe, 0x5e, 0xcd, 0x97, 0xab,
+  0x65, 0x09, 0x0e, 0xdf, 0x79, 0x12, 0xc1, 0x3f, 0x65, 0x66, 0xad, 0x69, 0xaa, 0xd4, 0xb4, 0x50,
+  0x2d, 0xd9, 0x88, 0x1a, 0x77, 0x37, 0x37, 0xdb, 0xde, 0x1a, 0x00, 0x81, 0x11, 0x45, 0xd2, 0x3e,
+  0x97, 0x1e, 0x24, 0x5a, 0x8f, 0x36, 0xec, 0xe3, 0xea, 0xf3, 0xe4, 0x36, 0xc5, 0xe0, 0x24, 0x3b,
+  0x95, 0xa5, 0xd6, 0x97, 0x88, 0x68, 0x10, 0x3a, 0xbd, 0x43, 0x1c, 0x1e, 0xf8, 0x1a, 0x16, 0x70,
+  0x24, 0xcc, 0x8a, 0xf8, 0x6c, 0x52, 0x23, 0x6e, 0xf2, 0x74, 0xfd, 0xa8, 0xd7, 0x76, 0x76, 0x6d,
+  0xb5, 0x83, 0x55, 0x1d, 0xc4, 0xc2, 0x00, 0x84, 0x6f, 0x7d, 0xc6, 0x2e, 0x97, 0x86, 0xd0, 0xf9,
+  0xed, 0xd8, 0x0b, 0xd1, 0x30, 0x25, 0x39, 0x39, 0x04, 0x16, 0x13, 0x83, 0x12, 0x8a, 0x4a, 0xe9,
+  0x98, 0x1b, 0xfd, 0xb8, 0xdb, 0x6c, 0xda, 0x72, 0x44, 0x3e, 0x6f, 0x20, 0x16, 0xa9, 0xe4, 0x7c,
+  0x67, 0x62, 0x16, 0xeb, 0x26, 0x55, 0x39, 0xc5, 0x0a, 0x72, 0x61, 0x4e, 0xd1, 0x53, 0x03, 0xac,
+  0xa2, 0x43, 0xb3, 0x52, 0x34, 0xde, 0x72, 0x87, 0x95, 0x91, 0xf9, 0x56, 0x41, 0xf9, 0x71, 0x12,
+  0x7e, 0x44, 0x39, 0x5e, 0x54, 0xcd, 0xfc, 0x2d, 0x26, 0x0a, 0x38, 0x10, 0x91, 0x18, 0x72, 0xc2,
+  0x45, 0x73, 0x9d, 0xf5, 0x85, 0x0d, 0x0b, 0xfe, 0xad, 0x6c, 0xe4, 0xcb, 0xf8, 0xb7, 0x4c, 0x4f,
+  0x27, 0xe9, 0xdf, 0x45, 0xfa, 0x77, 0x69, 0xc3, 0x44, 0xd4, 0x63, 0x1c, 0xa5, 0x61, 0xae, 0xd8,
+  0xec, 0xfb, 0x64, 0xe1, 0x91, 0x62, 0xe5, 0x58, 0xa0, 0x9f, 0x58, 0x9f, 0x9f, 0x92, 0xf7, 0xec,
+  0x2e, 0x89, 0x9d, 0x3f, 0xc3, 0x70, 0x54, 0xd8, 0xc8, 0x84, 0xa3, 0x3f, 0xf5, 0x89, 0xc9, 0x1b,
+  0x0b, 0x3b, 0x5d, 0xc7, 0x2c, 0x23, 0x15, 0xd0, 0xb7, 0x53, 0xb1, 0x52, 0xa3, 0xad, 0xe5, 0x3e,
+  0x5a, 0x35, 0x49, 0xc2, 0xfd, 0xee, 0x67, 0xff, 0x51, 0x11, 0x4d, 0x1f, 0xe2, 0x01, 0x32, 0x36,
+  0x2f, 0x4d, 0xae, 0x2e, 0x68, 0xcb, 0x5a, 0x46, 0x61, 0x08, 0x6c, 0x89, 0xf0, 0xcb, 0xab, 0x4b,
+  0xa5, 0xaa, 0xf4, 0xbc, 0xb4, 0xba, 0x20, 0x15, 0x9c, 0x58, 0x2a, 0x29, 0x5f, 0x26, 0x4b, 0xc1,
+  0x49, 0x20, 0x40, 0x60, 0x49, 0xda, 0x89, 0x69, 0x66, 0xcc, 0x53, 0x4d, 0x95, 0x84, 0x54, 0xf2,
+  0x92, 0xf4, 0x22, 0x64, 0xba, 0x86, 0x2a, 0x9c, 0x89, 0x51, 0x00, 0xff, 0x53, 0xe4, 0x8e, 0xf9,
+  0x79, 0x5c, 0xca, 0x76, 0xf2, 0x19, 0xf8, 0x0c, 0x44, 0xc9, 0xff, 0x08, 0x55, 0xbe, 0x6c, 0xae,
+  0xd2, 0x73, 0x95, 0x4e, 0x38, 0xca, 0xea, 0x94, 0xc0, 0xcc, 0xfc, 0xbc, 0x76, 0x1c, 0xba, 0x15,
+  0xd8, 0x59, 0x1f, 0xfa, 0x6e, 0x95, 0x9d, 0x5c, 0x42, 0x07, 0x69, 0x63, 0xb7, 0x0a, 0x82, 0xfe,
+  0xc8, 0x92, 0x4a, 0x63, 0x2a, 0x7d, 0x49, 0x2d, 0xac, 0x53, 0xe1, 0x8b, 0xa5, 0xd1, 0x46, 0xc2,
+  0xc3, 0xc5, 0xd7, 0xe2, 0x61, 0x3d, 0xce, 0x6f, 0xd0, 0x65, 0x79, 0x98, 0xea, 0x17, 0x15, 0xb8,
+  0x3b, 0x80, 0xd3, 0x26, 0xd4, 0x35, 0x8f, 0x54, 0xd1, 0x60, 0xad, 0x17, 0x1a, 0xbb, 0x39, 0xfd,
+  0x2f, 0x53, 0x9a, 0xfe, 0x30, 0xa1, 0x20, 0xa9, 0xaa, 0xd0, 0xc8, 0x3c, 0x5c, 0x25, 0x02, 0xd4,
+  0xed, 0xed, 0x49, 0x2c, 0x21, 0xc1, 0x71, 0x2f, 0x99, 0x04, 0xd9, 0xff, 0xc9, 0xb5, 0x25, 0xda,
+  0x07, 0x85, 0x89, 0x2a, 0xe5, 0x43, 0x85, 0x81, 0x98, 0x06, 0xa1, 0x55, 0x0d, 0x84, 0x4a, 0x95,
+  0x70, 0xbf, 0x08, 0x4b, 0x60, 0xe9, 0xf7, 0x90, 0x35, 0xa8, 0xfe, 0x6b, 0x90, 0x51, 0x38, 0xd7,
+  0xd8, 0xb6, 0x57, 0xb8, 0xbb, 0x71, 0xdb, 0x54, 0x9c, 0x7f, 0x9d, 0xc0, 0x86, 0x6d, 0x36, 0xf4,
+  0xdc, 0x3e, 0x50, 0x2f, 0xdf, 0x37, 0x9c, 0xe5, 0xfa, 0xaa, 0x53, 0xad, 0x9b, 0x56, 0x67, 0x67,
+  0xca, 0xcb, 0x15, 0xfe, 0xd2, 0xd9, 0x9e, 0xf2, 0x32, 0x57, 0xb7, 0x4a, 0x66, 0x71, 0x20, 0xbe,
+  0x34, 0xe3, 0x8e, 0x6b, 0xe4, 0x07, 0xb0, 0x34, 0x74, 0xab, 0x13, 0x28, 0x0e, 0x75, 0xb5, 0x82,
+  0xb3, 0x03, 0x15, 0x76, 0xb2, 0x1e, 0x77, 0x15, 0x8a, 0xb3, 0xbd, 0xa9, 0xc3, 0x00, 0x66, 0x42,
+  0x01, 0x8c, 0xe8, 0x96, 0x84, 0xf0, 0x5a, 0x62, 0x6d, 0x14, 0x5a, 0xe8, 0xec, 0xfd, 0x82, 0x53,
+  0xba, 0x39, 0x43, 0x49, 0xad, 0x2c, 0x49, 0x4a, 0xea, 0xc9, 0x4a, 0x1a, 0x4d, 0x38, 0x9a, 0x32,
+  0x7d, 0x71, 0x76, 0xfa, 0xe2, 0xec, 0xf4, 0xc5, 0xb3, 0xa7, 0x2f, 0x9e, 0x3e, 0x7d, 0xf3, 0xf3,
+  0xdb, 0x14, 0xdb, 0x9a, 0x30, 0xec, 0xf4, 0x33, 0x87, 0x12, 0x0a, 0x62, 0xc2, 0x74, 0x3c, 0x6b,
+  0x6e, 0x95, 0xc0, 0x4c, 0xa5, 0x19, 0xe2, 0x3f, 0x9e, 0x35, 0xeb, 0x4a, 0xb3, 0xd1, 0xb3, 0x62,
+  0x35, 0x16, 0x58, 0x8d, 0x11, 0xab, 0x8b, 0x4b, 0x8d, 0x46, 0xb3, 0xf2, 0x17, 0x60, 0xb5, 0x9e,
+  0xc5, 0x6a, 0x3d, 0xc5, 0xea, 0x33, 0x8c, 0xa6, 0x2e, 0x46, 0x53, 0xc7, 0xd1, 0x2c, 0x35, 0x1b,
+  0xcd, 0x97, 0x5e, 0x3c, 0x72, 0x34, 0x8a, 0x31, 0xe2, 0x5a, 0x00, 0x92, 0x49, 0x18, 0x39, 0x6d,
+  0x6d, 0xed, 0x8d, 0x1f, 0x68, 0x6d, 0xe8, 0x96, 0xfa, 0x07, 0x59, 0x5d, 0xfb, 0xfb, 0xb0, 0xb3,
+  0x65, 0x6d, 0x2e, 0x5b, 0xde, 0xae, 0x45, 0x0e, 0x78, 0xeb, 0xba, 0x75, 0xc1, 0xba, 0x64, 0x5d,
+  0xb1, 0xae, 0x5a, 0x67, 0x2c, 0x3c, 0xac, 0x74, 0x7a, 0xc7, 0x8b, 0x94, 0x73, 0x88, 0xd7, 0xed,
+  0xeb, 0xf9, 0x4b, 0xf9, 0x2b, 0x96, 0xd6, 0xbb, 0x60, 0x5f, 0xc8, 0x5f, 0xcd, 0x9f, 0x49, 0x05,
+  0x12, 0x90, 0x36, 0x67, 0x52, 0xed, 0x3a, 0x74, 0xb1, 0x71, 0x34, 0xe1, 0xe2, 0x94, 0x22, 0x18,
+  0xd9, 0x7a, 0x97, 0x61, 0xec, 0x6f, 0x27, 0x8c, 0xfd, 0x85, 0xe1, 0xf5, 0x62, 0x65, 0x44, 0xbc,
+  0xfd, 0x85, 0xe1, 0x05, 0xfa, 0xf9, 0x37, 0xe5, 0xec, 0x6f, 0xab, 0x76, 0x79, 0x76, 0x48, 0x9d,
+  0x9d, 0x4b, 0xa7, 0x43, 0xad, 0xe2, 0x80, 0xcd, 0x2d, 0x32, 0x59, 0x33, 0x3b, 0xf2, 0x1d, 0x0a,
+  0xce, 0xd9, 0x27, 0x99, 0x03, 0xd4, 0x0a, 0x50, 0x19, 0x3e, 0x47, 0x2f, 0x09, 0x59, 0x36, 0x6e,
+  0xa2, 0x0c, 0x82, 0xa1, 0x3e, 0x8f, 0xf1, 0x58, 0x7b, 0x62, 0x92, 0x26, 0x5f, 0x10, 0xe8, 0xc0,
+  0x1f, 0xa2, 0x65, 0x1a, 0x55, 0xf0, 0x9f, 0x92, 0x6e, 0xfd, 0x08, 0x20, 0x1a, 0x25, 0xcd, 0xa6,
+  0x91, 0xa5, 0xea, 0xc7, 0x63, 0x91, 0xde, 0x80, 0x94, 0x12, 0xac, 0xa7, 0x15, 0xb5, 0x6b, 0x6b,
+  0x67, 0x50, 0x92, 0x41, 0x6d, 0x38, 0x6a, 0x38, 0x6d, 0xef, 0x0d, 0x9c, 0x09, 0x03, 0x50, 0x4e,
+  0x47, 0x80, 0xf5, 0xbd, 0x3d, 0xfe, 0x13, 0x48, 0x7b, 0x95, 0xd0, 0x9b, 0x4e, 0xc3, 0xf6, 0x4a,
+  0xa9, 0x50, 0x5a, 0x34, 0xab, 0x58, 0x2c, 0x22, 0xd4, 0x04, 0x08, 0x69, 0x16, 0x52, 0xb0, 0xa2,
+  0x22, 0x76, 0x06, 0xbb, 0x44, 0x5a, 0x79, 0xf6, 0x66, 0x31, 0xb3, 0x0e, 0xe7, 0x1e, 0xb5, 0x04,
+  0xbb, 0xe8, 0x79, 0xda, 0x47, 0xbf, 0xd3, 0xc1, 0x2f, 0x09, 0x55, 0x8b, 0xdf, 0xd7, 0x40, 0x9b,
+  0xc6, 0x23, 0x39, 0x2c, 0xa2, 0x09, 0xdd, 0x01, 0x1f, 0x1c, 0xdc, 0x2e, 0x52, 0x14, 0xd0, 0x83,
+  0xf1, 0x97, 0xa0, 0xb6, 0x01, 0xde, 0x6e, 0xb1, 0x4c, 0x0a, 0x1a, 0x45, 0x7e, 0xf2, 0xc4, 0x11,
+  0x14, 0x11, 0xc5, 0x4c, 0xfe, 0x8f, 0x28, 0x7f, 0x00, 0x99, 0x44, 0x34, 0x44, 0xe1, 0x43, 0x42,
+  0xf8, 0x2f, 0xc7, 0x5f, 0x27, 0x94, 0x4b, 0x51, 0x35, 0x76, 0x67, 0x27, 0xdf, 0x09, 0xf6, 0xf6,
+  0xca, 0x38, 0x9c, 0x4e, 0x90, 0xb7, 0xa9, 0xf4, 0x04, 0xa2, 0xa7, 0xa6, 0x75, 0x76, 0x72, 0xf2,
+  0x33, 0x8f, 0x87, 0xdc, 0x01, 0xa4, 0x76, 0x02, 0x73, 0x88, 0xb5, 0x4b, 0x85, 0xc5, 0x1a, 0xd6,
+  0xc2, 0xbf, 0xe9, 0xd6, 0xbf, 0xb3, 0x66, 0xfb, 0xf6, 0xca, 0xa5, 0x9c, 0x5f, 0x34, 0xd2, 0x7d,
+  0x27, 0x5f, 0x86, 0x5e, 0xcc, 0x13, 0xbd, 0xeb, 0xe9, 0xda, 0xd9, 0x5d, 0xb3, 0x61, 0x32, 0xae,
+  0xe6, 0x7a, 0x17, 0xf2, 0xc6, 0x36, 0x0c, 0xc3, 0x2c, 0x1a, 0x34, 0x1c, 0xa8, 0x75, 0x41, 0x60,
+  0x1b, 0x63, 0x46, 0x6c, 0xe6, 0xce, 0x01, 0x6c, 0x6d, 0x86, 0xbe, 0x4b, 0xc6, 0x20, 0xd0, 0x58,
+  0x3f, 0x67, 0x14, 0x46, 0xe1, 0x61, 0x8f, 0xd3, 0x5c, 0x18, 0xcc, 0x8c, 0xcb, 0x91, 0x82, 0xf9,
+  0x1e, 0xb8, 0x45, 0xf7, 0x11, 0x10, 0xec, 0x87, 0x28, 0x2c, 0xa3, 0x23, 0x92, 0x07, 0x04, 0x10,
+  0x45, 0x33, 0xbf, 0xca, 0x83, 0x74, 0x54, 0xc8, 0x28, 0x22, 0x7b, 0x49, 0xf6, 0x2c, 0x6f, 0xd9,
+  0xa5, 0xda, 0xd6, 0xb2, 0xcd, 0x5e, 0xd5, 0xb6, 0x32, 0xfe, 0xe5, 0x6d, 0xc0, 0x47, 0x4e, 0x0c,
+  0x7d, 0xab, 0xc8, 0x6a, 0x59, 0xbb, 0xf6, 0xee, 0x1a, 0xac, 0x74, 0xc6, 0x8a, 0xf1, 0x33, 0x72,
+  0xb0, 0x8c, 0x89, 0x2f, 0xee, 0x94, 0x71, 0xf1, 0x5e, 0xc2, 0x55, 0x4c, 0xbf, 0x76, 0xa5, 0x9d,
+  0x04, 0x0a, 0x77, 0x2a, 0xb4, 0xcc, 0xf3, 0x57, 0xb0, 0x42, 0x65, 0x4a, 0x85, 0x28, 0x0e, 0xbb,
+  0x5b, 0xb0, 0x92, 0xbf, 0x57, 0x76, 0x2a, 0xa5, 0xb2, 0x23, 0x0a, 0xf2, 0x2c, 0x5e, 0x65, 0xae,
+  0x3c, 0x57, 0x84, 0x65, 0x2c, 0x76, 0x44, 0x95, 0xa1, 0xc9, 0x91, 0x4e, 0x0d, 0x3b, 0x59, 0x21,
+  0xab, 0x95, 0x6a, 0xb2, 0x70, 0x56, 0xcb, 0xd5, 0x05, 0x21, 0x66, 0x8a, 0x61, 0xa7, 0xdc, 0xe7,
+  0x52, 0x7e, 0x51, 0x70, 0x1f, 0x63, 0x37, 0xa7, 0x44, 0x62, 0x67, 0x59, 0x11, 0xc8, 0xf1, 0x87,
+  0xf2, 0xa1, 0xca, 0xdc, 0xca, 0x0b, 0xc3, 0x54, 0x6e, 0x81, 0x01, 0x99, 0xa3, 0x84, 0x0b, 0x31,
+  0xf9, 0x32, 0xf5, 0x91, 0xed, 0x68, 0x6d, 0xa7, 0xee, 0xb5, 0x59, 0xf6, 0x93, 0xc5, 0xfc, 0x8b,
+  0x2c, 0x7e, 0x9a, 0x59, 0x07, 0x89, 0x35, 0xdc, 0x25, 0xc7, 0xec, 0xd7, 0xc4, 0x9e, 0xe0, 0xd7,
+  0x31, 0xe5, 0xe3, 0x51, 0x90, 0xef, 0xc9, 0x82, 0xbf, 0x3c, 0x7d, 0x3b, 0x67, 0x31, 0x62, 0xca,
+  0x4e, 0xb4, 0x95, 0x17, 0x27, 0xa5, 0x25, 0x41, 0x07, 0x01, 0xd0, 0x41, 0xb0, 0xcc, 0x1a, 0xd4,
+  0x82, 0x84, 0x0c, 0x92, 0x14, 0x0b, 0x72, 0x40, 0x60, 0x70, 0x42, 0xa1, 0x7e, 0x20, 0x6e, 0xd6,
+  0x2e, 0x5f, 0x36, 0x4d, 0xd5, 0xb9, 0xb9, 0x63, 0xef, 0xac, 0x19, 0xbe, 0x69, 0xb5, 0xeb, 0x6d,
+  0x9b, 0xc5, 0x23, 0x80, 0x02, 0xbb, 0x9a, 0xfc, 0x52, 0xac, 0x5e, 0x56, 0x79, 0x49, 0x76, 0x6f,
+  0x72, 0xcd, 0xc8, 0x0e, 0x50, 0xed, 0x59, 0xd5, 0xe9, 0x24, 0xbb, 0x5e, 0xc5, 0x27, 0xd1, 0xd9,
+  0xaa, 0x8e, 0xfe, 0xba, 0xaa, 0xce, 0x36, 0x06, 0x3d, 0x3b, 0xb3, 0x12, 0x41, 0xee, 0xa8, 0x73,
+  0xc9, 0x68, 0xf3, 0x6a, 0x42, 0x90, 0xd9, 0xd7, 0x54, 0x88, 0x8b, 0x57, 0xa1, 0xc8, 0x53, 0x65,
+  0xb7, 0x7c, 0x2a, 0xa1, 0x48, 0x3c, 0x35, 0x47, 0x51, 0x03, 0xf6, 0xdc, 0x82, 0xb5, 0x70, 0x08,
+  0xa1, 0x4e, 0x23, 0xb5, 0x6c, 0x87, 0xb4, 0xe3, 0xe5, 0xcf, 0xe4, 0xca, 0x4b, 0x59, 0x4a, 0x7b,
+  0x61, 0xe8, 0x8c, 0x0e, 0x25, 0xb5, 0x32, 0x92, 0x1a, 0xa0, 0x77, 0x0a, 0x7d, 0x11, 0x75, 0xe1,
+  0x39, 0x06, 0x41, 0x60, 0x4e, 0xac, 0x79, 0xee, 0xa6, 0xc7, 0xf3, 0xec, 0x60, 0x10, 0xea, 0x3d,
+  0x96, 0x6e, 0xe7, 0xe3, 0x83, 0x5f, 0x68, 0x6f, 0x5a, 0x9c, 0xcb, 0x92, 0x15, 0x18, 0xde, 0x7d,
+  0x21, 0x07, 0x0b, 0xec, 0x6b, 0xa4, 0xc1, 0x53, 0x70, 0x90, 0x1c, 0x7f, 0x52, 0xa2, 0x69, 0x2d,
+  0x25, 0xd3, 0x5a, 0xca, 0x4c, 0x2b, 0x8a, 0x57, 0xe9, 0xac, 0xf2, 0x46, 0x65, 0x6a, 0x24, 0x93,
+  0x50, 0xd2, 0x3e, 0x5b, 0x38, 0x13, 0x14, 0x7a, 0xba, 0x4b, 0xe6, 0xb4, 0x65, 0x2c, 0x23, 0xb4,
+  0x72, 0x2a, 0x8b, 0x50, 0xa2, 0xa3, 0x04, 0xa3, 0x0b, 0xee, 0x62, 0x69, 0x41, 0xc5, 0xe8, 0x4b,
+  0x88, 0x50, 0xb7, 0x94, 0xc1, 0x27, 0x76, 0x57, 0x9e, 0x9f, 0x77, 0xcb, 0xc7, 0x6d, 0x7b, 0x7a,
+  0xbf, 0x9c, 0xab, 0xcd, 0xee, 0x59, 0x66, 0x1a, 0x33, 0xfb, 0x2d, 0x2b, 0xfd, 0x72, 0x0e, 0xe1,
+  0xc0, 0x3a, 0x57, 0x57, 0x3d, 0x5f, 0x9d, 0x87, 0xf2, 0xde, 0x94, 0xbe, 0x2f, 0xcd, 0x24, 0x6a,
+  0x41, 0x51, 0x19, 0xea, 0x2d, 0x2c, 0xa6, 0xf4, 0x7b, 0x78, 0x1f, 0x0c, 0xde, 0x24, 0x5f, 0x7f,
+  0xe6, 0x8e, 0xc4, 0xa7, 0x86, 0x9e, 0xa3, 0xe5, 0x48, 0xc8, 0xe6, 0xdb, 0x24, 0x96, 0xc0, 0x36,
+  0x69, 0x61, 0x11, 0xfb, 0x6b, 0xe7, 0xcb, 0x93, 0xb1, 0x51, 0x29, 0xe1, 0x4c, 0x04, 0x49, 0x29,
+  0xa7, 0xd0, 0x18, 0xef, 0x61, 0xf2, 0x6b, 0x32, 0xb5, 0x42, 0x76, 0xdd, 0xdb, 0xdb, 0x5e, 0xb6,
+  0xe9, 0x44, 0x21, 0xc6, 0x9b, 0xf8, 0x01, 0x33, 0x65, 0x51, 0x95, 0xe9, 0xe2, 0xd7, 0xfc, 0x3c,
+  0xb1, 0x45, 0xa7, 0x1e, 0x41, 0xeb, 0x65, 0x94, 0x25, 0xe6, 0xe7, 0x13, 0xf1, 0x08, 0x48, 0x05,
+  0xa5, 0xab, 0x2c, 0x30, 0xce, 0x19, 0x39, 0x6b, 0x94, 0x4f, 0x08, 0xee, 0xf2, 0x8d, 0x55, 0x2a,
+  0x4b, 0xfa, 0x6f, 0xfb, 0xcb, 0x25, 0x73, 0x48, 0xc8, 0x78, 0xfb, 0x55, 0x0d, 0x58, 0xc8, 0xce,
+  0x48, 0xe3, 0x68, 0x7e, 0xbb, 0x46, 0xb8, 0x91, 0x8a, 0x77, 0x77, 0xa1, 0x90, 0xb1, 0x00, 0x8c,
+  0x41, 0xa5, 0x66, 0x30, 0x87, 0xda, 0x25, 0xb5, 0x06, 0x36, 0x9b, 0x52, 0xcc, 0x1a, 0x02, 0x9e,
+  0xfd, 0x54, 0x35, 0x83, 0xfe, 0x57, 0xec, 0x12, 0x47, 0xab, 0x02, 0x6e, 0x0d, 0x5e, 0x29, 0x7b,
+  0xa5, 0x18, 0x96, 0xf6, 0xa3, 0x0c, 0x05, 0xf5, 0x00, 0x55, 0x9a, 0x4b, 0x3c, 0x0d, 0x00, 0x24,
+  0x6c, 0xed, 0x85, 0x21, 0xe9, 0x2a, 0xa3, 0x94, 0xb9, 0xda, 0x73, 0x68, 0x91, 0x9d, 0x24, 0xc1,
+  0x14, 0x00, 0x8e, 0x3c, 0x01, 0x40, 0x95, 0x93, 0xa6, 0x02, 0x5c, 0x96, 0xd6, 0x2a, 0x29, 0x3c,
+  0x1e, 0x78, 0x33, 0x41, 0x17, 0x6d, 0x95, 0x30, 0x44, 0xb7, 0x0d, 0x3f, 0x6c, 0xb4, 0x3d, 0xad,
+  0xc1, 0x58, 0xf7, 0xc4, 0xf7, 0xce, 0x69, 0x0d, 0x5a, 0xf5, 0x30, 0x75, 0xed, 0xed, 0xcc, 0x1b,
+  0x58, 0xf6, 0x27, 0xb3, 0xdf, 0x29, 0x53, 0xbc, 0xaa, 0x0b, 0x61, 0x87, 0x19, 0x47, 0xf8, 0xd5,
+  0x6e, 0xb7, 0x0d, 0xea, 0xaf, 0xf6, 0x1c, 0x67, 0x8f, 0xe8, 0x06, 0x57, 0xfd, 0x9e, 0xe1, 0x59,
+  0x91, 0xe4, 0xbe, 0xa2, 0xa8, 0x02, 0xa6, 0xd6, 0x73, 0xaf, 0x00, 0x46, 0x55, 0x43, 0xe9, 0xde,
+  0xde, 0x0c, 0x0b, 0x1a, 0x6b, 0x87, 0x2b, 0x6f, 0x38, 0xa8, 0xa2, 0xbd, 0x26, 0xae, 0xa2, 0x7d,
+  0xa1, 0x5e, 0x45, 0xbd, 0x1e, 0x83, 0x10, 0xb0, 0x70, 0xc4, 0x81, 0x71, 0xeb, 0x3b, 0xc5, 0xa0,
+  0x63, 0x75, 0xe5, 0x0c, 0x15, 0xb6, 0x64, 0x05, 0xf5, 0x36, 0x28, 0xfc, 0x04, 0x43, 0x09, 0x51,
+  0xe7, 0xe0, 0x94, 0x46, 0x2a, 0x64, 0x0c, 0x85, 0x26, 0xc0, 0x2c, 0xb0, 0x04, 0x21, 0x52, 0x5c,
+  0x3e, 0x82, 0xd2, 0xc6, 0x9f, 0x0a, 0x08, 0xec, 0xad, 0xda, 0xf4, 0xba, 0x8d, 0xa6, 0x87, 0x4b,
+  0xf6, 0x52, 0xc9, 0xba, 0x62, 0x97, 0x25, 0xfb, 0xbf, 0x50, 0xc5, 0x6b, 0x4a, 0xb4, 0x8c, 0x57,
+  0x68, 0xf4, 0xc3, 0xd0, 0x0b, 0xe2, 0xab, 0x4e, 0xb8, 0xe9, 0xc5, 0x16, 0x60, 0xa4, 0x11, 0xdb,
+  0x48, 0x36, 0xe8, 0xf2, 0x46, 0x69, 0x0c, 0xb6, 0xc6, 0xb3, 0x6d, 0x1f, 0x6a, 0x5c, 0xa1, 0x58,
+  0x45, 0xa5, 0xf9, 0x9b, 0xb6, 0x01, 0x00, 0xe8, 0xed, 0x9b, 0x79, 0x6c, 0x09, 0x88, 0x6d, 0xc6,
+  0x66, 0x91, 0x7e, 0xd2, 0xba, 0x38, 0x71, 0x5d, 0xa8, 0x23, 0x75, 0x2f, 0x8a, 0x81, 0xb3, 0x5a,
+  0xf8, 0xf7, 0x65, 0xfb, 0x25, 0xf8, 0xdf, 0xd1, 0x4c, 0x56, 0x08, 0x79, 0xb3, 0x14, 0x22, 0xcb,
+  0xb5, 0x13, 0xfe, 0xb8, 0x83, 0xb1, 0x3d, 0x6f, 0x9a, 0xe8, 0x48, 0x77, 0x97, 0xa9, 0x13, 0x73,
+  0xc8, 0xfa, 0x72, 0x6b, 0xd4, 0xb7, 0x5f, 0x1b, 0x71, 0x5e, 0x83, 0x8f, 0xcb, 0xa5, 0xbd, 0x3d,
+  0x7a, 0xbd, 0xd2, 0xbb, 0x5e, 0x4c, 0x41, 0x9f, 0x58, 0x30, 0x87, 0x2d, 0xdf, 0xf5, 0x90, 0xa4,
+  0x92, 0x8c, 0x6e, 0x92, 0x82, 0xd6, 0x23, 0xd1, 0x02, 0x1b, 0x6e, 0x58, 0x19, 0xc6, 0x9f, 0x2e,
+  0x6d, 0x6e, 0x93, 0xf3, 0x0f, 0xf1, 0x27, 0xc1, 0xcb, 0xc4, 0x9b, 0x04, 0xbf, 0x15, 0x83, 0x45,
+  0x5d, 0x23, 0x8f, 0x92, 0x3d, 0x47, 0x04, 0x56, 0x4d, 0xd6, 0x35, 0xec, 0xdf, 0xd9, 0x8d, 0x64,
+  0x15, 0x43, 0x8e, 0xaa, 0xa9, 0x26, 0x90, 0xaa, 0x25, 0x0b, 0xd5, 0x8a, 0x49, 0x21, 0xf5, 0xb0,
+  0xe1, 0xd7, 0x57, 0x96, 0xeb, 0x21, 0xb4, 0xc6, 0x14, 0x77, 0x3d, 0x10, 0x7a, 0xf6, 0xf6, 0x74,
+  0xdd, 0x1c, 0xbd, 0x2d, 0xfa, 0x56, 0xfd, 0x57, 0x4c, 0x00, 0xc2, 0x39, 0x89, 0x77, 0xa6, 0x4f,
+  0x6f, 0xae, 0x5c, 0xb2, 0xb4, 0x78, 0x37, 0x7d, 0xf9, 0x43, 0xf6, 0x32, 0xee, 0xf6, 0xcc, 0xfc,
+  0xc9, 0x53, 0x7c, 0xb5, 0xc5, 0x3b, 0xb9, 0xf2, 0xc9, 0xd2, 0x4a, 0x4a, 0x0a, 0xe6, 0x4c, 0x80,
+  0xf9, 0xf2, 0xa2, 0x08, 0xa7, 0x8e, 0x77, 0x61, 0x1b, 0x42, 0xe0, 0x8c, 0x74, 0xd3, 0xe1, 0x61,
+  0x45, 0x1b, 0x60, 0xea, 0xbd, 0x1d, 0xbd, 0x26, 0x95, 0x43, 0xa7, 0x76, 0xbc, 0xcb, 0x8a, 0xe5,
+  0x48, 0xdd, 0x74, 0x12, 0x87, 0x47, 0x1e, 0x16, 0x48, 0x67, 0x83, 0x9d, 0x17, 0xf0, 0xda, 0x59,
+  0x9c, 0x30, 0x0f, 0x9e, 0xc2, 0x39, 0xcf, 0xed, 0xf4, 0xba, 0xe1, 0xf3, 0x99, 0x0e, 0x49, 0x89,
+  0x67, 0x86, 0xef, 0x90, 0x12, 0x77, 0xe0, 0xbc, 0x53, 0x94, 0xa1, 0xea, 0x68, 0xa4, 0x50, 0x80,
+  0x99, 0xe8, 0xf3, 0x76, 0x7a, 0x79, 0xac, 0xa1, 0x9b, 0xcc, 0x85, 0x2c, 0x1f, 0x85, 0x3d, 0xbc,
+  0x55, 0xdc, 0x95, 0xdb, 0xe0, 0xc1, 0x45, 0x00, 0xb3, 0xb7, 0x17, 0x77, 0x4d, 0x36, 0x0a, 0xfc,
+  0x67, 0xc2, 0x65, 0x89, 0xac, 0x1c, 0x1d, 0x95, 0x66, 0xd6, 0x27, 0xa8, 0x7a, 0x33, 0x8f, 0xf4,
+  0x63, 0x4a, 0xde, 0xca, 0xe3, 0x9d, 0x99, 0xc0, 0xdc, 0xc8, 0x7e, 0xfb, 0x85, 0x21, 0xba, 0x2e,
+  0x47, 0x79, 0xfc, 0x5b, 0xe1, 0x7f, 0xcb, 0x1b, 0xa3, 0xb7, 0x15, 0xff, 0x9d, 0x71, 0x9c, 0x0d,
+  0xde, 0x8d, 0x56, 0x6c, 0xfc, 0x05, 0xc2, 0x9b, 0x71, 0x3c, 0xee, 0x62, 0xc1, 0xb2, 0x0d, 0x5f,
+  0x94, 0x7a, 0x2d, 0x93, 0xed, 0x23, 0xb2, 0xd7, 0xc5, 0xe6, 0x34, 0xdb, 0xca, 0xdc, 0x6d, 0xe7,
+  0x5d, 0x0a, 0x56, 0x6e, 0x79, 0x8d, 0x2d, 0xcf, 0x35, 0x35, 0x6a, 0xc9, 0x02, 0x6e, 0x87, 0x5b,
+  0x55, 0xdd, 0xc5, 0xd3, 0xda, 0x55, 0x1d, 0x33, 0x62, 0xa2, 0x65, 0xa6, 0x98, 0x2a, 0x52, 0xfa,
+  0xc8, 0x7c, 0x1a, 0xe8, 0x03, 0x05, 0x78, 0x06, 0xfa, 0x80, 0x01, 0xa7, 0xa3, 0x74, 0x16, 0xdf,
+  0x70, 0x9e, 0x0a, 0x6a, 0x7c, 0x18, 0x54, 0x3e, 0xe4, 0x3f, 0x31, 0xc3, 0xa8, 0x45, 0x9b, 0xdb,
+  0xd3, 0x81, 0x6d, 0x1d, 0x06, 0xb6, 0x25, 0x06, 0xfb, 0x88, 0xa2, 0x75, 0x1f, 0xf3, 0xb3, 0xa8,
+  0x1f, 0x5b, 0xda, 0xf7, 0x9f, 0x12, 0x3c, 0xc5, 0x4f, 0xa4, 0x1d, 0xa8, 0xe0, 0xeb, 0x0c, 0xfc,
+  0x27, 0xa9, 0xd1, 0x96, 0xc2, 0xcf, 0x3e, 0xe5, 0xb0, 0x39, 0x1d, 0x0c, 0x29, 0xbf, 0x0d, 0xb6,
+  0x1c, 0xa9, 0xee, 0x59, 0x8f, 0x38, 0xc6, 0xd9, 0x68, 0xdb, 0x90, 0x24, 0x15, 0xa9, 0xb6, 0x2d,
+  0xaf, 0x46, 0xc1, 0x84, 0x1b, 0xd1, 0xb6, 0xad, 0xbf, 0xd5, 0x3f, 0x7f, 0xee, 0xfc, 0x79, 0x3d,
+  0x47, 0xc3, 0x41, 0x73, 0x79, 0xc3, 0x5e, 0x69, 0x14, 0x5a, 0x66, 0xe1, 0x9d, 0x2e, 0x46, 0xa5,
+  0xd5, 0x30, 0xba, 0xe8, 0x2d, 0x16, 0x52, 0xc3, 0x56, 0x0c, 0xf7, 0x95, 0xe2, 0x92, 0x01, 0x00,
+  0x39, 0x5b, 0x6e, 0xe8, 0xae, 0x37, 0x0a, 0x5b, 0x1b, 0xb4, 0x07, 0x64, 0xdb, 0xb3, 0xef, 0x70,
+  0xdb, 0x67, 0xda, 0xdd, 0xba, 0x81, 0x7e, 0x7b, 0xfa, 0xb1, 0x0e, 0x20, 0x36, 0xac, 0x61, 0xbc,
+  0xdb, 0xf3, 0x60, 0xe6, 0x40, 0x79, 0x2c, 0x42, 0x41, 0x0d, 0xbd, 0x1f, 0x91, 0x17, 0xdb, 0xfd,
+  0xb8, 0x99, 0x3f, 0x05, 0x18, 0xb0, 0xf4, 0xba, 0xe7, 0xb5, 0xfc, 0x6d, 0xef, 0x46, 0xbb, 0xbb,
+  0x59, 0x80, 0x1a, 0x7a, 0x26, 0xc0, 0xa1, 0x17, 0x7a, 0xdb, 0xbe, 0x37, 0x60, 0x7c, 0xf3, 0x59,
+  0x50, 0x40, 0x86, 0x4c, 0x50, 0x85, 0x71, 0x0b, 0x93, 0x3f, 0x04, 0x8a, 0x5a, 0x7c, 0x57, 0x43,
+  0x64, 0xa0, 0x66, 0xdb, 0x5a, 0x79, 0x5b, 0x7c, 0x94, 0x4e, 0x05, 0x21, 0x93, 0x85, 0x09, 0x2b,
+  0x22, 0xc2, 0xb4, 0x64, 0x2a, 0x08, 0x4a, 0x54, 0xed, 0x29, 0xf0, 0x5d, 0x0e, 0x5f, 0xc2, 0x19,
+  0x42, 0x75, 0xa7, 0x75, 0x33, 0x3a, 0x3c, 0x7d, 0x1f, 0x7e, 0x7e, 0x3e, 0x76, 0xea, 0x6d, 0xcc,
+  0xce, 0x91, 0x95, 0xc9, 0x8f, 0x68, 0x07, 0x68, 0xc3, 0xb3, 0xa2, 0xbd, 0x24, 0xaf, 0x47, 0xb2,
+  0x31, 0xd5, 0x31, 0x6d, 0xa2, 0x3e, 0x8d, 0xce, 0xce, 0xed, 0x34, 0x3c, 0x1e, 0xbd, 0x48, 0xfb,
+  0x6a, 0xcf, 0xeb, 0x36, 0xb5, 0x37, 0x2f, 0xad, 0xbd, 0x89, 0x02, 0x02, 0xc8, 0x75, 0x5e, 0x13,
+  0x74, 0x1c, 0x57, 0x57, 0x34, 0xd9, 0x68, 0x66, 0xe2, 0xdb, 0xa8, 0x11, 0xfa, 0xbd, 0x58, 0xc4,
+  0x0d, 0x45, 0x85, 0x28, 0x6c, 0xd8, 0x7a, 0x2b, 0x8e, 0x7b, 0x51, 0xb5, 0x58, 0x6c, 0xb8, 0xc1,
+  0x3b, 0x98, 0xd6, 0xb5, 0xdb, 0x77, 0x9b, 0x6d, 0xd0, 0xbd, 0x0a, 0x8d, 0x6e, 0xa7, 0xe8, 0xbc,
+  0xe3, 0xec, 0x14, 0xdb, 0x7e, 0x3d, 0x2a, 0xee, 0xb4, 0xa3, 0x9d, 0x62, 0xa9, 0x50, 0x3e, 0x55,
+  0x58, 0xa4, 0xdf, 0x85, 0x66, 0xbf, 0xdd, 0x46, 0x7b, 0x61, 0xe1, 0x9d, 0x48, 0xc4, 0x4b, 0x17,
+  0xba, 0x01, 0x06, 0xa2, 0xd9, 0x37, 0xdc, 0x2e, 0x0d, 0xbc, 0x46, 0x45, 0x5e, 0x18, 0x82, 0x84,
+  0x2d, 0xe5, 0xc0, 0xa2, 0x77, 0x2c, 0x4b, 0xa8, 0x7c, 0xd0, 0xfc, 0xfe, 0xf8, 0xb1, 0x66, 0x88,
+  0xa0, 0xe4, 0x34, 0xb0, 0x91, 0x0a, 0x80, 0x23, 0x2a, 0xa9, 0x40, 0x4c, 0x91, 0xba, 0x25, 0x45,
+  0x79, 0xcb, 0x73, 0xdc, 0x82, 0xd3, 0xc3, 0x6c, 0x5e, 0x67, 0x5b, 0x7e, 0xdb, 0x35, 0x22, 0x39,
+  0x8b, 0x8e, 0x18, 0x92, 0xa1, 0x66, 0x0f, 0x4b, 0x8b, 0x9f, 0x8e, 0x92, 0xb9, 0xeb, 0xa0, 0x3b,
+  0x60, 0x09, 0xb0, 0x84, 0xd7, 0x8b, 0x4b, 0x27, 0x21, 0xba, 0xee, 0x89, 0xf8, 0x04, 0x69, 0x02,
+  0x01, 0x0e, 0x43, 0x20, 0xbb, 0xd6, 0x86, 0x9d, 0x52, 0x1f, 0x12, 0x19, 0x67, 0x33, 0x61, 0x4d,
+  0xde, 0x4c, 0x00, 0x2a, 0xce, 0x6d, 0xa1, 0x1f, 0xfb, 0x00, 0x03, 0x23, 0xe4, 0x6e, 0xc4, 0xdd,
+  0x1b, 0x51, 0xcb, 0xf3, 0x62, 0x8a, 0x85, 0x33, 0x33, 0x7e, 0x37, 0x79, 0x08, 0x4f, 0xed, 0xed,
+  0xe7, 0x44, 0x12, 0x3b, 0xb1, 0xbd, 0xbe, 0x8e, 0x59, 0x57, 0xf6, 0xc9, 0x7e, 0x4c, 0xe6, 0xe4,
+  0x83, 0x9b, 0xba, 0xa5, 0x8f, 0xff, 0x45, 0x3d, 0x95, 0xae, 0x6f, 0x58, 0xeb, 0x58, 0xb8, 0xcf,
+  0x8f, 0x1a, 0xdd, 0x1f, 0x7f, 0xa5, 0x5b, 0xd4, 0x35, 0x93, 0xb6, 0x37, 0xd8, 0x49, 0x2d, 0xa8,
+  0xf3, 0x7b, 0x16, 0x42, 0x47, 0x07, 0x83, 0x74, 0x4b, 0xf2, 0xe9, 0x31, 0x07, 0xd4, 0x11, 0xde,
+  0xe7, 0x05, 0xb4, 0xdb, 0xc9, 0xc0, 0xf6, 0xc7, 0x0f, 0x31, 0x53, 0xf5, 0x53, 0x82, 0x5b, 0x39,
+  0x1c, 0xdc, 0x67, 0x49, 0xf4, 0xec, 0x7d, 0xf8, 0x24, 0x4b, 0x93, 0xc1, 0x19, 0xd3, 0xe0, 0xb1,
+  0xf0, 0x05, 0xa9, 0x5a, 0x16, 0xf4, 0x86, 0x3c, 0x71, 0x15, 0x79, 0xe6, 0x9c, 0xae, 0x93, 0x4e,
+  0x1c, 0x62, 0x5a, 0xce, 0xde, 0xe5, 0xec, 0x46, 0x3c, 0xd2, 0x71, 0x92, 0xcb, 0x33, 0xf5, 0x95,
+  0x04, 0x9f, 0x55, 0x77, 0xaa, 0x61, 0x73, 0x55, 0xaf, 0x91, 0xe4, 0x04, 0x50, 0xd6, 0xb7, 0x36,
+  0x4c, 0xfe, 0xd7, 0x1e, 0x76, 0x82, 0x2a, 0x28, 0x63, 0x56, 0x67, 0xa7, 0x9a, 0xc7, 0xbf, 0x41,
+  0xb5, 0x84, 0x94, 0x38, 0x61, 0xd8, 0x42, 0xd2, 0x20, 0x00, 0x09, 0x49, 0x0c, 0x39, 0x88, 0x42,
+  0x27, 0x48, 0x5d, 0x00, 0x69, 0x99, 0xb5, 0x6d, 0xd6, 0x92, 0xa7, 0x1d, 0x3b, 0xc9, 0x63, 0x95,
+  0x96, 0xc9, 0x35, 0x82, 0x5c, 0x0e, 0xf4, 0x33, 0x85, 0xa2, 0x17, 0x66, 0x22, 0x06, 0xa9, 0x8f,
+  0x8b, 0x3b, 0x48, 0x75, 0x9c, 0x78, 0x48, 0x55, 0x96, 0x66, 0x9f, 0x3f, 0xff, 0x49, 0x04, 0x7e,
+  0xc1, 0x94, 0x16, 0x0a, 0x05, 0x1e, 0xeb, 0x08, 0xeb, 0x9e, 0x42, 0x0b, 0xb1, 0x7f, 0x93, 0x56,
+  0x82, 0xb1, 0xbe, 0x65, 0x6d, 0x6f, 0xc0, 0xfc, 0xe1, 0xdf, 0x82, 0x12, 0x5c, 0x82, 0xcf, 0x3b,
+  0xea, 0x73, 0xb0, 0x61, 0x2a, 0xd1, 0x83, 0x75, 0x79, 0xb0, 0xf5, 0x6e, 0x77, 0xeb, 0x46, 0x20,
+  0xf2, 0x2d, 0x67, 0x5f, 0x30, 0x4e, 0xc3, 0x3f, 0x65, 0x50, 0xb7, 0x06, 0x91, 0xa5, 0xcb, 0xf9,
+  0xcc, 0xf5, 0xa7, 0x6c, 0x55, 0xb1, 0x90, 0x36, 0x27, 0x12, 0xf8, 0x3d, 0x6d, 0xf3, 0x05, 0xea,
+  0x15, 0x89, 0xfa, 0xae, 0xc8, 0xa3, 0xce, 0x13, 0x37, 0x8e, 0x1f, 0x48, 0x30, 0x06, 0xa1, 0x1f,
+  0x7b, 0xe7, 0xfd, 0xb6, 0x87, 0xad, 0x94, 0x3d, 0x1e, 0x79, 0x79, 0x76, 0x93, 0xe7, 0xb2, 0x03,
+  0x6c, 0x4b, 0x75, 0x2b, 0x70, 0x3a, 0x9e, 0xd0, 0xbe, 0x9c, 0x99, 0x3b, 0x0b, 0x26, 0x05, 0xe0,
+  0x56, 0x0f, 0xfb, 0xda, 0x95, 0x4b, 0xfc, 0x35, 0x9b, 0x25, 0x78, 0x26, 0x50, 0x66, 0xcd, 0x29,
+  0xb4, 0x42, 0xaf, 0x69, 0xf7, 0xe1, 0x87, 0xdb, 0x1d, 0xb0, 0xbd, 0x02, 0xe1, 0xc3, 0x33, 0xe8,
+  0x93, 0x98, 0x72, 0xb7, 0x96, 0x49, 0xa8, 0x8a, 0xb0, 0x60, 0xeb, 0xec, 0x6e, 0x49, 0xb0, 0xfa,
+  0xa6, 0xb5, 0x48, 0x07, 0x58, 0xe5, 0x18, 0xeb, 0xf6, 0x9a, 0xfb, 0x23, 0x50, 0x14, 0xc5, 0x48,
+  0x9b, 0x87, 0x6b, 0x2c, 0xef, 0xf9, 0xaa, 0xae, 0x63, 0xc5, 0x47, 0xd7, 0x97, 0xb4, 0x1c, 0x5c,
+  0x40, 0xcd, 0xbd, 0xbd, 0xe3, 0xb1, 0x39, 0x14, 0x69, 0x1d, 0x3f, 0x05, 0xdc, 0xdf, 0x61, 0x51,
+  0xfc, 0xe4, 0xd0, 0xe7, 0x81, 0x02, 0x14, 0xd2, 0x2f, 0xf6, 0x2a, 0x61, 0x87, 0x18, 0xf8, 0x01,
+  0x7c, 0x7e, 0xa1, 0x0b, 0x73, 0x29, 0x9d, 0x31, 0x63, 0x1b, 0xfe, 0x2a, 0x8f, 0xd7, 0x6e, 0x8a,
+  0xb8, 0xec, 0xd8, 0xd2, 0x6f, 0xd4, 0xdb, 0x4e, 0xb0, 0xa5, 0x4f, 0x7c, 0x30, 0x8b, 0x3d, 0x4f,
+  0x02, 0xdd, 0x0f, 0xfd, 0x02, 0xf4, 0xf0, 0xe4, 0x23, 0x57, 0xf9, 0x04, 0xf7, 0x90, 0xe1, 0xb3,
+  0xf8, 0x83, 0xdb, 0x4f, 0x35, 0xf4, 0x55, 0x04, 0x0e, 0x43, 0x75, 0x95, 0xa1, 0x4a, 0x5a, 0xf6,
+  0x19, 0xca, 0xb8, 0xaa, 0xfd, 0x03, 0xa4, 0xb8, 0x65, 0x44, 0xcb, 0xbe, 0x07, 0x50, 0x3f, 0x89,
+  0x0e, 0x9e, 0x5c, 0x76, 0xfa, 0xa4, 0xa1, 0x08, 0x98, 0xb4, 0xcd, 0x1c, 0x33, 0x14, 0x59, 0x69,
+  0x8f, 0x3c, 0x5e, 0x7a, 0xb4, 0x21, 0x84, 0x81, 0xca, 0x73, 0x99, 0x53, 0x88, 0x7b, 0x99, 0x14,
+  0x13, 0x74, 0x98, 0x9f, 0xed, 0x2d, 0x7e, 0x73, 0xd7, 0x70, 0x2d, 0x3a, 0x4c, 0x51, 0x49, 0x2b,
+  0xab, 0x32, 0xea, 0x44, 0x81, 0xcd, 0xed, 0x29, 0xab, 0x5c, 0x7a, 0x95, 0x02, 0xa4, 0x9f, 0x39,
+  0xef, 0xa9, 0x14, 0xfb, 0x1a, 0xc5, 0xdd, 0xd0, 0xe3, 0x38, 0xf2, 0x83, 0x9e, 0x24, 0x96, 0x81,
+  0x3c, 0xe3, 0xd9, 0x50, 0x84, 0x82, 0x8d, 0x87, 0x3e, 0x44, 0x61, 0x10, 0xc6, 0x67, 0x71, 0xb6,
+  0xa2, 0x36, 0x92, 0x0a, 0x0b, 0xc8, 0x5b, 0xa4, 0xcc, 0xbf, 0x84, 0x50, 0xdd, 0x4c, 0xa9, 0xfe,
+  0x0f, 0x20, 0x77, 0x92, 0x03, 0x53, 0xa3, 0x57, 0xda, 0xc1, 0x8f, 0x81, 0x7f, 0x7f, 0x35, 0x7e,
+  0x24, 0xa8, 0x1e, 0x7b, 0x63, 0x89, 0x6e, 0x40, 0x68, 0x9b, 0xb0, 0x22, 0x02, 0x8b, 0x73, 0xbd,
+  0x90, 0xce, 0x97, 0x20, 0x67, 0xbd, 0x42, 0x8f, 0xe2, 0x20, 0x14, 0xfe, 0x16, 0xe2, 0x70, 0x12,
+  0xec, 0xea, 0x71, 0x39, 0x1d, 0xf5, 0x21, 0xec, 0x90, 0xe1, 0x3a, 0x0e, 0x77, 0x87, 0xf8, 0xc4,
+  0xa6, 0x84, 0x36, 0x6b, 0xc3, 0x2b, 0xc4, 0x64, 0xca, 0xc5, 0x43, 0xc4, 0xfd, 0x36, 0xc8, 0x0f,
+  0x23, 0x86, 0x51, 0x6f, 0x27, 0x1d, 0xbd, 0x94, 0x7f, 0xaf, 0xca, 0xbc, 0xb2, 0x08, 0xe0, 0xa8,
+  0xb1, 0x13, 0x7a, 0xb0, 0xbb, 0xc2, 0x0d, 0x54, 0x27, 0x8e, 0xc3, 0x3c, 0x9e, 0x61, 0xdb, 0xc1,
+  0x1a, 0xba, 0xa4, 0x6e, 0x08, 0x3a, 0x1c, 0x4a, 0x13, 0xc7, 0x82, 0x70, 0x68, 0x7f, 0xf9, 0x0a,
+  0x91, 0x84, 0x81, 0x27, 0x98, 0x62, 0xe2, 0x16, 0x66, 0x8e, 0xf8, 0x39, 0x45, 0x2e, 0x7d, 0x83,
+  0x9b, 0xf8, 0x53, 0xf4, 0x7c, 0x9c, 0x12, 0x36, 0x87, 0x1d, 0xe4, 0x39, 0x24, 0xfb, 0xb3, 0x6b,
+  0x5c, 0xe4, 0x8b, 0x01, 0xe0, 0xc5, 0x67, 0xe3, 0xdf, 0x90, 0x3f, 0x39, 0x3d, 0xc5, 0xc4, 0x72,
+  0x61, 0xf0, 0x64, 0x15, 0x49, 0x97, 0xab, 0x6f, 0x05, 0x06, 0x0b, 0x9c, 0x42, 0x4c, 0xf0, 0xfc,
+  0x5d, 0xf0, 0x6c, 0x69, 0xd7, 0xfd, 0xf3, 0xbe, 0xa5, 0x5d, 0xf5, 0xda, 0xde, 0x66, 0xe8, 0x74,
+  0x28, 0x03, 0x85, 0x22, 0xe7, 0x1e, 0x7c, 0x64, 0xbe, 0x15, 0xbc, 0x15, 0x90, 0xf1, 0x42, 0x24,
+  0x64, 0xba, 0x3f, 0xb5, 0x4f, 0x8c, 0x22, 0xe7, 0xa7, 0x9c, 0xbe, 0x11, 0xf7, 0xd1, 0x24, 0xb2,
+  0xf0, 0x3e, 0x22, 0xe5, 0x38, 0xd2, 0xd4, 0xec, 0xaf, 0x9e, 0x5c, 0xe5, 0x45, 0x4e, 0xe7, 0xba,
+  0x48, 0x2e, 0x5d, 0x65, 0xf9, 0xa7, 0x31, 0x5f, 0x1f, 0xd0, 0x4d, 0x54, 0x1d, 0xea, 0x7c, 0x99,
+  0xe6, 0xaf, 0xc2, 0x1c, 0xc1, 0xda, 0x82, 0x8d, 0x1f, 0x36, 0x48, 0xca, 0xc5, 0x5f, 0x24, 0x2a,
+  0x1e, 0x59, 0xf5, 0xae, 0xbb, 0x5b, 0xcd, 0xac, 0x62, 0x7c, 0x65, 0xf2, 0x73, 0x23, 0xe2, 0xe4,
+  0xc8, 0x74, 0x56, 0xa2, 0x66, 0x30, 0x7e, 0xfd, 0x95, 0x24, 0x6f, 0x31, 0xa5, 0x44, 0x86, 0x1f,
+  0xca, 0xe5, 0x0f, 0xcf, 0xb8, 0xa2, 0xf9, 0x19, 0x7b, 0xbe, 0x0a, 0xf0, 0xcf, 0xe9, 0x88, 0x82,
+  0x4a, 0x69, 0xa9, 0xd2, 0xba, 0x95, 0xb1, 0xa5, 0x3a, 0xb3, 0xae, 0x7b, 0x75, 0xed, 0xda, 0x45,
+  0x5a, 0xee, 0x91, 0x66, 0x88, 0xb4, 0x7f, 0xa6, 0xf6, 0x77, 0xb4, 0x0f, 0x24, 0xd7, 0x66, 0x64,
+  0x99, 0x38, 0xbc, 0xf8, 0x9b, 0x70, 0x70, 0x80, 0x93, 0x6f, 0xfb, 0x51, 0x2c, 0xf1, 0xee, 0xd4,
+  0xd8, 0xe0, 0x32, 0x0e, 0x98, 0x64, 0x02, 0xe0, 0x8f, 0x28, 0xfd, 0xe2, 0x01, 0x2c, 0xe2, 0x7a,
+  0x39, 0x9d, 0xc2, 0x37, 0x30, 0x29, 0x5c, 0x01, 0x23, 0x07, 0xa6, 0xa5, 0x8d, 0x1c, 0xff, 0x6e,
+  0xfc, 0x89, 0x26, 0x9d, 0x35, 0x76, 0x34, 0x92, 0xce, 0xe6, 0xbe, 0x37, 0xa7, 0x75, 0x03, 0x92,
+  0xc7, 0xec, 0x39, 0x18, 0xc8, 0xcb, 0xb0, 0x86, 0x40, 0xce, 0x78, 0x4b, 0x07, 0xa1, 0x84, 0x71,
+  0xd4, 0xd0, 0x83, 0x1d, 0x00, 0x34, 0xa5, 0xe2, 0x5b, 0x85, 0xcd, 0xf7, 0x5e, 0x28, 0x5a, 0x94,
+  0x13, 0xff, 0xad, 0xf4, 0x0c, 0x53, 0x13, 0x74, 0x26, 0x6f, 0x6e, 0xe5, 0xbb, 0xdf, 0xff, 0x66,
+  0xb9, 0xe8, 0xac, 0x24, 0x06, 0x2a, 0x74, 0x5f, 0xe8, 0x82, 0x36, 0xab, 0x98, 0xcf, 0xb5, 0x0f,
+  0x2a, 0xaa, 0x1f, 0xac, 0xea, 0xe3, 0xdf, 0x02, 0x15, 0x25, 0xe9, 0xce, 0xd8, 0xa9, 0x0d, 0x76,
+  0x48, 0xf4, 0x6e, 0xb2, 0x1a, 0xef, 0x73, 0xc1, 0xfa, 0x2b, 0xc9, 0x36, 0x80, 0x39, 0x6b, 0xf0,
+  0x80, 0x23, 0xe6, 0xb8, 0xfb, 0x77, 0xc6, 0xba, 0xe9, 0xca, 0x20, 0x66, 0x33, 0xd0, 0x67, 0xe4,
+  0x92, 0x1e, 0x1d, 0x73, 0xa2, 0xdd, 0xa0, 0xa1, 0xc9, 0xd3, 0x79, 0xad, 0x87, 0xf4, 0x9e, 0xec,
+  0x38, 0xe8, 0xd0, 0xe2, 0xbb, 0x8e, 0xd6, 0x6d, 0x6a, 0xc9, 0xae, 0xa3, 0xd8, 0x59, 0x9a, 0xec,
+  0x6c, 0xe1, 0xf9, 0x6e, 0xd8, 0xe1, 0x06, 0x82, 0xa6, 0x30, 0x40, 0x18, 0x3a, 0x56, 0xd7, 0xad,
+  0xa6, 0xc5, 0x50, 0x66, 0xa6, 0x9c, 0x5e, 0x48, 0x6b, 0xce, 0xc0, 0xf1, 0x63, 0x83, 0xfe, 0xcd,
+  0x92, 0x50, 0xb1, 0x4f, 0xa3, 0x99, 0xe0, 0x0e, 0xb4, 0xe2, 0x9b, 0xee, 0x08, 0x08, 0x8a, 0x11,
+  0x56, 0x8d, 0x2d, 0x45, 0x31, 0xe5, 0x55, 0x4a, 0x06, 0x86, 0x77, 0x22, 0xf0, 0xb5, 0xcc, 0xf8,
+  0x0f, 0xdf, 0x39, 0x14, 0x8e, 0x3e, 0x6d, 0xe1, 0xd6, 0xea, 0xb0, 0x52, 0xb7, 0x6a, 0x22, 0xe8,
+  0x4c, 0x59, 0xa2, 0xd2, 0x45, 0x31, 0x23, 0x65, 0x1d, 0x70, 0xea, 0x60, 0x5a, 0x02, 0xdb, 0x7b,
+  0xf1, 0x37, 0x8a, 0x07, 0x27, 0xf4, 0xf9, 0x79, 0x89, 0xdd, 0xff, 0x99, 0xe5, 0x32, 0x11, 0x4c,
+  0xfe, 0x2e, 0x5a, 0x12, 0xd8, 0xc9, 0xba, 0xcf, 0x29, 0x4a, 0xf6, 0x8b, 0x64, 0x8a, 0xef, 0x27,
+  0x1b, 0x31, 0x05, 0xd8, 0x66, 0x67, 0x1b, 0xd8, 0x3e, 0x30, 0xdc, 0xd4, 0xe9, 0x9b, 0xc5, 0x9e,
+  0x4b, 0x43, 0x5a, 0xa5, 0x61, 0xe8, 0x39, 0x2f, 0x68, 0x74, 0x5d, 0xef, 0xda, 0x95, 0x8b, 0x67,
+  0xbb, 0x9d, 0x1e, 0x48, 0x28, 0xa0, 0xad, 0xd0, 0x60, 0x33, 0xc8, 0x1d, 0x1d, 0x9e, 0xd1, 0xe1,
+  0x50, 0x96, 0x99, 0x22, 0xe7, 0xaf, 0xc9, 0xf8, 0x4e, 0xe9, 0xaa, 0xd8, 0x75, 0x06, 0xda, 0x73,
+  0x26, 0x17, 0xcb, 0x7b, 0x45, 0x96, 0x25, 0x8a, 0x0b, 0x1a, 0x9e, 0x92, 0x2b, 0x82, 0xfe, 0xf7,
+  0x86, 0x4d, 0x49, 0xd7, 0xcc, 0xc4, 0x20, 0x72, 0x44, 0x86, 0x30, 0x72, 0xf7, 0xcd, 0xcf, 0x6f,
+  0x83, 0x28, 0x93, 0x58, 0x44, 0xd1, 0xfb, 0xc7, 0x88, 0x77, 0xbb, 0x36, 0x4a, 0xce, 0x8c, 0xbc,
+  0x81, 0x29, 0x28, 0x37, 0xf3, 0x20, 0xe6, 0x84, 0x94, 0x2a, 0x8e, 0x7e, 0xbc, 0x8c, 0x39, 0xed,
+  0xd8, 0x91, 0x11, 0xfe, 0x9e, 0xdd, 0x6e, 0x84, 0xa9, 0xe4, 0xf0, 0x07, 0xcb, 0x14, 0x61, 0x66,
+  0x81, 0x78, 0x1d, 0x07, 0xab, 0xc0, 0x9f, 0xd3, 0xed, 0x5e, 0x0b, 0x01, 0xa8, 0xef, 0xa3, 0xb6,
+  0xe7, 0xf5, 0x28, 0x69, 0x32, 0xfe, 0x58, 0xf3, 0x1a, 0x13, 0x10, 0xea, 0x94, 0x1b, 0xb8, 0xdd,
+  0x70, 0xcf, 0xb4, 0xa7, 0xbd, 0x8e, 0x1a, 0x2d, 0xcc, 0x7f, 0x8a, 0x49, 0x75, 0xf1, 0x17, 0x6a,
+  0xc5, 0x11, 0x9e, 0xed, 0x4b, 0x9f, 0x44, 0x38, 0x67, 0xc9, 0x5c, 0x55, 0x8a, 0x19, 0xbb, 0xd5,
+  0x74, 0xb4, 0x52, 0x71, 0xb0, 0x3c, 0xa7, 0x18, 0x48, 0x34, 0x28, 0xed, 0x02, 0x49, 0xfe, 0x46,
+  0x93, 0x93, 0x55, 0xf2, 0xc8, 0x6b, 0x60, 0x9d, 0x3e, 0x66, 0x77, 0xe4, 0x57, 0xec, 0x61, 0xcd,
+  0x2f, 0x49, 0x64, 0x02, 0xa1, 0x08, 0x85, 0xa1, 0x34, 0x41, 0xaa, 0x46, 0x87, 0xf5, 0x3e, 0x81,
+  0x7f, 0xef, 0xf1, 0x63, 0x75, 0x22, 0x61, 0xd1, 0xbe, 0x46, 0x9b, 0x43, 0xab, 0xdb, 0x86, 0xbd,
+  0x3f, 0xbd, 0xde, 0xef, 0x0b, 0xbe, 0x08, 0x98, 0xa5, 0x03, 0xcf, 0xa7, 0xa7, 0x17, 0x30, 0xc4,
+  0x9b, 0x57, 0x41, 0xc1, 0x0f, 0xd6, 0x3c, 0xd0, 0xa7, 0x67, 0x7b, 0x77, 0x37, 0x41, 0x03, 0x87,
+  0x5a, 0x40, 0x49, 0x52, 0x07, 0xb6, 0x2e, 0x7f, 0x16, 0x0e, 0x96, 0x42, 0xfa, 0x35, 0x23, 0xb9,
+  0x20, 0xf0, 0xee, 0xc1, 0xc7, 0x5c, 0x21, 0xe7, 0x87, 0xe2, 0x3f, 0xc2, 0x23, 0xf2, 0x52, 0xfc,
+  0xf8, 0x63, 0x9e, 0x8c, 0x18, 0xb1, 0x80, 0xac, 0xc9, 0xd4, 0x39, 0xdf, 0x64, 0x53, 0x01, 0xfd,
+  0x36, 0x5a, 0x20, 0x78, 0xb9, 0x94, 0x80, 0x71, 0xf3, 0x2c, 0xfc, 0xbe, 0xe8, 0xa6, 0x3e, 0x47,
+  0x2c, 0xbb, 0xe2, 0xa1, 0xe6, 0x7e, 0x31, 0x88, 0x15, 0x0a, 0x4c, 0xdb, 0x87, 0xf4, 0x3e, 0xef,
+  0xb3, 0xfc, 0x84, 0x52, 0x7d, 0x19, 0x8c, 0x44, 0x8b, 0x52, 0xb2, 0x77, 0xf8, 0xe8, 0x16, 0xde,
+  0x7f, 0xa5, 0x52, 0x6b, 0x26, 0x81, 0x64, 0xe4, 0xb5, 0xaf, 0x77, 0xe4, 0x2c, 0xcc, 0xe2, 0xa2,
+  0x3d, 0x4a, 0xa3, 0x2e, 0xa5, 0x80, 0xa7, 0x8e, 0xf0, 0xe5, 0x5a, 0xe4, 0x27, 0x03, 0xc4, 0xe7,
+  0x7c, 0x14, 0xb1, 0x0f, 0x4c, 0x5e, 0xce, 0xda, 0x3a, 0x25, 0x86, 0xb5, 0xe6, 0x6c, 0x53, 0x2a,
+  0x59, 0xba, 0x4c, 0x4c, 0x7b, 0x7e, 0x12, 0x6f, 0xc0, 0xb0, 0xd7, 0xf8, 0xa8, 0x65, 0xb3, 0x3f,
+  0xee, 0xae, 0xca, 0x11, 0xf4, 0x4d, 0xe4, 0x43, 0x78, 0x74, 0xfa, 0xf0, 0xec, 0x84, 0xc2, 0x34,
+  0x26, 0x59, 0x59, 0x37, 0x65, 0x3e, 0xc3, 0x2d, 0x2e, 0xa6, 0xd5, 0x98, 0x52, 0x85, 0x5f, 0xa4,
+  0xc6, 0xab, 0xa4, 0xe0, 0xbc, 0x29, 0x75, 0x91, 0xe3, 0x24, 0xc0, 0xa2, 0x34, 0x71, 0xf8, 0xa6,
+  0xcc, 0x70, 0x92, 0x0a, 0xf5, 0x89, 0x0a, 0xc0, 0x6f, 0xe4, 0x8e, 0x52, 0x2b, 0xb0, 0x63, 0x9a,
+  0xf4, 0xf5, 0x12, 0x85, 0xd9, 0x8e, 0x5a, 0xa5, 0x21, 0xaa, 0x48, 0x2c, 0xd1, 0x6e, 0xa8, 0x75,
+  0x3c, 0x51, 0x47, 0xf0, 0x44, 0xdb, 0x53, 0x2b, 0x44, 0xa2, 0x82, 0x60, 0x89, 0x76, 0xa4, 0x56,
+  0xa8, 0x8b, 0x0a, 0x82, 0x29, 0xda, 0x75, 0xc9, 0x63, 0x81, 0x0c, 0xce, 0x4e, 0xbe, 0x96, 0xb8,
+  0x23, 0xff, 0x1e, 0xe6, 0x06, 0x05, 0x2d, 0xa8, 0xc3, 0xd4, 0x6f, 0xd6, 0x49, 0xc2, 0x10, 0x6d,
+  0xfa, 0x99, 0x70, 0xcb, 0x55, 0xf6, 0x18, 0x81, 0x46, 0x15, 0x83, 0x0c, 0x1b, 0xe5, 0x8a, 0x89,
+  0xb3, 0x24, 0xb6, 0x57, 0x8a, 0xff, 0xfc, 0x96, 0x3b, 0x2c, 0x5b, 0x95, 0x51, 0x95, 0x02, 0x0d,
+  0x5e, 0x28, 0x16, 0xf0, 0xf2, 0x1c, 0x23, 0x36, 0xcd, 0x2a, 0x73, 0xf3, 0xcb, 0x9b, 0x5b, 0x72,
+  0x95, 0xde, 0xdf, 0x5a, 0x91, 0xc3, 0x32, 0x53, 0x49, 0x00, 0x30, 0x75, 0xe7, 0x9c, 0x25, 0x92,
+  0xfc, 0x15, 0x62, 0x88, 0x50, 0x99, 0xb5, 0xe7, 0xd5, 0x48, 0x87, 0xeb, 0x5b, 0x7c, 0x84, 0xbc,
+  0xbe, 0x43, 0x5f, 0xca, 0xb5, 0x7f, 0xc8, 0x2e, 0x23, 0x71, 0xeb, 0x94, 0xbc, 0x16, 0x96, 0x4a,
+  0xca, 0xed, 0x0f, 0xc4, 0x2b, 0x68, 0x3f, 0xaa, 0x3e, 0xcd, 0x8e, 0xc5, 0x8c, 0xcc, 0x0d, 0xda,
+  0x3b, 0x0e, 0x6d, 0xc0, 0xb7, 0x1a, 0xd1, 0x22, 0x14, 0x3b, 0x45, 0x95, 0x2d, 0x90, 0xd0, 0x37,
+  0xe9, 0xf4, 0xb9, 0x74, 0x9d, 0x48, 0xe2, 0xb3, 0x09, 0x7d, 0xbc, 0xa9, 0xe8, 0x54, 0xc9, 0x34,
+  0x47, 0x59, 0x32, 0x8d, 0x37, 0xff, 0x61, 0x28, 0x15, 0x05, 0x99, 0x7f, 0x85, 0xcd, 0xfb, 0x1b,
+  0x7e, 0xe8, 0x85, 0x72, 0xc0, 0x25, 0x19, 0xde, 0x92, 0x7b, 0x79, 0xd3, 0xbb, 0xad, 0x40, 0x06,
+  0x60, 0xe9, 0x73, 0xc8, 0x70, 0x43, 0x77, 0xcb, 0x7e, 0xcc, 0x84, 0x10, 0xba, 0x2f, 0x8b, 0x8e,
+  0x85, 0xa1, 0x1d, 0xed, 0x2e, 0xbb, 0x03, 0x0b, 0xd5, 0x4e, 0x2b, 0x11, 0x5b, 0xc4, 0x8d, 0x58,
+  0x52, 0x46, 0x8b, 0xcd, 0xab, 0xc8, 0x0e, 0xcc, 0xa1, 0x74, 0xbb, 0x95, 0x2e, 0x5f, 0xb3, 0x85,
+  0x77, 0x5c, 0xa8, 0xf6, 0x0c, 0xff, 0xbc, 0xff, 0x0f, 0x71, 0x61, 0x2c, 0x13, 0x33, 0x3a, 0x20,
+  0x57, 0x58, 0x5a, 0xd0, 0xbd, 0xd6, 0x43, 0xab, 0x3f, 0xad, 0xaf, 0xe4, 0x62, 0x5f, 0x1b, 0x5f,
+  0x1e, 0x1a, 0x07, 0x31, 0xe8, 0xf6, 0xe2, 0x3c, 0x85, 0x40, 0x4c, 0x26, 0xf7, 0x00, 0xf8, 0xba,
+  0x85, 0x10, 0x28, 0x85, 0xc1, 0xd1, 0x60, 0x22, 0x4c, 0x45, 0x7d, 0x04, 0x9c, 0xf2, 0x51, 0x97,
+  0xd1, 0x92, 0xbc, 0xbb, 0x4e, 0xba, 0xe2, 0xdc, 0xa0, 0x33, 0xb7, 0x21, 0x65, 0xd3, 0x32, 0x42,
+  0xcb, 0xc7, 0xdc, 0x33, 0x22, 0x90, 0xc8, 0xf6, 0xf1, 0xe4, 0x1f, 0xc0, 0x95, 0xdd, 0xe8, 0xf5,
+  0x43, 0xee, 0x00, 0x88, 0x9d, 0x3c, 0xb3, 0x8d, 0x27, 0xd7, 0x00, 0xd4, 0x41, 0xe8, 0xaa, 0x67,
+  0x0c, 0xe9, 0x62, 0xa4, 0x13, 0x86, 0xf4, 0x91, 0xca, 0xd3, 0xae, 0x03, 0x92, 0x27, 0xe5, 0x15,
+  0x81, 0xfa, 0x6a, 0x32, 0x09, 0x3c, 0xbd, 0xa5, 0x91, 0xce, 0x0a, 0xa2, 0x41, 0xd1, 0xb1, 0x40,
+  0xc0, 0x3b, 0xc4, 0xf6, 0x94, 0xc8, 0x83, 0x9c, 0x0b, 0x49, 0x1b, 0x6b, 0x12, 0x40, 0x8b, 0x37,
+  0xea, 0x1c, 0x0e, 0x01, 0xab, 0xc8, 0x61, 0x81, 0x6c, 0x9f, 0x47, 0xb8, 0x92, 0xd7, 0x09, 0x57,
+  0x28, 0x26, 0xde, 0x21, 0x09, 0x7d, 0x6d, 0xed, 0xe2, 0xcb, 0x1a, 0x25, 0xd9, 0xb9, 0xcd, 0x43,
+  0x3f, 0xf6, 0xb3, 0xee, 0x27, 0x82, 0x43, 0xbb, 0xbb, 0x10, 0x54, 0x6d, 0x84, 0x98, 0xc0, 0xc7,
+  0x4e, 0x53, 0xad, 0x28, 0xad, 0x79, 0x19, 0xc7, 0x8b, 0x2f, 0x45, 0x48, 0xbd, 0x62, 0x33, 0x80,
+  0x0a, 0xff, 0xe5, 0xfc, 0x51, 0x1c, 0xa4, 0x9b, 0x69, 0x64, 0x48, 0x13, 0x5f, 0xd0, 0x73, 0xf6,
+  0xe6, 0x49, 0x81, 0xd2, 0x3f, 0x4f, 0x24, 0xfe, 0x7a, 0xa2, 0xda, 0xad, 0x85, 0xb1, 0x25, 0xe1,
+  0x76, 0xdf, 0xdd, 0xfc, 0x3f, 0xba, 0x69, 0x55, 0x16, 0x93, 0x0c, 0x9e, 0x7f, 0x8d, 0x11, 0xe3,
+  0xf4, 0x65, 0x0d, 0x71, 0x3d, 0xe8, 0x86, 0xee, 0xf3, 0x66, 0xc4, 0xa0, 0x55, 0x8e, 0x83, 0x5f,
+  0x8b, 0x43, 0xa2, 0x20, 0xc3, 0x0f, 0x2e, 0xba, 0x56, 0xdd, 0x09, 0x41, 0xdf, 0x4b, 0x97, 0xdd,
+  0xf6, 0x6c, 0x5b, 0x04, 0x54, 0x9f, 0x88, 0x9d, 0x85, 0xe6, 0x33, 0x1b, 0x30, 0xd0, 0x69, 0x5d,
+  0x20, 0x5c, 0x7b, 0x5b, 0xca, 0x96, 0xc1, 0x6f, 0x09, 0x72, 0xa2, 0x6b, 0xbd, 0x1e, 0xa8, 0xba,
+  0xc5, 0xf5, 0xd3, 0xf9, 0x1f, 0x6d, 0x70, 0x79, 0x74, 0xdb, 0xb4, 0xf0, 0xcd, 0x6b, 0xfd, 0x0e,
+  0x94, 0x97, 0xf2, 0x2f, 0x65, 0xca, 0xd7, 0x76, 0xb1, 0xfc, 0x9f, 0xa1, 0x81, 0x93, 0x7f, 0x4f,
+  0x79, 0x2d, 0x0b, 0xd4, 0xdd, 0xd0, 0x4b, 0x63, 0x3e, 0x4e, 0x5a, 0x06, 0x74, 0xbd, 0x62, 0x9f,
+  0x5a, 0x2d, 0x57, 0x4b, 0x66, 0x8e, 0x3d, 0x94, 0x2b, 0xfc, 0x49, 0x8c, 0x22, 0x7d, 0x84, 0xae,
+  0xd3, 0x07, 0xe8, 0x8f, 0x1e, 0xcc, 0xcc, 0xc1, 0x8a, 0xc8, 0x5e, 0xc7, 0x5b, 0xa8, 0xa4, 0x44,
+  0xfe, 0x53, 0x1f, 0xc4, 0xa1, 0x0b, 0xf5, 0x88, 0xc5, 0xc6, 0x94, 0x9b, 0x8c, 0x6d, 0x83, 0x86,
+  0x7d, 0xa2, 0xb2, 0x98, 0xa4, 0xa2, 0x4f, 0x6b, 0x48, 0x57, 0xd2, 0xb0, 0xde, 0xd7, 0xa9, 0x32,
+  0x06, 0x5d, 0xf1, 0xb3, 0x1c, 0x40, 0x97, 0xd8, 0x91, 0x1a, 0xee, 0x80, 0xdc, 0xf5, 0x74, 0x0f,
+  0xa7, 0x5e, 0xe6, 0xaf, 0xc1, 0x21, 0x81, 0xff, 0x4e, 0x8f, 0xf8, 0x5b, 0x3e, 0x40, 0xf7, 0x6a,
+  0x76, 0xca, 0x1b, 0x4f, 0xd1, 0x90, 0x9b, 0x45, 0x33, 0x71, 0xd3, 0x41, 0x4f, 0x9c, 0xbe, 0x3f,
+  0xb5, 0xb7, 0x97, 0x3c, 0xac, 0x54, 0x16, 0x52, 0x96, 0xc9, 0xc2, 0xb5, 0xc8, 0x52, 0x5e, 0xd5,
+  0x4e, 0x7d, 0x77, 0xf3, 0x57, 0x15, 0x4c, 0x14, 0x48, 0x37, 0x5c, 0xdc, 0x25, 0x5b, 0xce, 0x34,
+  0x9e, 0x49, 0xa0, 0x8f, 0xdb, 0x76, 0xa3, 0x37, 0x05, 0x10, 0xfa, 0xb8, 0xf8, 0x4d, 0x38, 0x68,
+  0xdc, 0xf9, 0x86, 0xd9, 0x50, 0x30, 0x57, 0xfc, 0x14, 0x48, 0xf2, 0xd6, 0xe3, 0x10, 0xca, 0xaa,
+  0x41, 0x6f, 0xf4, 0xf7, 0xa6, 0x16, 0x3d, 0x2b, 0x33, 0x1d, 0x3e, 0xcb, 0x44, 0xa3, 0x39, 0xfc,
+  0x59, 0xe7, 0x17, 0xdb, 0x8c, 0xfe, 0x6a, 0xe6, 0x4a, 0x97, 0xef, 0x84, 0x0e, 0x33, 0xbd, 0xfb,
+  0xef, 0x39, 0x7f, 0x87, 0x3c, 0x96, 0x27, 0x73, 0xbc, 0x7e, 0xf1, 0x47, 0xf6, 0x3a, 0x7c, 0xef,
+  0xb0, 0x5d, 0x05, 0x4a, 0x63, 0x86, 0x37, 0xbc, 0xac, 0x05, 0x77, 0xef, 0xaa, 0xbe, 0x5c, 0x5f,
+  0x19, 0xff, 0x5f, 0xdc, 0x8a, 0xb4, 0x72, 0x55, 0x1b, 0xff, 0x59, 0x0d, 0x3c, 0xe1, 0x7e, 0x01,
+  0xb6, 0x4d, 0x7d, 0x79, 0xf0, 0x51, 0x41, 0x9c, 0x7c, 0x01, 0x8a, 0x7d, 0x44, 0xb6, 0xc3, 0xc4,
+  0xff, 0xcc, 0x43, 0x03, 0x99, 0xcb, 0xe7, 0x1e, 0xd1, 0xf2, 0x17, 0xec, 0x14, 0xf2, 0x9d, 0x83,
+  0x8f, 0x98, 0x97, 0x61, 0x1f, 0x7e, 0xbe, 0x4f, 0xcb, 0xe5, 0x17, 0xfc, 0x6e, 0x31, 0x61, 0x07,
+  0xc4, 0x1d, 0xb2, 0x80, 0x96, 0x50, 0xb4, 0x4d, 0x7e, 0xcd, 0x7b, 0xff, 0xf6, 0x3f, 0x29, 0x84,
+  0x0b, 0x33, 0xa0, 0xdf, 0xff, 0xf6, 0x51, 0x01, 0xa8, 0x50, 0x7c, 0xc4, 0x9f, 0x98, 0xfb, 0x98,
+  0x3e, 0x41, 0xfd, 0x86, 0x4a, 0x55, 0xe3, 0x6f, 0x1f, 0xa4, 0x0e, 0xe8, 0x74, 0xd4, 0x13, 0x1d,
+  0xa8, 0x75, 0xf1, 0x83, 0x3e, 0x16, 0x99, 0x51, 0x33, 0xb7, 0xbb, 0xb2, 0x2b, 0x7d, 0xef, 0x88,
+  0xd4, 0x21, 0x6c, 0xbb, 0x2e, 0x10, 0x54, 0xd9, 0x6d, 0xfd, 0x15, 0xc7, 0x43, 0x8a, 0x03, 0x34,
+  0x86, 0x26, 0xa6, 0xd6, 0x8f, 0x35, 0x7e, 0x3d, 0xda, 0x97, 0x68, 0xc2, 0x45, 0x2b, 0xef, 0x43,
+  0xad, 0x24, 0x7f, 0xda, 0xaf, 0x18, 0xaa, 0xa7, 0x7c, 0xda, 0x42, 0x95, 0x12, 0x27, 0x66, 0x2c,
+  0xa9, 0x74, 0x91, 0x03, 0x3b, 0xfd, 0x9d, 0xb8, 0xe4, 0xf8, 0x74, 0xa5, 0x9f, 0x9d, 0xf5, 0xe8,
+  0x7d, 0xc5, 0x66, 0xf7, 0x73, 0x4a, 0x89, 0xf2, 0x0b, 0xcc, 0x51, 0x9a, 0xbd, 0xf5, 0x0d, 0xc1,
+  0x88, 0x7b, 0x2b, 0xf0, 0xc1, 0x48, 0xcd, 0xb9, 0x34, 0xd5, 0x34, 0x57, 0x8a, 0x73, 0x7e, 0xff,
+  0xe0, 0x03, 0x93, 0xa1, 0xe3, 0xd7, 0x74, 0x12, 0x9d, 0x0b, 0x92, 0x2c, 0x29, 0x3d, 0x1b, 0xf3,
+  0x1d, 0x9e, 0x0a, 0xe4, 0xcb, 0xe4, 0x4e, 0xe4, 0xc9, 0x2b, 0x74, 0x25, 0x5c, 0xc0, 0x0a, 0x2b,
+  0x9c, 0x2f, 0x20, 0x26, 0x14, 0x3c, 0x9c, 0x64, 0x78, 0x80, 0x0e, 0x64, 0x52, 0xa5, 0xca, 0x0e,
+  0x6a, 0x12, 0xe9, 0x67, 0x7f, 0xaa, 0x25, 0x9a, 0x29, 0x7d, 0xd0, 0x37, 0xd4, 0xc9, 0x7d, 0xe2,
+  0xb2, 0x30, 0xf7, 0xff, 0x86, 0x49, 0x38, 0x44, 0x66, 0xdb, 0x29, 0x71, 0x0b, 0x40, 0x08, 0x74,
+  0xa3, 0x53, 0x2a, 0x14, 0x9f, 0x3d, 0xaf, 0x31, 0x06, 0x9d, 0xa1, 0xa2, 0x3f, 0x52, 0x70, 0xd9,
+  0xd7, 0x2c, 0x46, 0x97, 0xd1, 0x50, 0x8a, 0x8a, 0x3b, 0x5c, 0x9f, 0xfd, 0x4a, 0x42, 0x87, 0xc4,
+  0xdc, 0xef, 0xf3, 0x7c, 0x29, 0x98, 0x98, 0x97, 0x08, 0xc7, 0x00, 0x6e, 0x62, 0x7e, 0xfb, 0x88,
+  0x32, 0xc7, 0xa2, 0x9c, 0xc8, 0x53, 0x89, 0x4c, 0xce, 0x89, 0x98, 0x67, 0x20, 0x70, 0x86, 0x91,
+  0x47, 0x7c, 0x88, 0xfb, 0x33, 0x2e, 0xc0, 0x7a, 0x72, 0xf4, 0x95, 0x57, 0x0a, 0x29, 0x92, 0xda,
+  0x4e, 0xf7, 0x0b, 0xa4, 0x93, 0xf0, 0xdd, 0xef, 0x7f, 0x85, 0xbe, 0xea, 0x09, 0x64, 0x31, 0x7b,
+  0x3f, 0xcb, 0x0f, 0xf3, 0x53, 0x82, 0xb7, 0x7f, 0x3c, 0x99, 0x88, 0x0c, 0x57, 0xe1, 0xe3, 0xd6,
+  0xbe, 0xfb, 0xc9, 0xa7, 0x53, 0x56, 0x2b, 0x15, 0x03, 0x36, 0x3e, 0x83, 0xee, 0x3f, 0xa0, 0xe9,
+  0xe3, 0x48, 0x55, 0x68, 0x1d, 0x27, 0x87, 0x48, 0xf1, 0x73, 0x3a, 0x99, 0xc2, 0x12, 0x6e, 0x7c,
+  0x45, 0xc3, 0xdf, 0xa8, 0x29, 0xd7, 0x5c, 0x81, 0x62, 0x7c, 0xdd, 0x7f, 0x8f, 0x09, 0x13, 0xc0,
+  0x0a, 0x53, 0x8d, 0xf2, 0x06, 0x69, 0x94, 0xfc, 0xbe, 0x83, 0x99, 0xea, 0x53, 0xa4, 0xe7, 0x7c,
+  0x53, 0xbe, 0xeb, 0x06, 0x2f, 0x24, 0x8b, 0x62, 0xaf, 0xa7, 0xe7, 0x0c, 0x7f, 0x19, 0xf4, 0xba,
+  0xf7, 0xd6, 0xe0, 0x61, 0x55, 0xa7, 0x34, 0xf1, 0x7a, 0x15, 0xd5, 0x52, 0xa9, 0x90, 0xe7, 0xc8,
+  0x14, 0xbe, 0x9f, 0x23, 0x0e, 0x34, 0x20, 0x68, 0xdc, 0x55, 0x95, 0xe3, 0x0c, 0x30, 0xe6, 0x75,
+  0x01, 0x71, 0xa3, 0x20, 0xd9, 0x60, 0xeb, 0x71, 0x60, 0x1f, 0x0e, 0x2a, 0xe6, 0xf7, 0x4b, 0x62,
+  0xfe, 0x4e, 0x39, 0xdc, 0x4c, 0x80, 0x63, 0x9a, 0xee, 0x77, 0xff, 0xe3, 0xb7, 0xda, 0x34, 0x46,
+  0xa8, 0x57, 0xa5, 0x7a, 0x88, 0x39, 0x71, 0x54, 0x14, 0x9a, 0xfc, 0xe4, 0xa1, 0x46, 0x41, 0xe8,
+  0xfc, 0xfe, 0x09, 0x9d, 0x1d, 0x96, 0x62, 0xbc, 0x1a, 0x27, 0x50, 0xd5, 0x98, 0x01, 0xcc, 0x6b,
+  0xe8, 0x42, 0x11, 0x4e, 0x69, 0xb9, 0x7f, 0xdc, 0xef, 0xf1, 0x1e, 0x72, 0x6e, 0xb7, 0x71, 0x42,
+  0x4f, 0xb8, 0x27, 0x71, 0x53, 0x96, 0x14, 0xab, 0xe4, 0x42, 0x6c, 0xba, 0x81, 0x1c, 0xf6, 0x63,
+  0x01, 0x25, 0x97, 0xab, 0x49, 0xd3, 0x9c, 0x11, 0xb5, 0x66, 0x7c, 0x02, 0x46, 0x0b, 0xbe, 0x77,
+  0x05, 0xef, 0x84, 0x50, 0x5b, 0xcc, 0x80, 0x99, 0xf9, 0x18, 0xde, 0x70, 0x98, 0x00, 0x2f, 0x29,
+  0xb5, 0x65, 0x71, 0x16, 0x65, 0xa9, 0x5d, 0x92, 0x15, 0x64, 0x71, 0xb6, 0xd1, 0x54, 0xe2, 0xc0,
+  0x8f, 0xbe, 0x13, 0x6e, 0xc2, 0x27, 0xd1, 0x6d, 0x46, 0x47, 0xdd, 0x25, 0x07, 0x55, 0x26, 0xe5,
+  0x61, 0xc9, 0xb1, 0x22, 0x39, 0x14, 0x9a, 0x8a, 0x47, 0x81, 0xf1, 0x51, 0xbb, 0xd1, 0xe4, 0xb5,
+  0x00, 0x10, 0x46, 0xa6, 0xe9, 0xbc, 0x0e, 0xbb, 0xce, 0x2f, 0xb5, 0xdf, 0xc2, 0x6b, 0x61, 0x53,
+  0xe1, 0x91, 0xe0, 0x5b, 0xde, 0x6e, 0xc4, 0xc4, 0x43, 0x8e, 0x70, 0x32, 0x22, 0xcd, 0xb0, 0x34,
+  0x64, 0x99, 0x90, 0xc4, 0xca, 0xa7, 0xc8, 0xbc, 0x8a, 0x37, 0x1b, 0x07, 0x8b, 0xf2, 0xed, 0x7f,
+  0x99, 0x68, 0x7b, 0x64, 0xe0, 0x96, 0x74, 0x8b, 0x7b, 0xed, 0xaf, 0x53, 0xe5, 0x2f, 0x52, 0xc0,
+  0xaa, 0x17, 0x3e, 0x87, 0xd9, 0xf5, 0x43, 0xaf, 0x89, 0x6e, 0x53, 0x58, 0xe5, 0x6f, 0xf8, 0x18,
+  0xc1, 0x3f, 0x79, 0x9d, 0x3d, 0x19, 0x0f, 0x8f, 0x52, 0x21, 0x0e, 0x91, 0xf3, 0xfd, 0x3c, 0x8b,
+  0x26, 0x7d, 0xea, 0xa0, 0x5a, 0xd5, 0x9b, 0xfa, 0xac, 0x90, 0xa7, 0x4c, 0x5b, 0x6d, 0xc2, 0x23,
+  0x8b, 0x01, 0xe1, 0x91, 0xe6, 0x07, 0xfe, 0x73, 0x74, 0x17, 0x48, 0x92, 0x0a, 0x96, 0xc6, 0x4d,
+  0x5f, 0xa0, 0x68, 0xe1, 0xdd, 0x41, 0x9a, 0xc1, 0x5d, 0xbe, 0x85, 0xb8, 0x13, 0xdb, 0x30, 0x4d,
+  0x6f, 0xbf, 0x30, 0xcc, 0x24, 0x73, 0xc7, 0x73, 0xbd, 0x4f, 0x97, 0xcb, 0x3d, 0x5b, 0x73, 0x46,
+  0x2a, 0x77, 0x76, 0x40, 0x58, 0x9c, 0x84, 0x76, 0x9d, 0x5d, 0x1b, 0xfa, 0x36, 0x60, 0x5c, 0xa6,
+  0xa5, 0x0d, 0x3c, 0x6f, 0xeb, 0xf4, 0x66, 0x97, 0x95, 0x88, 0x51, 0xc2, 0xab, 0xfc, 0x8b, 0x27,
+  0x92, 0xfb, 0x03, 0x68, 0xd0, 0xeb, 0x4a, 0x10, 0x7e, 0x9a, 0x07, 0xd7, 0x77, 0x9f, 0x29, 0xca,
+  0x25, 0x0d, 0x6b, 0xa1, 0x91, 0x1c, 0x75, 0x5a, 0x31, 0x7b, 0xa4, 0xdb, 0xe6, 0xe3, 0x3d, 0xb2,
+  0x51, 0x7a, 0xd6, 0x81, 0x77, 0x74, 0x6c, 0x64, 0x22, 0xf6, 0x65, 0xf6, 0xd0, 0x8f, 0xbb, 0x62,
+  0x99, 0x3d, 0x6f, 0xa6, 0x3e, 0x96, 0x15, 0xd9, 0x48, 0x12, 0xf2, 0xdf, 0x88, 0x22, 0x6f, 0x7e,
+  0x1e, 0xff, 0xa5, 0x60, 0xd5, 0x5d, 0xbc, 0x29, 0x9d, 0xd9, 0xe4, 0xaf, 0x9c, 0x3b, 0x7f, 0xe5,
+  0xdc, 0xda, 0x85, 0x1b, 0x6b, 0x6b, 0xe7, 0xaa, 0xfc, 0xb7, 0x1c, 0xd0, 0xef, 0x00, 0x12, 0xae,
+  0x30, 0x1c, 0x30, 0xa2, 0xbd, 0x41, 0x99, 0xa3, 0xa4, 0x5c, 0xde, 0x98, 0xe5, 0xa0, 0xb1, 0x75,
+  0x06, 0x29, 0xb3, 0xa6, 0xc9, 0xac, 0x99, 0xdf, 0x45, 0xca, 0x25, 0x0d, 0x09, 0x90, 0x25, 0x46,
+  0x97, 0xf8, 0xbb, 0xfe, 0x17, 0xbb, 0xc7, 0x4f, 0xdc, 0x25, 0xab, 0x28, 0x2f, 0x55, 0xba, 0x80,
+  0x8f, 0xee, 0x7f, 0x80, 0x7f, 0x31, 0x8f, 0xe4, 0x23, 0x72, 0x85, 0xa9, 0xf7, 0x84, 0xa1, 0x02,
+  0xc4, 0x75, 0x05, 0x80, 0x84, 0xee, 0xae, 0xfb, 0xc9, 0x8d, 0x47, 0x94, 0x1e, 0x30, 0x61, 0x8a,
+  0x85, 0xc4, 0xc3, 0x46, 0xdd, 0x68, 0xc6, 0x62, 0x69, 0x41, 0xbe, 0x2d, 0x86, 0xdc, 0x6b, 0x5c,
+  0x48, 0xb7, 0x84, 0x92, 0x79, 0x93, 0x29, 0x81, 0x94, 0x38, 0x9f, 0xd4, 0x03, 0x18, 0x8a, 0xc9,
+  0x83, 0x88, 0x78, 0x95, 0xe4, 0x3e, 0xa7, 0x27, 0x22, 0x91, 0xbe, 0xb8, 0x0e, 0x0d, 0x34, 0x3b,
+  0x8e, 0x59, 0xc9, 0x22, 0x87, 0x58, 0x3c, 0xb7, 0x0d, 0x34, 0x19, 0x25, 0x12, 0xdc, 0x71, 0x7e,
+  0xd8, 0x82, 0x8a, 0xd7, 0xba, 0xfd, 0xb0, 0xe1, 0x49, 0x41, 0x80, 0x38, 0x79, 0xc4, 0x28, 0xa4,
+  0xd7, 0x9c, 0xd7, 0x7b, 0x04, 0x87, 0x89, 0xa5, 0x34, 0xc7, 0xdd, 0xa0, 0xe3, 0x45, 0x91, 0xb3,
+  0xe9, 0xd9, 0x9e, 0x60, 0xf4, 0x94, 0x31, 0xa1, 0x86, 0xf1, 0x99, 0xae, 0x1a, 0x86, 0x8f, 0x38,
+  0x49, 0xa2, 0xef, 0x77, 0x94, 0x63, 0x06, 0x4c, 0xd8, 0xc3, 0x1b, 0x87, 0x4d, 0x10, 0xc5, 0x5e,
+  0x76, 0x80, 0x06, 0xb8, 0x30, 0x02, 0x82, 0xbb, 0xbf, 0x19, 0xb0, 0x77, 0x96, 0x2b, 0x45, 0x44,
+  0xf3, 0xee, 0xd3, 0x13, 0xb1, 0x43, 0x04, 0x31, 0x83, 0xfa, 0x2a, 0x26, 0xfb, 0x28, 0x4c, 0xce,
+  0x3d, 0xca, 0x70, 0xfa, 0x8b, 0xcf, 0x13, 0x8f, 0x9f, 0xb2, 0x14, 0x15, 0x49, 0x57, 0x59, 0x16,
+  0xca, 0xd4, 0xc3, 0xe3, 0xf4, 0x35, 0xc2, 0x29, 0x06, 0x2a, 0xfc, 0x7f, 0x45, 0x3f, 0xa5, 0x84,
+  0x33, 0x97, 0x00, 0x00,
+};
+
+// index.html: 33436 байт, в gzip 7745
+static const uint8_t WEB_INDEX_HTML[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0x69, 0x73, 0x1b, 0xd7,
+  0x91, 0xdf, 0xfd, 0x2b, 0x5e, 0x90, 0x72, 0x04, 0xc6, 0x1c, 0x1c, 0x24, 0x45, 0x53, 0x20, 0x41,
+  0x85, 0xba, 0x6c, 0x6e, 0x59, 0x47, 0x89, 0x4c, 0x9c, 0x64, 0x6b, 0x2b, 0x35, 0x00, 0x06, 0xe0,
+  0x44, 0x03, 0x0c, 0x76, 0x66, 0x48, 0x50, 0xde, 0xdd, 0x2a, 0x8a, 0x92, 0x25, 0x3b, 0x92, 0x2d,
+  0xeb, 0xc8, 0xc6, 0x71, 0xec, 0xd0, 0x72, 0x12, 0xef, 0x87, 0xdd, 0x54, 0x51, 0x94, 0x68, 0xd1,
+  0x14, 0x45, 0x57, 0xf9, 0x07, 0xa4, 0x80, 0xbf, 0xa0, 0x5f, 0xe0, 0x9f, 0xb0, 0xdd, 0xfd, 0xde,
+  0xdc, 0x07, 0x06, 0x24, 0x68, 0xc7, 0x96, 0x28, 0x62, 0x8e, 0x7e, 0xfd, 0xfa, 0xf5, 0xdd, 0xfd,
+  0x1e, 0x66, 0x7e, 0x74, 0xe6, 0xe2, 0xe9, 0xc5, 0x5f, 0x5d, 0x3a, 0xcb, 0x96, 0xac, 0xa6, 0x36,
+  0x3b, 0x83, 0x3f, 0x99, 0x26, 0xb7, 0x1a, 0xe5, 0x8c, 0xb1, 0x9c, 0x81, 0xcf, 0x8a, 0x5c, 0x9b,
+  0x7d, 0x65, 0xa6, 0xa9, 0x58, 0x32, 0xab, 0x2e, 0xc9, 0x86, 0xa9, 0x58, 0xe5, 0xcc, 0xcf, 0x17,
+  0xcf, 0x49, 0x53, 0x19, 0xfb, 0x72, 0x4b, 0x6e, 0x2a, 0xe5, 0xcc, 0x8a, 0xaa, 0x74, 0xda, 0xba,
+  0x61, 0x65, 0x58, 0x55, 0x6f, 0x59, 0x4a, 0x0b, 0x1e, 0xeb, 0xa8, 0x35, 0x6b, 0xa9, 0x5c, 0x53,
+  0x56, 0xd4, 0xaa, 0x22, 0xd1, 0x87, 0x51, 0xb5, 0xa5, 0x5a, 0xaa, 0xac, 0x49, 0x66, 0x55, 0xd6,
+  0x94, 0x72, 0x11, 0x61, 0x58, 0xaa, 0xa5, 0x29, 0xb3, 0xdf, 0x6d, 0x7c, 0xf4, 0x19, 0x3b, 0xa5,
+  0x28, 0x4b, 0xea, 0x8a, 0xb2, 0x80, 0x37, 0x67, 0xf2, 0xfc, 0xc6, 0x2b, 0x33, 0x9a, 0xda, 0xba,
+  0xc2, 0x0c, 0x45, 0x2b, 0x67, 0x4c, 0xeb, 0xaa, 0xa6, 0x98, 0x4b, 0x8a, 0x02, 0xa3, 0x2c, 0x19,
+  0x4a, 0xbd, 0x9c, 0xc9, 0xcb, 0xed, 0x76, 0xae, 0x6a, 0x9a, 0x27, 0x57, 0xca, 0xb5, 0x6a, 0xf5,
+  0x78, 0x61, 0x12, 0xd0, 0x9d, 0x9a, 0x54, 0x10, 0x6e, 0x5e, 0xa0, 0x5e, 0xd1, 0x6b, 0x57, 0x67,
+  0x5f, 0x79, 0x65, 0xa6, 0xa6, 0xae, 0xb0, 0xaa, 0x26, 0x9b, 0x26, 0xcc, 0x4c, 0xa9, 0x1b, 0x00,
+  0x47, 0xaa, 0xc8, 0x06, 0x4c, 0x31, 0xe2, 0x46, 0x5d, 0xd5, 0xb4, 0x0c, 0x53, 0x6b, 0x70, 0x05,
+  0x9f, 0x61, 0x34, 0xb0, 0x98, 0x50, 0xa9, 0x58, 0x28, 0xbc, 0x0a, 0xaf, 0xe5, 0xe1, 0x3d, 0xf1,
+  0xd3, 0x0f, 0x7d, 0xa9, 0x06, 0x50, 0x5f, 0x61, 0x2c, 0x70, 0x4d, 0x52, 0x5b, 0x2d, 0x85, 0xdf,
+  0x09, 0xdf, 0xd3, 0xf4, 0x86, 0x9e, 0x89, 0x22, 0x02, 0x81, 0x87, 0xe7, 0x9d, 0x5f, 0x02, 0x2f,
+  0x1a, 0x6a, 0x63, 0xc9, 0x8a, 0x01, 0x6a, 0x2e, 0x57, 0x1c, 0xd4, 0x9b, 0xb2, 0xd1, 0x50, 0x5b,
+  0xfc, 0xf1, 0x52, 0x71, 0xb2, 0xbd, 0x9a, 0x99, 0x7d, 0x6b, 0xfe, 0x17, 0x67, 0xd9, 0xf9, 0x8b,
+  0x17, 0xe6, 0x17, 0x2f, 0x5e, 0x66, 0xdf, 0x3e, 0x63, 0x67, 0x17, 0x2e, 0x4d, 0x8d, 0x4d, 0x4e,
+  0x3a, 0x43, 0x01, 0x40, 0xb3, 0x2d, 0xb7, 0x66, 0xe9, 0xa7, 0x0d, 0x57, 0x03, 0xd4, 0x70, 0xf2,
+  0x74, 0xe7, 0xe2, 0x85, 0xb7, 0xe6, 0x2f, 0x9c, 0x15, 0x1f, 0xdc, 0x37, 0x88, 0x70, 0xd5, 0x65,
+  0x43, 0xb2, 0xd4, 0x26, 0x3c, 0x2c, 0x49, 0x25, 0xfa, 0xe3, 0x3e, 0x27, 0x86, 0x88, 0x22, 0x9e,
+  0x25, 0x57, 0x4c, 0x4e, 0xbd, 0xca, 0xb2, 0x65, 0xe9, 0x2d, 0xcf, 0x75, 0x26, 0x57, 0x2d, 0x1c,
+  0x9d, 0x31, 0xbd, 0x55, 0xd5, 0xd4, 0xea, 0x95, 0x72, 0xa6, 0x25, 0xaf, 0x64, 0x8f, 0x35, 0x65,
+  0xb5, 0x75, 0x6c, 0x24, 0x33, 0xfb, 0xf2, 0xce, 0x3a, 0xeb, 0x3e, 0xe8, 0x3e, 0xef, 0x6e, 0x76,
+  0xb7, 0xba, 0x2f, 0xba, 0x9b, 0xbd, 0xbb, 0x33, 0x79, 0x0e, 0x24, 0x1a, 0x5e, 0x86, 0xd9, 0xff,
+  0xf9, 0xe1, 0x21, 0x9b, 0x5b, 0x08, 0xf0, 0xbb, 0x8d, 0x07, 0xef, 0x01, 0xc4, 0xde, 0x1a, 0xc0,
+  0xba, 0xd1, 0xdd, 0xe9, 0xee, 0xb2, 0xd7, 0x58, 0xf7, 0xef, 0xdd, 0xdd, 0xde, 0xb5, 0xee, 0x37,
+  0xdd, 0xfd, 0xde, 0x5a, 0x6f, 0xfd, 0x60, 0x03, 0x74, 0xd4, 0xba, 0x2a, 0xe0, 0x7f, 0xc5, 0xde,
+  0x56, 0xa5, 0x73, 0xea, 0xc1, 0xe0, 0x80, 0x2c, 0x5a, 0x6a, 0xab, 0x61, 0xd2, 0xe4, 0x3f, 0xf9,
+  0x23, 0xeb, 0x7e, 0x06, 0x88, 0x5e, 0xeb, 0xad, 0x03, 0xc2, 0xfb, 0xdd, 0xaf, 0xbb, 0xbb, 0xdd,
+  0x9d, 0x03, 0x12, 0x40, 0xd6, 0xd4, 0x0a, 0x07, 0xfa, 0xdf, 0xac, 0xfb, 0x09, 0xd0, 0xf3, 0x39,
+  0xcc, 0xfe, 0x31, 0x81, 0xdd, 0x02, 0xb0, 0x9b, 0x07, 0x03, 0x6b, 0x35, 0x08, 0xe6, 0xa7, 0xef,
+  0xb3, 0x45, 0x45, 0x53, 0x1a, 0x86, 0xdc, 0x3c, 0x18, 0x1c, 0xb9, 0x2d, 0xa8, 0xf7, 0xf0, 0x0e,
+  0x9b, 0xbb, 0x34, 0xef, 0x02, 0x71, 0xf8, 0xe9, 0x47, 0x92, 0xc4, 0x5e, 0xfe, 0xfe, 0xa3, 0xf4,
+  0x7f, 0xd8, 0xf9, 0xb9, 0xf9, 0x0b, 0x03, 0xbe, 0x22, 0x49, 0xb3, 0x3e, 0xce, 0x35, 0x15, 0x60,
+  0x4f, 0x98, 0x80, 0xcd, 0xa5, 0x28, 0x04, 0x70, 0x4d, 0x42, 0xf6, 0x0c, 0xe9, 0x83, 0x86, 0xa1,
+  0xd6, 0xe0, 0x62, 0x48, 0x6c, 0xab, 0xb2, 0x51, 0x13, 0xd2, 0x1c, 0xbe, 0x21, 0x91, 0x46, 0x14,
+  0xcb, 0xf2, 0x45, 0x77, 0x1b, 0x38, 0xf1, 0x7a, 0xef, 0x7d, 0x58, 0x9a, 0xaf, 0x19, 0xac, 0xcb,
+  0x76, 0xef, 0x9a, 0x47, 0x74, 0xfd, 0x6f, 0xaf, 0x80, 0xca, 0xad, 0xa8, 0x0d, 0x8e, 0x54, 0x47,
+  0x82, 0x8f, 0x28, 0x96, 0x3e, 0xc1, 0xc6, 0x47, 0x96, 0x41, 0x3b, 0x67, 0x66, 0x61, 0x85, 0x9f,
+  0x08, 0x59, 0x4d, 0x04, 0x88, 0xea, 0x65, 0xb6, 0xfb, 0xf7, 0xde, 0x3a, 0x31, 0xc8, 0x7e, 0xf7,
+  0x45, 0x09, 0x16, 0x51, 0x8c, 0x00, 0x8a, 0x94, 0x46, 0xc8, 0x57, 0x66, 0x19, 0xc2, 0x63, 0x3f,
+  0x69, 0x55, 0xcc, 0xf6, 0xf4, 0x7f, 0xf2, 0x7f, 0xd8, 0x3f, 0x1e, 0x7a, 0x9e, 0xad, 0x29, 0x9a,
+  0x25, 0x3b, 0x8a, 0xaa, 0xaa, 0x6b, 0xba, 0x51, 0x5a, 0x91, 0x8d, 0xac, 0x24, 0xc9, 0xcd, 0x8a,
+  0x62, 0x8c, 0x8d, 0xf8, 0x20, 0xc5, 0xa2, 0xd4, 0x90, 0x97, 0x1b, 0x60, 0x66, 0x0c, 0xb9, 0xed,
+  0x10, 0x30, 0xe2, 0x01, 0xbf, 0xbe, 0xe7, 0xef, 0xb8, 0xda, 0xbe, 0x23, 0xf1, 0x87, 0xfc, 0x0a,
+  0x3f, 0xa4, 0xee, 0x63, 0xa1, 0x4b, 0x5a, 0xc5, 0x85, 0xd4, 0xae, 0x02, 0x31, 0x0b, 0xaf, 0xfa,
+  0x11, 0xf6, 0x28, 0x57, 0xc1, 0xad, 0x51, 0x2b, 0xcd, 0x2a, 0xda, 0xb2, 0xd2, 0x97, 0x0f, 0xbe,
+  0xdb, 0xb8, 0xf3, 0x88, 0x33, 0xc2, 0x1e, 0x28, 0xa4, 0x6d, 0xd2, 0x53, 0xeb, 0xc0, 0x12, 0xf0,
+  0x2f, 0xcb, 0xb3, 0xee, 0x7d, 0x52, 0x85, 0x5f, 0x81, 0x2a, 0xdc, 0x27, 0xad, 0x70, 0x27, 0x1d,
+  0x7b, 0x58, 0x7d, 0xd8, 0xe3, 0xdb, 0xcd, 0xd3, 0xe9, 0xb9, 0x23, 0x84, 0x83, 0xb3, 0xee, 0x4b,
+  0xce, 0x30, 0xb0, 0xb2, 0xaf, 0x06, 0xf8, 0xe3, 0xf2, 0xe2, 0x69, 0xe7, 0x41, 0xc3, 0xaa, 0x7a,
+  0x1f, 0xa5, 0xe1, 0x8f, 0x90, 0x05, 0xac, 0x18, 0x16, 0x98, 0xae, 0xc8, 0xd5, 0x2b, 0x0d, 0x43,
+  0x5f, 0x6e, 0xd5, 0x04, 0x77, 0xe2, 0x1a, 0x8d, 0x0c, 0xce, 0x19, 0x96, 0xe0, 0x0c, 0x49, 0x0a,
+  0x4d, 0x25, 0x1d, 0x73, 0xa4, 0xe0, 0x8b, 0x87, 0xb7, 0x59, 0xf7, 0x1e, 0x72, 0x03, 0xfc, 0x5d,
+  0x03, 0xce, 0xb8, 0x9b, 0x6e, 0xe9, 0x2b, 0x32, 0x2c, 0x3e, 0x7d, 0x4c, 0xd0, 0x0e, 0xf7, 0xd3,
+  0xaf, 0xfe, 0x1f, 0x70, 0xf8, 0xde, 0xdd, 0xee, 0x53, 0x67, 0x31, 0x71, 0x04, 0x98, 0xbd, 0xb4,
+  0x82, 0x23, 0xbc, 0x8a, 0xeb, 0x79, 0xa4, 0x8b, 0x89, 0xc3, 0xa5, 0x5d, 0xce, 0x86, 0xa1, 0x28,
+  0xad, 0x03, 0xac, 0x27, 0x8d, 0x21, 0x56, 0x34, 0x56, 0xd8, 0x63, 0x17, 0x2b, 0xe0, 0x9f, 0x59,
+  0x7a, 0xbb, 0x54, 0x1c, 0x6b, 0xaf, 0x4e, 0xd7, 0xc1, 0x89, 0x96, 0x4c, 0xf5, 0x1d, 0xa5, 0x54,
+  0x2c, 0xc2, 0x47, 0xaf, 0x56, 0xb4, 0x94, 0x55, 0x6b, 0x8c, 0x0c, 0xe0, 0xfd, 0x7d, 0xd6, 0xfd,
+  0x13, 0x68, 0xde, 0x27, 0x28, 0xee, 0x1b, 0x20, 0x68, 0x7b, 0xbd, 0xbb, 0x7d, 0x05, 0xdd, 0x59,
+  0x9a, 0xee, 0x0b, 0x7c, 0xba, 0xbb, 0xef, 0x2c, 0x4e, 0x53, 0x69, 0x4a, 0xcb, 0xa6, 0x52, 0x73,
+  0xf5, 0xed, 0x27, 0xdd, 0x7b, 0x0c, 0xec, 0xcb, 0x33, 0xef, 0x13, 0x96, 0x6e, 0xb9, 0xd2, 0x48,
+  0x8f, 0x1c, 0xe9, 0x12, 0xe2, 0x90, 0x47, 0xbd, 0x84, 0x34, 0x46, 0xbf, 0x25, 0x3c, 0xa4, 0x48,
+  0x3e, 0x00, 0x55, 0xfd, 0x88, 0x04, 0x12, 0x55, 0xf4, 0x35, 0x06, 0x4e, 0xe4, 0x0e, 0xaa, 0x44,
+  0xd4, 0xde, 0xbd, 0xdb, 0xb1, 0x24, 0x34, 0x2d, 0xd9, 0x5a, 0x36, 0x25, 0x43, 0xef, 0xf8, 0xc9,
+  0x54, 0xd3, 0x2d, 0xd6, 0x91, 0x8d, 0x96, 0xf0, 0x33, 0x0c, 0x09, 0x2e, 0x38, 0x13, 0x0f, 0xbf,
+  0x8f, 0x53, 0x9d, 0x7d, 0xf3, 0x97, 0xaf, 0x17, 0x8b, 0xac, 0xfb, 0x94, 0x70, 0xb8, 0x85, 0x0e,
+  0x6d, 0xec, 0xf3, 0xa8, 0x70, 0x6d, 0xc8, 0xa4, 0x7c, 0x5f, 0xae, 0x7d, 0x19, 0x41, 0xd5, 0xc1,
+  0x31, 0xed, 0xd4, 0xd3, 0x60, 0x2a, 0x9c, 0xe2, 0x7e, 0xc8, 0x01, 0xb0, 0x21, 0x20, 0xa7, 0x5f,
+  0xe9, 0x87, 0x0e, 0x98, 0xb1, 0xed, 0xee, 0x63, 0x09, 0x96, 0x0c, 0x8d, 0x2c, 0xba, 0x5a, 0x6b,
+  0x89, 0xc8, 0xcd, 0x76, 0x3f, 0x02, 0xdf, 0x6c, 0x1d, 0x28, 0x0c, 0xcf, 0x76, 0x5f, 0xb0, 0xd2,
+  0x54, 0xe1, 0x70, 0xf8, 0xf1, 0xa5, 0xa8, 0xa5, 0x21, 0x5d, 0xf7, 0x6f, 0x68, 0xff, 0xc1, 0xe0,
+  0xee, 0xa0, 0xd7, 0x0e, 0xee, 0xe1, 0x36, 0x23, 0xef, 0xec, 0x49, 0x8a, 0xb5, 0xae, 0xb9, 0x86,
+  0xf6, 0xd0, 0xd8, 0x42, 0xf4, 0xdd, 0x4e, 0x83, 0xef, 0x39, 0x90, 0x59, 0xf6, 0x26, 0x3c, 0xdc,
+  0x1f, 0x3f, 0x02, 0x39, 0x14, 0x0c, 0xfb, 0xd1, 0x70, 0x83, 0x62, 0x9d, 0xc7, 0xbd, 0xeb, 0xe0,
+  0xba, 0x3c, 0xc5, 0x25, 0x44, 0x27, 0x3b, 0x05, 0x3f, 0x5e, 0xa9, 0x7e, 0x2f, 0xf8, 0x9d, 0x96,
+  0xb5, 0x1c, 0x3b, 0x07, 0x81, 0x86, 0x6e, 0xf4, 0x47, 0xaa, 0x5a, 0xff, 0x5e, 0x70, 0xba, 0x58,
+  0xaf, 0x43, 0x3c, 0xda, 0x1f, 0x1d, 0xbd, 0x6e, 0x7e, 0x3f, 0x6b, 0xf8, 0x90, 0xfb, 0x3f, 0xf9,
+  0xee, 0x16, 0xba, 0x40, 0x68, 0x1a, 0xfb, 0x23, 0x57, 0xb3, 0xbe, 0x17, 0xdc, 0x7e, 0xde, 0xc6,
+  0xcc, 0x48, 0x7f, 0x74, 0x96, 0xdb, 0xf1, 0xf8, 0x24, 0x86, 0x0f, 0xf5, 0x65, 0x30, 0x9f, 0xfd,
+  0x6d, 0xd2, 0x47, 0x9f, 0xb1, 0xee, 0xc7, 0xe0, 0x06, 0xdc, 0xc0, 0x6c, 0x06, 0x04, 0x11, 0x9b,
+  0xbd, 0x9b, 0xa0, 0x32, 0xee, 0x32, 0xe4, 0x7d, 0x06, 0xcc, 0xff, 0xbc, 0x77, 0x07, 0xd4, 0x47,
+  0x16, 0xf5, 0x5e, 0xf7, 0x09, 0x5c, 0x7c, 0x8a, 0x2e, 0xc3, 0x48, 0xbc, 0xb9, 0x87, 0xa0, 0x56,
+  0x92, 0x97, 0x2d, 0x3d, 0xc6, 0xda, 0xab, 0xad, 0xba, 0x0e, 0x83, 0x6b, 0x01, 0x8b, 0xcf, 0x97,
+  0xeb, 0x11, 0x8c, 0xf1, 0x0c, 0xa3, 0xc8, 0x30, 0x59, 0x88, 0x1e, 0x71, 0xe1, 0xe1, 0x88, 0xd0,
+  0x0d, 0xaa, 0x64, 0x2a, 0xb2, 0xa9, 0xb7, 0x62, 0x16, 0x6f, 0x00, 0x4c, 0xee, 0x63, 0x28, 0xcd,
+  0x80, 0x1c, 0x3b, 0xa0, 0xba, 0xf3, 0xf8, 0xcb, 0x26, 0xe6, 0x7c, 0xd2, 0xe3, 0xc5, 0xdd, 0x10,
+  0xaf, 0x0b, 0x07, 0x1e, 0x9d, 0x83, 0x26, 0xb8, 0x43, 0xad, 0x06, 0xa5, 0xc5, 0xf2, 0x92, 0xe4,
+  0x09, 0x69, 0x0f, 0x8a, 0xae, 0x88, 0xff, 0x0e, 0x83, 0x30, 0x45, 0x32, 0x71, 0xf8, 0x5a, 0x3e,
+  0x7c, 0x9d, 0x98, 0xe5, 0xa0, 0xe8, 0x7e, 0x0c, 0xab, 0xbc, 0x47, 0x2a, 0x95, 0xab, 0x55, 0x30,
+  0x4f, 0xcf, 0x20, 0x5e, 0xe5, 0x6a, 0xd6, 0x76, 0x5d, 0x43, 0x48, 0x0b, 0x5c, 0x78, 0xaa, 0x60,
+  0x76, 0x48, 0x74, 0xdb, 0x07, 0x27, 0x68, 0xbb, 0xbb, 0xcb, 0xfc, 0xfc, 0x9d, 0x9e, 0x6c, 0xc2,
+  0x11, 0xb7, 0x91, 0xab, 0x82, 0x27, 0x6a, 0x1d, 0x9e, 0xfd, 0x1e, 0x12, 0x69, 0xbe, 0x66, 0x98,
+  0xc2, 0xec, 0x3e, 0x06, 0x19, 0xfc, 0x30, 0xc9, 0x04, 0xa5, 0xc4, 0xad, 0x26, 0x5f, 0x35, 0xe3,
+  0xd4, 0xda, 0x30, 0x75, 0x8a, 0x33, 0x5d, 0x9e, 0x3b, 0xfd, 0x14, 0x59, 0xb2, 0xbb, 0x23, 0x75,
+  0x9f, 0xb8, 0x49, 0x54, 0x97, 0x22, 0x14, 0x60, 0xc6, 0xe4, 0x5e, 0xff, 0x15, 0x56, 0x67, 0x1d,
+  0xb8, 0x78, 0xad, 0x77, 0x1b, 0x23, 0x1a, 0x86, 0x19, 0x57, 0xf0, 0x63, 0x5e, 0xf4, 0x6e, 0x03,
+  0x69, 0x5e, 0xde, 0xbc, 0xff, 0x6f, 0xde, 0xac, 0x73, 0x52, 0xa8, 0x85, 0x00, 0x25, 0x2c, 0x49,
+  0xc8, 0x2a, 0xa6, 0xdf, 0x6d, 0x5a, 0x2d, 0x29, 0x94, 0x09, 0x1f, 0x3f, 0x5e, 0xc0, 0x54, 0x78,
+  0xe4, 0x2a, 0x59, 0x6a, 0x5b, 0x44, 0xec, 0x6a, 0x5b, 0x6a, 0xaa, 0x2d, 0x35, 0x13, 0x5a, 0x53,
+  0x73, 0xa5, 0xc1, 0x03, 0x08, 0xb8, 0x2b, 0xc1, 0x87, 0x8c, 0x7f, 0x58, 0xba, 0x82, 0x85, 0x91,
+  0x53, 0xfa, 0x6a, 0x39, 0x53, 0x60, 0x05, 0x76, 0xa2, 0x50, 0x60, 0x30, 0x66, 0x86, 0xb5, 0x0d,
+  0xc5, 0x54, 0x8c, 0x15, 0x65, 0xce, 0x6c, 0x2b, 0x55, 0xeb, 0xb2, 0x6c, 0xa9, 0x7a, 0x39, 0xb3,
+  0x7a, 0x5e, 0xad, 0xfd, 0x0a, 0xfe, 0xb2, 0x26, 0x96, 0x38, 0x9c, 0x61, 0x44, 0x0e, 0xb4, 0xa9,
+  0x43, 0x70, 0xd6, 0xd4, 0x57, 0x00, 0x7b, 0xbd, 0xb5, 0xa8, 0xb6, 0xb3, 0xca, 0x8a, 0xd2, 0xb2,
+  0x46, 0x8f, 0xe1, 0xe0, 0x40, 0x32, 0xfb, 0x09, 0x4d, 0x91, 0xf1, 0x91, 0x25, 0xb5, 0xa6, 0xe0,
+  0x43, 0xf6, 0xed, 0x59, 0x0f, 0xb8, 0x19, 0xe4, 0x0e, 0x06, 0x28, 0x4d, 0x20, 0x2a, 0x57, 0xcb,
+  0x99, 0xe2, 0x38, 0xfc, 0x8b, 0x17, 0x25, 0xb9, 0x55, 0x5d, 0xd2, 0x0d, 0x9c, 0x51, 0xad, 0x86,
+  0xe1, 0x29, 0x06, 0x62, 0xe5, 0xcc, 0x8f, 0x8f, 0x17, 0x26, 0x0b, 0x13, 0xf0, 0x8c, 0xa3, 0x23,
+  0xe0, 0x9d, 0x31, 0x11, 0x46, 0xc2, 0xda, 0x82, 0xad, 0x78, 0x86, 0x89, 0xe1, 0x5c, 0x2e, 0x37,
+  0x93, 0x47, 0x38, 0x1e, 0x1a, 0xe5, 0x81, 0x0a, 0x09, 0xbc, 0x16, 0x51, 0x0e, 0x18, 0x3c, 0x7d,
+  0x7b, 0xfa, 0xcd, 0xb9, 0xcb, 0x8b, 0xec, 0x35, 0x76, 0xf6, 0x97, 0x97, 0x2e, 0xc2, 0x2f, 0x43,
+  0x49, 0xe4, 0xba, 0x19, 0x5c, 0x5a, 0x4c, 0x9e, 0xad, 0x25, 0xdc, 0xc8, 0x42, 0xac, 0xf5, 0xde,
+  0xa5, 0x00, 0xfa, 0x2e, 0xb2, 0xe6, 0x26, 0xc9, 0x2c, 0x98, 0x4b, 0xb4, 0x9a, 0xdf, 0x90, 0x03,
+  0xbe, 0x05, 0xdc, 0x4a, 0x52, 0x8b, 0x4f, 0x78, 0xd8, 0x1f, 0xd8, 0x78, 0x8f, 0x86, 0x8c, 0x88,
+  0x22, 0x03, 0xc9, 0x80, 0x8a, 0x6e, 0x59, 0x7a, 0xb3, 0x54, 0x74, 0x59, 0x94, 0xde, 0x10, 0x0f,
+  0xd5, 0x54, 0xb3, 0xad, 0xc9, 0x57, 0x4b, 0x75, 0x4d, 0x59, 0x9d, 0xfe, 0xed, 0xb2, 0x69, 0xa9,
+  0xf5, 0xab, 0x92, 0xa8, 0xbd, 0x95, 0x40, 0x36, 0xaa, 0x8a, 0x54, 0x51, 0xac, 0x0e, 0x98, 0xa2,
+  0x69, 0x59, 0x53, 0x1b, 0x2d, 0x49, 0xb5, 0x94, 0xa6, 0x59, 0xaa, 0xc2, 0x6d, 0xc5, 0x98, 0xc6,
+  0xb7, 0x28, 0x32, 0x2f, 0xe1, 0x8f, 0xe9, 0x06, 0xfc, 0x32, 0xd5, 0x5e, 0x9d, 0x8e, 0x1d, 0xd9,
+  0x8f, 0x6d, 0x5b, 0x31, 0x54, 0x1d, 0x84, 0x1e, 0x8b, 0x35, 0x7e, 0xa4, 0x4b, 0x05, 0xaf, 0x34,
+  0xf9, 0x73, 0xfa, 0xe2, 0xad, 0x8a, 0xe5, 0x26, 0xc9, 0x1d, 0xe9, 0x07, 0xdf, 0xf1, 0x12, 0xdd,
+  0xce, 0x16, 0x47, 0xad, 0x25, 0xd5, 0x04, 0x86, 0x2d, 0xf6, 0x6e, 0x79, 0x0b, 0x04, 0x7d, 0x40,
+  0x46, 0xc2, 0x9a, 0xb4, 0x61, 0x4d, 0x1e, 0x1e, 0xd6, 0xd8, 0x84, 0x0d, 0x6c, 0x6c, 0xe2, 0xf0,
+  0xd0, 0x5e, 0x1f, 0xb3, 0xa1, 0x8d, 0x77, 0x9f, 0x1e, 0x16, 0x58, 0x71, 0x72, 0xca, 0x86, 0xf6,
+  0xfa, 0xe1, 0xa1, 0xbd, 0x3e, 0x56, 0x70, 0x70, 0x2b, 0x1c, 0x1e, 0x9c, 0x03, 0xac, 0x7b, 0xbf,
+  0x77, 0xad, 0x77, 0x2f, 0x08, 0x2e, 0xde, 0xc5, 0x86, 0xd7, 0x15, 0x13, 0xc1, 0x9a, 0xf1, 0x2c,
+  0x05, 0x0f, 0x11, 0x3f, 0x99, 0x52, 0xc7, 0x5f, 0x78, 0xa9, 0x48, 0x1d, 0x0f, 0x36, 0x96, 0xde,
+  0x68, 0x68, 0xca, 0x02, 0x41, 0xcc, 0x1e, 0xeb, 0x1c, 0xb3, 0x51, 0xa2, 0x4a, 0xca, 0x7d, 0x5e,
+  0x3a, 0xe9, 0x33, 0x4b, 0x77, 0x24, 0x2b, 0x38, 0x92, 0x15, 0x3b, 0x92, 0xe5, 0x8c, 0xe4, 0xcb,
+  0xd5, 0x0f, 0x30, 0x58, 0x25, 0x38, 0x58, 0x25, 0x76, 0xb0, 0x8a, 0x67, 0xb0, 0x88, 0x04, 0x70,
+  0x2c, 0xd9, 0x7d, 0x56, 0x9f, 0xf4, 0x9b, 0xb7, 0xe4, 0xc9, 0x2b, 0x4b, 0xe0, 0xa1, 0x71, 0x9d,
+  0xd5, 0xc7, 0xba, 0x52, 0xc0, 0x89, 0x1a, 0x05, 0xc9, 0xef, 0x37, 0xb5, 0x63, 0x53, 0x85, 0x90,
+  0x82, 0x19, 0x8b, 0x53, 0x30, 0x3e, 0xdb, 0xdb, 0xc9, 0x44, 0x04, 0x62, 0x02, 0xb8, 0xc7, 0x69,
+  0x1d, 0x8f, 0xc8, 0x93, 0x8e, 0x8f, 0x04, 0x46, 0x9c, 0xf0, 0x99, 0x7b, 0xee, 0xa0, 0x38, 0x09,
+  0xd0, 0xaa, 0xd4, 0x01, 0x6b, 0x99, 0x14, 0x6b, 0xd8, 0x69, 0x4f, 0x5e, 0xa7, 0xf0, 0xc2, 0x21,
+  0x97, 0xdb, 0x07, 0x49, 0x5e, 0x3d, 0x08, 0xa4, 0x47, 0x14, 0xad, 0x3e, 0x25, 0x83, 0xb2, 0xed,
+  0x85, 0x27, 0xa3, 0x33, 0xd1, 0x1f, 0x9e, 0xa7, 0xda, 0xe6, 0x02, 0x75, 0x7c, 0x5d, 0x0f, 0xc0,
+  0xb6, 0x05, 0x72, 0x55, 0xc0, 0x77, 0x22, 0x25, 0xd1, 0x76, 0x6d, 0xf8, 0x12, 0x77, 0x52, 0x79,
+  0x36, 0x63, 0x93, 0x83, 0x7b, 0x36, 0xf1, 0x7e, 0x4d, 0x27, 0xc1, 0xa9, 0xe9, 0xf8, 0x3c, 0x9a,
+  0xb0, 0x3f, 0x33, 0x76, 0x44, 0xfe, 0x8c, 0xc7, 0x9b, 0x49, 0x16, 0x1b, 0x9e, 0xd8, 0xf5, 0x97,
+  0xe5, 0x7a, 0xb7, 0x07, 0x15, 0x22, 0x2b, 0xad, 0x10, 0x4d, 0x57, 0x74, 0xa3, 0x06, 0x4a, 0x83,
+  0xea, 0x07, 0xed, 0x55, 0x66, 0xea, 0x1a, 0x10, 0x5b, 0x44, 0x77, 0x74, 0x6b, 0x64, 0xba, 0x2d,
+  0xd7, 0x6a, 0x6a, 0xab, 0xc1, 0x9f, 0x99, 0x48, 0x23, 0x78, 0xd6, 0xd1, 0x09, 0x9e, 0x3f, 0x6a,
+  0xf5, 0xb0, 0xa5, 0x15, 0x27, 0x81, 0xa2, 0xdc, 0x96, 0x5a, 0x00, 0xad, 0x38, 0x01, 0xf4, 0x03,
+  0x82, 0x80, 0x36, 0x05, 0xff, 0x5b, 0x3f, 0x00, 0xff, 0x5b, 0x09, 0xfc, 0x6f, 0xfd, 0xb3, 0xf3,
+  0x3f, 0x44, 0xae, 0x8e, 0xf5, 0xe9, 0xee, 0x0c, 0xca, 0xf7, 0x95, 0x68, 0xbe, 0x3f, 0x12, 0x26,
+  0xaf, 0x04, 0x99, 0xdc, 0xbf, 0xf2, 0x95, 0x1f, 0x60, 0xe5, 0x2b, 0x09, 0x2b, 0x5f, 0xf9, 0xa7,
+  0x59, 0x79, 0x2f, 0x0b, 0xf0, 0x98, 0xed, 0xe1, 0x1a, 0xfc, 0xe1, 0x95, 0x48, 0x27, 0x1e, 0xfa,
+  0xc0, 0xdb, 0x2f, 0x05, 0x6e, 0x84, 0x78, 0x28, 0x1c, 0x01, 0x29, 0xab, 0x6d, 0x09, 0x22, 0x7a,
+  0x45, 0x8b, 0xe8, 0x66, 0x73, 0xee, 0x39, 0x2d, 0x30, 0xff, 0x77, 0x2b, 0xd0, 0x8a, 0x45, 0x75,
+  0x2d, 0x18, 0xf6, 0x45, 0xef, 0x76, 0xef, 0xdd, 0xb8, 0x44, 0x06, 0xc2, 0xa9, 0xc9, 0x96, 0xc2,
+  0x13, 0xb7, 0x11, 0x9c, 0x51, 0xd7, 0x8d, 0xa6, 0xc8, 0xea, 0x6a, 0x72, 0x45, 0xd1, 0x66, 0xbb,
+  0x8f, 0xec, 0x82, 0xd9, 0xed, 0x99, 0x3c, 0xbf, 0x34, 0xa3, 0xb6, 0xda, 0xcb, 0x16, 0xb3, 0xae,
+  0xb6, 0x31, 0x0a, 0x03, 0x68, 0x9c, 0x97, 0x10, 0x76, 0xdd, 0xd0, 0x9b, 0x99, 0xf8, 0xac, 0x71,
+  0x18, 0xfa, 0x46, 0x77, 0xdf, 0x86, 0x7f, 0x3d, 0x05, 0x7c, 0x4c, 0xad, 0x26, 0xe5, 0x6b, 0xa2,
+  0x42, 0x43, 0x0c, 0xed, 0xc8, 0x44, 0x04, 0x42, 0xbe, 0x40, 0xa8, 0x37, 0x16, 0x90, 0x95, 0x40,
+  0x4e, 0x24, 0xac, 0xf5, 0xb1, 0x4a, 0xad, 0x29, 0x16, 0x04, 0x93, 0x12, 0x46, 0x9b, 0x20, 0x74,
+  0xa5, 0x62, 0xb4, 0x21, 0x20, 0x76, 0xc4, 0x34, 0xa2, 0x89, 0x04, 0x28, 0x2d, 0xb7, 0x21, 0x62,
+  0xa8, 0xca, 0xa6, 0x12, 0x40, 0x81, 0x9a, 0x12, 0xa9, 0x46, 0x8a, 0x99, 0x9e, 0xc7, 0xbd, 0x9b,
+  0x81, 0xb2, 0x68, 0x78, 0x29, 0x61, 0x2c, 0xd3, 0x9f, 0xd8, 0x20, 0x0a, 0x06, 0x1e, 0xa1, 0xc0,
+  0x37, 0xe3, 0x27, 0x6b, 0x75, 0x49, 0xa9, 0x5e, 0xa9, 0xe8, 0x22, 0xcb, 0x89, 0x0f, 0xd5, 0x50,
+  0xc5, 0xe3, 0x55, 0xa5, 0x06, 0x4e, 0x54, 0x54, 0xf1, 0x80, 0xaf, 0xce, 0x70, 0x46, 0x03, 0x7f,
+  0xca, 0x33, 0x1a, 0xcf, 0x38, 0x67, 0xd1, 0x75, 0x1b, 0x19, 0xee, 0x38, 0x96, 0x6f, 0x9c, 0xe8,
+  0x56, 0xa1, 0x2c, 0x98, 0xc0, 0x21, 0x0f, 0xbb, 0x94, 0x99, 0x8d, 0xe8, 0x3f, 0x62, 0xd9, 0x57,
+  0x87, 0x3c, 0x4e, 0x45, 0xb6, 0x70, 0x24, 0x5f, 0xa4, 0x03, 0x74, 0xbc, 0x1f, 0x1e, 0x26, 0xb9,
+  0x31, 0xe3, 0x87, 0x62, 0xf6, 0x3f, 0xf1, 0x1e, 0x00, 0x70, 0x0c, 0xcf, 0xae, 0x56, 0x15, 0x2d,
+  0x8a, 0xdd, 0x53, 0xbb, 0x5b, 0x1a, 0x18, 0x51, 0x49, 0x98, 0xcb, 0x62, 0xee, 0x84, 0x4f, 0x2e,
+  0x5e, 0x7e, 0xfa, 0x80, 0x7d, 0xfb, 0xbf, 0xc8, 0xd5, 0x5c, 0x43, 0x76, 0xb7, 0xbf, 0x7d, 0xce,
+  0x5e, 0xae, 0x3d, 0x84, 0xe8, 0x0e, 0x93, 0xdf, 0x94, 0x82, 0x07, 0xbe, 0xd8, 0xc1, 0xa6, 0x84,
+  0x99, 0x8a, 0x11, 0xf1, 0xaa, 0x68, 0x5d, 0x10, 0x3d, 0x0b, 0x98, 0xc7, 0xda, 0xb4, 0x41, 0x90,
+  0x07, 0x97, 0xb7, 0xab, 0x0e, 0x79, 0x78, 0xc0, 0x13, 0xc1, 0x44, 0x43, 0xe3, 0x39, 0xee, 0x2d,
+  0x8e, 0x0a, 0x03, 0xa0, 0x28, 0xf3, 0x4f, 0xba, 0x3b, 0x36, 0x48, 0x6e, 0x88, 0xbe, 0x21, 0x94,
+  0x9c, 0xae, 0xd3, 0x7f, 0xf2, 0xb5, 0xdc, 0xa0, 0x56, 0xa7, 0x3d, 0xc0, 0x76, 0x1b, 0x2b, 0x0a,
+  0x80, 0x30, 0xf5, 0x58, 0x6c, 0x89, 0x62, 0x3c, 0x5e, 0x64, 0x0b, 0x67, 0x12, 0x34, 0x1a, 0x04,
+  0xfc, 0x64, 0x1c, 0x82, 0x09, 0x35, 0xae, 0xb8, 0x6b, 0xaa, 0xc1, 0xf3, 0x92, 0x25, 0x40, 0x74,
+  0xb9, 0xd9, 0x22, 0xbd, 0x3e, 0xe9, 0x73, 0xaa, 0x43, 0x69, 0x04, 0x4c, 0x21, 0x20, 0x54, 0x2a,
+  0x48, 0x45, 0x75, 0xb1, 0xbb, 0xa9, 0x84, 0x8e, 0xda, 0xaa, 0xe9, 0x9d, 0x9c, 0xde, 0x56, 0x5a,
+  0xd9, 0x63, 0x79, 0xb9, 0xad, 0xe6, 0x35, 0xbd, 0x71, 0x6c, 0xf4, 0xd8, 0x6f, 0x2a, 0x9a, 0xdc,
+  0xba, 0x22, 0xba, 0x95, 0xff, 0x26, 0x54, 0x15, 0x88, 0xf2, 0xe9, 0x85, 0x5f, 0xb0, 0xec, 0xc2,
+  0x19, 0x89, 0xe6, 0x49, 0x96, 0x7d, 0x24, 0x9c, 0xd5, 0xe8, 0x63, 0x95, 0x82, 0xd8, 0xc3, 0xe3,
+  0xf1, 0xa6, 0x8f, 0xcc, 0xb6, 0xe9, 0xe6, 0x48, 0x11, 0x4a, 0xa9, 0x68, 0xfb, 0x7b, 0xa5, 0xe3,
+  0xe0, 0x0f, 0x4e, 0x85, 0xe1, 0x45, 0xd3, 0x83, 0x42, 0x66, 0xcf, 0xe4, 0x6b, 0xda, 0x42, 0xed,
+  0x0c, 0xc0, 0xcf, 0x3a, 0xd3, 0xfc, 0x03, 0x2f, 0x49, 0x09, 0xbb, 0x1c, 0x31, 0x2f, 0xff, 0x32,
+  0x0e, 0x73, 0xa2, 0xef, 0xa8, 0xc2, 0x8f, 0x18, 0x6c, 0xa6, 0xc9, 0x00, 0xc1, 0x71, 0x18, 0x06,
+  0xe1, 0xa8, 0x2d, 0xd5, 0x4f, 0xb7, 0x5f, 0x83, 0x53, 0xca, 0xc9, 0xf6, 0x25, 0xfb, 0xf5, 0xfc,
+  0x25, 0x2a, 0xd4, 0x30, 0x5e, 0x49, 0xeb, 0xee, 0xa5, 0x20, 0xdd, 0xa0, 0xb5, 0x28, 0x5b, 0x4a,
+  0x9c, 0x57, 0x12, 0x59, 0xde, 0x41, 0x15, 0x08, 0xa1, 0x1b, 0x16, 0x69, 0x59, 0x81, 0xee, 0xef,
+  0x58, 0xf7, 0x91, 0x90, 0xd2, 0x4d, 0xb2, 0x4e, 0x74, 0x93, 0x65, 0x73, 0xab, 0x9a, 0xb9, 0x1a,
+  0x62, 0xe6, 0x94, 0x9c, 0xc4, 0x87, 0x39, 0x6d, 0xae, 0x88, 0x41, 0x6e, 0x04, 0x07, 0x01, 0xb9,
+  0x49, 0x09, 0x9a, 0xd3, 0xda, 0x05, 0x0d, 0xd1, 0x05, 0x86, 0x1d, 0x67, 0x69, 0x04, 0x0e, 0xfe,
+  0xde, 0x35, 0x46, 0xad, 0x2a, 0xa8, 0x6d, 0xb1, 0xea, 0x00, 0x76, 0x16, 0x15, 0x10, 0xee, 0x00,
+  0x48, 0x39, 0x88, 0xa1, 0xd4, 0x32, 0xde, 0x06, 0x7b, 0xb5, 0x9e, 0x85, 0x80, 0xac, 0xae, 0x1a,
+  0xcd, 0xec, 0xb1, 0xee, 0x9f, 0x51, 0x81, 0x71, 0x7d, 0xcf, 0x6b, 0x70, 0xd4, 0x47, 0x74, 0xf2,
+  0xd8, 0xc8, 0x48, 0x4d, 0x9f, 0x6b, 0xab, 0xae, 0x9e, 0xc8, 0x57, 0x21, 0x4a, 0x31, 0xb8, 0x92,
+  0xf8, 0xc3, 0x3d, 0x16, 0xf3, 0xa2, 0x1f, 0xa5, 0xd0, 0xfa, 0x22, 0xbb, 0x8a, 0x39, 0xf2, 0x96,
+  0xc1, 0xa0, 0x38, 0xb5, 0xf4, 0x56, 0xa0, 0x27, 0x3a, 0x5a, 0xb7, 0xc7, 0xa7, 0x22, 0x28, 0x28,
+  0x2c, 0x44, 0xab, 0xff, 0x38, 0x5d, 0xef, 0x4d, 0x5a, 0xc4, 0xd0, 0x1a, 0x3c, 0x8e, 0x6f, 0xe8,
+  0xf3, 0x73, 0x61, 0xf7, 0x50, 0xdb, 0x17, 0x0b, 0xcc, 0xd9, 0x8b, 0xb1, 0x3b, 0xd2, 0x2f, 0xd9,
+  0x8d, 0x13, 0x0f, 0x35, 0x4a, 0x5a, 0x72, 0x45, 0x53, 0x7c, 0x4f, 0xd0, 0x95, 0x8c, 0x43, 0x2a,
+  0xf1, 0x19, 0x42, 0x02, 0xfa, 0x25, 0x5e, 0x8a, 0x86, 0x51, 0x63, 0x7b, 0x7b, 0xfe, 0xdc, 0xfc,
+  0xb0, 0x2b, 0x6b, 0xb8, 0x13, 0x26, 0x79, 0x6f, 0x04, 0x25, 0x16, 0x3e, 0x07, 0xba, 0x7e, 0x05,
+  0x54, 0xdd, 0xe3, 0x65, 0xe0, 0xa7, 0x20, 0x51, 0xcf, 0x7b, 0x1f, 0x52, 0x46, 0x93, 0x17, 0xd8,
+  0x22, 0xd3, 0x0b, 0x29, 0xfb, 0x32, 0xbf, 0xea, 0x0f, 0x3f, 0x76, 0xd9, 0x3a, 0x4d, 0x49, 0xa7,
+  0x3c, 0x6a, 0xa4, 0x41, 0xe7, 0x77, 0x19, 0xc4, 0xf0, 0xa2, 0x3d, 0x0c, 0x3e, 0x49, 0xc8, 0xd8,
+  0x9e, 0x2a, 0x89, 0xf6, 0x76, 0x33, 0x5b, 0x08, 0x54, 0x67, 0xbd, 0xaa, 0xdc, 0x90, 0x6b, 0x2a,
+  0xe8, 0x6e, 0xbe, 0xc7, 0xae, 0xd3, 0x74, 0x63, 0x94, 0xa0, 0xed, 0xf1, 0x8d, 0x29, 0xe1, 0xa6,
+  0xb7, 0x90, 0x4a, 0x17, 0x5d, 0xa8, 0x3c, 0x19, 0xbc, 0xcb, 0x2d, 0x1c, 0x77, 0xcd, 0xd1, 0xd7,
+  0x82, 0x40, 0x60, 0xee, 0xd2, 0x88, 0x27, 0x1f, 0x6c, 0xa7, 0x43, 0x9a, 0xb2, 0x06, 0x91, 0xea,
+  0x5f, 0xdc, 0x9d, 0x45, 0x24, 0xd9, 0x5b, 0xa0, 0xe6, 0x81, 0xe5, 0xf7, 0xc1, 0x75, 0x44, 0x3b,
+  0x79, 0x0f, 0x22, 0x70, 0xf8, 0x08, 0x57, 0x7b, 0x1f, 0x52, 0x43, 0x05, 0xf5, 0x21, 0x83, 0xf3,
+  0xb7, 0xb0, 0x30, 0x7f, 0xa6, 0xe4, 0xdf, 0xd4, 0x06, 0x57, 0xe7, 0x2f, 0x95, 0x58, 0xf1, 0xc4,
+  0x58, 0xae, 0x38, 0x39, 0x95, 0x9b, 0xc8, 0x15, 0x67, 0xf2, 0x7c, 0x94, 0x94, 0x66, 0x22, 0x6a,
+  0xca, 0x1e, 0x12, 0x9b, 0xb8, 0x9d, 0x24, 0x40, 0xe3, 0xe2, 0x00, 0x34, 0x3e, 0x20, 0x6d, 0xef,
+  0x7c, 0x84, 0x9c, 0xb4, 0x0f, 0x51, 0xd5, 0x3a, 0x46, 0x58, 0xe0, 0x1e, 0x2d, 0xce, 0xc5, 0xd3,
+  0x73, 0x23, 0xcc, 0x68, 0xe8, 0x0a, 0xef, 0xd2, 0xa2, 0x50, 0x2f, 0xd6, 0x7b, 0xe4, 0x24, 0xef,
+  0xf5, 0xae, 0x8b, 0x3d, 0x62, 0x82, 0x6c, 0xd4, 0x17, 0xf2, 0x8c, 0x36, 0xb8, 0x81, 0x51, 0x41,
+  0x42, 0x33, 0x52, 0x47, 0xce, 0xb0, 0x67, 0xde, 0x3c, 0x0d, 0xeb, 0x08, 0x4f, 0x5f, 0x58, 0x04,
+  0x73, 0xbc, 0xe3, 0xec, 0xb6, 0xf2, 0x2f, 0xf7, 0x0b, 0x8c, 0xae, 0x07, 0xa2, 0x7a, 0x58, 0x0a,
+  0x48, 0x8c, 0x2d, 0x19, 0x4c, 0x95, 0x5e, 0xbd, 0x92, 0xac, 0xaf, 0xfb, 0x24, 0x42, 0x90, 0x4b,
+  0x7c, 0xd3, 0xc0, 0x4d, 0x66, 0x11, 0xe9, 0x10, 0xd4, 0xd2, 0x62, 0xa5, 0x41, 0x75, 0x48, 0xa6,
+  0x09, 0xaa, 0x82, 0xc1, 0x68, 0x55, 0x65, 0x49, 0xd7, 0x6a, 0x8a, 0x51, 0xce, 0xe0, 0x26, 0x38,
+  0x20, 0x8f, 0xeb, 0x76, 0xe3, 0xaf, 0x40, 0x4b, 0x6c, 0xa9, 0x21, 0x3a, 0x0a, 0xee, 0xec, 0xee,
+  0x64, 0x58, 0x53, 0x5e, 0xd5, 0x94, 0x56, 0xc3, 0x5a, 0x2a, 0x67, 0xc6, 0xc7, 0x32, 0x0c, 0x5b,
+  0xd7, 0xaa, 0x7a, 0xb3, 0x0d, 0xd6, 0x01, 0x33, 0x72, 0xf5, 0x7a, 0x26, 0xa9, 0x89, 0x27, 0x2a,
+  0x99, 0xb3, 0x49, 0x02, 0x42, 0x79, 0xaf, 0xfe, 0x73, 0x69, 0x03, 0x98, 0x8e, 0x8e, 0x65, 0x7f,
+  0x67, 0x3e, 0x78, 0x29, 0x38, 0x1f, 0x2f, 0xd4, 0x2c, 0x5f, 0x40, 0x6c, 0x2f, 0xe8, 0xdd, 0x41,
+  0xe0, 0xa0, 0xb0, 0xb0, 0x9b, 0x1c, 0x43, 0x48, 0xd0, 0x5e, 0xbd, 0x5b, 0x14, 0x48, 0x3d, 0x86,
+  0x78, 0x12, 0x79, 0x87, 0xf1, 0x46, 0x2b, 0xbe, 0x27, 0x60, 0xa4, 0xcf, 0x74, 0x5b, 0x60, 0x76,
+  0x1d, 0x8c, 0x66, 0xd3, 0xed, 0x63, 0x08, 0xfa, 0x62, 0xa9, 0xbd, 0x31, 0x53, 0x5e, 0x51, 0xde,
+  0x86, 0x09, 0x67, 0x9d, 0x6d, 0x0c, 0x8f, 0x60, 0x66, 0xef, 0xda, 0x9d, 0xcb, 0xdc, 0x69, 0xd8,
+  0x61, 0x22, 0x55, 0xb1, 0x4d, 0xe1, 0xa9, 0x9d, 0x9c, 0xdc, 0xe1, 0x3b, 0x1c, 0xfa, 0x54, 0x50,
+  0xe3, 0xbc, 0x28, 0xf2, 0x5c, 0x2e, 0xe9, 0x9a, 0x26, 0xbc, 0x97, 0x96, 0xd5, 0xe6, 0x7e, 0x0b,
+  0x98, 0x2b, 0x92, 0x97, 0xfb, 0x6e, 0xc2, 0xa7, 0x5f, 0xa1, 0x7a, 0xd0, 0x4a, 0x88, 0xeb, 0x7e,
+  0xf8, 0x42, 0xf5, 0xd7, 0x7d, 0xf4, 0x4b, 0x2a, 0xf1, 0xcd, 0x5d, 0x62, 0x84, 0x1d, 0xd9, 0xaa,
+  0x12, 0x2f, 0xf7, 0x7d, 0xe3, 0x09, 0x3b, 0xa3, 0xac, 0x17, 0x57, 0x2a, 0x82, 0x49, 0x3c, 0xea,
+  0x1b, 0xd4, 0xca, 0xcb, 0x9b, 0xf7, 0x7d, 0x4a, 0xd8, 0x1b, 0xaa, 0x27, 0x23, 0x02, 0x9a, 0x2d,
+  0x84, 0x49, 0x78, 0x08, 0x0c, 0x04, 0xb6, 0xbc, 0xf2, 0x67, 0x4b, 0x1e, 0x8d, 0xec, 0xd3, 0x46,
+  0xd8, 0x25, 0x1f, 0x50, 0x57, 0x69, 0x0a, 0xd5, 0x8f, 0x44, 0x2b, 0xe1, 0x26, 0x35, 0xe1, 0x70,
+  0x31, 0xa1, 0x91, 0x0e, 0xe1, 0x10, 0x3c, 0xbc, 0xcf, 0x5c, 0x99, 0x43, 0x26, 0xdc, 0xf1, 0xa1,
+  0xea, 0x45, 0xc2, 0x46, 0xc3, 0x2b, 0xa2, 0xb8, 0x46, 0xeb, 0xc2, 0xc2, 0xee, 0x04, 0x2d, 0xac,
+  0x8d, 0x96, 0x9f, 0x81, 0x02, 0x99, 0xd8, 0x89, 0x70, 0x47, 0x5a, 0x3a, 0x4e, 0x1b, 0x0b, 0xd6,
+  0xdc, 0xa6, 0xec, 0x8d, 0x44, 0x1d, 0xce, 0x6b, 0x93, 0x85, 0x42, 0x26, 0xa0, 0xa6, 0xec, 0x15,
+  0x01, 0xb4, 0xb3, 0x5e, 0x23, 0x3d, 0x92, 0x46, 0xf3, 0x45, 0x4f, 0x20, 0x94, 0x94, 0x10, 0xea,
+  0xf1, 0x33, 0x4c, 0xe4, 0x50, 0xff, 0x9e, 0xbb, 0x58, 0xa8, 0xd3, 0xa6, 0x5e, 0xae, 0x3d, 0x18,
+  0x1b, 0xa7, 0x0d, 0x31, 0xb0, 0x9c, 0x5b, 0x44, 0xf6, 0xcd, 0xc8, 0x44, 0x61, 0xbc, 0xf6, 0x94,
+  0xdb, 0xa4, 0xbc, 0x24, 0xd0, 0x62, 0x01, 0xfd, 0xf9, 0x72, 0xed, 0x8b, 0xc8, 0x3f, 0x3e, 0x75,
+  0x38, 0x36, 0x9e, 0xa8, 0x0e, 0x41, 0x7d, 0xd0, 0xd0, 0x22, 0x05, 0x79, 0x09, 0xae, 0x2f, 0x58,
+  0x06, 0xbd, 0x8b, 0xdb, 0x91, 0x9d, 0xa1, 0x8f, 0x8d, 0x3a, 0x9f, 0x4c, 0xcb, 0x08, 0x36, 0xdd,
+  0x79, 0xdd, 0x7d, 0xf1, 0x08, 0x81, 0xf0, 0xcf, 0x00, 0xae, 0x86, 0xcd, 0xce, 0xd0, 0xd7, 0x62,
+  0x83, 0xd6, 0x02, 0xf9, 0x74, 0xcd, 0xbb, 0x1a, 0x77, 0x0f, 0x46, 0x75, 0x11, 0x32, 0x1e, 0x01,
+  0xe5, 0xe3, 0x69, 0x90, 0x2e, 0x1e, 0x47, 0x43, 0x33, 0xd7, 0xc6, 0x05, 0xe3, 0xa6, 0xe6, 0xe1,
+  0x3d, 0x57, 0x69, 0xec, 0xd8, 0x8d, 0xa5, 0x5e, 0xe1, 0x8d, 0x30, 0x2c, 0x07, 0x55, 0xf5, 0x41,
+  0xda, 0x53, 0xf8, 0xb8, 0xe3, 0x19, 0xfc, 0x1a, 0x6f, 0x1e, 0x14, 0x91, 0x63, 0xb4, 0xb5, 0x03,
+  0x25, 0x92, 0x43, 0x05, 0x63, 0x3f, 0x44, 0x51, 0x27, 0x1a, 0xf5, 0xdb, 0x41, 0x6d, 0xbf, 0x09,
+  0x6a, 0x77, 0x5d, 0x64, 0xe7, 0x40, 0xe3, 0xa3, 0x1e, 0xba, 0x86, 0x6e, 0x00, 0x17, 0xba, 0x3d,
+  0xbf, 0x86, 0xdc, 0xcb, 0x25, 0xfa, 0x78, 0xb1, 0xda, 0x8d, 0x36, 0x34, 0x3d, 0x96, 0x30, 0xe3,
+  0xcb, 0x7d, 0x9b, 0xde, 0x0d, 0xd4, 0xb7, 0xbe, 0x06, 0xa1, 0x28, 0x56, 0x17, 0x81, 0xdf, 0x51,
+  0xaa, 0x35, 0xbe, 0x47, 0x8b, 0x5c, 0x23, 0xe2, 0x6b, 0xdc, 0xb7, 0x68, 0xef, 0x68, 0x18, 0x62,
+  0x62, 0x7d, 0xca, 0xbf, 0xa6, 0x7f, 0xe2, 0x89, 0x6b, 0xd1, 0xc2, 0x10, 0xd3, 0x88, 0x0d, 0xac,
+  0x27, 0xd7, 0x9a, 0x6a, 0x8b, 0xf6, 0xbb, 0xfa, 0x13, 0xe2, 0x5e, 0xea, 0xf6, 0x01, 0x51, 0xe1,
+  0xea, 0x99, 0x8c, 0x2d, 0x65, 0x1c, 0xb0, 0xd9, 0x74, 0x8f, 0x5e, 0xbd, 0x25, 0xfc, 0xa6, 0x0f,
+  0x47, 0x02, 0xe0, 0x79, 0x8f, 0xb5, 0x0f, 0xe6, 0x8f, 0xc7, 0x6b, 0xc7, 0x0b, 0xe3, 0x05, 0x5f,
+  0x2b, 0x7e, 0x84, 0x28, 0x24, 0xad, 0x34, 0x8d, 0x4a, 0x85, 0x1d, 0xc6, 0xab, 0x75, 0xbd, 0x3b,
+  0xd8, 0xd8, 0x4a, 0xd6, 0x9e, 0xe7, 0x46, 0xde, 0xa3, 0xcc, 0xf7, 0x6e, 0x77, 0xbb, 0x14, 0x40,
+  0x08, 0xa0, 0x00, 0xa3, 0x76, 0x9f, 0xb3, 0x99, 0xaa, 0x5e, 0x53, 0x92, 0x7c, 0x8c, 0xb7, 0x95,
+  0xca, 0x02, 0x56, 0xd3, 0x8d, 0xf3, 0x7a, 0x6d, 0x59, 0x53, 0x72, 0x4b, 0x33, 0x79, 0x7c, 0x65,
+  0x96, 0x9c, 0x87, 0xfe, 0x6f, 0x9f, 0x3d, 0xf5, 0x9b, 0xb9, 0x33, 0xe7, 0xe7, 0x2f, 0xfc, 0xe6,
+  0xd2, 0xdc, 0xc2, 0x82, 0x78, 0xd5, 0xdf, 0x33, 0x9e, 0x26, 0xf7, 0x78, 0xf8, 0xb4, 0xc9, 0xc2,
+  0xd9, 0xc5, 0xc5, 0xf9, 0x0b, 0x6f, 0x2c, 0x0c, 0x3b, 0x75, 0x62, 0x1f, 0xfe, 0x11, 0x97, 0x3e,
+  0x39, 0xe0, 0xc9, 0x12, 0x7f, 0xb4, 0x39, 0x72, 0x13, 0x59, 0x03, 0xfd, 0x39, 0xd0, 0x34, 0x11,
+  0xae, 0xdd, 0xe6, 0x60, 0x45, 0x6e, 0x7a, 0xf7, 0x09, 0x23, 0x20, 0xdb, 0x64, 0xe3, 0x9f, 0x78,
+  0x23, 0x53, 0x2a, 0x7d, 0x8e, 0xb2, 0x42, 0xae, 0x08, 0xbe, 0x40, 0xb1, 0x30, 0x12, 0x19, 0x2f,
+  0xb5, 0x96, 0xb9, 0x72, 0xe7, 0x9b, 0xda, 0x1a, 0x12, 0x78, 0x29, 0x06, 0x35, 0x48, 0x29, 0xed,
+  0x72, 0x06, 0x5e, 0x05, 0xbb, 0xa2, 0xb6, 0xec, 0xdf, 0xe4, 0xd5, 0x72, 0xa6, 0x58, 0x08, 0x58,
+  0xa4, 0x42, 0xee, 0xf8, 0x40, 0xd5, 0x79, 0xcf, 0xd9, 0x16, 0x62, 0xe7, 0x81, 0xad, 0x97, 0xb1,
+  0xcd, 0x2e, 0x78, 0x2c, 0xca, 0x0e, 0x4c, 0x03, 0x26, 0x51, 0x2c, 0x14, 0x60, 0x12, 0xc7, 0x0b,
+  0x85, 0x94, 0xd3, 0xa0, 0xd3, 0x56, 0xec, 0x69, 0xc0, 0xcb, 0x62, 0x1a, 0xfc, 0x37, 0x9c, 0x06,
+  0x82, 0x0a, 0x4c, 0xa4, 0x88, 0x97, 0x06, 0x98, 0xc9, 0xd9, 0xf3, 0x73, 0x68, 0x39, 0x9e, 0x88,
+  0x8a, 0xac, 0xb7, 0x2a, 0xf5, 0x8f, 0xc7, 0x2c, 0x5b, 0xc8, 0x15, 0x8e, 0x03, 0xce, 0x85, 0xdc,
+  0x89, 0x74, 0x28, 0x2b, 0x4d, 0xd9, 0xa5, 0x7b, 0xe1, 0xb8, 0x43, 0x78, 0xfa, 0x15, 0x51, 0x06,
+  0x48, 0x21, 0xd2, 0x17, 0x07, 0x41, 0xf8, 0x8c, 0xa2, 0xb4, 0xd9, 0x82, 0x86, 0x3f, 0x5d, 0x0d,
+  0x44, 0x58, 0x3f, 0x17, 0xfb, 0xd1, 0x76, 0x47, 0xd9, 0x38, 0x12, 0x7a, 0x6a, 0x72, 0x22, 0x2d,
+  0xa5, 0x4d, 0x84, 0x67, 0x23, 0x3e, 0x69, 0x13, 0x7a, 0xdc, 0xa6, 0x33, 0x41, 0x0a, 0xa0, 0x7d,
+  0x62, 0x30, 0x3a, 0x77, 0x3f, 0xc7, 0x13, 0x78, 0x44, 0x25, 0x75, 0xd3, 0xb3, 0xbf, 0x89, 0x84,
+  0x89, 0x18, 0x85, 0x65, 0xdf, 0x7c, 0xb3, 0x74, 0xfe, 0x3c, 0xc3, 0xf8, 0x8c, 0x5b, 0x7b, 0xa1,
+  0x33, 0xbb, 0x8f, 0xb1, 0x65, 0x66, 0x94, 0x42, 0x06, 0x36, 0xc5, 0x9c, 0xce, 0x83, 0x7b, 0xdd,
+  0x17, 0x23, 0x7d, 0x72, 0x21, 0x34, 0x39, 0x70, 0x4d, 0x83, 0xb9, 0x90, 0xc2, 0x54, 0xa9, 0x50,
+  0x60, 0xc5, 0x09, 0xfc, 0x39, 0x56, 0x28, 0x09, 0x8e, 0xb2, 0x5d, 0xaf, 0xc9, 0xc1, 0xa6, 0xf6,
+  0x05, 0x29, 0x6e, 0x4c, 0x4c, 0x5d, 0xc7, 0x6e, 0x1b, 0x72, 0x3e, 0x28, 0xe3, 0x87, 0x01, 0x04,
+  0x72, 0xff, 0x5b, 0xa7, 0xcf, 0xb8, 0x6b, 0x53, 0x28, 0xf3, 0xd2, 0x32, 0xf0, 0xdc, 0x53, 0x8f,
+  0x37, 0x9f, 0xb8, 0x3e, 0x15, 0xcd, 0x15, 0x03, 0x9b, 0xa7, 0xc4, 0xda, 0x8c, 0x4f, 0x86, 0x96,
+  0x66, 0x3c, 0x09, 0xfd, 0x43, 0x65, 0x26, 0x16, 0x84, 0x6a, 0x4d, 0xc8, 0x4e, 0x1c, 0x38, 0xff,
+  0xa0, 0xe9, 0x72, 0xed, 0x34, 0xba, 0xcb, 0x0d, 0x84, 0xfe, 0xf2, 0xe6, 0x2e, 0xf3, 0x75, 0x5e,
+  0x0d, 0x06, 0x3c, 0xb1, 0x7a, 0xb3, 0x11, 0x97, 0x3b, 0xc1, 0x83, 0xbe, 0x82, 0x45, 0x1c, 0x43,
+  0xa9, 0xe8, 0x3a, 0x35, 0x15, 0x12, 0x4a, 0x1b, 0x69, 0xf3, 0x2e, 0x51, 0xa5, 0x86, 0x83, 0xd8,
+  0x9d, 0x1b, 0xa0, 0x5a, 0xff, 0xec, 0x97, 0x9b, 0x43, 0xe4, 0x5b, 0xbc, 0x1e, 0xdb, 0x58, 0xea,
+  0xec, 0x4a, 0xac, 0x9d, 0x22, 0x8f, 0x8b, 0xfa, 0x12, 0x76, 0xc2, 0x9b, 0x17, 0xed, 0xf6, 0x78,
+  0x60, 0x73, 0x88, 0x9f, 0xd0, 0x25, 0xdb, 0xa2, 0x2a, 0x10, 0xe6, 0x70, 0x3d, 0x3b, 0x80, 0xb6,
+  0x3c, 0xc6, 0x8e, 0x06, 0x11, 0x00, 0x40, 0xde, 0x77, 0x89, 0xb1, 0xbe, 0x02, 0x29, 0xc9, 0x0d,
+  0x90, 0x82, 0x49, 0x30, 0x4e, 0x2e, 0xbe, 0x7b, 0x74, 0x20, 0x18, 0xa1, 0xf7, 0x84, 0x5a, 0x29,
+  0x76, 0xb8, 0xb2, 0xd9, 0x89, 0xb2, 0x5f, 0xdb, 0x8c, 0x0e, 0x88, 0x18, 0x04, 0x09, 0xb4, 0x2b,
+  0xff, 0x78, 0xec, 0x8e, 0x07, 0x4e, 0x60, 0xef, 0x83, 0xde, 0x0d, 0xec, 0x01, 0x45, 0xc7, 0x9b,
+  0x02, 0x95, 0x75, 0x46, 0x2d, 0xa1, 0xcf, 0x31, 0x61, 0x89, 0x33, 0x2d, 0xd9, 0x69, 0xc9, 0x3b,
+  0x98, 0x15, 0x62, 0x65, 0x54, 0x25, 0xf6, 0x99, 0x6d, 0xdb, 0x44, 0x90, 0x3d, 0x22, 0x20, 0x27,
+  0x1e, 0x5d, 0xe3, 0xb9, 0x26, 0x6c, 0x2f, 0x21, 0x6f, 0x7e, 0x10, 0x0c, 0x5d, 0x43, 0xe2, 0x5d,
+  0x45, 0xbf, 0x41, 0x01, 0x02, 0x61, 0x0a, 0x09, 0xc4, 0x02, 0x42, 0xad, 0x8f, 0x79, 0x4b, 0x21,
+  0xf9, 0xb4, 0xcf, 0x80, 0x9a, 0xdb, 0x76, 0xa0, 0xb6, 0x4d, 0x11, 0xd8, 0x0e, 0xa3, 0xde, 0xa9,
+  0x90, 0x8e, 0x7f, 0x61, 0x2b, 0x7a, 0xde, 0x85, 0xb8, 0x3f, 0xd0, 0x52, 0x46, 0x58, 0x0d, 0x1f,
+  0x4d, 0xe1, 0xd2, 0x2e, 0x35, 0x37, 0xad, 0xdb, 0x1d, 0x33, 0xc2, 0x38, 0x38, 0xc9, 0xaf, 0xf0,
+  0x79, 0x05, 0x88, 0xf2, 0x8e, 0xaf, 0xb1, 0x47, 0x94, 0x61, 0xb1, 0xd0, 0x43, 0x35, 0x04, 0x78,
+  0x29, 0xc7, 0x42, 0x26, 0x62, 0x04, 0x68, 0xf0, 0x7b, 0x31, 0x55, 0xef, 0x84, 0x38, 0x32, 0xc4,
+  0x3c, 0x3c, 0xba, 0x22, 0x12, 0xae, 0xf3, 0x72, 0xc4, 0xd3, 0x10, 0x51, 0x91, 0xff, 0x31, 0x70,
+  0xe5, 0xae, 0xa3, 0x9b, 0x9d, 0x7c, 0x4e, 0x4b, 0xee, 0x8f, 0x1a, 0x02, 0xaf, 0x0e, 0x44, 0xba,
+  0x8d, 0x80, 0x19, 0xda, 0x44, 0x33, 0xe4, 0x10, 0xaf, 0x80, 0xec, 0xe5, 0xb1, 0x43, 0x8c, 0x18,
+  0xdd, 0xcd, 0x8e, 0x6e, 0x4e, 0xd3, 0xe8, 0x54, 0x4a, 0xd9, 0xa6, 0x37, 0x48, 0xa8, 0x3c, 0x66,
+  0xee, 0x31, 0xb7, 0xd0, 0x2f, 0xb8, 0x84, 0x52, 0xeb, 0xd3, 0xd7, 0xb9, 0x81, 0x94, 0x5f, 0xda,
+  0xcd, 0xf8, 0x68, 0x67, 0xee, 0x61, 0xbb, 0x2c, 0x2e, 0x0d, 0xad, 0xdd, 0x16, 0xe5, 0x0e, 0x79,
+  0xbe, 0x9f, 0xe2, 0x78, 0x5b, 0xa1, 0x1c, 0x4a, 0x39, 0x86, 0xfb, 0x3e, 0x13, 0xf2, 0xd1, 0x6e,
+  0xf7, 0x02, 0xcf, 0x2e, 0xf8, 0xf7, 0xe1, 0x02, 0xc7, 0x39, 0xf8, 0x12, 0x95, 0x7b, 0xef, 0x12,
+  0xa9, 0x9c, 0x68, 0x01, 0x77, 0x57, 0x67, 0x23, 0x54, 0xcd, 0xe6, 0x28, 0x7b, 0x5b, 0x3d, 0xa7,
+  0x8e, 0x3a, 0x4a, 0x71, 0xd4, 0xff, 0x1e, 0x1d, 0x5e, 0x18, 0x50, 0x87, 0x3c, 0x7d, 0xc2, 0x15,
+  0xd7, 0x57, 0x5c, 0xc1, 0x52, 0x01, 0xd2, 0x31, 0xcc, 0x9c, 0x34, 0x3b, 0x61, 0x0c, 0xbc, 0x68,
+  0x8a, 0xf4, 0x00, 0x2d, 0x30, 0xb6, 0x27, 0xdc, 0x22, 0xb9, 0xde, 0xe5, 0x80, 0xf7, 0x79, 0xc3,
+  0x99, 0x57, 0xea, 0x51, 0xbc, 0x3c, 0x6d, 0x4e, 0xbd, 0xeb, 0xb9, 0xb4, 0x45, 0x11, 0x7b, 0x45,
+  0xb0, 0x01, 0xa8, 0x18, 0xee, 0xbf, 0x1d, 0xdc, 0x35, 0xa9, 0xe9, 0x9d, 0x16, 0xba, 0x0f, 0xa7,
+  0xe4, 0xea, 0x95, 0xe5, 0xb6, 0xdb, 0xab, 0xe4, 0x6f, 0x30, 0x71, 0x27, 0x1b, 0xe1, 0x46, 0xf8,
+  0x3a, 0x2d, 0x03, 0x39, 0x33, 0x5b, 0xca, 0x96, 0x0d, 0x13, 0x58, 0xa6, 0xad, 0xab, 0xb8, 0x4f,
+  0x94, 0xc6, 0xf8, 0x6b, 0x84, 0x8f, 0xe2, 0x1d, 0xc7, 0xeb, 0xd3, 0xd5, 0x55, 0xbb, 0x41, 0xa1,
+  0x42, 0x68, 0x4a, 0xfc, 0x82, 0x5c, 0xad, 0x2a, 0x6d, 0xab, 0x9c, 0xc9, 0xfd, 0x16, 0x8f, 0x68,
+  0x88, 0xac, 0x14, 0xe2, 0x44, 0x97, 0xf0, 0xa8, 0x01, 0x3c, 0x86, 0xd5, 0xb4, 0x74, 0x43, 0x11,
+  0x13, 0x15, 0x9b, 0xda, 0xc2, 0x2d, 0x9d, 0xa9, 0x7a, 0x94, 0xa8, 0x55, 0xdf, 0x43, 0x31, 0xbb,
+  0x67, 0x26, 0xa9, 0x57, 0xc6, 0xb7, 0xb4, 0x6d, 0x43, 0xf1, 0xce, 0x47, 0xb4, 0xa8, 0x44, 0xce,
+  0x61, 0xba, 0x4f, 0x27, 0xca, 0x58, 0x30, 0x99, 0x74, 0x3c, 0x54, 0x1a, 0x02, 0x6f, 0xd7, 0xf1,
+  0x5c, 0x0a, 0x78, 0x41, 0x5f, 0x51, 0x8c, 0xba, 0xa6, 0x77, 0x4a, 0x98, 0x25, 0x8d, 0x38, 0x84,
+  0xae, 0xe1, 0xec, 0x79, 0xa0, 0xbc, 0x18, 0xdf, 0x07, 0x11, 0xb7, 0x3d, 0x02, 0xa9, 0x08, 0x13,
+  0x18, 0x9a, 0xce, 0xc2, 0x92, 0xf7, 0xfd, 0x98, 0x3c, 0xd1, 0xf7, 0xa6, 0xa2, 0xfe, 0xca, 0x33,
+  0x4a, 0x98, 0x11, 0x8d, 0x4c, 0x56, 0x51, 0xa7, 0xc2, 0x0d, 0xd4, 0x9d, 0xbd, 0xf7, 0x58, 0xf6,
+  0x2d, 0xd5, 0x02, 0xe4, 0xcf, 0x2d, 0x8c, 0xd8, 0xf9, 0x53, 0xbb, 0x46, 0xfa, 0x21, 0xaa, 0xfb,
+  0x2d, 0x8f, 0xe2, 0x10, 0x9d, 0xb2, 0xdc, 0xf0, 0x61, 0x78, 0x16, 0xd0, 0xc1, 0x8e, 0x71, 0xf0,
+  0xa7, 0xbc, 0x76, 0x02, 0x6a, 0x2b, 0x20, 0x3a, 0xe8, 0xcd, 0xdc, 0xf0, 0x62, 0x8c, 0x87, 0xab,
+  0xcd, 0x7a, 0x4b, 0x2f, 0xf9, 0x8e, 0x52, 0xc9, 0x8b, 0x2c, 0x9f, 0x27, 0xd1, 0x76, 0x8d, 0x1b,
+  0x20, 0x42, 0x29, 0xd7, 0x78, 0x07, 0xec, 0x34, 0xb6, 0xe5, 0x72, 0xa5, 0x4a, 0x87, 0x89, 0x81,
+  0x54, 0x3a, 0x5d, 0xbd, 0x64, 0x4d, 0x5f, 0xa0, 0x09, 0xa3, 0x54, 0x5e, 0x68, 0x56, 0x5f, 0x47,
+  0xd0, 0xea, 0x28, 0x34, 0xdb, 0x10, 0x15, 0x8e, 0x4b, 0xb5, 0x18, 0x85, 0xd3, 0xe9, 0x74, 0x84,
+  0xb6, 0x69, 0x2e, 0x6b, 0x96, 0xda, 0xd6, 0x94, 0x7e, 0x7a, 0x06, 0xde, 0xf8, 0x79, 0x1b, 0x55,
+  0xea, 0xa0, 0x3a, 0x86, 0x02, 0x2f, 0xb7, 0x77, 0xb6, 0xd3, 0x39, 0xa3, 0x60, 0xf1, 0x22, 0x7b,
+  0xec, 0xa7, 0x4e, 0x08, 0x15, 0x58, 0x99, 0xfe, 0xd5, 0x64, 0x7b, 0x0a, 0x9a, 0x6a, 0xba, 0xdb,
+  0xfe, 0x52, 0xa7, 0xc6, 0xe3, 0x6b, 0xcb, 0x47, 0xd3, 0x0d, 0x76, 0x7a, 0xee, 0xad, 0xf9, 0x53,
+  0x97, 0xe7, 0x16, 0xe7, 0x2f, 0x5e, 0x18, 0xfa, 0x71, 0x0b, 0x94, 0x10, 0x1b, 0x66, 0x5a, 0xf3,
+  0xbb, 0x8d, 0xff, 0xf9, 0x23, 0x6d, 0x11, 0xe4, 0x07, 0xee, 0x61, 0xcd, 0x2b, 0x22, 0x7d, 0x17,
+  0xdf, 0xe5, 0xa5, 0xbe, 0x23, 0x61, 0x5e, 0x22, 0xb6, 0xcf, 0x4b, 0xdc, 0xf7, 0x6d, 0xd5, 0xee,
+  0x98, 0x85, 0xcc, 0x6c, 0x31, 0xa9, 0x6d, 0x49, 0xbc, 0x65, 0x3f, 0x5e, 0xcc, 0xcc, 0x8e, 0x0d,
+  0xf0, 0x38, 0xc4, 0xb5, 0xe3, 0x03, 0x3c, 0x3e, 0x9e, 0x99, 0x9d, 0x18, 0xe0, 0xf1, 0x09, 0x3c,
+  0xa8, 0xf9, 0x41, 0xba, 0x2e, 0x10, 0x7c, 0x97, 0x7a, 0xa2, 0x44, 0x1f, 0x8b, 0xf8, 0x34, 0x9b,
+  0xf8, 0x82, 0x4c, 0x8b, 0x6e, 0x66, 0xd2, 0x56, 0xf4, 0x1c, 0xd0, 0xbe, 0x53, 0x06, 0xe0, 0xca,
+  0x05, 0x10, 0x03, 0xb4, 0xec, 0xb4, 0xb9, 0xe1, 0x39, 0x45, 0x8b, 0x2f, 0x6f, 0xde, 0x1f, 0x2c,
+  0x85, 0xe2, 0x85, 0x77, 0x59, 0x31, 0x15, 0x2b, 0xeb, 0x4a, 0xb1, 0xdd, 0x67, 0xf5, 0xdc, 0x7f,
+  0xec, 0xb5, 0xb7, 0xbc, 0xe2, 0x99, 0x16, 0x9e, 0x7a, 0xde, 0x11, 0x87, 0x32, 0x05, 0x4f, 0x67,
+  0x76, 0x8f, 0x3c, 0x86, 0x07, 0x3b, 0x69, 0xf7, 0x72, 0xc7, 0x9e, 0x73, 0x73, 0xa8, 0x7c, 0xcb,
+  0xa7, 0xe0, 0xda, 0x7e, 0x0e, 0xf8, 0xdd, 0xe2, 0x07, 0xa5, 0x47, 0xc9, 0x43, 0x9a, 0x0c, 0x7f,
+  0x40, 0xd1, 0x7b, 0x0f, 0xa6, 0x63, 0x59, 0xda, 0x02, 0xed, 0x10, 0xc1, 0xdd, 0x99, 0x5b, 0x97,
+  0xe8, 0x10, 0xf9, 0xfe, 0xf3, 0x8f, 0xd8, 0xc5, 0x13, 0x9b, 0x3e, 0x44, 0x9d, 0x21, 0x55, 0xeb,
+  0x4e, 0x02, 0x31, 0x94, 0x45, 0xc7, 0x94, 0x79, 0x28, 0x87, 0xe8, 0xc6, 0xc1, 0x63, 0x63, 0x53,
+  0xee, 0xc9, 0x25, 0x07, 0x98, 0x39, 0x3f, 0xfe, 0x2e, 0x76, 0xd2, 0x78, 0xea, 0xdd, 0x51, 0xcd,
+  0x1a, 0x60, 0x7b, 0xa6, 0xed, 0x9f, 0x1f, 0x35, 0x83, 0xd1, 0x2a, 0xef, 0xfb, 0x5b, 0xc2, 0xec,
+  0x08, 0x27, 0x33, 0xbc, 0x26, 0xaf, 0x60, 0xed, 0x5d, 0x6e, 0xb7, 0xb5, 0xab, 0xa7, 0x11, 0x45,
+  0x12, 0xa7, 0x4f, 0x1f, 0x84, 0x2b, 0xe0, 0x87, 0xec, 0xe3, 0x12, 0xc9, 0x4b, 0x4b, 0x36, 0x14,
+  0xb2, 0xbb, 0xbf, 0xfb, 0x18, 0xbb, 0x5b, 0x37, 0x79, 0xc7, 0x5d, 0x4a, 0xc0, 0xe1, 0x28, 0xcb,
+  0x05, 0x8c, 0xc9, 0xe0, 0x63, 0x09, 0x2d, 0x6a, 0xbd, 0x0f, 0xdc, 0x1c, 0xdc, 0x0f, 0xd2, 0x2e,
+  0x26, 0xba, 0x48, 0x1f, 0x93, 0xbb, 0xc7, 0x9d, 0x4b, 0x14, 0x41, 0x21, 0x81, 0x84, 0xdc, 0xee,
+  0xa8, 0xaf, 0x2d, 0x10, 0x7d, 0xde, 0x5d, 0xea, 0x90, 0xb4, 0x13, 0x4d, 0xe0, 0xac, 0x52, 0x1f,
+  0xef, 0x16, 0x9d, 0x63, 0xf4, 0x9c, 0x5c, 0x4d, 0x3b, 0xe1, 0x86, 0x29, 0x1a, 0xf4, 0x7a, 0xbf,
+  0x76, 0x53, 0x89, 0xf8, 0xc1, 0x3b, 0x6f, 0xba, 0xff, 0x04, 0xd9, 0xcb, 0x76, 0xd7, 0x36, 0x73,
+  0x47, 0xda, 0x87, 0xbe, 0x78, 0xf6, 0xad, 0xb3, 0x6f, 0x5c, 0x9e, 0x3b, 0x3f, 0x6c, 0xb7, 0xc3,
+  0x6a, 0x0c, 0xb7, 0x94, 0xea, 0xf9, 0x9e, 0x03, 0x76, 0x4a, 0xb7, 0xd2, 0x57, 0x5a, 0xe0, 0x61,
+  0xb6, 0xa8, 0x5f, 0x51, 0x5a, 0xbc, 0xca, 0x0f, 0x8b, 0x70, 0x9d, 0xf6, 0x53, 0x10, 0xc7, 0x5d,
+  0x67, 0x3f, 0x83, 0xfb, 0xe7, 0x64, 0x6b, 0x09, 0x54, 0x46, 0x8a, 0xb6, 0x52, 0x0b, 0xb7, 0xc2,
+  0x5f, 0x41, 0x0e, 0xf7, 0x17, 0x10, 0xc7, 0xc6, 0x27, 0x8e, 0x4f, 0xbe, 0x3e, 0x75, 0xa2, 0x34,
+  0x77, 0xea, 0x74, 0x2e, 0x97, 0xeb, 0xdf, 0xfc, 0x9a, 0x88, 0xf2, 0xe9, 0x25, 0xd9, 0x62, 0xf3,
+  0x58, 0xfe, 0xb9, 0x2e, 0x5a, 0x93, 0x09, 0x59, 0xb7, 0xc4, 0xf5, 0xb3, 0x65, 0x3c, 0xce, 0xa7,
+  0x55, 0xd7, 0x21, 0xa6, 0xeb, 0x57, 0xcd, 0x02, 0x94, 0xc1, 0x41, 0xb7, 0x42, 0x9d, 0xbd, 0x12,
+  0xa8, 0x70, 0x07, 0xef, 0x81, 0x4a, 0x57, 0x1f, 0x07, 0x12, 0xbe, 0x14, 0xf6, 0xdf, 0xc2, 0x9e,
+  0x75, 0x5e, 0x91, 0xe3, 0x5b, 0x18, 0xa9, 0x68, 0x45, 0xa7, 0xce, 0x61, 0x19, 0x6e, 0x7c, 0xb2,
+  0x50, 0x9e, 0xec, 0xdd, 0x1a, 0x65, 0xc5, 0x89, 0x89, 0x42, 0x99, 0xc4, 0xfe, 0x19, 0x35, 0x38,
+  0x88, 0x83, 0x0a, 0xfb, 0x97, 0xb4, 0x60, 0x1e, 0x86, 0x82, 0x9b, 0x75, 0x24, 0x88, 0x6c, 0x02,
+  0xf5, 0x2c, 0x98, 0x0a, 0xd8, 0x1b, 0x4f, 0x29, 0xd2, 0x5f, 0xda, 0x9a, 0x3c, 0xb2, 0xda, 0x96,
+  0xcd, 0x92, 0x47, 0x51, 0xdb, 0xb2, 0x1a, 0x8b, 0x8a, 0xc9, 0x7d, 0x27, 0x60, 0x7e, 0xf4, 0x81,
+  0xd0, 0xdf, 0x3e, 0xa2, 0x92, 0xd1, 0x77, 0x1b, 0x0f, 0x21, 0xd0, 0xfd, 0x82, 0x0c, 0xca, 0x13,
+  0xf8, 0x7f, 0x5b, 0x74, 0x2a, 0x84, 0xcb, 0x2f, 0xf6, 0xb1, 0x89, 0xc9, 0xba, 0xb8, 0x98, 0xa2,
+  0x94, 0x84, 0x35, 0xec, 0x57, 0xbc, 0x5b, 0x59, 0x69, 0xe7, 0xc8, 0x33, 0xca, 0x1c, 0x6e, 0x27,
+  0x56, 0x87, 0xf8, 0x0e, 0x21, 0x2a, 0x2e, 0x39, 0x3e, 0x01, 0x8a, 0xe6, 0x12, 0x7e, 0xdd, 0x50,
+  0x1f, 0xa7, 0x40, 0xb8, 0x81, 0xe8, 0x19, 0x78, 0x13, 0x0b, 0x62, 0x7c, 0xa7, 0x92, 0xc4, 0x23,
+  0x7f, 0x34, 0xf7, 0x3c, 0xd8, 0xdf, 0xb4, 0xbb, 0xcb, 0x78, 0x90, 0x7f, 0xd7, 0x41, 0x26, 0x0c,
+  0xe5, 0x13, 0xbb, 0x02, 0xc5, 0x53, 0xe0, 0x6b, 0x89, 0x93, 0x0a, 0xbf, 0xfe, 0x19, 0x3d, 0xb4,
+  0xcb, 0x5d, 0xdd, 0x67, 0xf6, 0x99, 0xff, 0xc1, 0x23, 0x40, 0xb2, 0x3f, 0xd1, 0xac, 0x69, 0x36,
+  0x9e, 0x3b, 0xce, 0x70, 0x7f, 0x76, 0x08, 0xc8, 0xfd, 0xf8, 0x64, 0x37, 0xdf, 0x67, 0x82, 0xab,
+  0xba, 0x63, 0xa3, 0xd1, 0xbb, 0x1b, 0x86, 0x20, 0xf8, 0x8d, 0xde, 0xdd, 0xb7, 0xdf, 0x42, 0xb3,
+  0xf7, 0xbe, 0x03, 0x08, 0x73, 0xd1, 0x2f, 0x28, 0xcd, 0x4b, 0xdb, 0x5f, 0xc4, 0x1b, 0x23, 0xc3,
+  0x37, 0xd9, 0xbe, 0x63, 0x48, 0xd2, 0x1d, 0x5d, 0xe2, 0x35, 0xeb, 0x0f, 0x79, 0x2d, 0x71, 0x8d,
+  0x4e, 0x00, 0xdd, 0xa7, 0x0d, 0xe2, 0xee, 0x2e, 0x8e, 0x17, 0x54, 0xe6, 0xc1, 0x8e, 0x69, 0xb7,
+  0x05, 0x5b, 0x6c, 0x6d, 0xe8, 0xdb, 0xb5, 0xed, 0x36, 0x8f, 0xc5, 0xf4, 0x89, 0x7b, 0xb6, 0x2d,
+  0xf4, 0xae, 0x8f, 0x1c, 0xa9, 0x21, 0x9f, 0xbb, 0x34, 0xf4, 0xfd, 0x64, 0xe0, 0xb4, 0x65, 0x0e,
+  0x71, 0xb2, 0x62, 0xb4, 0x9a, 0xb9, 0xc3, 0x2e, 0x9f, 0x5d, 0x58, 0x24, 0x74, 0x7b, 0x1f, 0x00,
+  0xa9, 0x9e, 0x12, 0xf9, 0x28, 0x7d, 0xe6, 0x3b, 0xa1, 0xc2, 0x0b, 0x02, 0x10, 0x91, 0x3c, 0xde,
+  0x43, 0xf8, 0xa6, 0x38, 0xde, 0x20, 0x70, 0xb5, 0xa9, 0x58, 0x4b, 0x7a, 0x8d, 0x35, 0x14, 0x2b,
+  0x33, 0xfb, 0xc6, 0xd9, 0x45, 0x46, 0x5e, 0x68, 0x4d, 0xb6, 0xe4, 0xf0, 0xc1, 0xaf, 0xf8, 0x78,
+  0x4d, 0x31, 0xab, 0xfc, 0x5c, 0x3d, 0xbb, 0x32, 0xe3, 0x71, 0xed, 0xe8, 0x24, 0x04, 0x12, 0xf9,
+  0xbc, 0x7d, 0x18, 0x55, 0x9e, 0x8b, 0x64, 0x9e, 0x8b, 0x19, 0xff, 0x22, 0x82, 0x91, 0x3e, 0x27,
+  0x5d, 0x0f, 0x8c, 0xac, 0xb9, 0x54, 0xd1, 0x81, 0x80, 0x89, 0x18, 0x6f, 0x04, 0x51, 0x1d, 0x65,
+  0x36, 0x4e, 0xde, 0x13, 0x06, 0xc4, 0x3e, 0x62, 0x16, 0x2c, 0xea, 0x7c, 0xcd, 0x0b, 0x36, 0xfb,
+  0x62, 0xb3, 0xe5, 0x1e, 0x19, 0x74, 0x51, 0x02, 0xc4, 0xb2, 0x50, 0xf6, 0x64, 0x5d, 0x55, 0xb4,
+  0x9a, 0x59, 0x46, 0xd2, 0x8d, 0xd6, 0xe4, 0xab, 0xa3, 0xd4, 0x16, 0xd1, 0x18, 0xf2, 0x5c, 0x39,
+  0xd0, 0xc4, 0x89, 0x7e, 0x82, 0x2e, 0x32, 0xd5, 0xbf, 0x9f, 0xf0, 0xd3, 0x36, 0xc4, 0x09, 0xdb,
+  0x59, 0x6a, 0x5e, 0x3b, 0x83, 0xc7, 0x19, 0x8f, 0x32, 0xa5, 0x09, 0x3f, 0xa8, 0x39, 0xe9, 0xe5,
+  0xda, 0x97, 0x43, 0xc6, 0x51, 0xd3, 0x93, 0x11, 0x0c, 0x14, 0x8f, 0xa8, 0x42, 0xcc, 0x37, 0xf7,
+  0xa3, 0x9a, 0xec, 0xdd, 0xcc, 0xb1, 0x93, 0xb8, 0x9b, 0xbc, 0xfc, 0x2b, 0xf8, 0x4f, 0x3a, 0x7f,
+  0x5e, 0x3a, 0x73, 0x66, 0xf8, 0x08, 0xe6, 0xb1, 0x28, 0x94, 0x88, 0x25, 0xff, 0x92, 0x13, 0xf0,
+  0xbe, 0xfe, 0x65, 0xe1, 0xe2, 0x05, 0x40, 0x8d, 0xf7, 0x5a, 0xbc, 0x61, 0xc8, 0x75, 0xb9, 0x25,
+  0xe7, 0xdf, 0xd4, 0x9b, 0x0a, 0x9b, 0x33, 0x4d, 0xd5, 0xb4, 0xe4, 0x96, 0x35, 0x32, 0xcd, 0x4e,
+  0xe2, 0xfe, 0xf9, 0xf2, 0x4f, 0xe4, 0x66, 0x7b, 0xda, 0xd2, 0xf9, 0xbf, 0x94, 0x5e, 0x36, 0xcb,
+  0x17, 0xb8, 0x95, 0x44, 0x4b, 0xb2, 0x49, 0xf1, 0x0e, 0x1d, 0x39, 0x3e, 0x6a, 0xe7, 0xf0, 0xb9,
+  0x3e, 0xf5, 0x24, 0xc9, 0xb1, 0x17, 0xeb, 0x82, 0xbd, 0xa1, 0x63, 0xdb, 0xf9, 0xc2, 0x8c, 0x21,
+  0xce, 0xbd, 0xa2, 0x26, 0x4f, 0xfd, 0x0b, 0x77, 0x2f, 0x89, 0xf7, 0x14, 0xd9, 0x4d, 0x26, 0x6c,
+  0x1d, 0x9d, 0x94, 0x43, 0x0d, 0x66, 0x60, 0x62, 0x97, 0x61, 0x92, 0xe3, 0x63, 0x6e, 0xef, 0x18,
+  0xc8, 0x15, 0x5c, 0x29, 0x4e, 0x0a, 0xdb, 0xff, 0xed, 0x33, 0xf0, 0x3b, 0xed, 0x4b, 0xb6, 0x52,
+  0xc0, 0x8b, 0xa3, 0x6c, 0x59, 0x3c, 0xb7, 0x07, 0xc6, 0x19, 0x08, 0xe8, 0x90, 0x8b, 0x7f, 0x8d,
+  0x44, 0x12, 0x45, 0x87, 0x4f, 0x12, 0x53, 0x6d, 0x55, 0x95, 0x7e, 0x44, 0x71, 0xdb, 0x07, 0xec,
+  0x16, 0xf7, 0xed, 0x40, 0xb7, 0x83, 0xdb, 0x59, 0x7f, 0x92, 0xd7, 0x18, 0xca, 0x68, 0xf9, 0xec,
+  0x86, 0x04, 0xee, 0xea, 0x5c, 0x63, 0xde, 0x04, 0x1f, 0x88, 0x62, 0xab, 0x66, 0xb7, 0x01, 0xf8,
+  0x12, 0x78, 0xbc, 0x09, 0x63, 0xbb, 0x77, 0x73, 0x84, 0xbd, 0xc6, 0x5a, 0xb8, 0x55, 0x9c, 0xee,
+  0xae, 0x51, 0x01, 0x7a, 0x0d, 0x08, 0xa6, 0xa9, 0x4d, 0xd5, 0x42, 0xf6, 0x7a, 0xff, 0xaf, 0xec,
+  0x78, 0xa1, 0x30, 0x7c, 0xa2, 0xf0, 0x93, 0x05, 0x92, 0xa8, 0x42, 0xa7, 0x2f, 0x3c, 0xe3, 0x7b,
+  0xa1, 0xb6, 0x79, 0x9f, 0x06, 0x7e, 0xf3, 0x12, 0x0a, 0x33, 0xef, 0x12, 0x11, 0x95, 0x73, 0x9b,
+  0xb3, 0x29, 0x8c, 0x41, 0x5d, 0xe9, 0x5d, 0xda, 0x51, 0x66, 0xcb, 0x3d, 0x5d, 0xc1, 0x88, 0x10,
+  0x5c, 0x54, 0xb3, 0x5c, 0x18, 0xb2, 0xd8, 0xff, 0xfb, 0xb2, 0x62, 0x5c, 0x4d, 0x5c, 0xe3, 0x8f,
+  0x88, 0xdf, 0xb1, 0x71, 0x83, 0xaa, 0x5e, 0xe2, 0x60, 0x89, 0x60, 0x9b, 0xc9, 0xa6, 0xab, 0xee,
+  0xcb, 0x7c, 0x3b, 0x00, 0xe1, 0x1d, 0x66, 0xd7, 0xca, 0x72, 0xf5, 0x8a, 0x62, 0x95, 0x8b, 0x4b,
+  0xf4, 0x49, 0x6e, 0x34, 0xca, 0x10, 0x90, 0x8d, 0x42, 0x30, 0x36, 0xda, 0x54, 0xe4, 0xd6, 0xd0,
+  0xad, 0xe0, 0x55, 0xfc, 0x2e, 0x87, 0x64, 0xcd, 0x4b, 0x7e, 0xd6, 0xbe, 0x93, 0x82, 0x8d, 0x34,
+  0x80, 0x01, 0x2d, 0x7c, 0x68, 0x34, 0xdb, 0xba, 0x09, 0x78, 0x5e, 0xba, 0xb8, 0x20, 0x10, 0xc5,
+  0xd4, 0x59, 0x1f, 0x49, 0xdb, 0xa4, 0xd4, 0x92, 0x93, 0x15, 0xb6, 0xc3, 0x08, 0xf8, 0x38, 0x6c,
+  0x64, 0x30, 0x3e, 0xed, 0x63, 0xac, 0x42, 0x19, 0xb8, 0xf5, 0x88, 0x44, 0x3b, 0xe7, 0xf4, 0xdd,
+  0x40, 0x7a, 0x6e, 0xc8, 0xb8, 0x8a, 0x1e, 0xd1, 0x44, 0x7c, 0x43, 0x1b, 0x2c, 0xc2, 0x4e, 0x0c,
+  0x19, 0xb4, 0xff, 0x70, 0xbd, 0x01, 0xf0, 0x00, 0xfe, 0x6b, 0xd8, 0xb8, 0xb6, 0xac, 0x76, 0x1f,
+  0xb2, 0xa2, 0x54, 0xbd, 0x4b, 0x58, 0xbd, 0xf0, 0x6e, 0x9b, 0xf1, 0xf7, 0x99, 0xed, 0xe0, 0x0e,
+  0xcd, 0xe1, 0xca, 0x49, 0x3f, 0xcc, 0x28, 0xbc, 0xe6, 0x5f, 0x44, 0xc2, 0x85, 0x83, 0xef, 0x12,
+  0x8c, 0x40, 0x76, 0x38, 0xd8, 0x05, 0x29, 0xc7, 0xdb, 0x62, 0xfb, 0xb8, 0xb2, 0x09, 0x6d, 0xb6,
+  0xee, 0xf7, 0xe9, 0x1e, 0x1c, 0xa7, 0x1a, 0x9e, 0x88, 0xe8, 0xa2, 0xe4, 0x1c, 0xb7, 0x92, 0x88,
+  0x55, 0xf4, 0x09, 0x2c, 0x76, 0x3b, 0x53, 0xfe, 0x1c, 0xbc, 0xb0, 0x34, 0x74, 0x5d, 0xd2, 0x48,
+  0x27, 0x15, 0x61, 0x29, 0x76, 0x62, 0x5b, 0x4a, 0x55, 0xe6, 0x31, 0xfb, 0x37, 0x5f, 0x3b, 0x02,
+  0xf4, 0x2c, 0xc5, 0xb4, 0xfa, 0x68, 0xbb, 0xbe, 0x29, 0x04, 0x4f, 0x27, 0xef, 0x70, 0x65, 0x21,
+  0x0d, 0x7e, 0x11, 0xf2, 0xb0, 0xee, 0x43, 0xf9, 0x89, 0x7d, 0x2a, 0x87, 0x07, 0x69, 0xe7, 0x2b,
+  0x4d, 0x86, 0x46, 0x4a, 0xaa, 0x3b, 0xe5, 0x23, 0xbf, 0xee, 0xc9, 0x83, 0xec, 0x5f, 0x7c, 0xd9,
+  0x1c, 0xbe, 0xd2, 0xf4, 0xa6, 0x28, 0x4f, 0xe4, 0x99, 0xee, 0xfd, 0xce, 0xa8, 0xa1, 0x61, 0x87,
+  0x27, 0x29, 0xa4, 0xe3, 0xc4, 0xcf, 0x03, 0xe9, 0x93, 0xd7, 0x18, 0x9e, 0x43, 0x91, 0xf7, 0xed,
+  0x83, 0x0b, 0x1e, 0xe4, 0x30, 0xcc, 0x25, 0xe7, 0x2d, 0x65, 0x83, 0xc4, 0x67, 0x71, 0xdd, 0x97,
+  0xa1, 0xa6, 0x4b, 0xb4, 0x2b, 0x43, 0xf7, 0x16, 0x38, 0xbe, 0x79, 0xd1, 0x9e, 0x97, 0x9c, 0x93,
+  0x08, 0xa5, 0xf3, 0x62, 0x4d, 0x20, 0xf5, 0x40, 0x91, 0x1d, 0x74, 0x67, 0x34, 0x6c, 0x4a, 0x77,
+  0x3a, 0x9d, 0x44, 0x74, 0x3d, 0x3d, 0x64, 0x49, 0xfb, 0x1e, 0xb7, 0x98, 0xdd, 0x3e, 0x36, 0x74,
+  0xa6, 0xed, 0x74, 0xf2, 0xcb, 0xd4, 0x8b, 0x94, 0x88, 0x67, 0x7c, 0x5b, 0x54, 0x74, 0xf3, 0x5b,
+  0x96, 0xb7, 0x42, 0xc9, 0x86, 0x35, 0x32, 0x64, 0x3b, 0x84, 0x08, 0xd7, 0xa8, 0xeb, 0x29, 0x59,
+  0x09, 0x50, 0xff, 0xf8, 0xf3, 0x74, 0xc8, 0x9e, 0xa4, 0x23, 0x78, 0x46, 0xd9, 0x4f, 0x3d, 0x67,
+  0x53, 0x8e, 0xc4, 0x7d, 0xf3, 0x99, 0xf7, 0x97, 0xe8, 0xe2, 0x41, 0x7c, 0x4e, 0xef, 0xde, 0x35,
+  0x58, 0xc8, 0x15, 0xc5, 0xcd, 0xaf, 0xa5, 0x39, 0x8a, 0x4d, 0xa4, 0x10, 0xed, 0x6e, 0xcb, 0xb1,
+  0xf6, 0x2a, 0xe3, 0xdd, 0x6f, 0x81, 0xef, 0xcd, 0x72, 0xea, 0x21, 0x86, 0x52, 0xc7, 0xf4, 0xfe,
+  0x5c, 0x5b, 0xfd, 0x85, 0xaa, 0x74, 0x9c, 0x9e, 0x92, 0x3f, 0x3b, 0xad, 0x84, 0x11, 0xe5, 0x16,
+  0xef, 0x3c, 0xed, 0xce, 0x53, 0x24, 0xa7, 0xaf, 0x6f, 0xb6, 0x7f, 0x57, 0x98, 0xbf, 0x64, 0x3c,
+  0xe9, 0x74, 0x91, 0x4a, 0xab, 0xbc, 0x8f, 0xb4, 0xb3, 0xa4, 0xe2, 0x71, 0x8a, 0xf8, 0x2d, 0x31,
+  0x25, 0x18, 0x46, 0x1c, 0x3d, 0x16, 0x79, 0x08, 0xb4, 0xe8, 0x17, 0x0d, 0xe6, 0x7b, 0xbd, 0xc7,
+  0x69, 0xeb, 0xb2, 0x69, 0xd7, 0xee, 0xe8, 0xd7, 0x59, 0xe7, 0x29, 0xb3, 0x6a, 0xa8, 0x78, 0x04,
+  0x96, 0x51, 0x2d, 0x67, 0x80, 0xd8, 0xed, 0xdc, 0x6f, 0xcd, 0x93, 0x2b, 0xe5, 0x5a, 0x7d, 0xb2,
+  0x58, 0x3c, 0x31, 0x51, 0x9d, 0xac, 0x4f, 0x51, 0xa1, 0x8b, 0x3f, 0x85, 0xc0, 0xb1, 0x73, 0x08,
+  0x2e, 0x2c, 0x59, 0x4d, 0x6d, 0xf6, 0x95, 0xff, 0x07, 0xdd, 0xeb, 0x97, 0x90, 0x9c, 0x82, 0x00,
+  0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+  { "/app.css", "text/css; charset=utf-8", WEB_APP_CSS, sizeof(WEB_APP_CSS), "\"dcc506ead86e\"", true },
+  { "/app.js", "application/javascript; charset=utf-8", WEB_APP_JS, sizeof(WEB_APP_JS), "\"df61194c6f80\"", true },
+  { "/index.html", "text/html; charset=utf-8", WEB_INDEX_HTML, sizeof(WEB_INDEX_HTML), "\"d23aa22a84b5\"", false },
+};
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))
+#define WEB_ASSET_INDEX (WEB_ASSET_COUNT - 1)  // index.html — последний
+
+#endif
@@ -8,10 +8,18 @@ using WebServerCompat = ESP8266WebServer;
 #include <WiFi.h>
 using WebServerCompat = WebServer;
 #endif
-#include <ArduinoJson.h>   // ArduinoJson v6 — установить через Library Manager
 #include "Memory.h"
 #include "Connectivity.h"  // для ntp_sync_time()
 #include "Logger.h"
+#include "GzipStream.h"
+#include "ZipStream.h"
+#include "JsonWriter.h"
+#include "JsonReader.h"
+#include <new>
+#ifdef WEB_UI_BUILTIN
+#include "WebAssets.h"
+#endif
+#include <time.h>
 #ifdef USE_SD_CARD
 #include <SPI.h>
 #include <SD.h>
@@ -37,1377 +45,625 @@ static bool _auth() {
   return true;
 }
 
-// ─── Главная HTML страница (хранится во Flash) ────────────────────────────
-static const char PAGE_HTML[] PROGMEM = R"rawhtml(
-<!DOCTYPE html><html lang="ru"><head>
-<meta charset="UTF-8">
-<meta name="viewport" content="width=device-width,initial-scale=1">
-<title>🐝 BeehiveScale</title>
-<style>
-*{box-sizing:border-box;margin:0;padding:0}
-:root{
-  --bg:#0d0f0b;--panel:#141710;--border:#2e3829;
-  --amber:#f5a623;--amber2:#ffd166;--green:#6fcf97;
-  --red:#eb5757;--blue:#56ccf2;--text:#c8d4b8;--text2:#8a9e78;--text3:#506040;
-  --mono:'Courier New',monospace;
-}
-body{background:var(--bg);color:var(--text);font-family:var(--mono);font-size:15px;min-height:100vh}
-a{color:var(--amber);text-decoration:none}
-
-.refresh-bar{height:2px;background:var(--border);position:fixed;top:0;left:0;right:0;z-index:200}
-.refresh-fill{height:100%;background:var(--amber);transition:width 0.5s linear}
-
-.hdr{background:rgba(20,23,16,.97);border-bottom:1px solid var(--border);padding:8px 24px;position:sticky;top:0;z-index:99;min-height:52px;display:flex;align-items:center;justify-content:center}
-.hdr-inner{display:flex;flex-direction:column;align-items:center;gap:0;position:relative;z-index:1}
-.hdr-logo{font-size:18px;font-weight:700;letter-spacing:3px;color:var(--amber);text-align:center}
-.hdr-sub{font-size:10px;color:var(--text3);letter-spacing:2px}
-.hdr-right{position:absolute;left:62%;top:50%;transform:translateY(-50%);
-  display:flex;align-items:center;gap:14px;font-size:13px;color:var(--text3)}
-.live{display:inline-block;width:7px;height:7px;border-radius:50%;
-  background:var(--green);box-shadow:0 0 5px var(--green);animation:pulse 2s infinite;margin-right:5px}
-@keyframes pulse{0%,100%{opacity:1}50%{opacity:.3}}
-
-.tabs{display:flex;border-bottom:1px solid var(--border);
-  background:rgba(20,23,16,.9);position:sticky;top:52px;z-index:98;overflow-x:auto;
-  justify-content:center;padding:0}
-.tab{padding:10px 18px;font-size:13px;letter-spacing:1px;color:var(--text3);
-  border-bottom:2px solid transparent;cursor:pointer;white-space:nowrap;text-transform:uppercase;
-  background:none;border-top:none;border-left:none;border-right:none;font-family:var(--mono)}
-.tab:hover{color:var(--text2)}
-.tab.active{color:var(--amber);border-bottom-color:var(--amber)}
-
-.section{display:none;padding:20px 24px;max-width:1080px;margin:0 auto;width:100%}
-.section.active{display:block}
-
-.grid{display:grid;grid-template-columns:1fr 1fr;gap:12px}
-.grid-3{display:grid;grid-template-columns:1fr 1fr 1fr;gap:10px}
-.grid-auto{display:grid;grid-template-columns:repeat(auto-fill,minmax(180px,1fr));gap:8px}
-@media(max-width:700px){.grid,.grid-3{grid-template-columns:1fr}}
-
-.card{background:var(--panel);border:1px solid var(--border);padding:14px;position:relative;overflow:hidden}
-.card::before{content:'';position:absolute;top:0;left:0;right:0;height:2px;
-  background:linear-gradient(90deg,var(--amber),transparent)}
-.card.blue::before{background:linear-gradient(90deg,var(--blue),transparent)}
-.card.green::before{background:linear-gradient(90deg,var(--green),transparent)}
-.card.red::before{background:linear-gradient(90deg,var(--red),transparent)}
-.card.full{grid-column:1/-1}
-.card-title{font-size:12px;letter-spacing:2px;color:var(--text3);text-transform:uppercase;margin-bottom:12px;display:flex;align-items:center;justify-content:space-between}
-.card-title span{cursor:pointer;color:var(--text3);font-size:11px}
-.card-title span:hover{color:var(--amber)}
-
-.val-big{font-size:42px;font-weight:700;color:var(--amber);line-height:1;letter-spacing:-1px}
-.val-unit{font-size:18px;color:var(--text2);margin-left:3px}
-.val-sub{font-size:12px;color:var(--text3);margin-top:6px;line-height:1.7}
-
-.gauge-wrap{display:flex;align-items:center;gap:8px;margin-top:8px}
-.gauge{flex:1;height:4px;background:var(--border)}
-.gauge-fill{height:100%;background:var(--amber);transition:width .5s}
-.gauge-lbl{font-size:12px;color:var(--text3);min-width:40px;text-align:right}
-
-.status-row{display:flex;align-items:center;gap:8px;padding:6px 0;
-  border-bottom:1px solid #1c2018;font-size:13px}
-.status-row:last-child{border:none}
-.dot{width:8px;height:8px;border-radius:50%;flex-shrink:0}
-.dot.ok{background:var(--green);box-shadow:0 0 4px var(--green)}
-.dot.err{background:var(--red);box-shadow:0 0 4px var(--red)}
-.dot.warn{background:var(--amber);box-shadow:0 0 4px var(--amber)}
-.status-lbl{flex:1;color:var(--text2)}
-.status-val{color:var(--text);font-size:13px;text-align:right}
-
-.btn{display:inline-flex;align-items:center;justify-content:center;font-family:var(--mono);
-  font-size:12px;letter-spacing:1px;padding:9px 16px;border:1px solid;cursor:pointer;
-  background:transparent;transition:all .15s;text-transform:uppercase;gap:6px}
-.btn-amber{border-color:var(--amber);color:var(--amber)}
-.btn-amber:hover{background:var(--amber);color:#000}
-.btn-red{border-color:var(--red);color:var(--red)}
-.btn-red:hover{background:var(--red);color:#fff}
-.btn-green{border-color:var(--green);color:var(--green)}
-.btn-green:hover{background:var(--green);color:#000}
-.btn-blue{border-color:var(--blue);color:var(--blue)}
-.btn-blue:hover{background:var(--blue);color:#000}
-.btn:disabled{opacity:.4;cursor:not-allowed}
-.btn:active{transform:scale(0.96)}
-.btn-row{display:flex;gap:8px;flex-wrap:wrap;margin-top:10px}
-
-.form-row{margin-bottom:12px}
-.form-row label{display:block;font-size:11px;letter-spacing:1.5px;color:var(--text3);
-  text-transform:uppercase;margin-bottom:5px}
-input,select{background:#1c2018;border:1px solid var(--border);color:var(--text);
-  font-family:var(--mono);font-size:13px;padding:9px 12px;outline:none;width:100%}
-input:focus,select:focus{border-color:var(--amber)}
-input[type=checkbox]{width:auto}
-
-/* ── WiFi mode cards ── */
-.wm-opts{display:flex;gap:8px;margin-bottom:12px}
-.wm-opt{flex:1;background:#1c2018;border:1px solid var(--border);padding:14px 10px;cursor:pointer;
-  display:flex;flex-direction:column;align-items:center;justify-content:center;text-align:center;gap:8px;min-height:130px;transition:border-color .15s}
-.wm-opt:hover{border-color:var(--text3)}
-.wm-opt.sel{border-color:var(--amber)}
-.wm-opt input[type=radio]{accent-color:var(--amber)}
-.wm-opt-body{font-size:13px;line-height:1.8;color:var(--text2);text-align:center}
-.wm-opt-body b{color:var(--text);font-size:14px;display:block;margin-bottom:4px}
-.wm-opt-body small{color:var(--text3);font-size:12px}
-
-/* ── Pass change ── */
-.pass-section{border-top:1px solid var(--border);padding-top:12px;margin-top:12px}
-.pass-row{display:flex;gap:8px;align-items:flex-end}
-.pass-row .form-row{flex:1;margin:0}
-.pass-strength{height:3px;background:var(--border);margin-top:4px;transition:all .2s}
-
-/* ── Chart ── */
-.chart-container{position:relative;margin-bottom:10px}
-.chart-svg{width:100%;display:block;overflow:visible}
-.period-tabs{display:flex;gap:4px;margin-bottom:8px;flex-wrap:wrap}
-.period-btn{padding:5px 12px;font-size:12px;letter-spacing:1px;border:1px solid var(--border);
-  background:transparent;color:var(--text3);cursor:pointer;font-family:var(--mono);text-transform:uppercase}
-.period-btn.active{border-color:var(--amber);color:var(--amber)}
-.series-btns{display:flex;gap:4px;flex-wrap:wrap}
-.ser-btn{padding:5px 12px;font-size:12px;border:1px solid var(--border);background:transparent;
-  color:var(--text3);cursor:pointer;font-family:var(--mono)}
-.ser-btn.active{background:#1c2018}
-.ser-btn.s-w.active{border-color:var(--amber);color:var(--amber)}
-.ser-btn.s-t.active{border-color:var(--blue);color:var(--blue)}
-.ser-btn.s-b.active{border-color:var(--green);color:var(--green)}
-
-/* ── Tooltip ── */
-.tip{position:absolute;display:none;background:rgba(13,15,11,.95);border:1px solid var(--border);
-  padding:6px 10px;font-size:10px;pointer-events:none;z-index:50;line-height:1.6;min-width:120px}
-
-/* ── Export panel ── */
-.exp-panel{background:#0f1209;border:1px solid var(--border);padding:12px;margin-top:10px;position:relative;z-index:10}
-.exp-panel-title{font-size:12px;letter-spacing:2px;color:var(--text3);text-transform:uppercase;margin-bottom:10px}
-.exp-cols{display:flex;flex-direction:column;gap:4px}
-.exp-col-item{display:flex;align-items:center;gap:8px;font-size:13px;color:var(--text2);cursor:pointer}
-.exp-col-item input{width:auto}
-.exp-date-row{display:flex;gap:8px;margin-bottom:10px}
-.exp-date-row .form-row{flex:1;margin:0}
-
-/* ── API ── */
-.api-grid{display:grid;grid-template-columns:repeat(auto-fill,minmax(200px,1fr));gap:6px;margin-top:8px}
-.api-item{background:#1c2018;padding:10px 12px;border:1px solid var(--border);font-size:12px}
-.api-method{font-weight:700;margin-bottom:2px}
-.api-desc{color:var(--text3)}
-.get{color:var(--green)}.post{color:var(--amber)}.del{color:var(--red)}
-
-/* ── Info tiles ── */
-.info-tile{background:#1c2018;border:1px solid var(--border);padding:8px 10px}
-.info-tile .lbl{font-size:11px;color:var(--text3);letter-spacing:1px;margin-bottom:4px;text-transform:uppercase}
-.info-tile .val{font-size:17px}
-
-/* ── Calibration wizard ── */
-.wiz-steps{display:flex;gap:0;margin-bottom:12px}
-.wiz-step{flex:1;text-align:center;padding:6px 3px;font-size:11px;letter-spacing:.5px;
-  border-bottom:2px solid var(--border);color:var(--text3);text-transform:uppercase}
-.wiz-step.active{border-color:var(--amber);color:var(--amber)}
-.wiz-step.done{border-color:var(--green);color:var(--green)}
-.wiz-body{background:#1c2018;border:1px solid var(--border);padding:14px;min-height:80px;font-size:13px;line-height:1.8}
-
-/* ── Toast ── */
-.toast{position:fixed;bottom:16px;right:16px;z-index:500;font-family:var(--mono);font-size:11px;
-  padding:10px 16px;border:1px solid var(--green);background:rgba(13,15,11,.97);color:var(--green);
-  letter-spacing:1px;transform:translateX(220%);transition:transform .3s;max-width:280px}
-.toast.show{transform:none}
-.toast.err{border-color:var(--red);color:var(--red)}
-
-/* ── Preview table ── */
-.prev-wrap{overflow-x:auto;margin-top:10px}
-.prev-table{width:100%;border-collapse:collapse;font-size:12px}
-.prev-table th{background:#1c2018;color:var(--text3);padding:6px 10px;border:1px solid var(--border);
-  text-align:left;font-weight:normal;letter-spacing:1px;text-transform:uppercase;font-size:11px}
-.prev-table td{padding:5px 10px;border:1px solid var(--border);color:var(--text2)}
-.prev-table tr:hover td{background:#1a1e15}
-
-/* ── Wiz step bar ── */
-.wiz-actions{display:flex;gap:8px;margin-top:10px;align-items:center}
-.wiz-cur-w{font-size:13px;color:var(--text3);margin-left:auto}
-</style>
-</head>
-<body>
-
-<div class="refresh-bar"><div class="refresh-fill" id="rbar" style="width:100%"></div></div>
-
-<div class="hdr">
-  <div class="hdr-inner">
-    <div class="hdr-logo">🐝 BeehiveScale</div>
-  </div>
-  <div class="hdr-right">
-    <div class="hdr-sub" style="margin-right:16px">LIVE MONITOR · ESP8266</div>
-    <span><span class="live"></span>ONLINE</span>
-    <span id="cur-time">--:--:--</span>
-  </div>
-</div>
-
-<div class="tabs">
-  <button class="tab active"  onclick="nav('main')">⌂ Главная</button>
-  <button class="tab"         onclick="nav('chart')">📈 График + Экспорт</button>
-  <button class="tab"         onclick="nav('wifi')">📶 Wi-Fi</button>
-  <button class="tab"         onclick="nav('settings')">⚙ Настройки</button>
-  <button class="tab"         onclick="nav('calib')">⚖ Калибровка</button>
-  <button class="tab"         onclick="nav('tg')">✉ Telegram</button>
-  <button class="tab"         onclick="nav('api')">🔌 API</button>
-</div>
-
-<!-- ═══════════════ MAIN ═══════════════ -->
-<div class="section active" id="sec-main">
-  <div class="grid">
-
-    <div class="card">
-      <div class="card-title">⚖ Текущий вес</div>
-      <div class="val-big" id="w-val">--<span class="val-unit">кг</span></div>
-      <div class="val-sub">Эталон: <b id="w-ref">--</b> кг &nbsp;|&nbsp; Δ: <b id="w-delta" style="color:var(--amber2)">--</b> кг</div>
-      <div class="gauge-wrap">
-        <div class="gauge"><div class="gauge-fill" id="w-gauge" style="width:0%"></div></div>
-        <div class="gauge-lbl" id="w-gpct">0%</div>
-      </div>
-    </div>
-
-    <div class="card blue">
-      <div class="card-title">🌡 Температура / Влажность</div>
-      <div class="val-big" id="t-val">--<span class="val-unit">°C</span></div>
-      <div class="val-sub">Влажность: <b id="h-val">--</b>% &nbsp;|&nbsp; RTC: <b id="rtc-val">--</b>°C</div>
-      <div class="gauge-wrap">
-        <div class="gauge"><div class="gauge-fill" id="t-gauge" style="width:0%;background:var(--blue)"></div></div>
-        <div class="gauge-lbl" id="t-gpct">--°C</div>
-      </div>
-    </div>
-
-    <div class="card">
-      <div class="card-title">🔋 Батарея</div>
-      <div class="val-big" id="bat-v-big">--<span class="val-unit">В</span></div>
-      <div class="val-sub">Заряд: <b id="bat-pct-v">--%</b></div>
-      <div class="gauge-wrap">
-        <div class="gauge"><div class="gauge-fill" id="bat-gauge" style="width:0%;background:var(--green)"></div></div>
-        <div class="gauge-lbl" id="bat-gpct">--%</div>
-      </div>
-      <div class="card-title" style="margin-top:12px;font-size:11px;color:var(--text2)">💾 Лог / Память</div>
-      <div class="val-sub">Занято: <b id="mem-used">--</b> КБ из <b id="mem-total">--</b> КБ</div>
-      <div class="gauge-wrap">
-        <div class="gauge"><div class="gauge-fill" id="mem-gauge" style="width:0%;background:var(--green)"></div></div>
-        <div class="gauge-lbl" id="mem-gpct">--%</div>
-      </div>
-    </div>
-
-    <div class="card">
-      <div class="card-title">📡 Статус системы</div>
-      <div class="status-row"><div class="dot warn" id="sr-dot"></div><div class="status-lbl">HX711 датчик</div><div class="status-val" id="sr-val">…</div></div>
-      <div class="status-row"><div class="dot warn" id="wf-dot"></div><div class="status-lbl">Wi-Fi</div><div class="status-val" id="wf-val">…</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Веб-сервер</div><div class="status-val">Активен :80</div></div>
-      <div class="status-row"><div class="dot ok" id="sd-dot"></div><div class="status-lbl">Хранилище лог</div><div class="status-val" id="sd-val">--</div></div>
-      <div class="status-row"><div class="dot ok" id="heap-dot"></div><div class="status-lbl">Free Heap</div><div class="status-val" id="heap-val">--</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Пробуждений</div><div class="status-val" id="wkc-val">--</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Cal. Factor</div><div class="status-val" id="cf-val">--</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Offset</div><div class="status-val" id="ofs-val">--</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Дата/время</div><div class="status-val" id="dt-val">--</div></div>
-      <div class="status-row"><div class="dot ok"></div><div class="status-lbl">Uptime</div><div class="status-val" id="upt-val">--</div></div>
-    </div>
-
-    <div class="card full">
-      <div class="card-title">🐝 Информация об улье (сегодня)</div>
-      <div class="grid-auto">
-        <div class="info-tile"><div class="lbl">Сезон</div><div class="val" style="color:var(--amber)" id="hi-season">--</div></div>
-        <div class="info-tile"><div class="lbl">Вес мин / макс</div><div class="val" style="color:var(--green);font-size:12px" id="hi-wrange">--/-- кг</div></div>
-        <div class="info-tile"><div class="lbl">Темп мин / макс</div><div class="val" style="color:var(--blue);font-size:12px" id="hi-trange">--/-- °C</div></div>
-        <div class="info-tile"><div class="lbl">Изменение за день</div><div class="val" id="hi-delta">-- кг</div></div>
-        <div class="info-tile"><div class="lbl">Точек сегодня</div><div class="val" style="color:var(--text2)" id="hi-count">--</div></div>
-        <div class="info-tile"><div class="lbl">Дней наблюдений</div><div class="val" style="color:var(--text2)" id="hi-days">--</div></div>
-      </div>
-    </div>
-
-    <div class="card full">
-      <div class="card-title">
-        📈 Мини-график
-        <span onclick="nav('chart')">[открыть полный →]</span>
-      </div>
-      <div class="chart-container" style="height:350px">
-        <div class="tip" id="tip-mini"></div>
-        <svg id="mini-svg" class="chart-svg" viewBox="0 0 900 350" preserveAspectRatio="xMidYMid meet"
-             onmousemove="onTip(event,'mini')" onmouseleave="hideTip('mini')">
-          <text x="450" y="130" text-anchor="middle" fill="#506040" font-size="12">Загрузка...</text>
-        </svg>
-      </div>
-    </div>
-
-
-  </div>
-</div>
-
-<!-- ═══════════════ CHART + EXPORT ═══════════════ -->
-<div class="section" id="sec-chart">
-
-  <!-- Верхняя панель управления графиком -->
-  <div class="card" style="margin-bottom:10px">
-    <div style="display:flex;justify-content:space-between;align-items:center;flex-wrap:wrap;gap:8px;margin-bottom:10px">
-      <div class="period-tabs" style="margin:0">
-        <button class="period-btn active" onclick="setPeriod(1,this)">1ч</button>
-        <button class="period-btn" onclick="setPeriod(6,this)">6ч</button>
-        <button class="period-btn" onclick="setPeriod(24,this)">24ч</button>
-        <button class="period-btn" onclick="setPeriod(72,this)">3д</button>
-        <button class="period-btn" onclick="setPeriod(168,this)">7д</button>
-        <button class="period-btn" onclick="setPeriod(0,this)">Всё</button>
-      </div>
-      <div class="series-btns">
-        <button class="ser-btn s-w active" id="sb-w" onclick="toggleSeries('w',this)">⚖ Вес</button>
-        <button class="ser-btn s-t active" id="sb-t" onclick="toggleSeries('t',this)">🌡 Темп</button>
-        <button class="ser-btn s-b active" id="sb-b" onclick="toggleSeries('b',this)">🔋 Батарея</button>
-      </div>
-    </div>
-
-    <!-- График веса -->
-    <div class="chart-container" id="cwrap-w" style="height:280px;margin-bottom:20px">
-      <div class="tip" id="tip-w"></div>
-      <div style="font-size:13px;color:var(--text3);margin-bottom:4px">
-        Мин: <b id="c-wmin" style="color:var(--amber)">--</b> &nbsp;
-        Макс: <b id="c-wmax" style="color:var(--amber)">--</b> &nbsp;
-        Среднее: <b id="c-wavg" style="color:var(--amber)">--</b> кг &nbsp;
-        Точек: <b id="c-pts">0</b>
-      </div>
-      <svg id="chart-w" class="chart-svg" viewBox="0 0 900 260" preserveAspectRatio="xMidYMid meet"
-           onmousemove="onTip(event,'w')" onmouseleave="hideTip('w')">
-        <text x="450" y="120" text-anchor="middle" fill="#506040" font-size="12">Загрузка...</text>
-      </svg>
-    </div>
-
-    <!-- График температуры -->
-    <div class="chart-container" id="cwrap-t" style="height:280px;margin-bottom:20px;border-top:1px solid var(--border);padding-top:14px">
-      <div class="tip" id="tip-t"></div>
-      <div style="font-size:13px;color:var(--text3);margin-bottom:4px">
-        Темп мин: <b id="c-tmin" style="color:var(--blue)">--</b> &nbsp;
-        Макс: <b id="c-tmax" style="color:var(--blue)">--</b> °C
-      </div>
-      <svg id="chart-t" class="chart-svg" viewBox="0 0 900 260" preserveAspectRatio="xMidYMid meet"
-           onmousemove="onTip(event,'t')" onmouseleave="hideTip('t')">
-        <text x="450" y="120" text-anchor="middle" fill="#506040" font-size="12">Загрузка...</text>
-      </svg>
-    </div>
-
-    <!-- График батареи -->
-    <div class="chart-container" id="cwrap-b" style="height:280px;border-top:1px solid var(--border);padding-top:14px">
-      <div class="tip" id="tip-b"></div>
-      <svg id="chart-b" class="chart-svg" viewBox="0 0 900 260" preserveAspectRatio="xMidYMid meet"
-           onmousemove="onTip(event,'b')" onmouseleave="hideTip('b')">
-        <text x="450" y="120" text-anchor="middle" fill="#506040" font-size="12">Загрузка...</text>
-      </svg>
-    </div>
-  </div>
-
-  <!-- ── Панель экспорта ── -->
-  <div class="exp-panel">
-    <div class="exp-panel-title">⬇ Экспорт данных</div>
-
-    <div class="exp-date-row">
-      <div class="form-row"><label>С даты</label><input type="date" id="exp-from"></div>
-      <div class="form-row"><label>По дату</label><input type="date" id="exp-to"></div>
-    </div>
-
-    <div style="display:flex;gap:20px;flex-wrap:wrap;margin-bottom:12px">
-      <div>
-        <div style="font-size:12px;letter-spacing:1px;color:var(--text3);text-transform:uppercase;margin-bottom:6px">Столбцы</div>
-        <div class="exp-cols">
-          <label class="exp-col-item"><input type="checkbox" id="col-dt" checked> Дата/время</label>
-          <label class="exp-col-item"><input type="checkbox" id="col-w"  checked> Вес (кг)</label>
-          <label class="exp-col-item"><input type="checkbox" id="col-t"  checked> Температура (°C)</label>
-          <label class="exp-col-item"><input type="checkbox" id="col-h"> Влажность (%)</label>
-          <label class="exp-col-item"><input type="checkbox" id="col-bat"> Батарея (В)</label>
-        </div>
-      </div>
-      <div>
-        <div style="font-size:12px;letter-spacing:1px;color:var(--text3);text-transform:uppercase;margin-bottom:6px">Листы Excel</div>
-        <div style="font-size:13px;color:var(--text3);line-height:1.9">
-          ✓ «Данные» — все записи<br>
-          ✓ «Статистика» — мин/макс/среднее<br>
-          ✓ «Дневные итоги» — группировка
-        </div>
-      </div>
-      <div>
-        <div style="font-size:12px;letter-spacing:1px;color:var(--text3);text-transform:uppercase;margin-bottom:6px">Прямое скачивание с SD</div>
-        <div class="btn-row" style="margin:0;flex-direction:column;gap:6px">
-          <button class="btn btn-green" style="width:100%" onclick="window.open('/api/log','_blank')">📥 Весь CSV (SD-карта)</button>
-          <div style="display:flex;gap:6px">
-            <input type="date" id="exp-date-sd" style="flex:1;padding:5px 8px">
-            <button class="btn btn-amber" onclick="dlSdDate()">📥 За дату</button>
-          </div>
-        </div>
-      </div>
-    </div>
-
-    <div class="btn-row">
-      <button class="btn btn-green" onclick="exportExcel()">📊 Скачать Excel (.xlsx)</button>
-      <button class="btn btn-amber" onclick="exportCsv()">📄 Скачать CSV</button>
-      <button class="btn btn-blue"  onclick="previewExport()">👁 Предпросмотр</button>
-      <button class="btn btn-red"   onclick="if(confirm('Очистить лог?'))doApi('/api/log/clear')">🗑 Очистить лог</button>
-    </div>
-
-    <div id="preview-wrap" style="display:none">
-      <div style="font-size:12px;color:var(--text3);margin-top:10px;letter-spacing:1px;text-transform:uppercase">
-        Предпросмотр (последние 10 строк)
-      </div>
-      <div class="prev-wrap">
-        <table class="prev-table" id="prev-table"></table>
-      </div>
-    </div>
-  </div>
-</div>
-
-<!-- ═══════════════ WIFI ═══════════════ -->
-<div class="section" id="sec-wifi">
-  <div class="grid">
-
-    <!-- Режим подключения -->
-    <div class="card">
-      <div class="card-title">📶 Режим подключения</div>
-      <div class="wm-opts">
-        <div class="wm-opt sel" id="wopt-ap" onclick="selWm(0)">
-          <input type="radio" name="wm" checked>
-          <div class="wm-opt-body">
-            <b>📡 Точка доступа (AP)</b>
-            <small>Устройство создаёт свою сеть<br>SSID: BeehiveScale<br>IP: 192.168.4.1</small>
-          </div>
-        </div>
-        <div class="wm-opt" id="wopt-sta" onclick="selWm(1)">
-          <input type="radio" name="wm">
-          <div class="wm-opt-body">
-            <b>🌐 Роутер (STA)</b>
-            <small>Подключение к домашнему Wi-Fi<br>IP: назначает роутер (DHCP)<br>NTP и Telegram доступны</small>
-          </div>
-        </div>
-      </div>
-      <div id="sta-block" style="display:none">
-        <div class="form-row"><label>SSID роутера</label><input type="text" id="wifi-ssid" placeholder="Название вашей Wi-Fi сети" maxlength="32" autocomplete="off"></div>
-        <div class="form-row"><label>Пароль роутера</label><input type="password" id="wifi-pass" placeholder="Пароль (оставьте пустым чтобы не менять)" maxlength="32" autocomplete="new-password"></div>
-      </div>
-      <div class="btn-row">
-        <button class="btn btn-green" onclick="saveWifi()">💾 Сохранить и перезагрузить</button>
-        <button class="btn btn-blue"  onclick="doApi('/api/ntp')">🕐 NTP Время</button>
-      </div>
-      <div style="font-size:13px;color:var(--text3);margin-top:10px;line-height:1.7">
-        <b style="color:var(--amber)">AP режим:</b> прямое подключение к устройству → 192.168.4.1<br>
-        <b style="color:var(--amber)">STA режим:</b> устройство в вашей сети → доступен NTP и Telegram
-      </div>
-    </div>
-
-    <!-- Смена паролей -->
-    <div class="card">
-      <div class="card-title">🔒 Пароли и доступ</div>
-
-      <!-- Пароль AP точки доступа -->
-      <div style="margin-bottom:14px">
-        <div style="font-size:13px;color:var(--text2);margin-bottom:8px;font-weight:600">Пароль сети AP (BeehiveScale)</div>
-        <div class="form-row" style="margin-bottom:6px">
-          <label>Новый пароль (8–23 символа)</label>
-          <input type="password" id="ap-pass-new" placeholder="••••••••" maxlength="23" autocomplete="new-password" oninput="checkPassStrength('ap-pass-new','ap-pass-str')">
-          <div class="pass-strength" id="ap-pass-str"></div>
-        </div>
-        <div class="form-row" style="margin-bottom:6px">
-          <label>Повтор пароля</label>
-          <input type="password" id="ap-pass-confirm" placeholder="••••••••" maxlength="23" autocomplete="new-password">
-        </div>
-        <button class="btn btn-amber" onclick="saveApPass()">🔑 Сменить пароль AP</button>
-        <div style="font-size:13px;color:var(--text3);margin-top:6px">
-          Применится после перезагрузки. После смены подключайтесь к AP с новым паролем.
-        </div>
-      </div>
-
-      <!-- Пароль веб-интерфейса -->
-      <div class="pass-section">
-        <div style="font-size:13px;color:var(--text2);margin-bottom:8px;font-weight:600">Веб-авторизация</div>
-        <div style="font-size:13px;color:var(--text3);line-height:1.8">
-          Логин: <b style="color:var(--text)">admin</b><br>
-          Пароль: <b style="color:var(--text)">beehive</b> (по умолчанию)<br>
-          <span style="color:#3d5030">Изменить пароль веб-интерфейса можно только в прошивке:<br>
-          файл <code style="color:var(--amber)">WebServerModule.h</code> → <code style="color:var(--amber)">WEB_ADMIN_PASS</code></span>
-        </div>
-      </div>
-    </div>
-
-  </div>
-</div>
-
-<!-- ═══════════════ SETTINGS ═══════════════ -->
-<div class="section" id="sec-settings">
-  <div class="grid">
-    <div class="card">
-      <div class="card-title">⚙ Параметры устройства</div>
-      <div class="form-row"><label>Порог тревоги Telegram (кг, 0.1–10)</label><input type="number" id="cfg-alert" step="0.1" min="0.1" max="10" placeholder="0.5"></div>
-      <div class="form-row"><label>Эталонный груз калибровки (г, 100–5000)</label><input type="number" id="cfg-calib" step="100" min="100" max="5000" placeholder="1000"></div>
-      <div class="form-row"><label>EMA сглаживание α (0.05–0.9)</label><input type="number" id="cfg-ema" step="0.05" min="0.05" max="0.9" placeholder="0.1"></div>
-      <div class="form-row"><label>Deep Sleep интервал (сек, 30–86400)</label><input type="number" id="cfg-sleep" step="60" min="30" max="86400" placeholder="900"></div>
-      <div class="form-row"><label>Расписание замеров (HH:MM через пробел, до 8 времён)</label><input type="text" id="cfg-sched" placeholder="08:00 14:00 20:00" maxlength="60"></div>
-      <div class="form-row"><label>Таймаут подсветки LCD (сек, 0=всегда)</label><input type="number" id="cfg-bl" step="10" min="0" max="3600" placeholder="30"></div>
-      <div class="btn-row">
-        <button class="btn btn-green" onclick="saveSettings()">💾 Сохранить</button>
-        <button class="btn btn-blue"  onclick="loadConfig()">↺ Загрузить</button>
-        <button class="btn btn-red"   onclick="if(confirm('Перезагрузить ESP?'))doApi('/api/reboot')">↺ Перезагрузить</button>
-      </div>
-    </div>
-    <div class="card">
-      <div class="card-title">ℹ Описание</div>
-      <div style="font-size:13px;color:var(--text3);line-height:2">
-        <b style="color:var(--amber)">Порог тревоги</b> — изменение веса для уведомления в Telegram (роение, кража).<br>
-        <b style="color:var(--amber)">Эталонный груз</b> — масса гири при калибровке HX711.<br>
-        <b style="color:var(--amber)">EMA α</b> — коэффициент фильтра: меньше = плавнее, медленнее реакция.<br>
-        <b style="color:var(--amber)">Deep Sleep</b> — интервал сна ESP. Используется если расписание не задано.<br>
-        <b style="color:var(--amber)">Расписание</b> — конкретные времена пробуждения и записи лога (напр. 08:00 14:00 20:00). Если задано — приоритет над интервалом. Пустое поле = только интервал.<br>
-        <b style="color:var(--amber)">Подсветка LCD</b> — 0 = всегда включена; иначе — таймаут без нажатий.
-      </div>
-    </div>
-    <div class="card full">
-      <div class="card-title">💾 Бэкап и восстановление</div>
-      <div style="font-size:13px;color:var(--text3);margin-bottom:12px;line-height:1.7">
-        Скачайте полный бэкап всех настроек (калибровка, WiFi, Telegram, настройки).<br>
-        При каждом сохранении настроек бэкап автоматически копируется на SD-карту.
-      </div>
-      <div class="btn-row" style="gap:10px;flex-wrap:wrap">
-        <button class="btn btn-green" onclick="downloadBackup()">📥 Скачать бэкап</button>
-        <label class="btn btn-amber" style="cursor:pointer">📤 Загрузить бэкап<input type="file" id="backup-file" accept=".json" style="display:none" onchange="restoreBackup(this)"></label>
-        <button class="btn btn-blue" onclick="viewBackup()">👁 Просмотр</button>
-      </div>
-      <pre id="backup-preview" style="display:none;font-size:12px;color:var(--text2);line-height:1.5;margin-top:10px;max-height:200px;overflow:auto;background:var(--bg);padding:8px;border:1px solid var(--border)"></pre>
-    </div>
-  </div>
-</div>
-
-<!-- ═══════════════ CALIBRATION ═══════════════ -->
-<div class="section" id="sec-calib">
-  <div class="grid">
-    <div class="card">
-      <div class="card-title">🧙 Мастер калибровки</div>
-      <div class="wiz-steps">
-        <div class="wiz-step active" id="ws0">1</div>
-        <div class="wiz-step" id="ws1">2</div>
-        <div class="wiz-step" id="ws2">3</div>
-        <div class="wiz-step" id="ws3">4</div>
-        <div class="wiz-step" id="ws4">✓</div>
-      </div>
-      <div class="wiz-body" id="wiz-body"></div>
-      <div class="wiz-actions">
-        <button class="btn btn-amber" id="wiz-btn" onclick="wizNext()">Далее →</button>
-        <button class="btn btn-red" onclick="wizReset()">↺ Сначала</button>
-        <span class="wiz-cur-w">Текущий вес: <b id="wiz-w" style="color:var(--amber)">--</b> кг</span>
-      </div>
-    </div>
-    <div class="card">
-      <div class="card-title">✏ Ручная калибровка</div>
-      <div class="form-row">
-        <label>Cal. Factor (текущий: <b id="cf-live" style="color:var(--amber)">--</b>)</label>
-        <input type="number" id="calib-cf" step="1" min="100" max="100000" placeholder="напр. 2280">
-      </div>
-      <div class="form-row">
-        <label>Offset (текущий: <b id="ofs-live" style="color:var(--amber)">--</b>)</label>
-        <input type="number" id="calib-ofs" step="1" placeholder="обычно не меняется">
-      </div>
-      <div class="btn-row">
-        <button class="btn btn-amber" onclick="applyCalib()">✓ Применить</button>
-        <button class="btn btn-blue"  onclick="doApi('/api/tare')">⊘ Тара</button>
-        <button class="btn btn-green" onclick="doApi('/api/save')">💾 Сохранить эталон</button>
-      </div>
-      <div style="font-size:13px;color:var(--text3);margin-top:10px;line-height:1.7">
-        Подберите Cal.Factor так, чтобы показание<br>совпало с реальной массой эталонного груза.
-      </div>
-    </div>
-  </div>
-</div>
-
-<!-- ═══════════════ TELEGRAM ═══════════════ -->
-<div class="section" id="sec-tg">
-  <div class="grid">
-    <div class="card">
-      <div class="card-title">✉ Telegram Bot</div>
-      <div class="form-row"><label>Bot Token (получить у @BotFather)</label><input type="password" id="tg-token" placeholder="123456789:ABC..." autocomplete="off"></div>
-      <div class="form-row"><label>Chat ID (узнать через @userinfobot)</label><input type="text" id="tg-chatid" placeholder="-100123456789"></div>
-      <div class="form-row"><label>Интервал отчётов (мин, 0=откл, 360=6ч, 1440=раз в день)</label><input type="number" id="tg-report-int" min="0" max="10080" step="60" placeholder="360"></div>
-      <div class="btn-row">
-        <button class="btn btn-green" onclick="saveTelegram()">💾 Сохранить</button>
-        <button class="btn btn-blue"  onclick="doApi('/api/tg/test')">✉ Тест</button>
-      </div>
-    </div>
-    <div class="card">
-      <div class="card-title">🔔 Триггеры уведомлений</div>
-      <div style="font-size:11px;color:var(--text3);line-height:2.1">
-        ✓ Резкое изменение веса (порог: <b id="tg-thresh" style="color:var(--amber)">-- кг</b>)<br>
-        ✓ Роение — быстрая потеря веса<br>
-        ✓ Кража — резкое изменение<br>
-        ✓ Низкий заряд батареи (&lt; 3.5 В)<br>
-        ✓ Восстановление соединения<br>
-        ✓ Тестовое сообщение (кнопка Тест)
-      </div>
-      <div style="font-size:13px;color:var(--text3);margin-top:10px;padding-top:10px;border-top:1px solid var(--border)">
-        Для работы Telegram нужен режим Wi-Fi <b style="color:var(--amber)">STA</b> (подключение к роутеру)
-      </div>
-    </div>
-  </div>
-</div>
-
-<!-- ═══════════════ API ═══════════════ -->
-<div class="section" id="sec-api">
-  <div class="card" style="margin-bottom:10px">
-    <div class="card-title">🔌 REST API эндпоинты</div>
-    <div class="api-grid">
-      <div class="api-item"><div class="api-method get">GET /api/data</div><div class="api-desc">Все показания (вес/темп/бат/статус)</div></div>
-      <div class="api-item"><div class="api-method get">GET /api/config</div><div class="api-desc">Конфигурация (alertDelta, ema, sleep…)</div></div>
-      <div class="api-item"><div class="api-method get">GET /api/log</div><div class="api-desc">Скачать лог CSV (опц. ?date=YYYY-MM-DD)</div></div>
-      <div class="api-item"><div class="api-method get">GET /api/log/json</div><div class="api-desc">Лог в JSON (для Grafana/Home Assistant)</div></div>
-      <div class="api-item"><div class="api-method get">GET /api/daystat</div><div class="api-desc">Суточная статистика (опц. ?date=)</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/tare</div><div class="api-desc">Тарировка весов</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/save</div><div class="api-desc">Сохранить текущий вес как эталон</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/settings</div><div class="api-desc">Изменить настройки JSON {alertDelta…}</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/ntp</div><div class="api-desc">Синхронизация времени NTP</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/reboot</div><div class="api-desc">Перезагрузить ESP8266</div></div>
-      <div class="api-item"><div class="api-method del">POST /api/log/clear</div><div class="api-desc">Очистить лог на SD/Flash</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/tg/settings</div><div class="api-desc">Сохранить Telegram token/chatId</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/tg/test</div><div class="api-desc">Тестовое сообщение в Telegram</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/calib/set</div><div class="api-desc">Установить calibFactor / offset</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/wifi/settings</div><div class="api-desc">Режим Wi-Fi + SSID/пароль роутера</div></div>
-      <div class="api-item"><div class="api-method get">GET /api/backup</div><div class="api-desc">Скачать полный бэкап настроек (JSON)</div></div>
-      <div class="api-item"><div class="api-method post">POST /api/backup/restore</div><div class="api-desc">Восстановить настройки из JSON бэкапа</div></div>
-    </div>
-  </div>
-  <div class="card">
-    <div class="card-title">👁 Live /api/data
-      <button class="btn btn-blue" style="padding:2px 10px;font-size:12px" onclick="refreshApiView()">↺ Обновить</button>
-    </div>
-    <pre id="api-json" style="font-size:13px;color:var(--text2);line-height:1.6;overflow-x:auto;white-space:pre-wrap">Загрузка...</pre>
-  </div>
-</div>
-
-<div class="toast" id="toast"></div>
-
-<script>
-// ── Globals ─────────────────────────────────────────────────────────
-const REFRESH = 5000;
-let _start = Date.now();
-let _all = [];           // весь лог
-let _curWeight = 0;      // текущий вес для мини-графика
-let _periodH = 1;
-let _serVisible = {w:true, t:true, b:true};
-let _wizStep = 0;
-let _wifiMode = 0;
-// Данные для тултипов (по серии)
-let _tipPts = {};
-function esc(s){var d=document.createElement('div');d.textContent=String(s);return d.innerHTML;}
-
-// ── Nav ──────────────────────────────────────────────────────────────
-function nav(id) {
-  document.querySelectorAll('.section').forEach(s=>s.classList.remove('active'));
-  document.querySelectorAll('.tab').forEach(t=>t.classList.remove('active'));
-  document.getElementById('sec-'+id).classList.add('active');
-  const idx = {main:0,chart:1,wifi:2,settings:3,calib:4,tg:5,api:6};
-  document.querySelectorAll('.tab')[idx[id]].classList.add('active');
-  if (id==='chart') renderCharts();
-  if (id==='api')   refreshApiView();
-  if (id==='settings'||id==='tg') loadConfig();
-  if (id==='wifi') loadConfig();
-  if (id==='calib') { fetchData(); }   // немедленно обновить cf-live, ofs-live, wiz-w
-}
-
-// ── Refresh bar ───────────────────────────────────────────────────────
-const bar = document.getElementById('rbar');
-function tickBar() {
-  const pct = Math.max(0, 100-(Date.now()-_start)/REFRESH*100);
-  bar.style.width = pct+'%';
-  if (Date.now()-_start < REFRESH) requestAnimationFrame(tickBar);
-}
-tickBar();
-
-// ── Clock ─────────────────────────────────────────────────────────────
-(function tick() {
-  const t=new Date(), p=n=>String(n).padStart(2,'0');
-  document.getElementById('cur-time').textContent = p(t.getHours())+':'+p(t.getMinutes())+':'+p(t.getSeconds());
-  setTimeout(tick, 1000);
-})();
-
-// ── Toast ─────────────────────────────────────────────────────────────
-function toast(msg, err) {
-  const el = document.getElementById('toast');
-  el.textContent=msg; el.className='toast'+(err?' err':'')+' show';
-  setTimeout(()=>el.classList.remove('show'), 3500);
-}
-
-// ── API ───────────────────────────────────────────────────────────────
-function doApi(url) {
-  const method = (url.includes('/data')||(url.includes('/log')&&!url.includes('/clear'))||url.includes('/config')||url.includes('/daystat')||url.endsWith('/backup')) ? 'GET' : 'POST';
-  return fetch(url,{method}).then(r=>r.json()).then(d=>{
-    toast(d.msg||(d.ok?'OK':'Ошибка'), !d.ok); return d;
-  }).catch(()=>toast('Нет связи',true));
-}
-
-// ── Fetch /api/data ───────────────────────────────────────────────────
-function fetchData() {
-  fetch('/api/data').then(r=>r.json()).then(updDash).catch(()=>{});
-  fetch('/api/daystat').then(r=>r.json()).then(updHive).catch(()=>{});
-  loadLog();
-}
-
-function updDash(d) {
-  const w = parseFloat(d.weight)||0;
-  _curWeight = w;
-  setText('w-val', w.toFixed(3)+'<span class="val-unit">кг</span>', true);
-  setText('w-ref', parseFloat(d.ref||0).toFixed(3));
-  const dw = w-parseFloat(d.ref||0);
-  const dwEl=document.getElementById('w-delta');
-  dwEl.textContent=(dw>=0?'+':'')+dw.toFixed(3);
-  dwEl.style.color=dw>0?'var(--green)':dw<0?'var(--red)':'var(--amber2)';
-  setGauge('w-gauge','w-gpct', Math.min(100,w/80*100), '', '%');
-
-  const t=parseFloat(d.temp), rtcT=parseFloat(d.rtcT||0);
-  if (!isNaN(t)&&t>-90) {
-    setText('t-val',t.toFixed(1)+'<span class="val-unit">°C</span>',true);
-    setGauge('t-gauge','t-gpct', Math.min(100,Math.max(0,(t+20)/70*100)), t.toFixed(1), '°C');
-  } else {
-    setText('t-val','---<span class="val-unit">°C</span>',true);
-    setGauge('t-gauge','t-gpct', 0, '---', '°C');
-  }
-  setText('h-val', parseFloat(d.hum||0).toFixed(0));
-  setText('rtc-val', rtcT.toFixed(1));
-
-  const bv=parseFloat(d.batV||0), bp=parseFloat(d.batPct||0);
-  setText('bat-v-big',bv.toFixed(2)+'<span class="val-unit">В</span>',true);
-  setText('bat-pct-v',bp.toFixed(0)+'%');
-  const bColor=bp<20?'var(--red)':bp<40?'var(--amber)':'var(--green)';
-  document.getElementById('bat-gauge').style.background=bColor;
-  setGauge('bat-gauge','bat-gpct',bp,'','%');
-
-  // Status
-  setDot('sr-dot',d.sensor,'ok','err'); setText('sr-val',d.sensor?'OK':'Ошибка');
-  setDot('wf-dot',d.wifi,'ok','warn'); setText('wf-val',d.wifi?'Подключён':'AP режим');
-  setText('wkc-val',d.wakeups||0);
-  setText('cf-val',parseFloat(d.cf||0).toFixed(0));
-  setText('ofs-val',d.offset||0);
-  setText('dt-val',d.datetime||'--');
-  setText('upt-val',d.uptime||'--');
-  const heap=parseInt(d.heap||0);
-  setText('heap-val',(heap/1024).toFixed(1)+' KB');
-  setDot('heap-dot',heap>5000,'ok','warn');
-  const sdKb=Math.round(parseInt(d.sdLog||0)/1024);
-  const freeKb=Math.round(parseInt(d.sdFree||0)/1024);
-  // Свободное место известно только при LittleFS (fallback); SD-библиотека его не отдаёт
-  const freeKnown=!!d.sdFallback;
-  const totalKb=freeKnown?sdKb+freeKb:0;
-  const memPct=totalKb>0?Math.min(100,sdKb/totalKb*100):0;
-  // Gauge памяти/лога
-  const mColor=memPct>90?'var(--red)':memPct>70?'var(--amber)':'var(--green)';
-  const memGauge=document.getElementById('mem-gauge');
-  if(memGauge){memGauge.style.background=mColor;setGauge('mem-gauge','mem-gpct',memPct,memPct.toFixed(0),'%');}
-  setText('mem-used',sdKb);setText('mem-total',freeKnown?totalKb:'?');
-  // Предупреждение: ФС не смонтирована
-  const fsOk=!!d.sdOk;
-  const sdDot=document.getElementById('sd-dot');
-  if(sdDot) sdDot.className='dot '+(fsOk?'ok':'err');
-  if(fsOk) setText('sd-val',sdKb+' KB / своб. '+(freeKnown?freeKb+' KB':'н/д'));
-  else setText('sd-val','⚠ ФС не доступна');
-
-  // Calib live
-  if (document.getElementById('cf-live')) setText('cf-live',parseFloat(d.cf||0).toFixed(0));
-  if (document.getElementById('ofs-live')) setText('ofs-live',d.offset||0);
-  if (document.getElementById('wiz-w')) setText('wiz-w',parseFloat(d.weight||0).toFixed(3));
-  // Автозаполнение поля CF текущим значением, если пользователь ещё не вводил своё
-  var cfInput=document.getElementById('calib-cf');
-  if(cfInput&&cfInput.value===''&&d.cf) cfInput.value=Math.round(parseFloat(d.cf||0));
-}
-
-function updHive(d) {
-  if (!d) return;
-  const s={Vesna:'🌸 Весна',Leto:'☀ Лето',Osen:'🍂 Осень',Zima:'❄ Зима'};
-  setText('hi-season',s[d.season]||d.season||'--');
-  if (d.valid) {
-    setText('hi-wrange',d.wMin.toFixed(2)+' / '+d.wMax.toFixed(2)+' кг');
-    if (!isNaN(d.tMin)) setText('hi-trange',d.tMin.toFixed(1)+' / '+d.tMax.toFixed(1)+' °C');
-    const dk=parseFloat(d.deltaKg||0);
-    const de=document.getElementById('hi-delta');
-    de.textContent=(dk>=0?'+':'')+dk.toFixed(3)+' кг';
-    de.style.color=dk>0?'var(--green)':dk<0?'var(--red)':'var(--text2)';
-    setText('hi-count',d.count||0);
-    setText('hi-days',d.daysSinceStart||0);
-  }
-}
-
-function setText(id,v,html) {
-  const el=document.getElementById(id);
-  if(!el)return;
-  if(html) el.innerHTML=v; else el.textContent=v;
-}
-function setGauge(gid,lid,pct,val,unit) {
-  const g=document.getElementById(gid),l=document.getElementById(lid);
-  if(g) g.style.width=pct.toFixed(0)+'%';
-  if(l) l.textContent=val+unit;
-}
-function setDot(id,ok,cOk,cBad) {
-  const el=document.getElementById(id);
-  if(el) el.className='dot '+(ok?cOk:cBad);
-}
-
-// ── Load log ──────────────────────────────────────────────────────────
-function loadLog() {
-  fetch('/api/log/json').then(r=>r.json()).then(data=>{
-    _all = data;
-    drawMini();
-    if (document.getElementById('sec-chart').classList.contains('active')) renderCharts();
-  }).catch(()=>{
-    drawMini();
-    if(document.getElementById('sec-chart').classList.contains('active')) renderCharts();
-  });
-}
-
-// ── Mini chart ────────────────────────────────────────────────────────
-function drawMini() {
-  const svg=document.getElementById('mini-svg');
-  if (!_all||_all.length<2) {
-    const wt=_curWeight>0?_curWeight.toFixed(3)+' кг':'--';
-    svg.innerHTML='<text x="450" y="120" text-anchor="middle" fill="#f5a623" font-size="28" font-weight="bold">'+wt+'</text>'+
-      '<text x="450" y="150" text-anchor="middle" fill="#506040" font-size="13">Лог пуст — нет данных для графика</text>';
-    return;
-  }
-  const pts=_all.slice(-120);
-  _tipPts.mini=pts;
-  drawLineSvg(svg,pts,'w','#f5a623',900,350,60,10,12,50,true);
-}
-
-// ── Chart page ────────────────────────────────────────────────────────
-function setPeriod(h,btn) {
-  _periodH=h;
-  document.querySelectorAll('.period-btn').forEach(b=>b.classList.remove('active'));
-  btn.classList.add('active');
-  renderCharts();
-}
-
-function toggleSeries(s,btn) {
-  _serVisible[s]=!_serVisible[s];
-  btn.classList.toggle('active',_serVisible[s]);
-  const wrap=document.getElementById('cwrap-'+s);
-  if(wrap) wrap.style.display=_serVisible[s]?'':'none';
-  renderCharts();
-}
-
-function filterPts() {
-  if (!_periodH) return _all;
-  const cutoff=Date.now()-_periodH*3600000;
-  const f=_all.filter(d=>{
-    const m=d.dt&&d.dt.match(/(\d{2})\.(\d{2})\.(\d{4})\s+(\d{2}):(\d{2}):(\d{2})/);
-    if(m) return new Date(+m[3],+m[2]-1,+m[1],+m[4],+m[5],+m[6]).getTime()>=cutoff;
-    return true;
-  });
-  // Возвращаем fallback если точек меньше 2 (drawLineSvg требует ≥2 точки)
-  if (f.length < 2) {
-    const n=_periodH===1?60:_periodH===6?360:_periodH*60;
-    return _all.slice(-Math.min(n,_all.length));
-  }
-  return f;
-}
-
-function renderCharts() {
-  if (!_all.length) {
-    [{id:'chart-w',cy:120},{id:'chart-t',cy:90},{id:'chart-b',cy:70}].forEach(function(s){
-      var svg=document.getElementById(s.id);
-      if(svg) svg.innerHTML='<text x="450" y="'+s.cy+'" text-anchor="middle" fill="#506040" font-size="13">Нет данных</text>';
-    });
-    return;
-  }
-  const pts=filterPts();
-  if (!pts.length) return;
-  _tipPts={};
-
-  if (_serVisible.w) {
-    _tipPts.w=pts;
-    const ws=pts.map(d=>parseFloat(d.w)).filter(v=>!isNaN(v));
-    const mn=ws.reduce((a,b)=>a<b?a:b),mx=ws.reduce((a,b)=>a>b?a:b),av=ws.reduce((a,b)=>a+b,0)/ws.length;
-    setText('c-wmin',mn.toFixed(3)); setText('c-wmax',mx.toFixed(3));
-    setText('c-wavg',av.toFixed(3)); setText('c-pts',pts.length);
-    drawLineSvg(document.getElementById('chart-w'),pts,'w','#f5a623',900,260,60,10,12,42,true);
-  }
-  if (_serVisible.t) {
-    _tipPts.t=pts;
-    const ts=pts.map(d=>parseFloat(d.t)).filter(v=>!isNaN(v)&&v>-90);
-    if(ts.length){setText('c-tmin',ts.reduce((a,b)=>a<b?a:b).toFixed(1));setText('c-tmax',ts.reduce((a,b)=>a>b?a:b).toFixed(1));}
-    drawLineSvg(document.getElementById('chart-t'),pts,'t','#56ccf2',900,260,60,10,12,42,true);
-  }
-  if (_serVisible.b) {
-    _tipPts.b=pts;
-    drawLineSvg(document.getElementById('chart-b'),pts,'b','#6fcf97',900,260,60,10,12,42,true);
-  }
-}
-
-// ── Universal SVG line drawing ────────────────────────────────────────
-function drawLineSvg(svg,pts,key,color,W,H,L,R,T,B,showAxes) {
-  const pW=W-L-R, pH=H-T-B;
-  const vals=pts.map(d=>parseFloat(d[key])).filter(v=>!isNaN(v)&&v>-90);
-  if (vals.length<2) { svg.innerHTML=`<text x="${W/2}" y="${H/2}" text-anchor="middle" fill="#506040" font-size="13">Нет данных</text>`; return; }
-  // Для температуры и батареи: игнорируем нули при расчёте шкалы (0 = датчик не работал / USB)
-  let scaleVals=(key==='t'||key==='b')?vals.filter(v=>v>0.05):vals;
-  if(scaleVals.length<2) scaleVals=vals;
-  let mn=scaleVals.reduce((a,b)=>a<b?a:b),mx=scaleVals.reduce((a,b)=>a>b?a:b);
-  // Добавляем 5% padding сверху/снизу чтобы линия не прилипала к краям
-  const range=mx-mn||1;
-  mn-=range*0.05; mx+=range*0.05;
-  if(mx===mn){mn-=0.5;mx+=0.5;}
-  const xS=i=>L+i/(pts.length-1||1)*pW;
-  const yS=v=>T+pH-(v-mn)/(mx-mn)*pH;
-  let html='';
-  // grid — 6 горизонтальных линий для лучшей читаемости
-  const yLines=6;
-  for(let k=0;k<=yLines;k++){
-    const v=mn+(mx-mn)*k/yLines,y=yS(v);
-    html+=`<line x1="${L}" y1="${y.toFixed(1)}" x2="${W-R}" y2="${y.toFixed(1)}" stroke="#1a201a" stroke-width="1"/>`;
-    if(showAxes) {
-      const dec=key==='b'?2:key==='t'?1:3;
-      html+=`<text x="${L-5}" y="${(y+4).toFixed(1)}" text-anchor="end" fill="#506040" font-size="12">${v.toFixed(dec)}</text>`;
-    }
-  }
-  // x labels — 5-7 меток равномерно
-  if(showAxes && pts.length>1){
-    const xCount=Math.min(7,pts.length);
-    for(let n=0;n<xCount;n++){
-      const i=Math.round(n*(pts.length-1)/(xCount-1));
-      const x=xS(i),lbl=pts[i].dt?pts[i].dt.substring(11,16):'';
-      const a=n===0?'start':n===xCount-1?'end':'middle';
-      html+=`<line x1="${x.toFixed(1)}" y1="${T}" x2="${x.toFixed(1)}" y2="${T+pH}" stroke="#181d18" stroke-dasharray="3,3" stroke-width="1"/>`;
-      html+=`<text x="${x.toFixed(1)}" y="${H-B+16}" text-anchor="${a}" fill="#506040" font-size="11">${lbl}</text>`;
-    }
-    // date labels at edges — под осью X, не наложение на время
-    const d0=pts[0].dt?pts[0].dt.substring(0,10):'';
-    const d1=pts[pts.length-1].dt?pts[pts.length-1].dt.substring(0,10):'';
-    if(d0) html+=`<text x="${L}" y="${H-B+28}" text-anchor="start" fill="#3d5030" font-size="9">${d0}</text>`;
-    if(d1&&d1!==d0) html+=`<text x="${W-R}" y="${H-B+28}" text-anchor="end" fill="#3d5030" font-size="9">${d1}</text>`;
-  }
-  // axes
-  if(showAxes){
-    html+=`<line x1="${L}" y1="${T}" x2="${L}" y2="${T+pH}" stroke="#506040" stroke-width="1.5"/>`;
-    html+=`<line x1="${L}" y1="${T+pH}" x2="${W-R}" y2="${T+pH}" stroke="#506040" stroke-width="1.5"/>`;
-  }
-  // area + line
-  let area='',line='',li=-1;
-  for(let i=0;i<pts.length;i++){
-    const v=parseFloat(pts[i][key]);
-    if(isNaN(v)||v<=-90) continue;
-    if((key==='t'||key==='b')&&Math.abs(v)<0.05&&scaleVals!==vals) continue;
-    const xx=xS(i).toFixed(1),yy=yS(v).toFixed(1);
-    if(li<0){area=`M ${xx} ${T+pH}`;line=`M ${xx} ${yy}`;}
-    else{area+=` L ${xx} ${yy}`;line+=` L ${xx} ${yy}`;}
-    li=i;
-  }
-  if(li>=0){
-    area+=` L ${xS(li).toFixed(1)} ${T+pH} Z`;
-    html+=`<path d="${area}" fill="${color}18" stroke="none"/>`;
-    html+=`<path d="${line}" fill="none" stroke="${color}" stroke-width="2"/>`;
-    const lv=parseFloat(pts[li][key]);
-    html+=`<circle cx="${xS(li).toFixed(1)}" cy="${yS(lv).toFixed(1)}" r="4" fill="${color}"/>`;
-  }
-  svg.innerHTML=html;
-}
-
-// ── Tooltip ───────────────────────────────────────────────────────────
-function onTip(e,s){
-  const pts=_tipPts[s];
-  if(!pts||!pts.length) return;
-  const key={w:'w',t:'t',b:'b',mini:'w'}[s];
-  const color={w:'var(--amber)',t:'var(--blue)',b:'var(--green)',mini:'var(--amber)'}[s];
-  const unit={w:' кг',t:' °C',b:' В',mini:' кг'}[s];
-  const W=900,L=60,R=10;
-  const pW=W-L-R;
-  const svg=e.currentTarget, rect=svg.getBoundingClientRect();
-  const svgX=(e.clientX-rect.left)/rect.width*W;
-  let best=-1,bestD=9999;
-  for(let i=0;i<pts.length;i++){const x=L+i/(pts.length-1||1)*pW,d=Math.abs(x-svgX);if(d<bestD){bestD=d;best=i;}}
-  if(best<0||bestD>pW/pts.length*3){hideTip(s);return;}
-  const p=pts[best], v=parseFloat(p[key]);
-  const tip=document.getElementById('tip-'+s);
-  tip.innerHTML=`<b style="color:${color}">${isNaN(v)||v<=-90?'--':v.toFixed(key==='b'?3:2)+unit}</b><br>${esc(p.dt||'')}`;
-  tip.style.display='';
-  let tx=(e.clientX-rect.left)+10, ty=(e.clientY-rect.top)-48;
-  if(tx+140>rect.width) tx=(e.clientX-rect.left)-150;
-  if(ty<0) ty=10;
-  tip.style.left=tx+'px'; tip.style.top=ty+'px';
-}
-function hideTip(s){const el=document.getElementById('tip-'+s);if(el)el.style.display='none';}
-
-// ── Export ────────────────────────────────────────────────────────────
-function getExpData() {
-  let data=_all;
-  const from=document.getElementById('exp-from').value;
-  const to=document.getElementById('exp-to').value;
-  if(from||to) data=data.filter(d=>{
-    if(!d.dt) return true;
-    const m=d.dt.match(/(\d{2})\.(\d{2})\.(\d{4})/);
-    if(!m) return true;
-    const ds=`${m[3]}-${m[2]}-${m[1]}`;
-    return (!from||ds>=from)&&(!to||ds<=to);
-  });
-  const cols=[];
-  if(document.getElementById('col-dt').checked)  cols.push({k:'dt',h:'Дата/время'});
-  if(document.getElementById('col-w').checked)   cols.push({k:'w',h:'Вес, кг'});
-  if(document.getElementById('col-t').checked)   cols.push({k:'t',h:'Темп, °C'});
-  if(document.getElementById('col-h').checked)   cols.push({k:'h',h:'Влажность, %'});
-  if(document.getElementById('col-bat').checked) cols.push({k:'b',h:'Батарея, В'});
-  return {data,cols};
-}
-
-function exportCsv(){
-  const {data,cols}=getExpData();
-  let csv='\uFEFF'+cols.map(c=>c.h).join(';')+'\n';
-  data.forEach(d=>{csv+=cols.map(c=>d[c.k]||'').join(';')+'\n';});
-  dlBlob(new Blob([csv],{type:'text/csv;charset=utf-8'}),'beehive_log.csv');
-}
-
-function previewExport(){
-  const {data,cols}=getExpData();
-  let html=`<tr>${cols.map(c=>`<th>${esc(c.h)}</th>`).join('')}</tr>`;
-  data.slice(-10).forEach(d=>{html+=`<tr>${cols.map(c=>`<td>${esc(d[c.k]||'')}</td>`).join('')}</tr>`;});
-  document.getElementById('prev-table').innerHTML=html;
-  document.getElementById('preview-wrap').style.display='block';
-}
-
-function exportExcel(){
-  if(typeof XLSX==='undefined'){
-    const s=document.createElement('script');
-    s.src='https://cdnjs.cloudflare.com/ajax/libs/xlsx/0.18.5/xlsx.full.min.js';
-    s.onload=_doExcel; s.onerror=()=>toast('Excel недоступен (нет интернета/AP режим)',true); document.head.appendChild(s);
-  } else _doExcel();
-}
-function _doExcel(){
-  const {data,cols}=getExpData();
-  const rows=data.map(d=>{const r={};cols.forEach(c=>{r[c.h]=d[c.k]||'';});return r;});
-  const ws=XLSX.utils.json_to_sheet(rows);
-  const vals=data.map(d=>parseFloat(d.w)).filter(v=>!isNaN(v));
-  const stat=[['Параметр','Значение'],['Записей',data.length],
-    ['Мин вес',vals.length?vals.reduce((a,b)=>a<b?a:b).toFixed(3):''],
-    ['Макс вес',vals.length?vals.reduce((a,b)=>a>b?a:b).toFixed(3):''],
-    ['Среднее', vals.length?(vals.reduce((a,b)=>a+b,0)/vals.length).toFixed(3):'']];
-  const ws2=XLSX.utils.aoa_to_sheet(stat);
-  const days={};
-  data.forEach(d=>{const k=d.dt?d.dt.substring(0,10):'?';if(!days[k])days[k]={mn:999,mx:-999,n:0};const v=parseFloat(d.w);if(!isNaN(v)){days[k].mn=Math.min(days[k].mn,v);days[k].mx=Math.max(days[k].mx,v);days[k].n++;}});
-  const ws3=XLSX.utils.aoa_to_sheet([['Дата','Мин кг','Макс кг','Точек'],...Object.entries(days).map(([k,v])=>[k,v.mn.toFixed(3),v.mx.toFixed(3),v.n])]);
-  const wb=XLSX.utils.book_new();
-  XLSX.utils.book_append_sheet(wb,ws,'Данные');
-  XLSX.utils.book_append_sheet(wb,ws2,'Статистика');
-  XLSX.utils.book_append_sheet(wb,ws3,'Дневные итоги');
-  XLSX.writeFile(wb,'beehive_log.xlsx');
-}
-
-function dlBlob(blob,name){const a=document.createElement('a');const u=URL.createObjectURL(blob);a.href=u;a.download=name;a.click();setTimeout(()=>URL.revokeObjectURL(u),5000);}
-function dlSdDate(){const d=document.getElementById('exp-date-sd').value;if(!d){toast('Выберите дату',true);return;}window.open('/api/log?date='+d,'_blank');}
-
-// ── Backup ─────────────────────────────────────────────────────────────
-function downloadBackup(){window.open('/api/backup','_blank');}
-function viewBackup(){
-  fetch('/api/backup').then(r=>r.json()).then(d=>{
-    const el=document.getElementById('backup-preview');
-    el.textContent=JSON.stringify(d,null,2);
-    el.style.display=el.style.display==='none'?'block':'none';
-  }).catch(()=>toast('Нет связи',true));
-}
-function restoreBackup(inp){
-  const file=inp.files[0];
-  if(!file){return;}
-  if(!file.name.endsWith('.json')){toast('Нужен .json файл',true);inp.value='';return;}
-  const reader=new FileReader();
-  reader.onload=function(e){
-    let json;
-    try{json=JSON.parse(e.target.result);}catch(ex){toast('Ошибка: не JSON',true);inp.value='';return;}
-    if(json._type!=='BeehiveScale_backup'){toast('Неверный формат бэкапа',true);inp.value='';return;}
-    if(!confirm('Восстановить ВСЕ настройки из бэкапа?\n(калибровка, WiFi, Telegram, параметры)\n\nТекущие настройки будут перезаписаны!')){inp.value='';return;}
-    fetch('/api/backup/restore',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(json)})
-      .then(r=>r.json()).then(d=>{toast(d.msg||'OK',!d.ok);if(d.ok)loadConfig();}).catch(()=>toast('Нет связи',true));
-  };
-  reader.readAsText(file);
-  inp.value='';
-}
-
-// ── Load config ───────────────────────────────────────────────────────
-function loadConfig(){
-  fetch('/api/config').then(r=>r.json()).then(d=>{
-    const setV=(id,v)=>{const el=document.getElementById(id);if(el&&v!==undefined)el.value=v;};
-    setV('cfg-alert',d.alertDelta); setV('cfg-calib',d.calibWeight);
-    setV('cfg-ema',d.emaAlpha);     setV('cfg-sleep',d.sleepSec);
-    setV('cfg-bl',d.lcdBlSec);
-    setV('cfg-sched',(d.schedTimes&&d.schedTimes.length>0)?d.schedTimes.join(' '):'');
-    // Токен НЕ заполняем в input — он замаскирован звёздочками, а placeholder покажет статус
-    if(d.tgTokenSet){document.getElementById('tg-token').placeholder='Токен задан (оставьте пустым чтобы не менять)';}
-    setV('tg-chatid',d.tgChatId);
-    if(d.tgReportInt!==undefined) setV('tg-report-int',d.tgReportInt);
-    if(d.alertDelta) setText('tg-thresh',d.alertDelta+' кг');
-    selWm(parseInt(d.wifiMode||0),true);
-    if(d.wifiSsid) setV('wifi-ssid',d.wifiSsid);
-  }).catch(()=>{});
-}
-
-// ── Save settings ─────────────────────────────────────────────────────
-function saveSettings(){
-  const body={};
-  const g=(id)=>document.getElementById(id);
-  const a=parseFloat(g('cfg-alert').value),c=parseFloat(g('cfg-calib').value);
-  const e=parseFloat(g('cfg-ema').value),s=parseInt(g('cfg-sleep').value),b=parseInt(g('cfg-bl').value);
-  if(!isNaN(a)) body.alertDelta=a;
-  if(!isNaN(c)) body.calibWeight=c;
-  if(!isNaN(e)) body.emaAlpha=e;
-  if(!isNaN(s)) body.sleepSec=s;
-  if(!isNaN(b)) body.lcdBlSec=b;
-  const sched=(g('cfg-sched').value||'').trim();
-  body.schedTimes=sched.length>0?sched.split(/\s+/).filter(t=>/^\d{1,2}:\d{2}$/.test(t)):[];
-  fetch('/api/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
-    .then(r=>r.json()).then(d=>toast(d.msg||'OK',!d.ok)).catch(()=>toast('Нет связи',true));
-}
-
-// ── Telegram ──────────────────────────────────────────────────────────
-function saveTelegram(){
-  const ri=parseInt(document.getElementById('tg-report-int').value||'360');
-  const body={token:document.getElementById('tg-token').value,chatId:document.getElementById('tg-chatid').value,reportInt:isNaN(ri)?360:Math.max(0,Math.min(ri,10080))};
-  fetch('/api/tg/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
-    .then(r=>r.json()).then(d=>toast(d.msg||'OK',!d.ok)).catch(()=>toast('Нет связи',true));
-}
-
-// ── WiFi ──────────────────────────────────────────────────────────────
-function selWm(mode, noUpdate){
-  _wifiMode=mode;
-  document.getElementById('wopt-ap').classList.toggle('sel',mode===0);
-  document.getElementById('wopt-sta').classList.toggle('sel',mode===1);
-  document.querySelectorAll('input[name="wm"]').forEach((r,i)=>r.checked=i===mode);
-  const sb=document.getElementById('sta-block');
-  if(sb) sb.style.display=mode===1?'block':'none';
-}
-function saveWifi(){
-  const body={wifiMode:_wifiMode};
-  if(_wifiMode===1){
-    const ssid=document.getElementById('wifi-ssid').value.trim();
-    const pass=document.getElementById('wifi-pass').value;
-    if(!ssid){toast('Введите SSID роутера',true);return;}
-    body.wifiSsid=ssid;
-    if(pass.length>0) body.wifiPass=pass;
-  }
-  fetch('/api/wifi/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
-    .then(r=>r.json()).then(d=>{
-      toast(d.msg||'OK',!d.ok);
-      if(d.ok) setTimeout(()=>toast('Устройство перезагружается…'),2500);
-    }).catch(()=>toast('Нет связи',true));
-}
-
-// ── AP Password ───────────────────────────────────────────────────────
-function checkPassStrength(inId,barId){
-  const v=document.getElementById(inId).value;
-  const bar=document.getElementById(barId);
-  const len=v.length;
-  const hasUpper=/[A-Z]/.test(v), hasNum=/[0-9]/.test(v), hasSym=/[^A-Za-z0-9]/.test(v);
-  const score=Math.min(4,(len>=8?1:0)+(len>=12?1:0)+(hasUpper?1:0)+(hasNum?1:0)+(hasSym?1:0));
-  const colors=['','var(--red)','var(--red)','var(--amber)','var(--green)'];
-  bar.style.width=(score*25)+'%';
-  bar.style.background=colors[score]||'var(--border)';
-}
-
-function saveApPass(){
-  const np=document.getElementById('ap-pass-new').value;
-  const cp=document.getElementById('ap-pass-confirm').value;
-  if(np.length<8||np.length>23){toast('Пароль: 8–23 символа',true);return;}
-  if(np!==cp){toast('Пароли не совпадают',true);return;}
-  const body={apPass:np};
-  fetch('/api/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
-    .then(r=>r.json()).then(d=>{
-      toast(d.msg||'OK',!d.ok);
-      if(d.ok){document.getElementById('ap-pass-new').value='';document.getElementById('ap-pass-confirm').value='';}
-    }).catch(()=>toast('Нет связи',true));
-}
-
-// ── Calibration wizard ────────────────────────────────────────────────
-const WIZ=[
-  {l:'Пусто',   b:'<b>Шаг 1: Уберите все грузы.</b><br>Платформа весов должна быть абсолютно пустой. Нажмите «Далее».'},
-  {l:'Тара',    b:'<b>Шаг 2: Тарировка.</b><br>Нажмите «Тарировать» — показание обнулится.<br>Текущий вес должен стать близким к 0.'},
-  {l:'Груз',    b:'<b>Шаг 3: Поставьте эталонный груз.</b><br>Используйте гирю с известной массой (задана в Настройках).<br>Дождитесь стабилизации показания.'},
-  {l:'Cal.F.',  b:'<b>Шаг 4: Подберите Cal.Factor.</b><br>В правой панели «Ручная калибровка» введите CF и нажмите «Применить».<br>Добивайтесь совпадения «Вес (wiz)» с реальной массой груза. Поле CF автозаполнено текущим значением.'},
-  {l:'Готово',  b:'<b>✓ Калибровка завершена!</b><br>Уберите груз → Тарировка → «Сохранить эталон» на главной.'},
-];
-function updateWiz(){
-  WIZ.forEach((_,i)=>{
-    document.getElementById('ws'+i).className='wiz-step'+(i<_wizStep?' done':i===_wizStep?' active':'');
-  });
-  document.getElementById('wiz-body').innerHTML=WIZ[_wizStep].b;
-  const btn=document.getElementById('wiz-btn');
-  btn.textContent=_wizStep===1?'⊘ Тарировать':_wizStep===WIZ.length-1?'↺ Заново':'Далее →';
-}
-function wizNext(){
-  if(_wizStep===1){doApi('/api/tare').then(()=>setTimeout(fetchData,1500));_wizStep++;updateWiz();return;}
-  if(_wizStep===WIZ.length-1){wizReset();return;}
-  _wizStep++;updateWiz();
-}
-function wizReset(){_wizStep=0;updateWiz();}
-
-function applyCalib(){
-  const cf=parseFloat(document.getElementById('calib-cf').value);
-  const ofs=document.getElementById('calib-ofs').value;
-  const body={};
-  if(!isNaN(cf)) body.calibFactor=cf;
-  if(ofs!=='') body.offset=parseInt(ofs);
-  if(Object.keys(body).length===0){toast('Введите значение Cal.Factor',true);return;}
-  fetch('/api/calib/set',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
-    .then(r=>r.json()).then(d=>{toast(d.msg||'OK',!d.ok);if(d.ok)fetchData();}).catch(()=>toast('Нет связи',true));
-}
-
-// ── API viewer ────────────────────────────────────────────────────────
-function refreshApiView(){
-  fetch('/api/data').then(r=>r.json()).then(d=>{
-    document.getElementById('api-json').textContent=JSON.stringify(d,null,2);
-  }).catch(()=>{document.getElementById('api-json').textContent='Нет связи';});
-}
-
-// ── Dates init ────────────────────────────────────────────────────────
-(function initDates(){
-  const now=new Date();
-  const fmt=d=>`${d.getFullYear()}-${String(d.getMonth()+1).padStart(2,'0')}-${String(d.getDate()).padStart(2,'0')}`;
-  const today=fmt(now), weekAgo=fmt(new Date(now-7*86400000));
-  ['exp-date-sd'].forEach(id=>{const el=document.getElementById(id);if(el)el.value=today;});
-  document.getElementById('exp-from').value=weekAgo;
-  document.getElementById('exp-to').value=today;
-})();
-
-// ── Auto refresh ───────────────────────────────────────────────────────
-function autoRefresh(){
-  _start=Date.now(); tickBar(); fetchData();
-  setTimeout(autoRefresh,REFRESH);
-}
-
-// ── Init ──────────────────────────────────────────────────────────────
-updateWiz();
-fetchData();
-setTimeout(autoRefresh,REFRESH);
-</script>
-</body></html>
-
-)rawhtml";
+// ─── Веб-интерфейс (хранится во Flash) ──────────────────────────────────
+// Исходники — web/ (index.html, app.css, app.js); WebAssets.h собирается из них
+// tools/gen_web_assets.py: файлы уже сжаты gzip, ETag — хэш содержимого.
 
 // Настройки читаются/записываются через Memory.h (web_get_*/save_web_settings)
 
-// Маскировка секретов: показывает первые 4 и последние 4 символа, остальное — звёздочки
-static String _maskSecret(const char *src) {
-  size_t len = strlen(src);
-  if (len == 0) return "";
-  if (len <= 8) return "****";
-  char buf[64];
-  if (len >= sizeof(buf)) len = sizeof(buf) - 1;
-  for (size_t i = 0; i < len; i++) {
-    buf[i] = (i < 4 || i >= len - 4) ? src[i] : '*';
-  }
-  buf[len] = '\0';
-  return String(buf);
+// Маскировка секретов на месте: первые 4 и последние 4 символа, остальное —
+// звёздочки; 1–8 символов — "****" (буфер не короче 5). Возвращает s
+static char *_maskSecret(char *s) {
+  size_t len = strlen(s);
+  if (len == 0) return s;
+  if (len <= 8) { strcpy(s, "****"); return s; }
+  for (size_t i = 4; i < len - 4; i++) s[i] = '*';
+  return s;
 }
 
 // ─── Uptime в читаемом виде ───────────────────────────────────────────────
-static String _uptime() {
+static const char *_uptime(char *buf, size_t len) {
   unsigned long s = millis() / 1000UL;
-  char buf[16];
-  snprintf(buf, sizeof(buf), "%lud%02lu:%02lu:%02lu",
+  snprintf(buf, len, "%lud%02lu:%02lu:%02lu",
            s/86400, (s%86400)/3600, (s%3600)/60, s%60);
-  return String(buf);
+  return buf;
 }
 
 // _buildPage() удалён — страница полностью статическая, данные через AJAX
 
 // ─── JSON ответ ───────────────────────────────────────────────────────────
+// Поток в chunked-ответ сервера: мелкие записи копятся в buf,
+// крупные уходят кусками по 512 байт
+class ChunkStream : public Stream {
+public:
+  WebServerCompat &srv;
+  char buf[256];
+  uint16_t pos;
+  ChunkStream(WebServerCompat &s) : srv(s), pos(0) {}
+  size_t write(uint8_t c) override {
+    buf[pos++] = (char)c;
+    if (pos >= sizeof(buf)) _flush_buf();
+    return 1;
+  }
+  size_t write(const uint8_t *b, size_t s) override {
+    if (pos + s <= sizeof(buf)) {  // короткая строка — в буфер, а не отдельным чанком
+      memcpy(buf + pos, b, s);
+      pos += s;
+      return s;
+    }
+    size_t sent = 0;
+    while (sent < s) {
+      size_t n = (s - sent > 512) ? 512 : (s - sent);
+      if (pos > 0) _flush_buf();
+      srv.sendContent((const char*)(b + sent), n);
+      sent += n;
+      yield();  // WDT safe: не блокировать loop при стриме CSV
+    }
+    return s;
+  }
+  void _flush_buf() { if (pos > 0) { srv.sendContent(buf, pos); pos = 0; } }
+  int available() override { return 0; }
+  int read()      override { return -1; }
+  int peek()      override { return -1; }
+  void flush()    override { _flush_buf(); }
+};
+
+// Ответ JSON: заголовки здесь, тело — JsonWriter в ChunkStream. Документа и
+// String с ответом в heap нет — только буфер ChunkStream на стеке
+static void _jsonBegin(int code = 200) {
+  _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  _srv.send(code, "application/json", "");
+}
+
 static void _sendJson(bool ok, const String &msg) {
-  StaticJsonDocument<128> doc;
-  doc["ok"]  = ok;
-  doc["msg"] = msg;
-  String out; serializeJson(doc, out);
-  _srv.send(ok ? 200 : 400, "application/json", out);
+  _jsonBegin(ok ? 200 : 400);
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  j.add("ok", ok);
+  j.add("msg", msg);
+  j.endObject();
+  cs.flush();
 }
 
 // ─── Маршруты ─────────────────────────────────────────────────────────────
+static bool _dataDirty = true;  // снимок /api/data устарел (см. _dataSnap)
+
 static inline void _activity() {
   lastActivityTime = millis();
+  _dataDirty = true;            // действие могло изменить показания (тара, калибровка…)
   if (_wa.onActivity) _wa.onActivity();
 }
 static inline void _keepalive() {
   // GET-поллинг НЕ сбрасывает таймер авто-сна — иначе deep sleep никогда не сработает
 }
 
-// Отправка PROGMEM-строки чанками (без копирования всего в heap)
-static void _sendProgmemChunked(const char *pgm) {
-  if (!pgm) { _srv.send(500, "text/plain", "No content"); return; }
-  _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
-  _srv.send(200, "text/html; charset=utf-8", "");
-  size_t total = strlen_P(pgm);
-  size_t sent = 0;
-  char chunk[512];
-  while (sent < total) {
-    size_t n = min((size_t)sizeof(chunk), total - sent);
-    memcpy_P(chunk, pgm + sent, n);
-    _srv.sendContent(chunk, n);
-    yield();
-    sent += n;
+// Забрать соединение текущего запроса: сервер после обработчика его не ждёт
+// и сразу принимает следующих клиентов
+static WiFiClient _takeClient() {
+  WiFiClient c = _srv.client();
+  _srv.client() = WiFiClient();
+  return c;
+}
+
+// Заголовки кэша: immutable (файл интерфейса с версией в ссылке, ?v=хэш) —
+// кэшировать навсегда, иначе — перепроверять по ETag. true — у клиента
+// та же версия, ответ 304 уже отправлен.
+static bool _notModified(const char *etag, bool immutable, const char *type) {
+  _srv.sendHeader("ETag", etag);
+  _srv.sendHeader("Cache-Control", immutable ? "private, max-age=31536000, immutable" : "no-cache");
+  String inm = _srv.header("If-None-Match");
+  if (inm.length() && (inm.indexOf(etag) >= 0 || inm == "*")) {
+    _srv.send(304, type, "");
+    return true;
+  }
+  return false;
+}
+
+// ─── Веб-интерфейс из LittleFS (WWW_DIR) ─────────────────────────────────
+// ETag файла — размер и CRC-32; CRC считается один раз (при загрузке или
+// первом запросе) и запоминается в RAM, повторный запрос файл не читает.
+struct WwwTag { char path[WWW_NAME_MAX + 8]; uint32_t size, crc; };
+static WwwTag  _wwwTags[WWW_TAG_CACHE];
+static uint8_t _wwwTagNext = 0;
+
+static bool _wwwFS() {
+  static bool ready = false;
+  if (!ready) ready = LittleFS.begin();
+  return ready;
+}
+
+static void _wwwRemember(const String &path, uint32_t size, uint32_t crc) {
+  WwwTag &t = _wwwTags[_wwwTagNext];
+  _wwwTagNext = (_wwwTagNext + 1) % WWW_TAG_CACHE;
+  snprintf(t.path, sizeof(t.path), "%s", path.c_str());
+  t.size = size;
+  t.crc  = crc;
+}
+
+static void _wwwForget(const String &path) {
+  for (WwwTag &t : _wwwTags) if (path == t.path) t.path[0] = '\0';
+}
+
+static uint32_t _wwwCrc(const String &path, File &f) {
+  for (WwwTag &t : _wwwTags) if (t.size == f.size() && path == t.path) return t.crc;
+  uint8_t buf[256];
+  uint32_t crc = 0;
+  size_t n;
+  while ((n = f.read(buf, sizeof(buf))) > 0) crc = gz_crc32(crc, buf, n);
+  f.seek(0);
+  _wwwRemember(path, f.size(), crc);
+  return crc;
+}
+
+static const char *_wwwType(const String &path) {
+  if (path.endsWith(".html")) return "text/html; charset=utf-8";
+  if (path.endsWith(".css"))  return "text/css; charset=utf-8";
+  if (path.endsWith(".js"))   return "application/javascript; charset=utf-8";
+  if (path.endsWith(".json")) return "application/json";
+  if (path.endsWith(".svg"))  return "image/svg+xml";
+  if (path.endsWith(".png"))  return "image/png";
+  if (path.endsWith(".ico"))  return "image/x-icon";
+  if (path.endsWith(".txt"))  return "text/plain; charset=utf-8";
+  return "application/octet-stream";
+}
+
+// Файл из WWW_DIR: сначала вариант .gz, затем как есть. false — файла нет
+static bool _wwwSend(const String &path) {
+  if (!_wwwFS()) return false;
+  String fn = String(WWW_DIR) + path;
+  if (LittleFS.exists(fn + ".gz")) fn += ".gz";
+  else if (!LittleFS.exists(fn))   return false;
+  File f = LittleFS.open(fn, "r");
+  if (!f) return false;
+  char etag[24];
+  snprintf(etag, sizeof(etag), "\"%lx-%08lx\"", (unsigned long)f.size(), (unsigned long)_wwwCrc(fn, f));
+  const char *type = _wwwType(path);
+  if (!_notModified(etag, _srv.hasArg("v"), type)) {
+    // streamFile сам добавляет Content-Encoding: gzip для имени *.gz
+    _srv.streamFile(f, type);
+  }
+  f.close();
+  return true;
+}
+
+#ifndef WEB_UI_BUILTIN
+// Без встроенного интерфейса и файлов в WWW_DIR — только загрузка файлов
+static const char PAGE_WWW_EMPTY[] PROGMEM = R"rawhtml(<!DOCTYPE html><html lang="ru"><head>
+<meta charset="UTF-8"><meta name="viewport" content="width=device-width,initial-scale=1">
+<title>BeehiveScale</title></head><body style="font-family:sans-serif;padding:20px">
+<h3>🐝 BeehiveScale: веб-интерфейс не загружен</h3>
+<p>Выберите файлы из BeehiveScale/web/ (index.html, app.css, app.js или их .gz).</p>
+<form method="POST" action="/api/www/upload" enctype="multipart/form-data" id="f">
+<input type="file" name="file" multiple id="i"> <button>Загрузить</button></form><pre id="o"></pre>
+<script>document.getElementById('f').onsubmit=async e=>{e.preventDefault();
+for(const x of document.getElementById('i').files){const d=new FormData();d.append('file',x,x.name);
+const r=await(await fetch('/api/www/upload',{method:'POST',body:d})).json();
+document.getElementById('o').textContent+=x.name+': '+r.msg+'\n';}location.reload();};</script>
+</body></html>)rawhtml";
+#endif
+
+// Файл интерфейса по пути запроса: LittleFS, затем встроенный (WebAssets.h,
+// уже в gzip — его понимают все браузеры). false — такого файла нет.
+static bool _sendUi(const String &path) {
+  if (path.indexOf("..") >= 0) return false;
+  if (_wwwSend(path)) return true;
+#ifdef WEB_UI_BUILTIN
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset &a = WEB_ASSETS[i];
+    if (path != a.path) continue;
+    if (!_notModified(a.etag, a.immutable, a.type)) {
+      _srv.sendHeader("Content-Encoding", "gzip");
+      _srv.send_P(200, a.type, (PGM_P)a.gz, a.len);
+    }
+    return true;
+  }
+#else
+  if (path == "/index.html") {
+    _srv.send_P(200, "text/html; charset=utf-8", PAGE_WWW_EMPTY);
+    return true;
+  }
+#endif
+  return false;
+}
+
+// ─── /api/www — файлы интерфейса в LittleFS ──────────────────────────────
+// GET — список {"files":[{"name":…,"size":…}],"builtin":true}.
+// POST /api/www/upload — multipart, файлы по одному; имя берётся из файла.
+// Пишется во временный файл и подменяет старый только целиком принятым;
+// другой вариант того же файла (сжатый/несжатый) удаляется.
+// POST /api/www/delete?name=… — удалить файл (оба варианта), name=* — все.
+static File     _wwwUp;
+static char     _wwwUpName[WWW_NAME_MAX + 1];
+static char     _wwwUpErr[48];
+static uint32_t _wwwUpSize = 0, _wwwUpCrc = 0;
+static bool     _wwwUpOk = false;
+#define WWW_UP_TMP WWW_DIR "/.upload"
+
+// Имя без пути; только буквы, цифры, '.', '-', '_' и не с точки
+static bool _wwwName(const String &in, char *out, size_t len) {
+  const char *b = in.c_str();
+  const char *sl = strrchr(b, '/');
+  if (sl) b = sl + 1;
+  size_t n = strlen(b);
+  if (n == 0 || n > WWW_NAME_MAX || b[0] == '.') return false;
+  for (size_t i = 0; i < n; i++) {
+    char ch = b[i];
+    if (!isalnum((unsigned char)ch) && ch != '.' && ch != '-' && ch != '_') return false;
+  }
+  snprintf(out, len, "%s", b);
+  return true;
+}
+
+static void _wwwUpFail(const char *msg) {
+  if (_wwwUp) _wwwUp.close();
+  LittleFS.remove(WWW_UP_TMP);
+  snprintf(_wwwUpErr, sizeof(_wwwUpErr), "%s", msg);
+}
+
+static void _handleWwwUploadData() {
+  HTTPUpload &up = _srv.upload();
+  if (up.status == UPLOAD_FILE_START) {
+    _wwwUpOk = false;
+    _wwwUpErr[0] = '\0';
+    _wwwUpSize = _wwwUpCrc = 0;
+    // Авторизация — до записи на флеш; ответ 401 отправит _handleWwwUpload
+    if (!_srv.authenticate(WEB_ADMIN_USER, WEB_ADMIN_PASS)) return;
+    if (!_wwwName(up.filename, _wwwUpName, sizeof(_wwwUpName))) { _wwwUpFail("Недопустимое имя файла"); return; }
+    if (!_wwwFS()) { _wwwUpFail("LittleFS недоступна"); return; }
+    LittleFS.mkdir(WWW_DIR);
+    _wwwUp = LittleFS.open(WWW_UP_TMP, "w");
+    if (!_wwwUp) _wwwUpFail("Ошибка записи");
+  } else if (up.status == UPLOAD_FILE_WRITE) {
+    if (!_wwwUp) return;
+    if (_wwwUpSize + up.currentSize > WWW_MAX_FILE) { _wwwUpFail("Файл слишком большой"); return; }
+    if (_wwwUp.write(up.buf, up.currentSize) != up.currentSize) { _wwwUpFail("Нет места во флеш"); return; }
+    _wwwUpCrc = gz_crc32(_wwwUpCrc, up.buf, up.currentSize);
+    _wwwUpSize += up.currentSize;
+  } else if (up.status == UPLOAD_FILE_END) {
+    if (!_wwwUp) return;
+    _wwwUp.close();
+    String fn  = String(WWW_DIR "/") + _wwwUpName;
+    String alt = fn.endsWith(".gz") ? fn.substring(0, fn.length() - 3) : fn + ".gz";
+    LittleFS.remove(alt);
+    LittleFS.remove(fn);
+    _wwwForget(alt);
+    _wwwForget(fn);
+    if (!LittleFS.rename(WWW_UP_TMP, fn)) { _wwwUpFail("Ошибка записи"); return; }
+    _wwwRemember(fn, _wwwUpSize, _wwwUpCrc);
+    _wwwUpOk = true;
+    Serial.printf("[WebServer] www: %s (%lu B)\n", _wwwUpName, (unsigned long)_wwwUpSize);
+  } else if (up.status == UPLOAD_FILE_ABORTED) {
+    _wwwUpFail("Загрузка прервана");
+  }
+}
+
+static void _handleWwwUpload() {
+  if (!_auth()) return;
+  _activity();
+  if (!_wwwUpOk) { _sendJson(false, _wwwUpErr[0] ? _wwwUpErr : "Файл не получен"); return; }
+  _wwwUpOk = false;
+  _sendJson(true, String("Загружен ") + _wwwUpName);
+}
+
+static void _handleWwwList() {
+  if (!_auth()) return;
+  _keepalive();
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  j.beginArray("files");
+  if (_wwwFS()) {
+    Dir d = LittleFS.openDir(WWW_DIR);
+    while (d.next()) {
+      if (d.isDirectory() || d.fileName().startsWith(".")) continue;
+      j.beginObject();
+      j.add("name", d.fileName());
+      j.add("size", (unsigned long)d.fileSize());
+      j.endObject();
+    }
+  }
+  j.endArray();
+#ifdef WEB_UI_BUILTIN
+  j.add("builtin", true);
+#else
+  j.add("builtin", false);
+#endif
+  j.endObject();
+  cs.flush();
+}
+
+static void _handleWwwDelete() {
+  if (!_auth()) return;
+  _activity();
+  String name = _srv.arg("name");
+  if (!_wwwFS()) { _sendJson(false, "LittleFS недоступна"); return; }
+  if (name == "*") {
+    // Имена сначала собираются: каталог во время обхода не меняется
+    String all;
+    Dir d = LittleFS.openDir(WWW_DIR);
+    while (d.next()) if (!d.isDirectory()) all += d.fileName() + "\n";
+    int p = 0, q;
+    while ((q = all.indexOf('\n', p)) >= 0) {
+      String fn = String(WWW_DIR "/") + all.substring(p, q);
+      LittleFS.remove(fn);
+      _wwwForget(fn);
+      p = q + 1;
+    }
+    _sendJson(true, "Файлы интерфейса удалены");
+    return;
   }
+  char clean[WWW_NAME_MAX + 1];
+  if (!_wwwName(name, clean, sizeof(clean))) { _sendJson(false, "Недопустимое имя файла"); return; }
+  String fn = String(WWW_DIR "/") + clean;
+  String gz = fn + ".gz";
+  bool ok = LittleFS.remove(fn) | LittleFS.remove(gz);
+  _wwwForget(fn);
+  _wwwForget(gz);
+  _sendJson(ok, ok ? "Удалено" : "Файл не найден");
 }
 
 static void _handleRoot() {
   if (!_auth()) return;
   _activity();
-  _sendProgmemChunked(PAGE_HTML);
+  _sendUi("/index.html");
 }
 
 // ─── /api/config  GET — начальные значения для форм настроек ─────────────
+// Расписание "HH:MM" массивом schedTimes
+static void _schedTimes(JsonWriter &j) {
+  uint16_t times[8]; uint8_t cnt;
+  get_sched_times(times, cnt);
+  j.beginArray("schedTimes");
+  for (uint8_t i = 0; i < cnt; i++) {
+    char tbuf[8];
+    snprintf(tbuf, sizeof(tbuf), "%02u:%02u", (unsigned)(times[i] / 60) % 100, (unsigned)(times[i] % 60));
+    j.add(nullptr, tbuf);
+  }
+  j.endArray();
+}
+
+static void _fillConfig(JsonWriter &j) {
+  j.add("alertDelta",  web_get_alert_delta());
+  j.add("calibWeight", web_get_calib_weight());
+  j.add("emaAlpha",    web_get_ema_alpha());
+  j.add("sleepSec",    (unsigned long)get_sleep_sec());
+  j.add("lcdBlSec",    (unsigned int)get_lcd_bl_sec());
+  j.add("wifiMode",    (int)get_wifi_mode());
+  char ss[33]; get_wifi_ssid(ss, sizeof(ss));
+  j.add("wifiSsid", ss);
+  char tgTok[50], tgCid[16];
+  get_tg_token(tgTok, sizeof(tgTok));
+  get_tg_chatid(tgCid, sizeof(tgCid));
+  bool tokSet = (tgTok[0] != '\0');
+  j.add("tgToken",     _maskSecret(tgTok));
+  j.add("tgChatId",    tgCid);
+  j.add("tgTokenSet",  tokSet);
+  j.add("tgReportInt", (unsigned int)get_tg_report_interval_min());
+  _schedTimes(j);
+}
+
 static void _handleConfig() {
   if (!_auth()) return;
   _keepalive();  // GET-поллинг — не сбрасывать таймер авто-сна
-  StaticJsonDocument<640> doc;
-  doc["alertDelta"]  = web_get_alert_delta();
-  doc["calibWeight"] = web_get_calib_weight();
-  doc["emaAlpha"]    = web_get_ema_alpha();
-  doc["sleepSec"]    = (unsigned long)get_sleep_sec();
-  doc["lcdBlSec"]    = (unsigned int)get_lcd_bl_sec();
-  doc["wifiMode"]    = (int)get_wifi_mode();
-  // НЕ использовать block scope для char-буферов + ArduinoJson!
-  // ArduinoJson v6 для char* хранит указатель (zero-copy) — dangling pointer если буфер на стеке.
-  // Оборачиваем в String() чтобы ArduinoJson скопировал содержимое.
-  {
-    char ss[33]; get_wifi_ssid(ss, sizeof(ss));
-    doc["wifiSsid"] = String(ss);
-  }
-  {
-    char tgTok[50], tgCid[16];
-    get_tg_token(tgTok, sizeof(tgTok));
-    get_tg_chatid(tgCid, sizeof(tgCid));
-    doc["tgToken"]  = _maskSecret(tgTok);
-    doc["tgChatId"] = String(tgCid);
-    doc["tgTokenSet"] = (tgTok[0] != '\0');
-    doc["tgReportInt"] = get_tg_report_interval_min();
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  _fillConfig(j);
+  j.endObject();
+  cs.flush();
+}
+
+static void _fillData(JsonWriter &j) {
+  char up[16];
+  j.add("weight",   *_wd.weight);
+  j.add("ref",      *_wd.lastSavedWeight);
+  j.add("prev",     *_wd.prevWeight);
+  j.add("temp",     *_wd.tempC, 2);
+  j.add("hum",      *_wd.humidity, 1);
+  j.add("rtcT",     *_wd.rtcTempC, 2);
+  j.add("sensor",   *_wd.sensorReady);
+  j.add("wifi",     *_wd.wifiOk);
+  j.add("datetime", *_wd.datetime);
+  j.add("uptime",   _uptime(up, sizeof(up)));
+  j.add("wakeups",  (unsigned long)*_wd.wakeupCount);
+  j.add("cf",       *_wd.calibFactor, 4);
+  j.add("offset",   *_wd.offset);
+  j.add("batV",     *_wd.batVoltage, 3);
+  j.add("batPct",   *_wd.batPercent);
+  j.add("sdLog",      (unsigned long)log_size());
+  j.add("sdFree",     (unsigned long)log_free_space());
+  j.add("sdFallback", log_using_fallback());
+  j.add("sdOk",       log_fs_ok() ? 1 : 0);
+#if defined(ESP32) || defined(ESP8266)
+  j.add("heap",     (unsigned long)ESP.getFreeHeap());
+#else
+  j.add("heap",     0);
+#endif
+}
+
+// ─── /api/events  GET — Server-Sent Events ──────────────────────────────
+// Соединение остаётся открытым: клиент хранится в слоте, события пишутся из
+// webserver_handle(). Первое событие — все поля (как в /api/data), дальше —
+// только изменившиеся с точностью отображения. Клиент, которому некуда писать
+// (буфер TCP полон), отключается: EventSource переподключится сам и получит
+// полный снимок заново — пропущенных изменений не бывает.
+struct SseVals {
+  long w, ref, prev;   // граммы
+  long t, rtcT;        // 0.1 °C
+  long h;              // %
+  long bv;             // 0.01 В
+  int  bp;
+  bool sensor;
+};
+static WiFiClient    _sseCli[WEB_SSE_MAX_CLIENTS];
+static bool          _sseFresh[WEB_SSE_MAX_CLIENTS];  // ещё не получил полный снимок
+static SseVals       _sseLast;                        // что уже есть у всех клиентов
+static uint8_t       _ssePending = 0;                 // WEB_EV_* с прошлой рассылки
+static unsigned long _ssePingAt  = 0;
+
+static void _sseSnap(SseVals &v) {
+  v.w      = lroundf(*_wd.weight * 1000.0f);
+  v.ref    = lroundf(*_wd.lastSavedWeight * 1000.0f);
+  v.prev   = lroundf(*_wd.prevWeight * 1000.0f);
+  v.t      = lroundf(*_wd.tempC * 10.0f);
+  v.rtcT   = lroundf(*_wd.rtcTempC * 10.0f);
+  v.h      = lroundf(*_wd.humidity);
+  v.bv     = lroundf(*_wd.batVoltage * 100.0f);
+  v.bp     = *_wd.batPercent;
+  v.sensor = *_wd.sensorReady;
+}
+
+// Событие с полями v, отличными от old (old == nullptr — со всеми).
+// Возвращает длину; 0 — менять нечего
+static size_t _sseEvent(char *buf, size_t len, const SseVals &v, const SseVals *old) {
+  size_t n = snprintf(buf, len, "data: {");
+  size_t body = n;
+  auto add = [&](const char *key, bool changed, const char *fmt, double x) {
+    if (old && !changed) return;
+    if (n < len) n += snprintf(buf + n, len - n, "%s\"%s\":", n > body ? "," : "", key);
+    if (n < len) n += snprintf(buf + n, len - n, fmt, x);
+  };
+  add("weight", old && old->w    != v.w,    "%.3f", v.w / 1000.0);
+  add("ref",    old && old->ref  != v.ref,  "%.3f", v.ref / 1000.0);
+  add("prev",   old && old->prev != v.prev, "%.3f", v.prev / 1000.0);
+  add("temp",   old && old->t    != v.t,    "%.1f", v.t / 10.0);
+  add("hum",    old && old->h    != v.h,    "%.0f", (double)v.h);
+  add("rtcT",   old && old->rtcT != v.rtcT, "%.1f", v.rtcT / 10.0);
+  add("batV",   old && old->bv   != v.bv,   "%.2f", v.bv / 100.0);
+  add("batPct", old && old->bp   != v.bp,   "%.0f", (double)v.bp);
+  if ((!old || old->sensor != v.sensor) && n < len)
+    n += snprintf(buf + n, len - n, "%s\"sensor\":%s", n > body ? "," : "", v.sensor ? "true" : "false");
+  if (n == body) return 0;
+  if (n < len) n += snprintf(buf + n, len - n, "}\n\n");
+  return n < len ? n : 0;
+}
+
+static void _sseDrop(int i) {
+  _sseCli[i].stop();
+  _sseCli[i] = WiFiClient();
+}
+
+static void _sseSend(int i, const char *buf, size_t n) {
+  if (!n) return;
+  if (_sseCli[i].availableForWrite() < (int)n || _sseCli[i].write((const uint8_t*)buf, n) != n) _sseDrop(i);
+}
+
+static void _ssePump() {
+  bool any = false, fresh = false;
+  for (int i = 0; i < WEB_SSE_MAX_CLIENTS; i++) {
+    if (!_sseCli[i].connected()) { _sseDrop(i); continue; }
+    any = true;
+    fresh |= _sseFresh[i];
   }
-  {
-    uint16_t times[8]; uint8_t cnt;
-    get_sched_times(times, cnt);
-    JsonArray arr = doc.createNestedArray("schedTimes");
-    char tbuf[6];
-    for (uint8_t i = 0; i < cnt; i++) {
-      snprintf(tbuf, sizeof(tbuf), "%02d:%02d", times[i] / 60, times[i] % 60);
-      arr.add(String(tbuf));
+  if (!any) { _ssePending = 0; return; }
+  if (_ssePending || fresh) {
+    SseVals v;
+    _sseSnap(v);
+    char delta[192], full[192];
+    size_t nd = _sseEvent(delta, sizeof(delta), v, &_sseLast);
+    size_t nf = fresh ? _sseEvent(full, sizeof(full), v, nullptr) : 0;
+    for (int i = 0; i < WEB_SSE_MAX_CLIENTS; i++) {
+      if (!_sseCli[i]) continue;
+      if (_sseFresh[i]) _sseSend(i, full, nf);
+      else              _sseSend(i, delta, nd);
+      _sseFresh[i] = false;
     }
+    _sseLast = v;
+    _ssePending = 0;
+  }
+  if (millis() - _ssePingAt >= WEB_SSE_PING_MS) {
+    _ssePingAt = millis();
+    for (int i = 0; i < WEB_SSE_MAX_CLIENTS; i++) if (_sseCli[i]) _sseSend(i, ":\n\n", 3);
+  }
+}
+
+static void _handleEvents() {
+  if (!_auth()) return;
+  _keepalive();
+  int slot = -1;
+  for (int i = 0; i < WEB_SSE_MAX_CLIENTS && slot < 0; i++) if (!_sseCli[i]) slot = i;
+  if (slot < 0) { _srv.send(503, "text/plain", "Too many subscribers"); return; }
+  // Заголовки — напрямую в сокет: ответ не завершается, соединение
+  // остаётся за слотом и после возврата из обработчика
+  WiFiClient c = _takeClient();
+  c.setNoDelay(true);
+  c.print(F("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\n"
+            "Cache-Control: no-cache\r\nConnection: keep-alive\r\n\r\nretry: 3000\n\n"));
+  _sseCli[slot]   = c;
+  _sseFresh[slot] = true;
+}
+
+// ─── /api/data  GET — снимок показаний ───────────────────────────────────
+// Ответ собирается заранее в _dataBuf и отдаётся готовыми байтами, сколько бы
+// клиентов ни опрашивали. Пересборка — только когда снимок устарел: отсчёт
+// RTC и датчики (webserver_notify: WEB_EV_TEMP раз в TEMP_READ_INTERVAL_MS,
+// WEB_EV_BAT), вес и прочие показания SseVals изменились с точностью
+// отображения, любой запрос-действие (_activity). uptime, heap, размер лога —
+// на момент сборки. ETag — CRC-32 снимка: у клиента та же версия — 304.
+class BufPrint : public Print {
+public:
+  BufPrint(char *buf, size_t cap) : _buf(buf), _cap(cap) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *p, size_t n) override {
+    if (_len + n > _cap) { _over = true; return 0; }
+    memcpy(_buf + _len, p, n);
+    _len += n;
+    return n;
+  }
+  size_t length() const { return _over ? 0 : _len; }
+private:
+  char  *_buf;
+  size_t _cap, _len = 0;
+  bool   _over = false;
+};
+
+static char    _dataBuf[WEB_DATA_BUF];
+static size_t  _dataLen = 0;       // 0 — снимок не поместился: ответ собирается на лету
+static char    _dataTag[12];       // "crc32"
+static SseVals _dataVals;          // показания снимка — для сравнения
+
+static bool _sseSame(const SseVals &a, const SseVals &b) {
+  return a.w == b.w && a.ref == b.ref && a.prev == b.prev && a.t == b.t && a.rtcT == b.rtcT &&
+         a.h == b.h && a.bv == b.bv && a.bp == b.bp && a.sensor == b.sensor;
+}
+
+// Актуальный снимок; false — не поместился в WEB_DATA_BUF
+static bool _dataSnap() {
+  SseVals v;
+  _sseSnap(v);
+  if (_dataDirty || !_sseSame(v, _dataVals)) {
+    BufPrint out(_dataBuf, sizeof(_dataBuf));
+    JsonWriter j(out);
+    j.beginObject();
+    _fillData(j);
+    j.endObject();
+    _dataLen = out.length();
+    snprintf(_dataTag, sizeof(_dataTag), "\"%08lx\"",
+             (unsigned long)gz_crc32(0, (const uint8_t*)_dataBuf, _dataLen));
+    _dataVals  = v;
+    _dataDirty = false;
   }
-  String out; serializeJson(doc, out);
-  _srv.send(200, "application/json", out);
+  return _dataLen > 0;
 }
 
 static void _handleData() {
   if (!_auth()) return;
   _keepalive();  // поллинг — не сбрасывать подсветку
-  StaticJsonDocument<512> doc;
-  doc["weight"]   = *_wd.weight;
-  doc["ref"]      = *_wd.lastSavedWeight;
-  doc["prev"]     = *_wd.prevWeight;
-  doc["temp"]     = *_wd.tempC;
-  doc["hum"]      = *_wd.humidity;
-  doc["rtcT"]     = *_wd.rtcTempC;
-  doc["sensor"]   = *_wd.sensorReady;
-  doc["wifi"]     = *_wd.wifiOk;
-  doc["datetime"] = *_wd.datetime;
-  doc["uptime"]   = _uptime();
-  doc["wakeups"]  = *_wd.wakeupCount;
-  doc["cf"]       = *_wd.calibFactor;
-  doc["offset"]   = *_wd.offset;
-  doc["batV"]     = *_wd.batVoltage;
-  doc["batPct"]   = *_wd.batPercent;
-  doc["sdLog"]      = (unsigned long)log_size();
-  doc["sdFree"]     = (unsigned long)log_free_space();
-  doc["sdFallback"] = log_using_fallback();
-  doc["sdOk"]       = log_fs_ok() ? 1 : 0;
-#if defined(ESP32) || defined(ESP8266)
-  doc["heap"]     = ESP.getFreeHeap();
-#else
-  doc["heap"]     = 0;
-#endif
-  String out; serializeJson(doc, out);
-  _srv.send(200, "application/json", out);
+  if (!_dataSnap()) {
+    _jsonBegin();
+    ChunkStream cs(_srv);
+    JsonWriter j(cs);
+    j.beginObject();
+    _fillData(j);
+    j.endObject();
+    cs.flush();
+    return;
+  }
+  if (_notModified(_dataTag, false, "application/json")) return;
+  _srv.send_P(200, "application/json", _dataBuf, _dataLen);
 }
 
 static void _handleTare() {
@@ -1424,25 +680,222 @@ static void _handleSave() {
   else _sendJson(false, "Нет обработчика");
 }
 
+// ─── Тело POST — потоковый разбор JSON ──────────────────────────────────
+// JSON-тела POST (настройки, Telegram, калибровка, WiFi, восстановление бэкапа)
+// не собираются в arg("plain") и документ: с HTTPRaw (ядро 3.x) каждый кусок тела
+// сразу идёт в JsonReader, и известные поля раскладываются в BodyForm — набор
+// полей фиксированного размера, сколько бы ключей ни прислали. Значения
+// проверяет и применяет обработчик маршрута — уже после _auth(). Поля, которые
+// маршрут не знает или не смог разобрать, не теряются молча: они в ответе.
+enum : uint8_t {
+  // числа
+  F_CALIB_FACTOR, F_OFFSET, F_WEIGHT, F_PREV_WEIGHT, F_PREV_OFFSET,
+  F_ALERT_DELTA, F_CALIB_WEIGHT, F_EMA_ALPHA, F_SLEEP_SEC, F_LCD_BL_SEC,
+  F_TG_REPORT, F_WIFI_MODE,
+  F_NUM_END,
+  // строки
+  F_AP_PASS = F_NUM_END, F_TG_TOKEN, F_TG_CHAT, F_WIFI_SSID, F_WIFI_PASS,
+  F_STR_END,
+  // прочее
+  F_SCHED = F_STR_END, F_TYPE, F_VER
+};
+#define FB(id)          (1UL << (id))
+#define FORM_STR_MAX    50   // самая длинная строка настроек — tgToken (49)
+#define FORM_SCHED_MAX  8
+#define FORM_SKIP_MAX   96   // имена пропущенных полей
+
+// Поля маршрутов
+#define FORM_SETTINGS  (FB(F_ALERT_DELTA) | FB(F_CALIB_WEIGHT) | FB(F_EMA_ALPHA) | \
+                        FB(F_SLEEP_SEC) | FB(F_LCD_BL_SEC) | FB(F_AP_PASS) | FB(F_SCHED))
+#define FORM_TG        (FB(F_TG_TOKEN) | FB(F_TG_CHAT) | FB(F_TG_REPORT))
+#define FORM_CALIB     (FB(F_CALIB_FACTOR) | FB(F_OFFSET))
+#define FORM_WIFI      (FB(F_WIFI_MODE) | FB(F_WIFI_SSID) | FB(F_WIFI_PASS))
+#define FORM_BACKUP    (FORM_SETTINGS | FORM_TG | FORM_CALIB | FORM_WIFI | FB(F_WEIGHT) | \
+                        FB(F_PREV_WEIGHT) | FB(F_PREV_OFFSET) | FB(F_TYPE) | FB(F_VER))
+
+// Имена ключей; /api/tg/settings принимает короткие, бэкап — с префиксом tg
+// (первое имя поля — его имя в бэкапе)
+static const struct { const char *name; uint8_t id; } _formKeys[] = {
+  { "calibFactor", F_CALIB_FACTOR }, { "offset",      F_OFFSET },
+  { "weight",      F_WEIGHT },       { "prevWeight",  F_PREV_WEIGHT },
+  { "prevOffset",  F_PREV_OFFSET },  { "alertDelta",  F_ALERT_DELTA },
+  { "calibWeight", F_CALIB_WEIGHT }, { "emaAlpha",    F_EMA_ALPHA },
+  { "sleepSec",    F_SLEEP_SEC },    { "lcdBlSec",    F_LCD_BL_SEC },
+  { "tgReportInt", F_TG_REPORT },    { "reportInt",   F_TG_REPORT },
+  { "wifiMode",    F_WIFI_MODE },    { "apPass",      F_AP_PASS },
+  { "tgToken",     F_TG_TOKEN },     { "token",       F_TG_TOKEN },
+  { "tgChatId",    F_TG_CHAT },      { "chatId",      F_TG_CHAT },
+  { "wifiSsid",    F_WIFI_SSID },    { "wifiPass",    F_WIFI_PASS },
+  { "schedTimes",  F_SCHED },        { "_type",       F_TYPE },
+  { "_ver",        F_VER },
+};
+
+static const char *_formName(uint8_t id) {
+  for (auto &k : _formKeys) if (k.id == id) return k.name;
+  return "?";
+}
+
+struct BodyForm {
+  JsonReader rd;
+  uint32_t allow;                          // FB(): поля маршрута
+  uint32_t has;                            // FB(): поле пришло и разобрано
+  double   num[F_NUM_END];
+  char     str[F_STR_END - F_NUM_END][FORM_STR_MAX];
+  uint16_t sched[FORM_SCHED_MAX];          // минуты от полуночи
+  uint8_t  schedCnt;
+  bool     backup;                         // _type == "BeehiveScale_backup"
+  char     bad[JSON_READ_KEY];             // первое поле маршрута с негодным значением
+  char     skip[FORM_SKIP_MAX];            // пропущенные имена через ", "
+
+  bool has_(uint8_t id) const { return has & FB(id); }
+  const char *s(uint8_t id) const { return str[id - F_NUM_END]; }
+};
+static BodyForm *_form = nullptr;  // тело текущего запроса, пока идёт приём
+
+static void _formSkip(BodyForm &f, const char *key) {
+  size_t n = strlen(f.skip);
+  if (n + 3 >= sizeof(f.skip)) return;
+  snprintf(f.skip + n, sizeof(f.skip) - n, "%s%s", n ? ", " : "", key);
+  if (strlen(f.skip) + 3 >= sizeof(f.skip)) strcpy(f.skip + sizeof(f.skip) - 4, "...");
+}
+
+static void _formField(const JsonField &fl, void *ctx) {
+  BodyForm &f = *(BodyForm*)ctx;
+  int id = -1;
+  for (auto &k : _formKeys) {
+    if (!strcmp(fl.key, k.name)) { id = k.id; break; }
+  }
+  if (fl.depth > 1) {
+    // Вложенное — только элементы schedTimes: "ЧЧ:ММ", негодные пропускаются
+    if (id == F_SCHED && fl.depth == 2 && f.has_(F_SCHED) && fl.type == JSON_STRING) {
+      int h = 0, m = 0;
+      if (sscanf(fl.val, "%d:%d", &h, &m) == 2 && h >= 0 && h <= 23 && m >= 0 && m <= 59) {
+        if (f.schedCnt < FORM_SCHED_MAX) f.sched[f.schedCnt++] = (uint16_t)h * 60 + m;
+      }
+    }
+    return;
+  }
+  if (id < 0 || !(f.allow & FB(id))) { _formSkip(f, fl.key); return; }
+
+  bool ok = false;
+  if (id < F_NUM_END) {
+    ok = (fl.type == JSON_NUMBER);
+    if (ok) f.num[id] = strtod(fl.val, nullptr);
+  } else if (id < F_STR_END) {
+    ok = (fl.type == JSON_STRING && !fl.overflow && strlen(fl.val) < FORM_STR_MAX);
+    if (ok) strcpy(f.str[id - F_NUM_END], fl.val);
+  } else if (id == F_SCHED) {
+    ok = (fl.type == JSON_ARRAY);
+    f.schedCnt = 0;
+  } else if (id == F_TYPE) {
+    ok = (fl.type == JSON_STRING);
+    f.backup = ok && !strcmp(fl.val, "BeehiveScale_backup");
+  } else {
+    ok = true;                             // _ver — для справки
+  }
+  if (ok) { f.has |= FB(id); return; }
+  f.has &= ~FB(id);
+  if (!f.bad[0]) strncpy(f.bad, fl.key, sizeof(f.bad) - 1);
+  _formSkip(f, fl.key);
+}
+
+static void _formStart(uint32_t allow) {
+  delete _form;                            // прошлое тело, не дошедшее до обработчика
+  _form = new (std::nothrow) BodyForm();
+  if (!_form) return;
+  _form->allow = allow;
+  _form->rd.begin(_formField, _form);
+}
+
+// Приём тела кусками по HTTP_RAW_BUFLEN (callback загрузки маршрута)
+static void _formBody(uint32_t allow) {
+#ifdef HTTP_RAW_BUFLEN
+  HTTPRaw &raw = _srv.raw();
+  if (raw.status == RAW_START) _formStart(allow);
+  else if (raw.status == RAW_WRITE && _form) _form->rd.feed((const char*)raw.buf, raw.currentSize);
+#else
+  (void)allow;
+#endif
+}
+
+// Тело запроса на время обработчика: освобождается на любом выходе
+struct FormHold {
+  BodyForm *f;
+  explicit FormHold(uint32_t allow) {
+#ifndef HTTP_RAW_BUFLEN
+    // Ядро без HTTPRaw: тело уже в arg("plain") — тот же разбор одним куском
+    _formStart(allow);
+    if (_form) { const String &b = _srv.arg("plain"); _form->rd.feed(b.c_str(), b.length()); }
+#else
+    (void)allow;
+#endif
+    f = _form;
+    _form = nullptr;
+  }
+  ~FormHold() { delete f; }
+};
+
+// false — ответ об ошибке уже отправлен. strict: поле маршрута с негодным
+// значением (не тот тип, слишком длинное) — ошибка, а не пропуск
+static bool _formOk(const FormHold &h, bool strict) {
+  if (!h.f || !h.f->rd.finish()) { _sendJson(false, "Ошибка JSON"); return false; }
+  if (strict && h.f->bad[0]) {
+    char msg[64];
+    snprintf(msg, sizeof(msg), "Неверное значение: %s", h.f->bad);
+    _sendJson(false, msg);
+    return false;
+  }
+  return true;
+}
+
+// Ответ с перечнем пропущенных полей: {"ok":…,"msg":"… (пропущено: a, b)","skipped":["a","b"]}
+static void _sendForm(const BodyForm &f, const char *msg) {
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  j.add("ok", true);
+  if (f.skip[0]) {
+    char m[160];
+    snprintf(m, sizeof(m), "%s (пропущено: %s)", msg, f.skip);
+    j.add("msg", m);
+  } else {
+    j.add("msg", msg);
+  }
+  j.beginArray("skipped");
+  char name[JSON_READ_KEY];
+  for (const char *p = f.skip; *p; ) {
+    size_t n = strcspn(p, ",");
+    if (n >= sizeof(name)) n = sizeof(name) - 1;
+    memcpy(name, p, n); name[n] = '\0';
+    j.add(nullptr, name);
+    p += strcspn(p, ",");
+    while (*p == ',' || *p == ' ') p++;
+  }
+  j.endArray();
+  j.endObject();
+  cs.flush();
+}
+
 // Forward declaration — используется в авто-бэкапе при сохранении настроек
 // masked=true: секреты замаскированы (для GET /api/backup), false: полные (для SD-файла)
-static String _buildBackupJson(bool masked = false);
+static void _saveBackup();
 
 static void _handleSettings() {
+  FormHold form(FORM_SETTINGS);
   if (!_auth()) return;
   if (_srv.method() != HTTP_POST) { _sendJson(false,"Только POST"); return; }
   _activity();
-  StaticJsonDocument<512> doc;
-  DeserializationError err = deserializeJson(doc, _srv.arg("plain"));
-  if (err) { _sendJson(false,"Ошибка JSON"); return; }
+  if (!_formOk(form, true)) return;
+  const BodyForm &f = *form.f;
 
   // Валидация входных данных
   float newAlert  = web_get_alert_delta();
   float newCalib  = web_get_calib_weight();
   float newAlpha  = web_get_ema_alpha();
 
-  if (doc.containsKey("alertDelta")) {
-    float val = doc["alertDelta"].as<float>();
+  if (f.has_(F_ALERT_DELTA)) {
+    float val = f.num[F_ALERT_DELTA];
     if (val >= 0.1f && val <= 10.0f) {
       newAlert = val;
     } else {
@@ -1451,8 +904,8 @@ static void _handleSettings() {
     }
   }
 
-  if (doc.containsKey("calibWeight")) {
-    float val = doc["calibWeight"].as<float>();
+  if (f.has_(F_CALIB_WEIGHT)) {
+    float val = f.num[F_CALIB_WEIGHT];
     if (val >= 100.0f && val <= 5000.0f) {
       newCalib = val;
     } else {
@@ -1461,8 +914,8 @@ static void _handleSettings() {
     }
   }
 
-  if (doc.containsKey("emaAlpha")) {
-    float val = doc["emaAlpha"].as<float>();
+  if (f.has_(F_EMA_ALPHA)) {
+    float val = f.num[F_EMA_ALPHA];
     if (val >= 0.05f && val <= 0.9f) {
       newAlpha = val;
     } else {
@@ -1475,24 +928,19 @@ static void _handleSettings() {
   uint32_t newSleepSec = 0; bool hasSleepSec = false;
   uint16_t newLcdBlSec = 0;  bool hasLcdBlSec = false;
   const char* newApPass = nullptr;
-  if (doc.containsKey("sleepSec")) {
-    uint32_t val = doc["sleepSec"].as<uint32_t>();
-    if (val >= 30UL && val <= 86400UL) { newSleepSec = val; hasSleepSec = true; }
+  if (f.has_(F_SLEEP_SEC)) {
+    double val = f.num[F_SLEEP_SEC];
+    if (val >= 30 && val <= 86400) { newSleepSec = (uint32_t)val; hasSleepSec = true; }
     else { _sendJson(false, "sleepSec: 30–86400"); return; }
   }
-  if (doc.containsKey("lcdBlSec")) {
-    uint16_t val = doc["lcdBlSec"].as<uint16_t>();
-    if (val <= 3600) { newLcdBlSec = val; hasLcdBlSec = true; }
+  if (f.has_(F_LCD_BL_SEC)) {
+    double val = f.num[F_LCD_BL_SEC];
+    if (val >= 0 && val <= 3600) { newLcdBlSec = (uint16_t)val; hasLcdBlSec = true; }
     else { _sendJson(false, "lcdBlSec: 0–3600"); return; }
   }
-  static char apPassBuf[24];
-  if (doc.containsKey("apPass")) {
-    const char* pass = doc["apPass"].as<const char*>();
-    if (pass && strlen(pass) >= 8 && strlen(pass) <= 23) {
-      strncpy(apPassBuf, pass, sizeof(apPassBuf) - 1);
-      apPassBuf[sizeof(apPassBuf) - 1] = '\0';
-      newApPass = apPassBuf;
-    }
+  if (f.has_(F_AP_PASS)) {
+    const char* pass = f.s(F_AP_PASS);
+    if (strlen(pass) >= 8 && strlen(pass) <= 23) newApPass = pass;
     else { _sendJson(false, "apPass: 8–23 символа"); return; }
   }
 
@@ -1506,24 +954,12 @@ static void _handleSettings() {
       newApPass
     );
   }
-  if (doc.containsKey("schedTimes")) {
-    JsonArray arr = doc["schedTimes"].as<JsonArray>();
-    uint16_t times[8]; uint8_t cnt = 0;
-    for (JsonVariant v : arr) {
-      const char* s = v.as<const char*>();
-      if (!s) continue;
-      int h = 0, m = 0;
-      if (sscanf(s, "%d:%d", &h, &m) == 2 && h >= 0 && h <= 23 && m >= 0 && m <= 59) {
-        if (cnt < 8) times[cnt++] = (uint16_t)h * 60 + m;
-      }
-    }
-    set_sched_times(times, cnt);
-  }
+  if (f.has_(F_SCHED)) set_sched_times(f.sched, f.schedCnt);
 
   // Авто-бэкап на SD при изменении настроек
-  log_save_backup(_buildBackupJson());
+  _saveBackup();
 
-  _sendJson(true, "Сохранено");
+  _sendForm(f, "Сохранено");
 }
 
 static void _handleReboot() {
@@ -1532,133 +968,491 @@ static void _handleReboot() {
   _srv.client().flush();
   _srv.client().stop();
   delay(500);
+  log_flush();
   ESP.restart();
 }
 
-// Обработчик NTP синхронизации
+// ─── /api/ntp  POST — синхронизировать время ─────────────────────────────
+// Как /api/tg/test: POST запускает SNTP (ntp_sync_begin), ответ ждёт
+// webserver_handle() через ntp_sync_poll(), результат отдаёт GET /api/ntp
 static void _handleNtp() {
   if (!_auth()) return;
   _activity();
-  if (_srv.method() != HTTP_POST) { _sendJson(false,"Только POST"); return; }
-
-  Serial.println(F("[Web] NTP sync requested..."));
-
-  if (ntp_sync_time()) {
-    _sendJson(true, "Время синхронизировано");
-  } else {
-    _sendJson(false, "Ошибка синхронизации");
+  uint8_t st = ntp_sync_state();
+  if (_srv.method() == HTTP_POST && st != NTP_SYNC_BUSY) {
+    Serial.println(F("[Web] NTP sync requested..."));
+    st = ntp_sync_begin() ? NTP_SYNC_BUSY : NTP_SYNC_FAIL;
   }
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  j.add("ok",      st != NTP_SYNC_FAIL);
+  j.add("pending", st == NTP_SYNC_BUSY);
+  j.add("msg",     st == NTP_SYNC_BUSY ? "Синхронизация…"
+                 : st == NTP_SYNC_OK   ? "Время синхронизировано"
+                 : st == NTP_SYNC_FAIL ? "Ошибка синхронизации"
+                                       : "Синхронизация не запускалась");
+  j.endObject();
+  cs.flush();
 }
 
 static void _handleChart() {
   if (!_auth()) return;
   _activity();
-  _sendProgmemChunked(PAGE_HTML);
+  _sendUi("/index.html");
 }
 
 static void _handleWifi() {
   if (!_auth()) return;
   _activity();
-  _sendProgmemChunked(PAGE_HTML);
+  _sendUi("/index.html");
 }
 
 // ─── /api/tg/settings  POST — сохранить Telegram токен и chat_id ─────────
 static void _handleTgSettings() {
+  FormHold form(FORM_TG);
   if (!_auth()) return;
   _activity();
   if (_srv.method() != HTTP_POST) { _sendJson(false,"Только POST"); return; }
-  StaticJsonDocument<256> doc;
-  DeserializationError err = deserializeJson(doc, _srv.arg("plain"));
-  if (err) { _sendJson(false,"Ошибка JSON"); return; }
+  if (!_formOk(form, true)) return;
+  const BodyForm &f = *form.f;
   // Batch: собираем token и chatId, один commit через set_tg_all()
   const char* newToken = NULL;
   const char* newChatId = NULL;
-  if (doc.containsKey("token")) {
-    const char* t = doc["token"].as<const char*>();
-    if (t && strlen(t) > 0 && strlen(t) < 50 && strchr(t, '*') == NULL) newToken = t;
-    else if (t && strlen(t) == 0) newToken = "";
+  if (f.has_(F_TG_TOKEN)) {
+    const char* t = f.s(F_TG_TOKEN);
+    if (strlen(t) > 0 && strlen(t) < 50 && strchr(t, '*') == NULL) newToken = t;
+    else if (strlen(t) == 0) newToken = "";
   }
-  if (doc.containsKey("chatId")) {
-    const char* c = doc["chatId"].as<const char*>();
-    if (c && strlen(c) < 16) newChatId = c;
+  if (f.has_(F_TG_CHAT)) {
+    const char* c = f.s(F_TG_CHAT);
+    if (strlen(c) < 16) newChatId = c;
   }
   if (newToken || newChatId) set_tg_all(newToken, newChatId);
-  if (doc.containsKey("reportInt")) {
-    uint32_t v = doc["reportInt"].as<uint32_t>();
+  if (f.has_(F_TG_REPORT)) {
+    double v = f.num[F_TG_REPORT];
     // 0 = откл, минимум 60 мин, максимум 10080 (7 дней)
-    if (v == 0 || (v >= 60 && v <= 10080)) set_tg_report_interval_min(v);
+    if (v == 0 || (v >= 60 && v <= 10080)) set_tg_report_interval_min((uint32_t)v);
   }
-  log_save_backup(_buildBackupJson());
-  _sendJson(true, "Telegram настройки сохранены");
+  _saveBackup();
+  _sendForm(f, "Telegram настройки сохранены");
 }
 
 // ─── /api/tg/test  POST — отправить тестовое сообщение ──────────────────
+// Отправка идёт в фоне (tg_send_begin/tg_send_poll): webserver_handle() ведёт
+// TLS-обмен порциями по TG_SLICE_MS, loop() не ждёт сети. Результат страница
+// забирает GET /api/tg/test
 static void _handleTgTest() {
   if (!_auth()) return;
   _activity();
-  bool ok = tg_send_message("BeehiveScale: тестовое сообщение. Весы работают!");
-  _sendJson(ok, ok ? "Сообщение отправлено" : "Ошибка отправки (проверьте token/chat_id)");
+  uint8_t st = tg_send_state();
+  if (_srv.method() == HTTP_POST && st != TG_SEND_BUSY) {
+    st = tg_send_begin("BeehiveScale: тестовое сообщение. Весы работают!") ? TG_SEND_BUSY : TG_SEND_FAIL;
+  }
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  j.add("ok",      st != TG_SEND_FAIL);
+  j.add("pending", st == TG_SEND_BUSY);
+  j.add("msg",     st == TG_SEND_BUSY ? "Отправка…"
+                 : st == TG_SEND_OK   ? "Сообщение отправлено"
+                 : st == TG_SEND_FAIL ? "Ошибка отправки (проверьте token/chat_id)"
+                                      : "Тест не запускался");
+  j.endObject();
+  cs.flush();
 }
 
 // ─── /api/calib/set  POST — установить cal.factor и offset ───────────────
 static void _handleCalibSet() {
+  FormHold form(FORM_CALIB);
   if (!_auth()) return;
   _activity();
   if (_srv.method() != HTTP_POST) { _sendJson(false,"Только POST"); return; }
-  StaticJsonDocument<128> doc;
-  DeserializationError err = deserializeJson(doc, _srv.arg("plain"));
-  if (err) { _sendJson(false,"Ошибка JSON"); return; }
+  if (!_formOk(form, true)) return;
+  const BodyForm &f = *form.f;
   bool changed = false;
-  if (doc.containsKey("calibFactor") && _wa.doSetCalibFactor) {
-    float cf = doc["calibFactor"].as<float>();
+  if (f.has_(F_CALIB_FACTOR) && _wa.doSetCalibFactor) {
+    float cf = f.num[F_CALIB_FACTOR];
     if (cf >= 100.0f && cf <= 100000.0f) {
       _wa.doSetCalibFactor(cf);
       changed = true;
     } else { _sendJson(false,"calibFactor: 100–100000"); return; }
   }
-  if (doc.containsKey("offset") && _wa.doSetCalibOffset) {
-    long ofs = doc["offset"].as<long>();
+  if (f.has_(F_OFFSET) && _wa.doSetCalibOffset) {
+    long ofs = (long)f.num[F_OFFSET];
     _wa.doSetCalibOffset(ofs);
     changed = true;
   }
-  if (changed) { log_save_backup(_buildBackupJson()); _sendJson(true, "Калибровка обновлена"); }
+  if (changed) { _saveBackup(); _sendForm(f, "Калибровка обновлена"); }
   else _sendJson(false, "Нет данных для обновления");
 }
 
 // ─── /api/wifi/settings  POST — сохранить режим WiFi и credentials ──────
 static void _handleWifiSettings() {
+  FormHold form(FORM_WIFI);
   if (!_auth()) return;
   _activity();
   if (_srv.method() != HTTP_POST) { _sendJson(false,"Только POST"); return; }
-  StaticJsonDocument<256> doc;
-  DeserializationError err = deserializeJson(doc, _srv.arg("plain"));
-  if (err) { _sendJson(false,"Ошибка JSON"); return; }
-  if (!doc.containsKey("wifiMode")) { _sendJson(false,"Нет wifiMode"); return; }
-  uint8_t mode = doc["wifiMode"].as<uint8_t>();
-  if (mode > 1) { _sendJson(false,"wifiMode: 0 или 1"); return; }
+  if (!_formOk(form, true)) return;
+  const BodyForm &f = *form.f;
+  if (!f.has_(F_WIFI_MODE)) { _sendJson(false,"Нет wifiMode"); return; }
+  if (f.num[F_WIFI_MODE] != 0 && f.num[F_WIFI_MODE] != 1) { _sendJson(false,"wifiMode: 0 или 1"); return; }
+  uint8_t mode = (uint8_t)f.num[F_WIFI_MODE];
   // Batch: один commit через set_wifi_all() вместо 3 отдельных
   const char *ssid = NULL;
   const char *pass = NULL;
   if (mode == 1) {
-    ssid = doc["wifiSsid"].as<const char*>();
-    pass = doc["wifiPass"].as<const char*>();
+    ssid = f.has_(F_WIFI_SSID) ? f.s(F_WIFI_SSID) : NULL;
+    pass = f.has_(F_WIFI_PASS) ? f.s(F_WIFI_PASS) : NULL;
     if (!ssid || strlen(ssid) == 0) { _sendJson(false,"Введите SSID роутера"); return; }
     if (strlen(ssid) > 32) { _sendJson(false,"SSID слишком длинный (макс 32)"); return; }
     if (pass && strlen(pass) > 32) { _sendJson(false,"Пароль слишком длинный (макс 32)"); return; }
   }
   set_wifi_all(mode, ssid, pass);
-  log_save_backup(_buildBackupJson());
-  _sendJson(true, "WiFi настройки сохранены, перезагрузка...");
+  _saveBackup();
+  _sendForm(f, "WiFi настройки сохранены, перезагрузка...");
   _srv.client().flush();
   delay(300);
+  log_flush();
   ESP.restart();
 }
 
+// Прочие GET вне /api/ — файлы интерфейса (app.css, app.js, загруженные в WWW_DIR)
 static void _handleNotFound() {
+  if (_srv.method() == HTTP_GET && !_srv.uri().startsWith("/api/")) {
+    if (!_auth()) return;
+    if (_sendUi(_srv.uri())) return;
+  }
   _srv.send(404, "text/plain", "Not found");
 }
 
-// ─── /api/log  GET — скачать CSV-лог (опционально: ?date=YYYY-MM-DD) ─────
+// Санитизация даты из параметра: только цифры, '-' и '.', длина ≤10
+// (защита от HTTP header injection). false — недопустимые символы.
+static bool _cleanDateArg(String &d) {
+  if (d.length() > 10) d = d.substring(0, 10);
+  for (unsigned int i = 0; i < d.length(); i++) {
+    char ch = d[i];
+    if (!isdigit(ch) && ch != '-' && ch != '.') return false;
+  }
+  return true;
+}
+
+// Поток-окно: в out уходят только байты [from, to] того, что в него пишут;
+// pos считает всё (out == nullptr — только подсчёт длины)
+class RangeStream : public Stream {
+public:
+  Stream  *out;
+  uint32_t pos, from, to;
+  RangeStream(Stream *o, uint32_t f, uint32_t t) : out(o), pos(0), from(f), to(t) {}
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t s) override {
+    uint32_t p0 = pos;
+    pos += s;
+    if (!out || pos <= from || p0 > to) return s;
+    size_t a = (from > p0) ? from - p0 : 0;
+    size_t e = (to - p0 < s) ? to - p0 + 1 : s;  // p0 ≤ to; to может быть 0xFFFFFFFF
+    out->write(b + a, e - a);
+    return s;
+  }
+  int available() override { return 0; }
+  int read()      override { return -1; }
+  int peek()      override { return -1; }
+  void flush()    override { if (out) out->flush(); }
+};
+
+// Клиент принимает gzip (Accept-Encoding)
+static bool _acceptsGzip() {
+  return _srv.header("Accept-Encoding").indexOf("gzip") >= 0;
+}
+
+// Потоковый ответ 200 chunked: тело пишет gen(Stream&). Если клиент принимает
+// gzip и хватает heap под сжатие — тело сжимается на лету (GzipStream):
+// по AP уходит в разы меньше байт, сервер занят во столько же раз меньше
+template <typename F>
+static void _sendStream(const char *type, F gen) {
+  ChunkStream cs(_srv);
+  GzipStream gz(cs);
+  bool z = _acceptsGzip() && gz.begin();
+  if (z) _srv.sendHeader("Content-Encoding", "gzip");
+  _srv.sendHeader("Vary", "Accept-Encoding");
+  _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  _srv.send(200, type, "");
+  if (z) { gen((Stream&)gz); gz.end(); }
+  else   gen((Stream&)cs);
+  cs.flush();
+}
+
+// ─── Фоновые ответы ──────────────────────────────────────────────────────
+// Выгрузка лога не пишется в обработчике целиком: соединение забирается у
+// сервера в слот, а тело отдаётся из webserver_handle() порциями — не больше,
+// чем TCP примет без ожидания (availableForWrite). Медленный клиент не держит
+// loop(): весы, SSE и другие запросы обслуживаются между порциями. Тело — из
+// курсора лога (LogCursor) или порционного генератора (JobGen), и считается
+// оно тоже порциями — не дольше WEB_JOB_SLICE_MS за вызов. Заголовки пишутся
+// в сокет сами; конец тела — закрытие соединения, если длина заранее неизвестна.
+
+// Ещё не отправленные байты ответа (куча): дописываются в конец, уходят с начала
+class JobBuf : public Stream {
+public:
+  uint8_t *data = nullptr;
+  size_t   len = 0, cap = 0;
+  bool     oom = false;  // не хватило heap — ответ обрывается
+  ~JobBuf() { free(data); }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) override {
+    if (len + n > cap) {
+      size_t c = (len + n + 255) & ~(size_t)255;
+      uint8_t *p = (uint8_t*)realloc(data, c);
+      if (!p) { oom = true; return 0; }
+      data = p;
+      cap  = c;
+    }
+    memcpy(data + len, b, n);
+    len += n;
+    return n;
+  }
+  void consume(size_t n) { memmove(data, data + n, len - n); len -= n; }
+  int available() override { return 0; }
+  int read()      override { return -1; }
+  int peek()      override { return -1; }
+};
+
+// Тело ответа из генератора лога: step пишет следующую порцию, true — всё
+struct JobGen {
+  virtual ~JobGen() {}
+  virtual bool step(Stream &out) = 0;
+};
+
+struct QueryGen : public JobGen {
+  LogQuery q = {};
+  bool step(Stream &out) override { return log_query_step(q, out, 32); }
+};
+
+struct PointsGen : public JobGen {
+  LogPoints p = {};
+  ~PointsGen() { log_points_end(p); }
+  bool step(Stream &out) override { return log_points_step(p, out, 32); }
+};
+
+struct SinceGen : public JobGen {
+  LogSince s = {};
+  bool step(Stream &out) override { return log_since_step(s, out, 32); }
+};
+
+struct WebJob {
+  WiFiClient    cli;
+  JobBuf        buf;
+  GzipStream    gz;              // сжатие тела CSV (z)
+  RangeStream   win;             // окно Range над телом CSV; pos — его длина
+  ZipStream    *zip = nullptr;   // архив /api/log/export вместо CSV
+  JobGen       *gen = nullptr;   // тело из генератора вместо курсора
+  LogCursor     cur;
+  LogCursor     start;           // курсор с начала — после подсчёта длины
+  bool          z = false;
+  bool          tail = false;    // концовка (gzip, каталог ZIP) дописана
+  void        (*onDone)(WebJob &j) = nullptr;   // тело CSV выдано целиком
+  void        (*onCount)(WebJob &j) = nullptr;  // курсор только считал длину (win.pos)
+  String        hdr, rng;        // для onCount: заголовки и Range запроса
+  char          key[64] = "";    // для onDone
+  uint32_t      size = 0, lastTs = 0;
+  unsigned long ioAt = 0;        // последняя отправка — для таймаута
+  WebJob() : gz(buf), win(nullptr, 0, 0xFFFFFFFFUL) {}
+  ~WebJob() { delete zip; delete gen; }
+};
+static WebJob *_jobs[WEB_JOBS_MAX];
+
+static int _jobSlot() {
+  for (int i = 0; i < WEB_JOBS_MAX; i++) if (!_jobs[i]) return i;
+  return -1;
+}
+
+// Новая выгрузка; nullptr — слоты заняты или нет heap
+static WebJob *_jobNew() {
+  return (_jobSlot() >= 0) ? new (std::nothrow) WebJob() : nullptr;
+}
+
+// Статус, тип и заголовки hdr ("Имя: значение\r\n") ответа j — в буфер;
+// len < 0 — длина неизвестна
+static void _jobHead(WebJob &j, int code, const char *type, const String &hdr, long len) {
+  j.buf.printf("HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code,
+               code == 206 ? "Partial Content" : code == 416 ? "Range Not Satisfiable" : "OK", type);
+  j.buf.print(hdr);
+  if (len >= 0) j.buf.printf("Content-Length: %ld\r\n", len);
+  j.buf.print(F("Connection: close\r\n\r\n"));
+}
+
+// Соединение запроса — в слот выгрузки j
+static void _jobTake(WebJob *j) {
+  j->cli  = _takeClient();
+  j->cli.setNoDelay(true);
+  j->ioAt = millis();
+  _jobs[_jobSlot()] = j;
+}
+
+// Начать ответ выгрузки j с заголовками (как _jobHead); false — нет heap
+static bool _jobRun(WebJob *j, int code, const char *type, const String &hdr, long len) {
+  _jobHead(*j, code, type, hdr, len);
+  if (j->buf.oom) { delete j; return false; }
+  _jobTake(j);
+  return true;
+}
+
+// Ответ 200 из генератора g в фоне; gzip — если клиент принимает. Поток, в
+// который генератор пишет начало тела; nullptr — слотов или heap нет (g удалён)
+static Stream *_jobGen(JobGen *g, const char *type) {
+  WebJob *j = g ? _jobNew() : nullptr;
+  if (!j) { delete g; return nullptr; }
+  j->gen = g;
+  j->z = _acceptsGzip() && j->gz.begin();
+  String hdr = "Vary: Accept-Encoding\r\n";
+  if (j->z) hdr += "Content-Encoding: gzip\r\n";
+  if (!_jobRun(j, 200, type, hdr, -1)) return nullptr;
+  return j->z ? (Stream*)&j->gz : (Stream*)&j->buf;
+}
+
+// Выгрузку начать нельзя — клиент повторит позже
+static void _jobBusy() {
+  _srv.sendHeader("Retry-After", "5");
+  _srv.send(503, "text/plain", "Busy");
+}
+
+static void _jobEnd(int i) {
+  _jobs[i]->cli.stop();
+  delete _jobs[i];
+  _jobs[i] = nullptr;
+}
+
+// Дополнить буфер до WEB_JOB_BUF из курсора или генератора, но не дольше
+// WEB_JOB_SLICE_MS от t0; false — отдавать больше нечего
+static bool _jobFill(WebJob &j, unsigned long t0) {
+  while (j.buf.len < WEB_JOB_BUF && !j.tail && !j.buf.oom && millis() - t0 < WEB_JOB_SLICE_MS) {
+    if (j.gen) {
+      j.tail = j.gen->step(j.z ? (Stream&)j.gz : (Stream&)j.buf);
+      if (j.tail && j.z) j.gz.end();
+    } else if (!j.cur.done) {
+      log_cursor_csv(j.cur, j.zip ? (Stream&)*j.zip : (Stream&)j.win, 16);
+    } else if (j.onCount) {
+      void (*f)(WebJob &j) = j.onCount;
+      j.onCount = nullptr;
+      f(j);
+    } else if (j.zip) {
+      j.tail = j.zip->finish(16);
+    } else {
+      if (j.z) j.gz.end();
+      j.tail = true;
+      if (j.onDone) j.onDone(j);
+    }
+  }
+  return j.buf.len > 0 || !j.tail;
+}
+
+static void _jobPump() {
+  for (int i = 0; i < WEB_JOBS_MAX; i++) {
+    WebJob *j = _jobs[i];
+    if (!j) continue;
+    unsigned long t0 = millis();
+    for (;;) {
+      if (j->buf.oom || !j->cli.connected() || millis() - j->ioAt > WEB_JOB_TIMEOUT_MS ||
+          !_jobFill(*j, t0)) {
+        _jobEnd(i);
+        break;
+      }
+      // Буфер пуст — время ушло на подсчёт (проход LTTB, длина для Range):
+      // клиент ничего не ждёт, продолжение — в следующий раз
+      if (j->buf.len == 0) { j->ioAt = millis(); break; }
+      int room = j->cli.availableForWrite();
+      size_t n = 0;
+      if (room > 0) {
+        n = j->cli.write(j->buf.data, j->buf.len < (size_t)room ? j->buf.len : (size_t)room);
+        j->buf.consume(n);
+        if (n) j->ioAt = millis();
+      }
+      if (n == 0 || millis() - t0 >= WEB_JOB_SLICE_MS) break;  // остальное — в следующий раз
+    }
+  }
+}
+
+// Заголовки "Имя: значение\r\n…" — в обычный ответ сервера
+static void _srvHeaders(const String &h) {
+  int p = 0, e;
+  while ((e = h.indexOf("\r\n", p)) > p) {
+    int c = h.indexOf(':', p);
+    _srv.sendHeader(h.substring(p, c), h.substring(c + 2, e));
+    p = e + 2;
+  }
+}
+
+// ─── /api/log  GET — скачать CSV-лог ──────────────────────────────────────
+// Опционально: ?date=YYYY-MM-DD или ?from=YYYY-MM-DD&to=YYYY-MM-DD (включительно)
+// ETag — размер лога + время последней записи: повторная загрузка неизменного
+// лога — 304 без чтения файлов. Range: bytes=a-b | a- | -n — докачка с любого
+// байта (CSV собирается на лету, поэтому начало всё равно читается, но не
+// передаётся). Длина ответа запоминается для последнего ETag — при повторе
+// известен Content-Length, иначе для Range она считается холостым проходом
+// курсора в фоне, до заголовков ответа.
+static char     _csvKey[64] = "";
+static uint32_t _csvLen = 0;
+
+// Курсор выдачи: диапазон from..to или дата (как у log_stream_csv_date:
+// дата не из 10 символов — весь лог)
+static void _logCursor(LogCursor &c, const String &date, const String &from, const String &to) {
+  if (from.length()) log_cursor_begin(c, from, to);
+  else               log_cursor_begin(c, date.length() == 10 ? date : String(), date.length() == 10 ? date : String());
+}
+
+// Range "bytes=a-b | a- | -n" для тела длины total → [first, last]; false — 416
+static bool _logRange(const String &rh, uint32_t total, uint32_t &first, uint32_t &last) {
+  int dash = rh.indexOf('-');
+  String a = rh.substring(6, dash), b = rh.substring(dash + 1);
+  last = total ? total - 1 : 0;
+  bool ok = dash > 6 || (dash == 6 && b.length() > 0);
+  if (dash == 6) {                      // bytes=-n: последние n байт
+    uint32_t n = b.toInt();
+    first = (n < total) ? total - n : 0;
+    ok = ok && n > 0;
+  } else {
+    first = a.toInt();
+    if (b.length() && (uint32_t)b.toInt() < last) last = b.toInt();
+    ok = ok && (b.length() == 0 || (uint32_t)b.toInt() >= first);
+  }
+  return ok && first < total;
+}
+
+// Полная выдача выгружена (или сосчитана): её длина — для Content-Length и
+// Range следующих запросов, если лог за это время не менялся
+static void _logJobDone(WebJob &j) {
+  uint32_t size, lastTs;
+  log_stamp(size, lastTs);
+  if (size != j.size || lastTs != j.lastTs) return;
+  snprintf(_csvKey, sizeof(_csvKey), "%s", j.key);
+  _csvLen = j.win.pos;
+}
+
+// Длина сосчитана: заголовки 206 (или 416) и выдача окна с начала курсора.
+// Если лог за время подсчёта дописан, окно всё равно ровно [first, last]
+static void _logCounted(WebJob &j) {
+  uint32_t total = j.win.pos, first, last;
+  _logJobDone(j);
+  if (!_logRange(j.rng, total, first, last)) {
+    _jobHead(j, 416, "text/plain", j.hdr + "Content-Range: bytes */" + String(total) + "\r\n", 21);
+    j.buf.print(F("Range Not Satisfiable"));
+    j.tail = true;
+    return;
+  }
+  _jobHead(j, 206, "text/csv; charset=utf-8", j.hdr + "Content-Range: bytes " + String(first) + "-" +
+           String(last) + "/" + String(total) + "\r\n", (long)(last - first + 1));
+  j.hdr = String();
+  j.rng = String();
+  j.cur = j.start;
+  j.win.out  = &j.buf;
+  j.win.pos  = 0;
+  j.win.from = first;
+  j.win.to   = last;
+  j.win.print(log_csv_header());
+}
+
 static void _handleLog() {
   if (!_auth()) return;
   _activity();
@@ -1667,113 +1461,225 @@ static void _handleLog() {
     return;
   }
   String date = _srv.arg("date");  // "" если параметр не передан
-  // Санитизация: только цифры, '-' и '.', длина ≤10 (защита от HTTP header injection)
-  if (date.length() > 0) {
-    if (date.length() > 10) date = date.substring(0, 10);
-    for (unsigned int i = 0; i < date.length(); i++) {
-      char ch = date[i];
-      if (!isdigit(ch) && ch != '-' && ch != '.') {
-        _srv.send(400, "text/plain", "Bad date");
-        return;
-      }
-    }
+  String from = _srv.arg("from");
+  String to   = _srv.arg("to");
+  if (!_cleanDateArg(date) || !_cleanDateArg(from) || !_cleanDateArg(to)) {
+    _srv.send(400, "text/plain", "Bad date");
+    return;
   }
-  if (date.length() == 0) {
-    // Без фильтра — стримим весь файл напрямую
-    File f;
-#ifdef USE_SD_CARD
-    if (log_using_fallback()) {
-      f = LittleFS.open(LOG_FILE, "r");
-    } else {
-      f = SD.open(LOG_FILE, FILE_READ);
-    }
-#else
-    f = LOG_FS.open(LOG_FILE, "r");
-#endif
-    if (!f) { _srv.send(500, "text/plain", "Cannot open log"); return; }
-    _srv.sendHeader("Content-Disposition", "attachment; filename=\"beehive_log.csv\"");
-    _srv.streamFile(f, "text/csv");
-    f.close();
-  } else {
-    // С фильтром по дате — стримим чанками (chunked transfer) для экономии heap
-    String fname = "beehive_" + date + ".csv";
-    _srv.sendHeader("Content-Disposition", "attachment; filename=\"" + fname + "\"");
-    _srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
-    _srv.send(200, "text/csv; charset=utf-8", "");
-    {
-      class ChunkStream : public Stream {
-      public:
-        WebServerCompat &srv;
-        char buf[256];
-        uint16_t pos;
-        ChunkStream(WebServerCompat &s) : srv(s), pos(0) {}
-        size_t write(uint8_t c) override {
-          buf[pos++] = (char)c;
-          if (pos >= sizeof(buf)) _flush_buf();
-          return 1;
-        }
-        size_t write(const uint8_t *b, size_t s) override {
-          size_t sent = 0;
-          while (sent < s) {
-            size_t n = (s - sent > 512) ? 512 : (s - sent);
-            if (pos > 0) _flush_buf();
-            srv.sendContent((const char*)(b + sent), n);
-            sent += n;
-            yield();  // WDT safe: не блокировать loop при стриме CSV
-          }
-          return s;
-        }
-        void _flush_buf() { if (pos > 0) { srv.sendContent(buf, pos); pos = 0; } }
-        int available() override { return 0; }
-        int read()      override { return -1; }
-        int peek()      override { return -1; }
-        void flush()    override { _flush_buf(); }
-      } cs(_srv);
-      log_stream_csv_date(cs, date);
-      cs.flush();
+  bool range = from.length() > 0 || to.length() > 0;
+  if (range && (from.length() != 10 || to.length() != 10)) {
+    _srv.send(400, "text/plain", "Need from and to");
+    return;
+  }
+  if (_jobSlot() < 0) { _jobBusy(); return; }
+  // Валидаторы: время RTC местное, в Last-Modified подписано как GMT —
+  // клиент лишь возвращает строку обратно в If-Modified-Since
+  uint32_t size, lastTs;
+  log_stamp(size, lastTs);
+  // Сжатый вариант — отдельный ETag (…-gz); докачка — только несжатого
+  char core[20], etag[24], etagGz[28], lm[32];
+  snprintf(core, sizeof(core), "%lx-%lx", (unsigned long)size, (unsigned long)lastTs);
+  snprintf(etag, sizeof(etag), "\"%s\"", core);
+  snprintf(etagGz, sizeof(etagGz), "\"%s-gz\"", core);
+  time_t t = (time_t)lastTs;
+  struct tm tmv;
+  gmtime_r(&t, &tmv);
+  strftime(lm, sizeof(lm), "%a, %d %b %Y %H:%M:%S GMT", &tmv);
+  String hdr = String("Last-Modified: ") + lm +
+               "\r\nAccept-Ranges: bytes\r\nCache-Control: no-cache\r\nVary: Accept-Encoding\r\n";
+
+  // Range — один интервал; If-Range с чужим валидатором — целиком
+  String rh = _srv.header("Range");
+  String ir = _srv.header("If-Range");
+  bool partial = rh.startsWith("bytes=") && rh.indexOf(',') < 0 &&
+                 (ir.length() == 0 || ir == etag || ir == lm);
+  bool wantGz = !partial && _acceptsGzip();
+  String inm = _srv.header("If-None-Match");
+  if (inm.length() ? (inm.indexOf(core) >= 0 || inm == "*") : _srv.header("If-Modified-Since") == lm) {
+    _srvHeaders(hdr);
+    _srv.sendHeader("ETag", wantGz ? etagGz : etag);
+    _srv.send(304, "text/plain", "");
+    return;
+  }
+  char key[64];
+  snprintf(key, sizeof(key), "%s%s%s%s", etag, date.c_str(), from.c_str(), to.c_str());
+  bool known = (strcmp(key, _csvKey) == 0);
+  String fname = range ? "beehive_" + from + "_" + to + ".csv"
+               : date.length() ? "beehive_" + date + ".csv" : String("beehive_log.csv");
+  hdr += "Content-Disposition: attachment; filename=\"" + fname + "\"\r\n";
+
+  // Без фильтра — все партиции лога подряд, с фильтром — только нужные дни.
+  // CSV собирается курсором на лету и отдаётся в фоне; длина известна — с
+  // Content-Length, с gzip — сжатым на лету (длина тогда неизвестна)
+  WebJob *j = _jobNew();
+  if (!j) { _jobBusy(); return; }
+  snprintf(j->key, sizeof(j->key), "%s", key);
+  j->size   = size;
+  j->lastTs = lastTs;
+  _logCursor(j->cur, date, from, to);
+  if (partial && !known) {
+    // Длина неизвестна: сначала холостой проход курсора (win без выхода),
+    // заголовки 206 или 416 — по его итогу (_logCounted)
+    j->start   = j->cur;
+    j->hdr     = hdr + "ETag: " + etag + "\r\n";
+    j->rng     = rh;
+    j->onCount = _logCounted;
+    _jobTake(j);
+    j->win.print(log_csv_header());
+    return;
+  }
+
+  uint32_t first = 0, last = 0xFFFFFFFFUL;
+  if (partial) {
+    if (!_logRange(rh, _csvLen, first, last)) {
+      delete j;
+      _srvHeaders(hdr);
+      _srv.sendHeader("Content-Range", "bytes */" + String(_csvLen));
+      _srv.send(416, "text/plain", "Range Not Satisfiable");
+      return;
     }
+    hdr += String("ETag: ") + etag + "\r\nContent-Range: bytes " + String(first) + "-" +
+           String(last) + "/" + String(_csvLen) + "\r\n";
+  } else if (known) {
+    last = _csvLen ? _csvLen - 1 : 0;
   }
-}
 
-// ─── /api/daystat  GET — суточная статистика (фичи 12, 17) ──────────────
-static void _handleDayStat() {
+  j->z = wantGz && j->gz.begin();
+  if (!partial) hdr += String("ETag: ") + (j->z ? etagGz : etag) + "\r\n";
+  if (j->z) hdr += "Content-Encoding: gzip\r\n";
+  long len = partial ? (long)(last - first + 1) : (known && !j->z) ? (long)_csvLen : -1;
+  j->win.out  = j->z ? (Stream*)&j->gz : (Stream*)&j->buf;
+  j->win.from = first;
+  j->win.to   = last;
+  if (!partial) j->onDone = _logJobDone;  // длина полной выдачи запомнится в конце
+  if (!_jobRun(j, partial ? 206 : 200, "text/csv; charset=utf-8", hdr, len)) { _jobBusy(); return; }
+  j->win.print(log_csv_header());
+}
+
+// ─── /api/log/export  GET — ZIP-архив с CSV по дням ───────────────────────
+// ?from=YYYY-MM-DD&to=YYYY-MM-DD[&compress=0]: сезон одним запросом и одним
+// последовательным чтением вместо запроса ?date= на каждый день. Отдаётся в фоне.
+static void _handleLogExport() {
   if (!_auth()) return;
-  _keepalive();  // GET-поллинг — не сбрасывать подсветку
-  // Дата из параметра или текущая из RTC
-  String date = _srv.arg("date");
-  // Санитизация: только цифры, '-' и '.', длина ≤10 (защита от инъекций)
-  if (date.length() > 0) {
-    if (date.length() > 10) date = date.substring(0, 10);
-    for (unsigned int i = 0; i < date.length(); i++) {
-      char ch = date[i];
-      if (!isdigit(ch) && ch != '-' && ch != '.') {
-        _srv.send(400, "text/plain", "Bad date");
-        return;
-      }
-    }
+  _activity();
+  String from = _srv.arg("from");
+  String to   = _srv.arg("to");
+  if (!_cleanDateArg(from) || !_cleanDateArg(to) || from.length() != 10 || to.length() != 10) {
+    _srv.send(400, "text/plain", "Need from and to");
+    return;
   }
-  if (date.length() == 0) date = *_wd.datetime;  // "DD.MM.YYYY HH:MM:SS" → берём первые 10
-  if (date.length() > 10) date = date.substring(0, 10);
-  if (date.length() < 10) {
-    _sendJson(false, "Дата недоступна");
+  WebJob *j = _jobNew();
+  if (j) j->zip = new (std::nothrow) ZipStream(j->buf);
+  if (!j || !j->zip) { delete j; _jobBusy(); return; }
+  // Неверные даты — пустой, но корректный архив
+  log_export_begin(j->cur, *j->zip, from, to, _srv.arg("compress") != "0");
+  String hdr = "Content-Disposition: attachment; filename=\"beehive_" + from + "_" + to + ".zip\"\r\n";
+  if (!_jobRun(j, 200, "application/zip", hdr, -1)) _jobBusy();
+}
+
+// ─── /api/query  GET — агрегаты поля по интервалам ───────────────────────
+// ?field=weight|temp|hum|bat&from=…&to=…&bucket=15m|1h|1d&agg=min,max,mean,count
+// Интервалы считаются на устройстве за один проход по логу — в браузер уходят
+// только они, а не тысячи строк.
+#define QUERY_MAX_BUCKETS 2000
+
+static void _handleQuery() {
+  if (!_auth()) return;
+  _keepalive();  // GET-поллинг графика — не сбрасывать подсветку
+  String from = _srv.arg("from");
+  String to   = _srv.arg("to");
+  if (!_cleanDateArg(from) || !_cleanDateArg(to)) {
+    _srv.send(400, "text/plain", "Bad date");
+    return;
+  }
+  // Порядок — по ключам YYYYMMDD, длина диапазона — по номерам дней
+  uint32_t d0 = log_day_key(from), d1 = log_day_key(to);
+  if (d0 == 0 || d1 == 0 || d1 < d0) {
+    _srv.send(400, "text/plain", "Need from and to");
+    return;
+  }
+
+  String fs = _srv.arg("field");
+  LogField field;
+  if      (fs == "weight" || fs.length() == 0) field = LOG_FIELD_WEIGHT;
+  else if (fs == "temp")                       field = LOG_FIELD_TEMP;
+  else if (fs == "hum")                        field = LOG_FIELD_HUM;
+  else if (fs == "bat")                        field = LOG_FIELD_BAT;
+  else { _srv.send(400, "text/plain", "Bad field"); return; }
+
+  // bucket: число и единица s/m/h/d (по умолчанию 1h)
+  String bs = _srv.arg("bucket");
+  uint32_t bucket = 3600;
+  if (bs.length() > 0) {
+    char u = bs.charAt(bs.length() - 1);
+    uint32_t mul = (u == 's') ? 1 : (u == 'm') ? 60 : (u == 'h') ? 3600 : (u == 'd') ? 86400UL : 0;
+    long v = bs.substring(0, bs.length() - 1).toInt();
+    bucket = (mul && v > 0) ? (uint32_t)v * mul : 0;
+  }
+  if (bucket < 60 || bucket > 31UL * 86400UL || (86400UL % bucket != 0 && bucket % 86400UL != 0)) {
+    _srv.send(400, "text/plain", "Bad bucket");
+    return;
+  }
+  uint32_t days = (uint32_t)(log_day_number(d1) - log_day_number(d0)) + 1;
+  if ((uint64_t)days * 86400UL / bucket > QUERY_MAX_BUCKETS) {
+    _srv.send(400, "text/plain", "Too many buckets");
     return;
   }
+
+  // agg: список через запятую (по умолчанию min,max,mean)
+  String as = _srv.arg("agg");
+  uint8_t agg = 0;
+  if (as.length() == 0) as = "min,max,mean";
+  int p = 0;
+  while (p <= (int)as.length()) {
+    int c = as.indexOf(',', p);
+    if (c < 0) c = as.length();
+    String a = as.substring(p, c);
+    if      (a == "min")   agg |= LOG_AGG_MIN;
+    else if (a == "max")   agg |= LOG_AGG_MAX;
+    else if (a == "mean")  agg |= LOG_AGG_MEAN;
+    else if (a == "count") agg |= LOG_AGG_COUNT;
+    else { _srv.send(400, "text/plain", "Bad agg"); return; }
+    p = c + 1;
+  }
+
+  // Проход по логу — в фоне порциями; слоты заняты — целиком здесь: ответ
+  // ограничен QUERY_MAX_BUCKETS, а 503 сорвал бы опрос графика
+  QueryGen *g = new (std::nothrow) QueryGen();
+  Stream *o = _jobGen(g, "application/json");
+  if (o) log_query_begin(g->q, *o, field, from, to, bucket, agg);
+  else   _sendStream("application/json", [&](Stream &s) { log_query(s, field, from, to, bucket, agg); });
+}
+
+// ─── /api/daystat  GET — суточная статистика (фичи 12, 17) ──────────────
+// date — уже санитизирована (_cleanDateArg); пустая — текущая из RTC.
+// Приводится к DD.MM.YYYY; false — даты нет (RTC не выставлены)
+static bool _dayStatDate(String &date) {
+  if (date.length() == 0) date = *_wd.datetime;  // "DD.MM.YYYY HH:MM:SS" → берём первые 10
+  if (date.length() > 10) date = date.substring(0, 10);
+  if (date.length() < 10) return false;
   // Нормализация: YYYY-MM-DD → DD.MM.YYYY (единый формат для season/days/log_day_stat)
   if (date.length() == 10 && date.charAt(4) == '-') {
     // "YYYY-MM-DD" → "DD.MM.YYYY"
     date = date.substring(8, 10) + "." + date.substring(5, 7) + "." + date.substring(0, 4);
   }
+  return true;
+}
 
+// Поля суточной статистики за date (после _dayStatDate)
+static void _fillDayStat(JsonWriter &j, const String &date) {
   DayStat ds = log_day_stat(date);
 
-  StaticJsonDocument<256> doc;
-  doc["date"]   = date;
-  doc["valid"]  = ds.valid;
-  doc["wMin"]   = ds.valid ? ds.wMin : 0;
-  doc["wMax"]   = ds.valid ? ds.wMax : 0;
-  doc["tMin"]   = (ds.valid && ds.tMin < 1e8f) ? ds.tMin : (float)NAN;
-  doc["tMax"]   = (ds.valid && ds.tMax > -1e8f) ? ds.tMax : (float)NAN;
-  doc["count"]  = ds.count;
+  j.add("date",  date);
+  j.add("valid", ds.valid);
+  j.add("wMin",  ds.valid ? ds.wMin : 0.0f);
+  j.add("wMax",  ds.valid ? ds.wMax : 0.0f);
+  j.add("tMin",  (ds.valid && ds.tMin < 1e8f) ? ds.tMin : (float)NAN, 2);
+  j.add("tMax",  (ds.valid && ds.tMax > -1e8f) ? ds.tMax : (float)NAN, 2);
+  j.add("wAvg",  ds.valid ? ds.wAvg : 0.0f);
+  j.add("tAvg",  ds.valid ? ds.tAvg : 0.0f, 2);
+  j.add("count", (unsigned long)ds.count);
 
   // Фича 17: информация об улье
   // Сезон по месяцу (date уже нормализован к DD.MM.YYYY)
@@ -1783,14 +1689,15 @@ static void _handleDayStat() {
     (month >= 3 && month <= 5)  ? "Vesna" :
     (month >= 6 && month <= 8)  ? "Leto"  :
     (month >= 9 && month <= 11) ? "Osen"  : "Zima";
-  doc["season"] = season;
+  j.add("season", season);
 
   // Дней наблюдений: разница между текущей и первой датой лога
   // Обе даты в формате DD.MM.YYYY после нормализации
   {
     char firstDate[12];
     int days = 0;
-    if (log_first_date(firstDate, sizeof(firstDate)) && date.length() >= 10) {
+    bool haveFirst = log_first_date(firstDate, sizeof(firstDate));
+    if (haveFirst && date.length() >= 10) {
       int d1 = atoi(firstDate);      int m1 = atoi(firstDate + 3);  int y1 = atoi(firstDate + 6);
       int d2 = atoi(date.c_str());   int m2 = atoi(date.c_str()+3); int y2 = atoi(date.c_str()+6);
       long e1 = (long)y1*365 + y1/4 - y1/100 + y1/400 + (m1*306+5)/10 + d1;
@@ -1798,16 +1705,93 @@ static void _handleDayStat() {
       days = (int)(e2 - e1);
       if (days < 0) days = 0;
     }
-    doc["daysSinceStart"] = days > 0 ? days : (log_size() > 100 ? 1 : 0);
+    j.add("daysSinceStart", days > 0 ? days : (haveFirst ? 1 : 0));
   }
 
   // Последнее значительное изменение — дельта текущий - опорный
-  doc["deltaKg"] = *_wd.weight - *_wd.prevWeight;
+  j.add("deltaKg", *_wd.weight - *_wd.prevWeight);
+}
 
-  String out; serializeJson(doc, out);
-  _srv.send(200, "application/json", out);
+static void _handleDayStat() {
+  if (!_auth()) return;
+  _keepalive();  // GET-поллинг — не сбрасывать подсветку
+  // Дата из параметра или текущая из RTC
+  String date = _srv.arg("date");
+  // Санитизация: только цифры, '-' и '.', длина ≤10 (защита от инъекций)
+  if (!_cleanDateArg(date)) {
+    _srv.send(400, "text/plain", "Bad date");
+    return;
+  }
+  if (!_dayStatDate(date)) {
+    _sendJson(false, "Дата недоступна");
+    return;
+  }
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  _fillDayStat(j, date);
+  j.endObject();
+  cs.flush();
+}
+
+// ─── /api/dashboard  GET — всё для страницы одним ответом ───────────────
+// ?fields=data,day,config (по умолчанию data,day) — только нужные разделы:
+// {"data":{…как /api/data},"day":{…как /api/daystat},"config":{…как /api/config}}.
+// Обновление дашборда — один запрос (одно соединение и одна проверка Basic Auth)
+// вместо двух-трёх; разделы пишутся JsonWriter по очереди прямо в ответ.
+// day — null, если даты нет; ?date= — как у /api/daystat.
+#define DASH_DATA    0x01
+#define DASH_DAY     0x02
+#define DASH_CONFIG  0x04
+
+static void _handleDashboard() {
+  if (!_auth()) return;
+  _keepalive();  // поллинг — не сбрасывать подсветку
+  String date = _srv.arg("date");
+  if (!_cleanDateArg(date)) {
+    _srv.send(400, "text/plain", "Bad date");
+    return;
+  }
+  uint8_t mask = DASH_DATA | DASH_DAY;
+  if (_srv.hasArg("fields")) {
+    String f = "," + _srv.arg("fields") + ",";
+    mask = (f.indexOf(",data,")   >= 0 ? DASH_DATA   : 0) |
+           (f.indexOf(",day,")    >= 0 ? DASH_DAY    : 0) |
+           (f.indexOf(",config,") >= 0 ? DASH_CONFIG : 0);
+  }
+  bool day = (mask & DASH_DAY) && _dayStatDate(date);
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  j.beginObject();
+  if (mask & DASH_DATA) {
+    if (_dataSnap()) {             // готовый снимок /api/data
+      j.key("data");
+      cs.write((const uint8_t*)_dataBuf, _dataLen);
+    } else {
+      j.beginObject("data");
+      _fillData(j);
+      j.endObject();
+    }
+  }
+  if (day) {
+    j.beginObject("day");
+    _fillDayStat(j, date);
+    j.endObject();
+  } else if (mask & DASH_DAY) {
+    j.addNull("day");
+  }
+  if (mask & DASH_CONFIG) {
+    j.beginObject("config");
+    _fillConfig(j);
+    j.endObject();
+  }
+  j.endObject();
+  cs.flush();
 }
 
+
 // ─── /api/log/clear  POST — очистить лог ─────────────────────────────────
 static void _handleLogClear() {
   if (!_auth()) return;
@@ -1817,143 +1801,210 @@ static void _handleLogClear() {
 }
 
 // ─── /api/log/json  GET — лог в JSON ─────────────────────────────────────
+// Без параметров — последние 50 строк. ?from=…&to=…[&points=N] — весь диапазон,
+// прореженный на устройстве до ~N точек (LTTB, по умолчанию 300): ответ
+// и отрисовка не растут с длиной истории.
 static void _handleLogJson() {
   if (!_auth()) return;
   _keepalive();  // GET-поллинг — не сбрасывать подсветку
-  String json = log_to_json(50);
-  _srv.send(200, "application/json", json);
+  String from = _srv.arg("from");
+  String to   = _srv.arg("to");
+  if (from.length() == 0 && to.length() == 0) {
+    _sendStream("application/json", [&](Stream &s) { log_stream_json_tail(s, 50); });
+    return;
+  }
+  if (!_cleanDateArg(from) || !_cleanDateArg(to) || from.length() != 10 || to.length() != 10) {
+    _srv.send(400, "text/plain", "Need from and to");
+    return;
+  }
+  long points = _srv.hasArg("points") ? _srv.arg("points").toInt() : 300;
+  if (points < 3 || points > LOG_LTTB_MAX) {
+    _srv.send(400, "text/plain", "Bad points");
+    return;
+  }
+  // Оба прохода LTTB — в фоне порциями; слоты заняты — целиком здесь
+  PointsGen *g = new (std::nothrow) PointsGen();
+  Stream *o = _jobGen(g, "application/json");
+  if (o) log_points_begin(g->p, *o, from, to, (uint16_t)points, false);
+  else   _sendStream("application/json", [&](Stream &s) { log_stream_json_lttb(s, from, to, (uint16_t)points); });
+}
+
+// ─── /api/log/bin  GET — точки графика столбцами ─────────────────────────
+// ?points=N — последние N записей; ?from=…&to=…[&points=N] — диапазон,
+// прореженный как в /api/log/json. Формат — log_stream_bin() в Logger.h.
+static void _handleLogBin() {
+  if (!_auth()) return;
+  _keepalive();  // GET-поллинг — не сбрасывать подсветку
+  String from = _srv.arg("from");
+  String to   = _srv.arg("to");
+  bool range = (from.length() > 0 || to.length() > 0);
+  if (range && (!_cleanDateArg(from) || !_cleanDateArg(to) || from.length() != 10 || to.length() != 10)) {
+    _srv.send(400, "text/plain", "Need from and to");
+    return;
+  }
+  long points = _srv.hasArg("points") ? _srv.arg("points").toInt() : 300;
+  if (points < 3 || points > LOG_LTTB_MAX) {
+    _srv.send(400, "text/plain", "Bad points");
+    return;
+  }
+  PointsGen *g = new (std::nothrow) PointsGen();
+  Stream *o = _jobGen(g, "application/octet-stream");
+  if (o) log_points_begin(g->p, *o, from, to, (uint16_t)points, true);
+  else   _sendStream("application/octet-stream", [&](Stream &s) { log_stream_bin(s, from, to, (uint16_t)points); });
+}
+
+// ─── /api/log/since  GET — записи после курсора ─────────────────────────
+// ?cursor=<next из прошлого ответа>[&limit=N]. Сборщик за опрос получает только
+// новые строки; формат и курсор — log_stream_since() в Logger.h.
+static void _handleLogSince() {
+  if (!_auth()) return;
+  _keepalive();  // GET-поллинг — не сбрасывать подсветку
+  String cursor = _srv.arg("cursor");
+  bool ok = (cursor.length() <= 20);
+  if (ok && cursor != "end") {
+    for (unsigned int i = 0; i < cursor.length(); i++) {
+      if (!isdigit(cursor[i]) && cursor[i] != '.') ok = false;
+    }
+  }
+  if (!ok) {
+    _srv.send(400, "text/plain", "Bad cursor");
+    return;
+  }
+  long limit = _srv.hasArg("limit") ? _srv.arg("limit").toInt() : LOG_SINCE_MAX;
+  if (limit < 1 || limit > LOG_SINCE_MAX) {
+    _srv.send(400, "text/plain", "Bad limit");
+    return;
+  }
+  SinceGen *g = new (std::nothrow) SinceGen();
+  Stream *o = _jobGen(g, "application/json");
+  if (o) log_since_begin(g->s, *o, cursor, (uint16_t)limit);
+  else   _sendStream("application/json", [&](Stream &s) { log_stream_since(s, cursor, (uint16_t)limit); });
 }
 
 // ─── /api/backup  GET — полный бэкап настроек EEPROM ──────────────────────
-static String _buildBackupJson(bool masked) {
-  DynamicJsonDocument doc(768);
-  doc["_type"] = "BeehiveScale_backup";
-  doc["_ver"]  = "4.1";
+static void _writeBackup(JsonWriter &j, bool masked) {
+  j.beginObject();
+  j.add("_type", "BeehiveScale_backup");
+  j.add("_ver",  "4.1");
 
   // Калибровка
-  doc["calibFactor"]  = *_wd.calibFactor;
-  doc["offset"]       = *_wd.offset;
-  doc["weight"]       = *_wd.lastSavedWeight;
-  doc["prevWeight"]   = *_wd.prevWeight;
-  doc["prevOffset"]   = load_prev_offset();
+  j.add("calibFactor", *_wd.calibFactor, 6);
+  j.add("offset",      *_wd.offset);
+  j.add("weight",      *_wd.lastSavedWeight);
+  j.add("prevWeight",  *_wd.prevWeight);
+  j.add("prevOffset",  (long)load_prev_offset());
 
   // Настройки
-  doc["alertDelta"]   = web_get_alert_delta();
-  doc["calibWeight"]  = web_get_calib_weight();
-  doc["emaAlpha"]     = web_get_ema_alpha();
-  doc["sleepSec"]     = (unsigned long)get_sleep_sec();
-  doc["lcdBlSec"]     = (unsigned int)get_lcd_bl_sec();
-  {
-    uint16_t times[8]; uint8_t cnt;
-    get_sched_times(times, cnt);
-    JsonArray arr = doc.createNestedArray("schedTimes");
-    char tbuf[6];
-    for (uint8_t i = 0; i < cnt; i++) {
-      snprintf(tbuf, sizeof(tbuf), "%02d:%02d", times[i] / 60, times[i] % 60);
-      arr.add(String(tbuf));
-    }
-  }
+  j.add("alertDelta",  web_get_alert_delta());
+  j.add("calibWeight", web_get_calib_weight());
+  j.add("emaAlpha",    web_get_ema_alpha());
+  j.add("sleepSec",    (unsigned long)get_sleep_sec());
+  j.add("lcdBlSec",    (unsigned int)get_lcd_bl_sec());
+  _schedTimes(j);
 
   // AP пароль
-  // НЕ использовать (const char*) каст! ArduinoJson v6 для const char* хранит указатель
-  // (zero-copy), а char* — копирует строку в пул. Каст → dangling pointer после }.
   char ap[24]; get_ap_pass(ap, sizeof(ap));
-  doc["apPass"] = masked ? _maskSecret(ap) : String(ap);
+  j.add("apPass", masked ? _maskSecret(ap) : ap);
 
   // Telegram
   char tok[50], cid[16];
   get_tg_token(tok, sizeof(tok));
   get_tg_chatid(cid, sizeof(cid));
-  doc["tgToken"]  = masked ? _maskSecret(tok) : String(tok);
-  doc["tgChatId"] = String(cid);
-  doc["tgReportInt"] = get_tg_report_interval_min();
+  j.add("tgToken",     masked ? _maskSecret(tok) : tok);
+  j.add("tgChatId",    cid);
+  j.add("tgReportInt", (unsigned int)get_tg_report_interval_min());
 
   // WiFi
-  doc["wifiMode"] = (int)get_wifi_mode();
+  j.add("wifiMode", (int)get_wifi_mode());
   char ss[33], wp[33];
   get_wifi_ssid(ss, sizeof(ss));
   get_wifi_sta_pass(wp, sizeof(wp));
-  doc["wifiSsid"] = String(ss);
-  doc["wifiPass"] = masked ? _maskSecret(wp) : String(wp);
+  j.add("wifiSsid", ss);
+  j.add("wifiPass", masked ? _maskSecret(wp) : wp);
+  j.endObject();
+}
+
+// Полный бэкап (с секретами) — в BACKUP_FILE, пишется в файл по мере сборки
+static void _backupFull(Print &out) {
+  JsonWriter j(out);
+  _writeBackup(j, false);
+}
 
-  String out;
-  serializeJson(doc, out);
-  return out;
+static void _saveBackup() {
+  log_save_backup(_backupFull);
 }
 
 static void _handleBackup() {
   if (!_auth()) return;
   _keepalive();  // GET-запрос — не сбрасывать таймер авто-сна
-  // Сначала сохраняем полный бэкап на SD (с секретами), потом отправляем маскированный.
-  // Так два больших String не сосуществуют в heap одновременно.
-  log_save_backup(_buildBackupJson(false));
-  {
-    String json = _buildBackupJson(true);
-    _srv.sendHeader("Content-Disposition", "attachment; filename=\"beehive_backup.json\"");
-    _srv.send(200, "application/json", json);
-  }
+  // Сначала полный бэкап на SD (с секретами), затем клиенту — маскированный
+  _saveBackup();
+  _srv.sendHeader("Content-Disposition", "attachment; filename=\"beehive_backup.json\"");
+  _jsonBegin();
+  ChunkStream cs(_srv);
+  JsonWriter j(cs);
+  _writeBackup(j, true);
+  cs.flush();
 }
 
 // ─── /api/backup/restore  POST — восстановление из JSON бэкапа ───────────
 static void _handleBackupRestore() {
+  FormHold form(FORM_BACKUP);
   if (!_auth()) return;
   _activity();
   if (_srv.method() != HTTP_POST) { _sendJson(false, "Только POST"); return; }
-
-  DynamicJsonDocument doc(768);
-  DeserializationError err = deserializeJson(doc, _srv.arg("plain"));
-  if (err) { _sendJson(false, "Ошибка JSON"); return; }
+  if (!_formOk(form, false)) return;
+  BodyForm &f = *form.f;
 
   // Проверяем маркер бэкапа
-  const char* type = doc["_type"] | "";
-  if (strcmp(type, "BeehiveScale_backup") != 0) {
+  if (!f.backup) {
     _sendJson(false, "Неверный формат бэкапа");
     return;
   }
 
-  int restored = 0;
+  uint32_t done = 0;  // FB(): применённые поля
 
   // Калибровка — используем функции Memory.cpp (mark_eeprom_valid + commit)
-  if (doc.containsKey("calibFactor")) {
-    float cf = doc["calibFactor"].as<float>();
+  if (f.has_(F_CALIB_FACTOR)) {
+    float cf = f.num[F_CALIB_FACTOR];
     if (cf >= 100.0f && cf <= 100000.0f) {
       save_calibration(cf);  // EEPROM.put + mark_eeprom_valid + commit
       if (_wa.doSetCalibFactor) _wa.doSetCalibFactor(cf);
-      restored++;
+      done |= FB(F_CALIB_FACTOR);
     }
   }
-  if (doc.containsKey("offset")) {
-    long ofs = doc["offset"].as<long>();
+  if (f.has_(F_OFFSET)) {
+    long ofs = (long)f.num[F_OFFSET];
     save_offset(ofs);  // EEPROM.put + mark_eeprom_valid + commit
     if (_wa.doSetCalibOffset) _wa.doSetCalibOffset(ofs);
-    restored++;
+    done |= FB(F_OFFSET);
   }
-  if (doc.containsKey("weight")) {
-    float w = doc["weight"].as<float>();
+  if (f.has_(F_WEIGHT)) {
+    float w = f.num[F_WEIGHT];
     if (w >= 0.0f && w <= 500.0f) {
       save_weight(*_wd.lastSavedWeight, w);  // lastWeight=w, EEPROM.put + commit
-      restored++;
+      done |= FB(F_WEIGHT);
     }
   }
-  if (doc.containsKey("prevWeight")) {
-    float pw = doc["prevWeight"].as<float>();
+  if (f.has_(F_PREV_WEIGHT)) {
+    float pw = f.num[F_PREV_WEIGHT];
     if (pw >= 0.0f && pw <= 500.0f) {
       save_prev_weight(pw);  // EEPROM.put + commit
       *_wd.prevWeight = pw;
-      restored++;
+      done |= FB(F_PREV_WEIGHT);
     }
   }
-  if (doc.containsKey("prevOffset")) {
-    long po = doc["prevOffset"].as<long>();
+  if (f.has_(F_PREV_OFFSET)) {
+    long po = (long)f.num[F_PREV_OFFSET];
     save_prev_offset(po);  // EEPROM.put + commit
-    restored++;
+    done |= FB(F_PREV_OFFSET);
   }
 
   // Настройки
   float ad = web_get_alert_delta(), cw = web_get_calib_weight(), ea = web_get_ema_alpha();
-  if (doc.containsKey("alertDelta"))  { float v = doc["alertDelta"].as<float>();  if (v >= 0.1f && v <= 10.0f) { ad = v; restored++; } }
-  if (doc.containsKey("calibWeight")) { float v = doc["calibWeight"].as<float>(); if (v >= 100.0f && v <= 5000.0f) { cw = v; restored++; } }
-  if (doc.containsKey("emaAlpha"))    { float v = doc["emaAlpha"].as<float>();    if (v >= 0.05f && v <= 0.9f) { ea = v; restored++; } }
+  if (f.has_(F_ALERT_DELTA))  { float v = f.num[F_ALERT_DELTA];  if (v >= 0.1f && v <= 10.0f) { ad = v; done |= FB(F_ALERT_DELTA); } }
+  if (f.has_(F_CALIB_WEIGHT)) { float v = f.num[F_CALIB_WEIGHT]; if (v >= 100.0f && v <= 5000.0f) { cw = v; done |= FB(F_CALIB_WEIGHT); } }
+  if (f.has_(F_EMA_ALPHA))    { float v = f.num[F_EMA_ALPHA];    if (v >= 0.05f && v <= 0.9f) { ea = v; done |= FB(F_EMA_ALPHA); } }
   save_web_settings(ad, cw, ea);
 
   // Ext settings — batch: один commit вместо 3
@@ -1961,35 +2012,22 @@ static void _handleBackupRestore() {
     uint32_t extSleep = get_sleep_sec();
     uint16_t extLcd   = get_lcd_bl_sec();
     const char* extAp = nullptr;
-    if (doc.containsKey("sleepSec")) { uint32_t v = doc["sleepSec"].as<uint32_t>(); if (v >= 30 && v <= 86400) { extSleep = v; restored++; } }
-    if (doc.containsKey("lcdBlSec")) { uint16_t v = doc["lcdBlSec"].as<uint16_t>(); if (v <= 3600) { extLcd = v; restored++; } }
-    static char apPassRestore[24];
-    if (doc.containsKey("apPass"))   { const char* p = doc["apPass"] | ""; if (strlen(p) >= 8 && strlen(p) <= 23 && strchr(p, '*') == NULL) { strncpy(apPassRestore, p, sizeof(apPassRestore)-1); apPassRestore[sizeof(apPassRestore)-1] = '\0'; extAp = apPassRestore; restored++; } }
+    if (f.has_(F_SLEEP_SEC))  { double v = f.num[F_SLEEP_SEC];  if (v >= 30 && v <= 86400) { extSleep = (uint32_t)v; done |= FB(F_SLEEP_SEC); } }
+    if (f.has_(F_LCD_BL_SEC)) { double v = f.num[F_LCD_BL_SEC]; if (v >= 0 && v <= 3600) { extLcd = (uint16_t)v; done |= FB(F_LCD_BL_SEC); } }
+    if (f.has_(F_AP_PASS))    { const char* p = f.s(F_AP_PASS); if (strlen(p) >= 8 && strlen(p) <= 23 && strchr(p, '*') == NULL) { extAp = p; done |= FB(F_AP_PASS); } }
     set_ext_all(extSleep, extLcd, extAp);
   }
-  if (doc.containsKey("schedTimes")) {
-    JsonArray arr = doc["schedTimes"].as<JsonArray>();
-    uint16_t times[8]; uint8_t cnt = 0;
-    for (JsonVariant v : arr) {
-      const char* s = v.as<const char*>();
-      if (!s) continue;
-      int h = 0, m = 0;
-      if (sscanf(s, "%d:%d", &h, &m) == 2 && h >= 0 && h <= 23 && m >= 0 && m <= 59) {
-        if (cnt < 8) times[cnt++] = (uint16_t)h * 60 + m;
-      }
-    }
-    set_sched_times(times, cnt); restored++;
-  }
+  if (f.has_(F_SCHED)) { set_sched_times(f.sched, f.schedCnt); done |= FB(F_SCHED); }
 
   // Telegram — batch: собираем поля, один commit через set_tg_all()
   {
     const char* newTkn = nullptr;
     const char* newCid = nullptr;
-    if (doc.containsKey("tgToken"))  { const char* t = doc["tgToken"] | "";  if (strlen(t) > 0 && strchr(t, '*') == NULL) { newTkn = t; restored++; } }
-    if (doc.containsKey("tgChatId")) { const char* c = doc["tgChatId"] | ""; if (strlen(c) > 0 && strlen(c) < 16) { newCid = c; restored++; } }
+    if (f.has_(F_TG_TOKEN)) { const char* t = f.s(F_TG_TOKEN); if (strlen(t) > 0 && strchr(t, '*') == NULL) { newTkn = t; done |= FB(F_TG_TOKEN); } }
+    if (f.has_(F_TG_CHAT))  { const char* c = f.s(F_TG_CHAT);  if (strlen(c) > 0 && strlen(c) < 16) { newCid = c; done |= FB(F_TG_CHAT); } }
     if (newTkn || newCid) set_tg_all(newTkn, newCid);
   }
-  if (doc.containsKey("tgReportInt")) { uint32_t v = doc["tgReportInt"].as<uint32_t>(); if (v == 0 || (v >= 60 && v <= 10080)) { set_tg_report_interval_min(v); restored++; } }
+  if (f.has_(F_TG_REPORT)) { double v = f.num[F_TG_REPORT]; if (v == 0 || (v >= 60 && v <= 10080)) { set_tg_report_interval_min((uint32_t)v); done |= FB(F_TG_REPORT); } }
 
   // WiFi — batch: собираем поля, один commit через set_wifi_all()
   {
@@ -1997,15 +2035,21 @@ static void _handleBackupRestore() {
     uint8_t mode = get_wifi_mode();
     char ssid[33]; get_wifi_ssid(ssid, sizeof(ssid));
     char pass[33]; get_wifi_sta_pass(pass, sizeof(pass));
-    if (doc.containsKey("wifiMode")) { uint8_t m = doc["wifiMode"].as<uint8_t>(); if (m <= 1) { mode = m; hasWifi = true; restored++; } }
-    if (doc.containsKey("wifiSsid")) { const char* s = doc["wifiSsid"] | ""; if (strlen(s) > 0) { strncpy(ssid, s, 32); ssid[32] = '\0'; hasWifi = true; restored++; } }
-    if (doc.containsKey("wifiPass")) { const char* p = doc["wifiPass"] | ""; if (strlen(p) > 0 && strchr(p, '*') == NULL) { strncpy(pass, p, 32); pass[32] = '\0'; hasWifi = true; restored++; } }
+    if (f.has_(F_WIFI_MODE)) { double m = f.num[F_WIFI_MODE]; if (m == 0 || m == 1) { mode = (uint8_t)m; hasWifi = true; done |= FB(F_WIFI_MODE); } }
+    if (f.has_(F_WIFI_SSID)) { const char* s = f.s(F_WIFI_SSID); if (strlen(s) > 0) { strncpy(ssid, s, 32); ssid[32] = '\0'; hasWifi = true; done |= FB(F_WIFI_SSID); } }
+    if (f.has_(F_WIFI_PASS)) { const char* p = f.s(F_WIFI_PASS); if (strlen(p) > 0 && strchr(p, '*') == NULL) { strncpy(pass, p, 32); pass[32] = '\0'; hasWifi = true; done |= FB(F_WIFI_PASS); } }
     if (hasWifi) set_wifi_all(mode, ssid, pass);
   }
 
+  // Пришедшие, но не применённые (вне диапазона, маска вместо секрета) — в ответ
+  int restored = 0;
+  for (uint8_t id = 0; id <= F_SCHED; id++) {
+    if (done & FB(id)) restored++;
+    else if (f.has_(id)) _formSkip(f, _formName(id));
+  }
   char msg[64];
   snprintf(msg, sizeof(msg), "Восстановлено %d параметров", restored);
-  _sendJson(true, msg);
+  _sendForm(f, msg);
 }
 
 // ─── PUBLIC API ───────────────────────────────────────────────────────────
@@ -2015,25 +2059,39 @@ void webserver_init(WebData &data, WebActions &actions) {
 
   _srv.on("/",             HTTP_GET,  _handleRoot);
   _srv.on("/api/data",     HTTP_GET,  _handleData);
+  _srv.on("/api/events",   HTTP_GET,  _handleEvents);
+  _srv.on("/api/dashboard", HTTP_GET, _handleDashboard);
   _srv.on("/api/tare",     HTTP_POST, _handleTare);
   _srv.on("/api/save",     HTTP_POST, _handleSave);
-  _srv.on("/api/settings",   HTTP_POST, _handleSettings);
+  _srv.on("/api/settings",   HTTP_POST, _handleSettings, [] { _formBody(FORM_SETTINGS); });
   _srv.on("/api/ntp",        HTTP_POST, _handleNtp);
+  _srv.on("/api/ntp",        HTTP_GET,  _handleNtp);
   _srv.on("/api/reboot",     HTTP_POST, _handleReboot);
   _srv.on("/api/log",          HTTP_GET,  _handleLog);
   _srv.on("/api/daystat",      HTTP_GET,  _handleDayStat);
   _srv.on("/api/log/clear",    HTTP_POST, _handleLogClear);
   _srv.on("/api/log/json",     HTTP_GET,  _handleLogJson);
+  _srv.on("/api/log/bin",      HTTP_GET,  _handleLogBin);
+  _srv.on("/api/log/since",    HTTP_GET,  _handleLogSince);
+  _srv.on("/api/log/export",   HTTP_GET,  _handleLogExport);
+  _srv.on("/api/query",        HTTP_GET,  _handleQuery);
   _srv.on("/chart",            HTTP_GET,  _handleChart);
-  _srv.on("/api/tg/settings",  HTTP_POST, _handleTgSettings);
+  _srv.on("/api/tg/settings",  HTTP_POST, _handleTgSettings, [] { _formBody(FORM_TG); });
   _srv.on("/api/tg/test",      HTTP_POST, _handleTgTest);
-  _srv.on("/api/calib/set",    HTTP_POST, _handleCalibSet);
+  _srv.on("/api/tg/test",      HTTP_GET,  _handleTgTest);
+  _srv.on("/api/calib/set",    HTTP_POST, _handleCalibSet, [] { _formBody(FORM_CALIB); });
   _srv.on("/wifi",              HTTP_GET,  _handleWifi);
-  _srv.on("/api/wifi/settings", HTTP_POST, _handleWifiSettings);
+  _srv.on("/api/wifi/settings", HTTP_POST, _handleWifiSettings, [] { _formBody(FORM_WIFI); });
   _srv.on("/api/config",        HTTP_GET,  _handleConfig);
   _srv.on("/api/backup",          HTTP_GET,  _handleBackup);
-  _srv.on("/api/backup/restore",  HTTP_POST, _handleBackupRestore);
+  _srv.on("/api/backup/restore",  HTTP_POST, _handleBackupRestore, [] { _formBody(FORM_BACKUP); });
+  _srv.on("/api/www",             HTTP_GET,  _handleWwwList);
+  _srv.on("/api/www/upload",      HTTP_POST, _handleWwwUpload, _handleWwwUploadData);
+  _srv.on("/api/www/delete",      HTTP_POST, _handleWwwDelete);
   _srv.onNotFound(_handleNotFound);
+  // Заголовки условного GET и докачки для /api/log, сжатия ответов
+  static const char *hdrs[] = {"Range", "If-Range", "If-None-Match", "If-Modified-Since", "Accept-Encoding"};
+  _srv.collectHeaders(hdrs, 5);
 
   _srv.begin();
   Serial.print(F("[WebServer] Started on port "));
@@ -2044,9 +2102,21 @@ void webserver_init(WebData &data, WebActions &actions) {
 
 void webserver_handle() {
   _srv.handleClient();
+  _ssePump();
+  _jobPump();
+  tg_send_poll();
+  ntp_sync_poll();
+}
+
+void webserver_notify(uint8_t what) {
+  _ssePending |= what;
+  // Вес — сравнивается при запросе (_dataSnap), остальное — сразу в пересборку
+  if (what & ~WEB_EV_WEIGHT) _dataDirty = true;
 }
 
 void webserver_stop() {
+  for (int i = 0; i < WEB_SSE_MAX_CLIENTS; i++) if (_sseCli[i]) _sseDrop(i);
+  for (int i = 0; i < WEB_JOBS_MAX; i++) if (_jobs[i]) _jobEnd(i);
   _srv.stop();
   Serial.println(F("[WebServer] Stopped"));
 }
@@ -8,6 +8,33 @@
 #define WEB_ADMIN_PASS    "beehive"
 #define WEB_REFRESH_SEC   5
 
+// Веб-интерфейс из LittleFS: файл WWW_DIR/<имя> (или <имя>.gz — отдаётся сжатым
+// как есть) подменяет встроенный. Загрузка — POST /api/www/upload, без прошивки.
+#define WWW_DIR           "/www"
+#define WWW_NAME_MAX      31             // имя файла: буквы, цифры, '.', '-', '_'
+#define WWW_MAX_FILE      (160 * 1024UL) // предел одного файла
+#define WWW_TAG_CACHE     8              // ETag (CRC-32) файлов, запомненных в RAM
+// Встроенный интерфейс из WebAssets.h (~21 КБ flash). Закомментировать — прошивка
+// меньше; пока WWW_DIR пуст, на странице только форма загрузки файлов.
+#define WEB_UI_BUILTIN
+
+// Server-Sent Events (/api/events): страница держит одно соединение, показания
+// приходят сами и только изменившиеся; /api/data тогда опрашивается редко.
+#define WEB_SSE_MAX_CLIENTS  3
+#define WEB_SSE_PING_MS      15000UL   // пустой комментарий — держит соединение, выявляет обрыв
+// /api/data отдаётся готовым снимком, пересобранным после изменения показаний
+#define WEB_DATA_BUF         512       // снимок; не поместился — ответ собирается на лету
+// Фоновые ответы: выгрузки /api/log и /api/log/export отдаются из
+// webserver_handle() порциями, сколько примет TCP, — медленный клиент не держит loop()
+#define WEB_JOBS_MAX         2         // одновременных выгрузок; сверх — 503
+#define WEB_JOB_SLICE_MS     20        // время на одну выгрузку за вызов
+#define WEB_JOB_TIMEOUT_MS   30000UL   // клиент ничего не принимает — обрыв
+#define WEB_JOB_BUF          1460      // копить до сегмента TCP перед отправкой
+// Что обновилось — для webserver_notify()
+#define WEB_EV_WEIGHT  0x01   // process_weight(): вес, эталоны, датчик
+#define WEB_EV_TEMP    0x02   // DS18B20 и RTC: температура, влажность
+#define WEB_EV_BAT     0x04   // напряжение и заряд батареи
+
 struct WebData {
   float*  weight;
   float*  lastSavedWeight;
@@ -37,6 +64,9 @@ extern unsigned long lastActivityTime;
 
 void webserver_init(WebData &data, WebActions &actions);
 void webserver_handle();
+// Показания обновлены (WEB_EV_*): подписчики /api/events получат изменившиеся
+// поля при следующем webserver_handle(). Без подписчиков — ничего не стоит
+void webserver_notify(uint8_t what);
 void webserver_stop();
 
 #endif
@@ -0,0 +1,129 @@
+#include "ZipStream.h"
+
+// Сигнатуры записей ZIP (APPNOTE 4.3)
+static const uint32_t ZIP_LOCAL   = 0x04034B50UL;
+static const uint32_t ZIP_DESCR   = 0x08074B50UL;
+static const uint32_t ZIP_CENTRAL = 0x02014B50UL;
+static const uint32_t ZIP_END     = 0x06054B50UL;
+static const uint16_t ZIP_VERSION = 20;      // 2.0: deflate
+static const uint16_t ZIP_FLAGS   = 0x0008;  // размеры и CRC — после данных
+
+ZipStream::~ZipStream() {
+  free(_dir);
+}
+
+bool ZipStream::begin(uint16_t maxFiles, bool deflate) {
+  _dir = (Entry*)malloc(sizeof(Entry) * (maxFiles ? maxFiles : 1));
+  _max = _dir ? maxFiles : 0;
+  _n = 0;
+  _cdNext = 0;
+  _ended = false;
+  _deflate = deflate;
+  return _dir != nullptr;
+}
+
+size_t ZipStream::_name(uint32_t ymd, char *buf, size_t len) {
+  int n = snprintf(buf, len, "%04u-%02u-%02u%s", (unsigned)(ymd / 10000),
+                   (unsigned)(ymd / 100 % 100), (unsigned)(ymd % 100), _ext);
+  return (n > 0 && (size_t)n < len) ? (size_t)n : 0;
+}
+
+void ZipStream::_put16(uint16_t v) {
+  uint8_t b[2] = { (uint8_t)v, (uint8_t)(v >> 8) };
+  _sink.write(b, 2);
+}
+
+void ZipStream::_put32(uint32_t v) {
+  uint8_t b[4] = { (uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24) };
+  _sink.write(b, 4);
+}
+
+// Локальный заголовок (central = false: CRC и размеры — нули, они в дескрипторе)
+// или запись каталога. Время файла — полночь его даты (формат MS-DOS).
+void ZipStream::_header(const Entry &e, bool central) {
+  char name[24];
+  size_t nl = _name(e.ymd, name, sizeof(name));
+  uint16_t y = e.ymd / 10000;
+  uint16_t date = (uint16_t)(((y > 1980 ? y - 1980 : 0) << 9) | ((e.ymd / 100 % 100) << 5) | (e.ymd % 100));
+  _put32(central ? ZIP_CENTRAL : ZIP_LOCAL);
+  if (central) _put16(ZIP_VERSION);           // создано
+  _put16(ZIP_VERSION);                        // нужно для распаковки
+  _put16(ZIP_FLAGS);
+  _put16(e.method);
+  _put16(0);                                  // время 00:00:00
+  _put16(date);
+  _put32(central ? e.crc : 0);
+  _put32(central ? e.csize : 0);
+  _put32(central ? e.usize : 0);
+  _put16(nl);
+  _put16(0);                                  // extra
+  if (central) {
+    _put16(0);                                // комментарий
+    _put16(0);                                // диск
+    _put16(0);                                // внутренние атрибуты
+    _put32(0);                                // внешние атрибуты
+    _put32(e.off);
+  }
+  _sink.write((const uint8_t*)name, nl);
+}
+
+bool ZipStream::open(uint32_t ymd, const char *ext) {
+  close();
+  if (_n >= _max) return false;
+  snprintf(_ext, sizeof(_ext), "%s", ext);
+  // Нет памяти под сжатие — этот файл пишется как есть. begin() копит биты
+  // заголовка блока в себе, в поток они уйдут уже после локального заголовка
+  Entry &e = _dir[_n];
+  e.ymd = ymd;
+  e.off = _sink.pos;
+  e.method = (_deflate && _gz.begin(true)) ? 8 : 0;
+  _header(e, false);
+  _crc = 0;
+  _usize = 0;
+  _start = _sink.pos;
+  _open = true;
+  return true;
+}
+
+size_t ZipStream::write(const uint8_t *b, size_t n) {
+  if (!_open) return 0;
+  _crc = gz_crc32(_crc, b, n);
+  _usize += n;
+  if (_dir[_n].method) _gz.write(b, n);
+  else                 _sink.write(b, n);
+  return n;
+}
+
+void ZipStream::close() {
+  if (!_open) return;
+  Entry &e = _dir[_n++];
+  if (e.method) _gz.end();
+  e.crc   = _crc;
+  e.usize = _usize;
+  e.csize = _sink.pos - _start;
+  _put32(ZIP_DESCR);
+  _put32(e.crc);
+  _put32(e.csize);
+  _put32(e.usize);
+  _open = false;
+}
+
+bool ZipStream::finish(uint16_t maxEntries) {
+  if (_ended) return true;
+  close();
+  if (_cdNext == 0) _cdStart = _sink.pos;
+  while (_cdNext < _n && maxEntries-- > 0) _header(_dir[_cdNext++], true);
+  if (_cdNext < _n) return false;
+  uint32_t cdStart = _cdStart;
+  uint32_t cdSize = _sink.pos - cdStart;
+  _put32(ZIP_END);
+  _put16(0);                                  // номер диска
+  _put16(0);                                  // диск каталога
+  _put16(_n);
+  _put16(_n);
+  _put32(cdSize);
+  _put32(cdStart);
+  _put16(0);                                  // комментарий архива
+  _ended = true;
+  return true;
+}
@@ -0,0 +1,69 @@
+#ifndef ZIP_STREAM_H
+#define ZIP_STREAM_H
+
+#include <Arduino.h>
+#include "GzipStream.h"
+
+// ─── Потоковая запись ZIP-архива суточных файлов ─────────────────────────
+// Файлы пишутся один за другим прямо в поток: размеры и CRC идут после данных
+// (data descriptor), поэтому ни файл, ни архив целиком в памяти не держатся.
+// В RAM — только каталог архива, 24 байта на файл. Имя файла — его дата:
+// "YYYY-MM-DD" + ext. Сжатие — голый deflate из GzipStream (~5 КБ на время записи).
+class ZipStream : public Stream {
+public:
+  explicit ZipStream(Stream &out) : _sink(out), _gz(_sink) {}
+  ~ZipStream();
+  // maxFiles — предел файлов в архиве (память под каталог); false — нет heap
+  bool   begin(uint16_t maxFiles, bool deflate);
+  // Начать файл за день ymd (YYYYMMDD); предыдущий закрывается. false — каталог полон
+  bool   open(uint32_t ymd, const char *ext);
+  void   close();
+  // Закрыть последний файл и записать каталог архива: не больше maxEntries
+  // записей каталога за вызов (отдача порциями). true — архив дописан
+  bool   finish(uint16_t maxEntries = 0xFFFF);
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) override;
+  int    available() override { return 0; }
+  int    read()      override { return -1; }
+  int    peek()      override { return -1; }
+  void   flush()     override {}
+  uint16_t files() const { return _n; }
+
+private:
+  // Счётчик байт архива (смещения локальных заголовков для каталога)
+  class Sink : public Stream {
+  public:
+    Stream  &out;
+    uint32_t pos = 0;
+    explicit Sink(Stream &o) : out(o) {}
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *b, size_t n) override { out.write(b, n); pos += n; return n; }
+    int available() override { return 0; }
+    int read()      override { return -1; }
+    int peek()      override { return -1; }
+  };
+  struct Entry {
+    uint32_t ymd;    // дата файла (YYYYMMDD) — из неё имя и время в архиве
+    uint32_t off;    // смещение локального заголовка
+    uint32_t crc, csize, usize;
+    uint16_t method; // 8 — deflate, 0 — без сжатия (не хватило heap)
+  };
+
+  Sink        _sink;
+  GzipStream  _gz;
+  Entry      *_dir = nullptr;
+  uint16_t    _max = 0, _n = 0;
+  bool        _deflate = false, _open = false;  // сжимать; файл открыт
+  uint16_t    _cdNext = 0;                      // следующая запись каталога в finish()
+  uint32_t    _cdStart = 0;                     // смещение каталога
+  bool        _ended = false;                   // каталог и конец архива записаны
+  char        _ext[8] = "";
+  uint32_t    _crc = 0, _usize = 0, _start = 0;
+
+  void _put16(uint16_t v);
+  void _put32(uint32_t v);
+  size_t _name(uint32_t ymd, char *buf, size_t len);
+  void _header(const Entry &e, bool central);
+};
+
+#endif
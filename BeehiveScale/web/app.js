@@ -0,0 +1,708 @@
+// ── Globals ─────────────────────────────────────────────────────────
+const REFRESH = 5000;
+const REFRESH_SSE = 60000; // показания идут через /api/events — остальное раз в минуту
+let _sse = null;           // EventSource /api/events
+let _live = null;          // последний /api/data с применёнными событиями
+let _start = Date.now();
+let _all = [];           // весь лог
+let _curWeight = 0;      // текущий вес для мини-графика
+let _periodH = 1;
+let _serVisible = {w:true, t:true, b:true};
+let _wizStep = 0;
+let _wifiMode = 0;
+// Данные для тултипов (по серии)
+let _tipPts = {};
+function esc(s){var d=document.createElement('div');d.textContent=String(s);return d.innerHTML;}
+
+// ── Nav ──────────────────────────────────────────────────────────────
+function nav(id) {
+  document.querySelectorAll('.section').forEach(s=>s.classList.remove('active'));
+  document.querySelectorAll('.tab').forEach(t=>t.classList.remove('active'));
+  document.getElementById('sec-'+id).classList.add('active');
+  const idx = {main:0,chart:1,wifi:2,settings:3,calib:4,tg:5,api:6};
+  document.querySelectorAll('.tab')[idx[id]].classList.add('active');
+  if (id==='chart') renderCharts();
+  if (id==='api')   refreshApiView();
+  if (id==='settings'||id==='tg') loadConfig();
+  if (id==='settings') wwwLoad();
+  if (id==='wifi') loadConfig();
+  if (id==='calib') { fetchData(); }   // немедленно обновить cf-live, ofs-live, wiz-w
+}
+
+// ── Refresh bar ───────────────────────────────────────────────────────
+const bar = document.getElementById('rbar');
+function tickBar() {
+  const pct = Math.max(0, 100-(Date.now()-_start)/period()*100);
+  bar.style.width = pct+'%';
+  if (Date.now()-_start < period()) requestAnimationFrame(tickBar);
+}
+tickBar();
+
+// ── Clock ─────────────────────────────────────────────────────────────
+(function tick() {
+  const t=new Date(), p=n=>String(n).padStart(2,'0');
+  document.getElementById('cur-time').textContent = p(t.getHours())+':'+p(t.getMinutes())+':'+p(t.getSeconds());
+  setTimeout(tick, 1000);
+})();
+
+// ── Toast ─────────────────────────────────────────────────────────────
+function toast(msg, err) {
+  const el = document.getElementById('toast');
+  el.textContent=msg; el.className='toast'+(err?' err':'')+' show';
+  setTimeout(()=>el.classList.remove('show'), 3500);
+}
+
+// ── API ───────────────────────────────────────────────────────────────
+function doApi(url) {
+  const method = (url.includes('/data')||(url.includes('/log')&&!url.includes('/clear'))||url.includes('/config')||url.includes('/daystat')||url.endsWith('/backup')) ? 'GET' : 'POST';
+  return fetch(url,{method}).then(r=>r.json()).then(d=>{
+    toast(d.msg||(d.ok?'OK':'Ошибка'), !d.ok); return d;
+  }).catch(()=>toast('Нет связи',true));
+}
+// Фоновые операции (/api/tg/test, /api/ntp): POST отвечает pending,
+// итог отдаёт GET по тому же адресу
+function doApiPoll(url){
+  doApi(url).then(d=>{if(d&&d.pending)setTimeout(apiPoll,1500,url,20);});
+}
+function apiPoll(url,n){
+  fetch(url).then(r=>r.json()).then(d=>{
+    if(d.pending&&n>0)setTimeout(apiPoll,1000,url,n-1);else toast(d.msg||'Ошибка',!d.ok);
+  }).catch(()=>toast('Нет связи',true));
+}
+
+// ── Fetch /api/dashboard (показания + статистика дня одним запросом) ──
+function fetchData() {
+  fetch('/api/dashboard?fields=data,day').then(r=>r.json()).then(d=>{
+    _live=d.data; updDash(d.data); updHive(d.day);
+  }).catch(()=>{});
+  loadLog();
+}
+
+function updDash(d) {
+  const w = parseFloat(d.weight)||0;
+  _curWeight = w;
+  setText('w-val', w.toFixed(3)+'<span class="val-unit">кг</span>', true);
+  setText('w-ref', parseFloat(d.ref||0).toFixed(3));
+  const dw = w-parseFloat(d.ref||0);
+  const dwEl=document.getElementById('w-delta');
+  dwEl.textContent=(dw>=0?'+':'')+dw.toFixed(3);
+  dwEl.style.color=dw>0?'var(--green)':dw<0?'var(--red)':'var(--amber2)';
+  setGauge('w-gauge','w-gpct', Math.min(100,w/80*100), '', '%');
+
+  const t=parseFloat(d.temp), rtcT=parseFloat(d.rtcT||0);
+  if (!isNaN(t)&&t>-90) {
+    setText('t-val',t.toFixed(1)+'<span class="val-unit">°C</span>',true);
+    setGauge('t-gauge','t-gpct', Math.min(100,Math.max(0,(t+20)/70*100)), t.toFixed(1), '°C');
+  } else {
+    setText('t-val','---<span class="val-unit">°C</span>',true);
+    setGauge('t-gauge','t-gpct', 0, '---', '°C');
+  }
+  setText('h-val', parseFloat(d.hum||0).toFixed(0));
+  setText('rtc-val', rtcT.toFixed(1));
+
+  const bv=parseFloat(d.batV||0), bp=parseFloat(d.batPct||0);
+  setText('bat-v-big',bv.toFixed(2)+'<span class="val-unit">В</span>',true);
+  setText('bat-pct-v',bp.toFixed(0)+'%');
+  const bColor=bp<20?'var(--red)':bp<40?'var(--amber)':'var(--green)';
+  document.getElementById('bat-gauge').style.background=bColor;
+  setGauge('bat-gauge','bat-gpct',bp,'','%');
+
+  // Status
+  setDot('sr-dot',d.sensor,'ok','err'); setText('sr-val',d.sensor?'OK':'Ошибка');
+  setDot('wf-dot',d.wifi,'ok','warn'); setText('wf-val',d.wifi?'Подключён':'AP режим');
+  setText('wkc-val',d.wakeups||0);
+  setText('cf-val',parseFloat(d.cf||0).toFixed(0));
+  setText('ofs-val',d.offset||0);
+  setText('dt-val',d.datetime||'--');
+  setText('upt-val',d.uptime||'--');
+  const heap=parseInt(d.heap||0);
+  setText('heap-val',(heap/1024).toFixed(1)+' KB');
+  setDot('heap-dot',heap>5000,'ok','warn');
+  const sdKb=Math.round(parseInt(d.sdLog||0)/1024);
+  const freeKb=Math.round(parseInt(d.sdFree||0)/1024);
+  // Свободное место известно только при LittleFS (fallback); SD-библиотека его не отдаёт
+  const freeKnown=!!d.sdFallback;
+  const totalKb=freeKnown?sdKb+freeKb:0;
+  const memPct=totalKb>0?Math.min(100,sdKb/totalKb*100):0;
+  // Gauge памяти/лога
+  const mColor=memPct>90?'var(--red)':memPct>70?'var(--amber)':'var(--green)';
+  const memGauge=document.getElementById('mem-gauge');
+  if(memGauge){memGauge.style.background=mColor;setGauge('mem-gauge','mem-gpct',memPct,memPct.toFixed(0),'%');}
+  setText('mem-used',sdKb);setText('mem-total',freeKnown?totalKb:'?');
+  // Предупреждение: ФС не смонтирована
+  const fsOk=!!d.sdOk;
+  const sdDot=document.getElementById('sd-dot');
+  if(sdDot) sdDot.className='dot '+(fsOk?'ok':'err');
+  if(fsOk) setText('sd-val',sdKb+' KB / своб. '+(freeKnown?freeKb+' KB':'н/д'));
+  else setText('sd-val','⚠ ФС не доступна');
+
+  // Calib live
+  if (document.getElementById('cf-live')) setText('cf-live',parseFloat(d.cf||0).toFixed(0));
+  if (document.getElementById('ofs-live')) setText('ofs-live',d.offset||0);
+  if (document.getElementById('wiz-w')) setText('wiz-w',parseFloat(d.weight||0).toFixed(3));
+  // Автозаполнение поля CF текущим значением, если пользователь ещё не вводил своё
+  var cfInput=document.getElementById('calib-cf');
+  if(cfInput&&cfInput.value===''&&d.cf) cfInput.value=Math.round(parseFloat(d.cf||0));
+}
+
+function updHive(d) {
+  if (!d) return;
+  const s={Vesna:'🌸 Весна',Leto:'☀ Лето',Osen:'🍂 Осень',Zima:'❄ Зима'};
+  setText('hi-season',s[d.season]||d.season||'--');
+  if (d.valid) {
+    setText('hi-wrange',d.wMin.toFixed(2)+' / '+d.wMax.toFixed(2)+' кг');
+    if (!isNaN(d.tMin)) setText('hi-trange',d.tMin.toFixed(1)+' / '+d.tMax.toFixed(1)+' °C');
+    const dk=parseFloat(d.deltaKg||0);
+    const de=document.getElementById('hi-delta');
+    de.textContent=(dk>=0?'+':'')+dk.toFixed(3)+' кг';
+    de.style.color=dk>0?'var(--green)':dk<0?'var(--red)':'var(--text2)';
+    setText('hi-count',d.count||0);
+    setText('hi-days',d.daysSinceStart||0);
+  }
+}
+
+function setText(id,v,html) {
+  const el=document.getElementById(id);
+  if(!el)return;
+  if(html) el.innerHTML=v; else el.textContent=v;
+}
+function setGauge(gid,lid,pct,val,unit) {
+  const g=document.getElementById(gid),l=document.getElementById(lid);
+  if(g) g.style.width=pct.toFixed(0)+'%';
+  if(l) l.textContent=val+unit;
+}
+function setDot(id,ok,cOk,cBad) {
+  const el=document.getElementById(id);
+  if(el) el.className='dot '+(ok?cOk:cBad);
+}
+
+// ── Load log ──────────────────────────────────────────────────────────
+// Точки приходят столбцами (/api/log/bin): массивы читаются прямо из буфера,
+// без разбора JSON. Время — секунды RTC (местное), поэтому getUTC*.
+function p2(n){return String(n).padStart(2,'0');}
+function binPts(buf){
+  const n=buf.byteLength>=4?new Uint32Array(buf,0,1)[0]:0;
+  if(buf.byteLength<4+n*10) return [];
+  const ts=new Uint32Array(buf,4,n),w=new Int16Array(buf,4+n*4,n),t=new Int16Array(buf,4+n*6,n),b=new Uint16Array(buf,4+n*8,n);
+  const pts=new Array(n);
+  for(let i=0;i<n;i++){
+    const d=new Date(ts[i]*1000);
+    pts[i]={dt:p2(d.getUTCDate())+'.'+p2(d.getUTCMonth()+1)+'.'+d.getUTCFullYear()+' '+p2(d.getUTCHours())+':'+p2(d.getUTCMinutes())+':'+p2(d.getUTCSeconds()),
+      w:w[i]/100,t:t[i]===-32768?-99:t[i]/10,b:b[i]/1000};
+  }
+  return pts;
+}
+function getBin(q){return fetch('/api/log/bin'+q).then(r=>r.ok?r.arrayBuffer():Promise.reject()).then(binPts);}
+
+// Первый раз — хвост лога столбцами, дальше — только дописанные строки
+// по курсору (/api/log/since): обновление не тянет заново весь хвост
+let _cursor='';
+function loadLog() {
+  const done=()=>{
+    drawMini();
+    if (document.getElementById('sec-chart').classList.contains('active')) renderCharts();
+  };
+  if (_cursor) {
+    fetch('/api/log/since?cursor='+_cursor).then(r=>r.json()).then(d=>{
+      if (d.reset) { _cursor=''; loadLog(); return; }
+      _cursor=d.next;
+      const last=_all.length?dtKey(_all[_all.length-1].dt):'';
+      d.rows.forEach(r=>{ if(dtKey(r.dt)>last) _all.push(r); });
+      if (_all.length>600) _all=_all.slice(-600);
+      done();
+    }).catch(done);
+    return;
+  }
+  // Курсор берётся до хвоста: строка между запросами придёт дважды и отсеется по dt
+  fetch('/api/log/since?cursor=end').then(r=>r.json())
+    .then(c=>getBin('?points=600').then(data=>{ _all=data; _cursor=c.next; done(); }))
+    .catch(done);
+}
+
+// ── Mini chart ────────────────────────────────────────────────────────
+function drawMini() {
+  const svg=document.getElementById('mini-svg');
+  if (!_all||_all.length<2) {
+    const wt=_curWeight>0?_curWeight.toFixed(3)+' кг':'--';
+    svg.innerHTML='<text x="450" y="120" text-anchor="middle" fill="#f5a623" font-size="28" font-weight="bold">'+wt+'</text>'+
+      '<text x="450" y="150" text-anchor="middle" fill="#506040" font-size="13">Лог пуст — нет данных для графика</text>';
+    return;
+  }
+  const pts=_all.slice(-120);
+  _tipPts.mini=pts;
+  drawLineSvg(svg,pts,'w','#f5a623',900,350,60,10,12,50,true);
+}
+
+// ── Chart page ────────────────────────────────────────────────────────
+function setPeriod(h,btn) {
+  _periodH=h;
+  document.querySelectorAll('.period-btn').forEach(b=>b.classList.remove('active'));
+  btn.classList.add('active');
+  if (QUERY_BUCKET[h]) loadQuery(h);
+  if (h===0) loadAll();
+  renderCharts();
+}
+
+// «Всё» — вся история, прореженная на устройстве до ~300 точек (LTTB)
+function loadAll(){
+  getBin('?from=2000-01-01&to='+ymd(Date.now()+86400000)+'&points=300')
+    .then(d=>{_qPts=d;_qH=0;if(_periodH===0)renderCharts();}).catch(()=>{});
+}
+
+// Периоды от 3 суток — средние по интервалам с устройства (/api/query),
+// а не хвост лога: по слабому каналу AP идут десятки точек вместо тысяч строк
+const QUERY_BUCKET={72:'1h',168:'2h',720:'6h'};
+let _qPts=null, _qH=0;
+function ymd(t){const d=new Date(t);return d.getFullYear()+'-'+String(d.getMonth()+1).padStart(2,'0')+'-'+String(d.getDate()).padStart(2,'0');}
+function dtKey(dt){return dt.substring(6,10)+dt.substring(3,5)+dt.substring(0,2)+dt.substring(11);}
+function loadQuery(h){
+  const q='&from='+ymd(Date.now()-h*3600000)+'&to='+ymd(Date.now())+'&bucket='+QUERY_BUCKET[h]+'&agg=mean';
+  const get=f=>fetch('/api/query?field='+f+q).then(r=>r.json());
+  const m={};
+  const put=(rows,k)=>rows.forEach(r=>{(m[r.dt]=m[r.dt]||{dt:r.dt})[k]=r.mean;});
+  // По очереди: у ESP8266 один обработчик запросов
+  get('weight').then(w=>{put(w,'w');return get('temp');})
+    .then(t=>{put(t,'t');return get('bat');})
+    .then(b=>{
+      put(b,'b');
+      _qPts=Object.values(m).sort((a,b)=>dtKey(a.dt)<dtKey(b.dt)?-1:1);
+      _qH=h;
+      if (_periodH===h) renderCharts();
+    }).catch(()=>{});
+}
+
+function toggleSeries(s,btn) {
+  _serVisible[s]=!_serVisible[s];
+  btn.classList.toggle('active',_serVisible[s]);
+  const wrap=document.getElementById('cwrap-'+s);
+  if(wrap) wrap.style.display=_serVisible[s]?'':'none';
+  renderCharts();
+}
+
+function filterPts() {
+  if (!_periodH) return _all;
+  const cutoff=Date.now()-_periodH*3600000;
+  const f=_all.filter(d=>{
+    const m=d.dt&&d.dt.match(/(\d{2})\.(\d{2})\.(\d{4})\s+(\d{2}):(\d{2}):(\d{2})/);
+    if(m) return new Date(+m[3],+m[2]-1,+m[1],+m[4],+m[5],+m[6]).getTime()>=cutoff;
+    return true;
+  });
+  // Возвращаем fallback если точек меньше 2 (drawLineSvg требует ≥2 точки)
+  if (f.length < 2) {
+    const n=_periodH===1?60:_periodH===6?360:_periodH*60;
+    return _all.slice(-Math.min(n,_all.length));
+  }
+  return f;
+}
+
+function renderCharts() {
+  const agg=((QUERY_BUCKET[_periodH]||_periodH===0)&&_qH===_periodH&&_qPts&&_qPts.length>1)?_qPts:null;
+  if (!_all.length && !agg) {
+    [{id:'chart-w',cy:120},{id:'chart-t',cy:90},{id:'chart-b',cy:70}].forEach(function(s){
+      var svg=document.getElementById(s.id);
+      if(svg) svg.innerHTML='<text x="450" y="'+s.cy+'" text-anchor="middle" fill="#506040" font-size="13">Нет данных</text>';
+    });
+    return;
+  }
+  const pts=agg||filterPts();
+  if (!pts.length) return;
+  _tipPts={};
+
+  if (_serVisible.w) {
+    _tipPts.w=pts;
+    const ws=pts.map(d=>parseFloat(d.w)).filter(v=>!isNaN(v));
+    const mn=ws.reduce((a,b)=>a<b?a:b),mx=ws.reduce((a,b)=>a>b?a:b),av=ws.reduce((a,b)=>a+b,0)/ws.length;
+    setText('c-wmin',mn.toFixed(3)); setText('c-wmax',mx.toFixed(3));
+    setText('c-wavg',av.toFixed(3)); setText('c-pts',pts.length);
+    drawLineSvg(document.getElementById('chart-w'),pts,'w','#f5a623',900,260,60,10,12,42,true);
+  }
+  if (_serVisible.t) {
+    _tipPts.t=pts;
+    const ts=pts.map(d=>parseFloat(d.t)).filter(v=>!isNaN(v)&&v>-90);
+    if(ts.length){setText('c-tmin',ts.reduce((a,b)=>a<b?a:b).toFixed(1));setText('c-tmax',ts.reduce((a,b)=>a>b?a:b).toFixed(1));}
+    drawLineSvg(document.getElementById('chart-t'),pts,'t','#56ccf2',900,260,60,10,12,42,true);
+  }
+  if (_serVisible.b) {
+    _tipPts.b=pts;
+    drawLineSvg(document.getElementById('chart-b'),pts,'b','#6fcf97',900,260,60,10,12,42,true);
+  }
+}
+
+// ── Universal SVG line drawing ────────────────────────────────────────
+function drawLineSvg(svg,pts,key,color,W,H,L,R,T,B,showAxes) {
+  const pW=W-L-R, pH=H-T-B;
+  const vals=pts.map(d=>parseFloat(d[key])).filter(v=>!isNaN(v)&&v>-90);
+  if (vals.length<2) { svg.innerHTML=`<text x="${W/2}" y="${H/2}" text-anchor="middle" fill="#506040" font-size="13">Нет данных</text>`; return; }
+  // Для температуры и батареи: игнорируем нули при расчёте шкалы (0 = датчик не работал / USB)
+  let scaleVals=(key==='t'||key==='b')?vals.filter(v=>v>0.05):vals;
+  if(scaleVals.length<2) scaleVals=vals;
+  let mn=scaleVals.reduce((a,b)=>a<b?a:b),mx=scaleVals.reduce((a,b)=>a>b?a:b);
+  // Добавляем 5% padding сверху/снизу чтобы линия не прилипала к краям
+  const range=mx-mn||1;
+  mn-=range*0.05; mx+=range*0.05;
+  if(mx===mn){mn-=0.5;mx+=0.5;}
+  const xS=i=>L+i/(pts.length-1||1)*pW;
+  const yS=v=>T+pH-(v-mn)/(mx-mn)*pH;
+  let html='';
+  // grid — 6 горизонтальных линий для лучшей читаемости
+  const yLines=6;
+  for(let k=0;k<=yLines;k++){
+    const v=mn+(mx-mn)*k/yLines,y=yS(v);
+    html+=`<line x1="${L}" y1="${y.toFixed(1)}" x2="${W-R}" y2="${y.toFixed(1)}" stroke="#1a201a" stroke-width="1"/>`;
+    if(showAxes) {
+      const dec=key==='b'?2:key==='t'?1:3;
+      html+=`<text x="${L-5}" y="${(y+4).toFixed(1)}" text-anchor="end" fill="#506040" font-size="12">${v.toFixed(dec)}</text>`;
+    }
+  }
+  // x labels — 5-7 меток равномерно
+  if(showAxes && pts.length>1){
+    const xCount=Math.min(7,pts.length);
+    for(let n=0;n<xCount;n++){
+      const i=Math.round(n*(pts.length-1)/(xCount-1));
+      const x=xS(i),lbl=pts[i].dt?pts[i].dt.substring(11,16):'';
+      const a=n===0?'start':n===xCount-1?'end':'middle';
+      html+=`<line x1="${x.toFixed(1)}" y1="${T}" x2="${x.toFixed(1)}" y2="${T+pH}" stroke="#181d18" stroke-dasharray="3,3" stroke-width="1"/>`;
+      html+=`<text x="${x.toFixed(1)}" y="${H-B+16}" text-anchor="${a}" fill="#506040" font-size="11">${lbl}</text>`;
+    }
+    // date labels at edges — под осью X, не наложение на время
+    const d0=pts[0].dt?pts[0].dt.substring(0,10):'';
+    const d1=pts[pts.length-1].dt?pts[pts.length-1].dt.substring(0,10):'';
+    if(d0) html+=`<text x="${L}" y="${H-B+28}" text-anchor="start" fill="#3d5030" font-size="9">${d0}</text>`;
+    if(d1&&d1!==d0) html+=`<text x="${W-R}" y="${H-B+28}" text-anchor="end" fill="#3d5030" font-size="9">${d1}</text>`;
+  }
+  // axes
+  if(showAxes){
+    html+=`<line x1="${L}" y1="${T}" x2="${L}" y2="${T+pH}" stroke="#506040" stroke-width="1.5"/>`;
+    html+=`<line x1="${L}" y1="${T+pH}" x2="${W-R}" y2="${T+pH}" stroke="#506040" stroke-width="1.5"/>`;
+  }
+  // area + line
+  let area='',line='',li=-1;
+  for(let i=0;i<pts.length;i++){
+    const v=parseFloat(pts[i][key]);
+    if(isNaN(v)||v<=-90) continue;
+    if((key==='t'||key==='b')&&Math.abs(v)<0.05&&scaleVals!==vals) continue;
+    const xx=xS(i).toFixed(1),yy=yS(v).toFixed(1);
+    if(li<0){area=`M ${xx} ${T+pH}`;line=`M ${xx} ${yy}`;}
+    else{area+=` L ${xx} ${yy}`;line+=` L ${xx} ${yy}`;}
+    li=i;
+  }
+  if(li>=0){
+    area+=` L ${xS(li).toFixed(1)} ${T+pH} Z`;
+    html+=`<path d="${area}" fill="${color}18" stroke="none"/>`;
+    html+=`<path d="${line}" fill="none" stroke="${color}" stroke-width="2"/>`;
+    const lv=parseFloat(pts[li][key]);
+    html+=`<circle cx="${xS(li).toFixed(1)}" cy="${yS(lv).toFixed(1)}" r="4" fill="${color}"/>`;
+  }
+  svg.innerHTML=html;
+}
+
+// ── Tooltip ───────────────────────────────────────────────────────────
+function onTip(e,s){
+  const pts=_tipPts[s];
+  if(!pts||!pts.length) return;
+  const key={w:'w',t:'t',b:'b',mini:'w'}[s];
+  const color={w:'var(--amber)',t:'var(--blue)',b:'var(--green)',mini:'var(--amber)'}[s];
+  const unit={w:' кг',t:' °C',b:' В',mini:' кг'}[s];
+  const W=900,L=60,R=10;
+  const pW=W-L-R;
+  const svg=e.currentTarget, rect=svg.getBoundingClientRect();
+  const svgX=(e.clientX-rect.left)/rect.width*W;
+  let best=-1,bestD=9999;
+  for(let i=0;i<pts.length;i++){const x=L+i/(pts.length-1||1)*pW,d=Math.abs(x-svgX);if(d<bestD){bestD=d;best=i;}}
+  if(best<0||bestD>pW/pts.length*3){hideTip(s);return;}
+  const p=pts[best], v=parseFloat(p[key]);
+  const tip=document.getElementById('tip-'+s);
+  tip.innerHTML=`<b style="color:${color}">${isNaN(v)||v<=-90?'--':v.toFixed(key==='b'?3:2)+unit}</b><br>${esc(p.dt||'')}`;
+  tip.style.display='';
+  let tx=(e.clientX-rect.left)+10, ty=(e.clientY-rect.top)-48;
+  if(tx+140>rect.width) tx=(e.clientX-rect.left)-150;
+  if(ty<0) ty=10;
+  tip.style.left=tx+'px'; tip.style.top=ty+'px';
+}
+function hideTip(s){const el=document.getElementById('tip-'+s);if(el)el.style.display='none';}
+
+// ── Export ────────────────────────────────────────────────────────────
+function getExpData() {
+  let data=_all;
+  const from=document.getElementById('exp-from').value;
+  const to=document.getElementById('exp-to').value;
+  if(from||to) data=data.filter(d=>{
+    if(!d.dt) return true;
+    const m=d.dt.match(/(\d{2})\.(\d{2})\.(\d{4})/);
+    if(!m) return true;
+    const ds=`${m[3]}-${m[2]}-${m[1]}`;
+    return (!from||ds>=from)&&(!to||ds<=to);
+  });
+  const cols=[];
+  if(document.getElementById('col-dt').checked)  cols.push({k:'dt',h:'Дата/время'});
+  if(document.getElementById('col-w').checked)   cols.push({k:'w',h:'Вес, кг'});
+  if(document.getElementById('col-t').checked)   cols.push({k:'t',h:'Темп, °C'});
+  if(document.getElementById('col-h').checked)   cols.push({k:'h',h:'Влажность, %'});
+  if(document.getElementById('col-bat').checked) cols.push({k:'b',h:'Батарея, В'});
+  return {data,cols};
+}
+
+function exportCsv(){
+  const {data,cols}=getExpData();
+  let csv='\uFEFF'+cols.map(c=>c.h).join(';')+'\n';
+  data.forEach(d=>{csv+=cols.map(c=>d[c.k]||'').join(';')+'\n';});
+  dlBlob(new Blob([csv],{type:'text/csv;charset=utf-8'}),'beehive_log.csv');
+}
+
+function previewExport(){
+  const {data,cols}=getExpData();
+  let html=`<tr>${cols.map(c=>`<th>${esc(c.h)}</th>`).join('')}</tr>`;
+  data.slice(-10).forEach(d=>{html+=`<tr>${cols.map(c=>`<td>${esc(d[c.k]||'')}</td>`).join('')}</tr>`;});
+  document.getElementById('prev-table').innerHTML=html;
+  document.getElementById('preview-wrap').style.display='block';
+}
+
+function exportExcel(){
+  if(typeof XLSX==='undefined'){
+    const s=document.createElement('script');
+    s.src='https://cdnjs.cloudflare.com/ajax/libs/xlsx/0.18.5/xlsx.full.min.js';
+    s.onload=_doExcel; s.onerror=()=>toast('Excel недоступен (нет интернета/AP режим)',true); document.head.appendChild(s);
+  } else _doExcel();
+}
+function _doExcel(){
+  const {data,cols}=getExpData();
+  const rows=data.map(d=>{const r={};cols.forEach(c=>{r[c.h]=d[c.k]||'';});return r;});
+  const ws=XLSX.utils.json_to_sheet(rows);
+  const vals=data.map(d=>parseFloat(d.w)).filter(v=>!isNaN(v));
+  const stat=[['Параметр','Значение'],['Записей',data.length],
+    ['Мин вес',vals.length?vals.reduce((a,b)=>a<b?a:b).toFixed(3):''],
+    ['Макс вес',vals.length?vals.reduce((a,b)=>a>b?a:b).toFixed(3):''],
+    ['Среднее', vals.length?(vals.reduce((a,b)=>a+b,0)/vals.length).toFixed(3):'']];
+  const ws2=XLSX.utils.aoa_to_sheet(stat);
+  const days={};
+  data.forEach(d=>{const k=d.dt?d.dt.substring(0,10):'?';if(!days[k])days[k]={mn:999,mx:-999,n:0};const v=parseFloat(d.w);if(!isNaN(v)){days[k].mn=Math.min(days[k].mn,v);days[k].mx=Math.max(days[k].mx,v);days[k].n++;}});
+  const ws3=XLSX.utils.aoa_to_sheet([['Дата','Мин кг','Макс кг','Точек'],...Object.entries(days).map(([k,v])=>[k,v.mn.toFixed(3),v.mx.toFixed(3),v.n])]);
+  const wb=XLSX.utils.book_new();
+  XLSX.utils.book_append_sheet(wb,ws,'Данные');
+  XLSX.utils.book_append_sheet(wb,ws2,'Статистика');
+  XLSX.utils.book_append_sheet(wb,ws3,'Дневные итоги');
+  XLSX.writeFile(wb,'beehive_log.xlsx');
+}
+
+function dlBlob(blob,name){const a=document.createElement('a');const u=URL.createObjectURL(blob);a.href=u;a.download=name;a.click();setTimeout(()=>URL.revokeObjectURL(u),5000);}
+function dlSdZip(){const f=document.getElementById('exp-zip-from').value,t=document.getElementById('exp-zip-to').value;if(!f||!t){toast('Выберите период',true);return;}window.open('/api/log/export?from='+f+'&to='+t,'_blank');}
+function dlSdDate(){const d=document.getElementById('exp-date-sd').value;if(!d){toast('Выберите дату',true);return;}window.open('/api/log?date='+d,'_blank');}
+
+// ── Backup ─────────────────────────────────────────────────────────────
+function downloadBackup(){window.open('/api/backup','_blank');}
+function viewBackup(){
+  fetch('/api/backup').then(r=>r.json()).then(d=>{
+    const el=document.getElementById('backup-preview');
+    el.textContent=JSON.stringify(d,null,2);
+    el.style.display=el.style.display==='none'?'block':'none';
+  }).catch(()=>toast('Нет связи',true));
+}
+function restoreBackup(inp){
+  const file=inp.files[0];
+  if(!file){return;}
+  if(!file.name.endsWith('.json')){toast('Нужен .json файл',true);inp.value='';return;}
+  const reader=new FileReader();
+  reader.onload=function(e){
+    let json;
+    try{json=JSON.parse(e.target.result);}catch(ex){toast('Ошибка: не JSON',true);inp.value='';return;}
+    if(json._type!=='BeehiveScale_backup'){toast('Неверный формат бэкапа',true);inp.value='';return;}
+    if(!confirm('Восстановить ВСЕ настройки из бэкапа?\n(калибровка, WiFi, Telegram, параметры)\n\nТекущие настройки будут перезаписаны!')){inp.value='';return;}
+    fetch('/api/backup/restore',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(json)})
+      .then(r=>r.json()).then(d=>{toast(d.msg||'OK',!d.ok);if(d.ok)loadConfig();}).catch(()=>toast('Нет связи',true));
+  };
+  reader.readAsText(file);
+  inp.value='';
+}
+
+// ── Web UI files (LittleFS) ───────────────────────────────────────────
+function wwwLoad(){
+  fetch('/api/www').then(r=>r.json()).then(d=>{
+    const el=document.getElementById('www-list');
+    el.innerHTML=d.files.length?d.files.map(f=>f.name+' — '+(f.size/1024).toFixed(1)+' КБ '+
+      '<a href="#" onclick="wwwDelete(\''+f.name.replace(/\.gz$/,'')+'\');return false">✕</a>').join('<br>')
+      :(d.builtin?'Используется встроенный интерфейс':'Файлов нет');
+  }).catch(()=>{});
+}
+async function wwwUpload(inp){
+  for(const f of inp.files){
+    const fd=new FormData();fd.append('file',f,f.name);
+    try{const d=await(await fetch('/api/www/upload',{method:'POST',body:fd})).json();toast(f.name+': '+d.msg,!d.ok);}
+    catch(e){toast('Нет связи',true);break;}
+  }
+  inp.value='';wwwLoad();
+}
+function wwwDelete(name){
+  if(name==='*'&&!confirm('Удалить все загруженные файлы интерфейса?'))return;
+  fetch('/api/www/delete?name='+encodeURIComponent(name),{method:'POST'}).then(r=>r.json())
+    .then(d=>{toast(d.msg||'OK',!d.ok);wwwLoad();}).catch(()=>toast('Нет связи',true));
+}
+
+// ── Load config ───────────────────────────────────────────────────────
+function loadConfig(){
+  fetch('/api/config').then(r=>r.json()).then(d=>{
+    const setV=(id,v)=>{const el=document.getElementById(id);if(el&&v!==undefined)el.value=v;};
+    setV('cfg-alert',d.alertDelta); setV('cfg-calib',d.calibWeight);
+    setV('cfg-ema',d.emaAlpha);     setV('cfg-sleep',d.sleepSec);
+    setV('cfg-bl',d.lcdBlSec);
+    setV('cfg-sched',(d.schedTimes&&d.schedTimes.length>0)?d.schedTimes.join(' '):'');
+    // Токен НЕ заполняем в input — он замаскирован звёздочками, а placeholder покажет статус
+    if(d.tgTokenSet){document.getElementById('tg-token').placeholder='Токен задан (оставьте пустым чтобы не менять)';}
+    setV('tg-chatid',d.tgChatId);
+    if(d.tgReportInt!==undefined) setV('tg-report-int',d.tgReportInt);
+    if(d.alertDelta) setText('tg-thresh',d.alertDelta+' кг');
+    selWm(parseInt(d.wifiMode||0),true);
+    if(d.wifiSsid) setV('wifi-ssid',d.wifiSsid);
+  }).catch(()=>{});
+}
+
+// ── Save settings ─────────────────────────────────────────────────────
+function saveSettings(){
+  const body={};
+  const g=(id)=>document.getElementById(id);
+  const a=parseFloat(g('cfg-alert').value),c=parseFloat(g('cfg-calib').value);
+  const e=parseFloat(g('cfg-ema').value),s=parseInt(g('cfg-sleep').value),b=parseInt(g('cfg-bl').value);
+  if(!isNaN(a)) body.alertDelta=a;
+  if(!isNaN(c)) body.calibWeight=c;
+  if(!isNaN(e)) body.emaAlpha=e;
+  if(!isNaN(s)) body.sleepSec=s;
+  if(!isNaN(b)) body.lcdBlSec=b;
+  const sched=(g('cfg-sched').value||'').trim();
+  body.schedTimes=sched.length>0?sched.split(/\s+/).filter(t=>/^\d{1,2}:\d{2}$/.test(t)):[];
+  fetch('/api/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
+    .then(r=>r.json()).then(d=>toast(d.msg||'OK',!d.ok)).catch(()=>toast('Нет связи',true));
+}
+
+// ── Telegram ──────────────────────────────────────────────────────────
+function saveTelegram(){
+  const ri=parseInt(document.getElementById('tg-report-int').value||'360');
+  const body={token:document.getElementById('tg-token').value,chatId:document.getElementById('tg-chatid').value,reportInt:isNaN(ri)?360:Math.max(0,Math.min(ri,10080))};
+  fetch('/api/tg/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
+    .then(r=>r.json()).then(d=>toast(d.msg||'OK',!d.ok)).catch(()=>toast('Нет связи',true));
+}
+// Отправка идёт после ответа — результат опрашивается, пока pending
+function tgTest(){ doApiPoll('/api/tg/test'); }
+
+// ── WiFi ──────────────────────────────────────────────────────────────
+function selWm(mode, noUpdate){
+  _wifiMode=mode;
+  document.getElementById('wopt-ap').classList.toggle('sel',mode===0);
+  document.getElementById('wopt-sta').classList.toggle('sel',mode===1);
+  document.querySelectorAll('input[name="wm"]').forEach((r,i)=>r.checked=i===mode);
+  const sb=document.getElementById('sta-block');
+  if(sb) sb.style.display=mode===1?'block':'none';
+}
+function saveWifi(){
+  const body={wifiMode:_wifiMode};
+  if(_wifiMode===1){
+    const ssid=document.getElementById('wifi-ssid').value.trim();
+    const pass=document.getElementById('wifi-pass').value;
+    if(!ssid){toast('Введите SSID роутера',true);return;}
+    body.wifiSsid=ssid;
+    if(pass.length>0) body.wifiPass=pass;
+  }
+  fetch('/api/wifi/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
+    .then(r=>r.json()).then(d=>{
+      toast(d.msg||'OK',!d.ok);
+      if(d.ok) setTimeout(()=>toast('Устройство перезагружается…'),2500);
+    }).catch(()=>toast('Нет связи',true));
+}
+
+// ── AP Password ───────────────────────────────────────────────────────
+function checkPassStrength(inId,barId){
+  const v=document.getElementById(inId).value;
+  const bar=document.getElementById(barId);
+  const len=v.length;
+  const hasUpper=/[A-Z]/.test(v), hasNum=/[0-9]/.test(v), hasSym=/[^A-Za-z0-9]/.test(v);
+  const score=Math.min(4,(len>=8?1:0)+(len>=12?1:0)+(hasUpper?1:0)+(hasNum?1:0)+(hasSym?1:0));
+  const colors=['','var(--red)','var(--red)','var(--amber)','var(--green)'];
+  bar.style.width=(score*25)+'%';
+  bar.style.background=colors[score]||'var(--border)';
+}
+
+function saveApPass(){
+  const np=document.getElementById('ap-pass-new').value;
+  const cp=document.getElementById('ap-pass-confirm').value;
+  if(np.length<8||np.length>23){toast('Пароль: 8–23 символа',true);return;}
+  if(np!==cp){toast('Пароли не совпадают',true);return;}
+  const body={apPass:np};
+  fetch('/api/settings',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
+    .then(r=>r.json()).then(d=>{
+      toast(d.msg||'OK',!d.ok);
+      if(d.ok){document.getElementById('ap-pass-new').value='';document.getElementById('ap-pass-confirm').value='';}
+    }).catch(()=>toast('Нет связи',true));
+}
+
+// ── Calibration wizard ────────────────────────────────────────────────
+const WIZ=[
+  {l:'Пусто',   b:'<b>Шаг 1: Уберите все грузы.</b><br>Платформа весов должна быть абсолютно пустой. Нажмите «Далее».'},
+  {l:'Тара',    b:'<b>Шаг 2: Тарировка.</b><br>Нажмите «Тарировать» — показание обнулится.<br>Текущий вес должен стать близким к 0.'},
+  {l:'Груз',    b:'<b>Шаг 3: Поставьте эталонный груз.</b><br>Используйте гирю с известной массой (задана в Настройках).<br>Дождитесь стабилизации показания.'},
+  {l:'Cal.F.',  b:'<b>Шаг 4: Подберите Cal.Factor.</b><br>В правой панели «Ручная калибровка» введите CF и нажмите «Применить».<br>Добивайтесь совпадения «Вес (wiz)» с реальной массой груза. Поле CF автозаполнено текущим значением.'},
+  {l:'Готово',  b:'<b>✓ Калибровка завершена!</b><br>Уберите груз → Тарировка → «Сохранить эталон» на главной.'},
+];
+function updateWiz(){
+  WIZ.forEach((_,i)=>{
+    document.getElementById('ws'+i).className='wiz-step'+(i<_wizStep?' done':i===_wizStep?' active':'');
+  });
+  document.getElementById('wiz-body').innerHTML=WIZ[_wizStep].b;
+  const btn=document.getElementById('wiz-btn');
+  btn.textContent=_wizStep===1?'⊘ Тарировать':_wizStep===WIZ.length-1?'↺ Заново':'Далее →';
+}
+function wizNext(){
+  if(_wizStep===1){doApi('/api/tare').then(()=>setTimeout(fetchData,1500));_wizStep++;updateWiz();return;}
+  if(_wizStep===WIZ.length-1){wizReset();return;}
+  _wizStep++;updateWiz();
+}
+function wizReset(){_wizStep=0;updateWiz();}
+
+function applyCalib(){
+  const cf=parseFloat(document.getElementById('calib-cf').value);
+  const ofs=document.getElementById('calib-ofs').value;
+  const body={};
+  if(!isNaN(cf)) body.calibFactor=cf;
+  if(ofs!=='') body.offset=parseInt(ofs);
+  if(Object.keys(body).length===0){toast('Введите значение Cal.Factor',true);return;}
+  fetch('/api/calib/set',{method:'POST',headers:{'Content-Type':'application/json'},body:JSON.stringify(body)})
+    .then(r=>r.json()).then(d=>{toast(d.msg||'OK',!d.ok);if(d.ok)fetchData();}).catch(()=>toast('Нет связи',true));
+}
+
+// ── API viewer ────────────────────────────────────────────────────────
+function refreshApiView(){
+  fetch('/api/data').then(r=>r.json()).then(d=>{
+    document.getElementById('api-json').textContent=JSON.stringify(d,null,2);
+  }).catch(()=>{document.getElementById('api-json').textContent='Нет связи';});
+}
+
+// ── Dates init ────────────────────────────────────────────────────────
+(function initDates(){
+  const now=new Date();
+  const fmt=d=>`${d.getFullYear()}-${String(d.getMonth()+1).padStart(2,'0')}-${String(d.getDate()).padStart(2,'0')}`;
+  const today=fmt(now), weekAgo=fmt(new Date(now-7*86400000));
+  ['exp-date-sd'].forEach(id=>{const el=document.getElementById(id);if(el)el.value=today;});
+  document.getElementById('exp-from').value=weekAgo;
+  document.getElementById('exp-to').value=today;
+})();
+
+// ── Auto refresh ───────────────────────────────────────────────────────
+function period(){return _sse&&_sse.readyState===1?REFRESH_SSE:REFRESH;}
+function autoRefresh(){
+  _start=Date.now(); tickBar(); fetchData();
+  setTimeout(autoRefresh,period());
+}
+// Живые показания: сервер шлёт только изменившиеся поля /api/data.
+// Отказ (503 — нет слотов, старый браузер) — остаётся опрос раз в REFRESH
+function startEvents(){
+  if(!window.EventSource)return;
+  _sse=new EventSource('/api/events');
+  _sse.onmessage=e=>{
+    let d;try{d=JSON.parse(e.data);}catch(x){return;}
+    if(_live)updDash(Object.assign(_live,d));
+  };
+  _sse.onerror=()=>{if(_sse&&_sse.readyState===2)_sse=null;};
+}
+
+// ── Init ──────────────────────────────────────────────────────────────
+updateWiz();
+fetchData();
+startEvents();
+setTimeout(autoRefresh,REFRESH);
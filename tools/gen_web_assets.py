@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""Сборка веб-интерфейса в BeehiveScale/WebAssets.h.
+
+Исходники страницы — BeehiveScale/web/ (index.html, app.css, app.js).
+Каждый файл сжимается gzip и попадает в PROGMEM как массив байт с ETag —
+хэшем содержимого. CSS и JS подключаются из index.html с ?v=<хэш>:
+браузер кэширует их навсегда, а новая сборка меняет ссылку.
+
+Запуск после любой правки в web/ (Python 3, без зависимостей):
+    python3 tools/gen_web_assets.py
+Результат детерминирован — без изменений в web/ файл не меняется.
+"""
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB = os.path.join(ROOT, "BeehiveScale", "web")
+OUT = os.path.join(ROOT, "BeehiveScale", "WebAssets.h")
+
+# (файл в web/, URL, Content-Type, имя массива, неизменяемый по URL)
+ASSETS = [
+    ("app.css",    "/app.css",    "text/css; charset=utf-8",               "WEB_APP_CSS",    True),
+    ("app.js",     "/app.js",     "application/javascript; charset=utf-8", "WEB_APP_JS",     True),
+    ("index.html", "/index.html", "text/html; charset=utf-8",              "WEB_INDEX_HTML", False),
+]
+
+
+def _hash(data):
+    return hashlib.sha1(data).hexdigest()[:12]
+
+
+def _c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "static const uint8_t %s[] PROGMEM = {\n%s\n};\n" % (name, "\n".join(lines))
+
+
+def main():
+    files, hashes = {}, {}
+    for fname, url, _, _, _ in ASSETS:
+        with open(os.path.join(WEB, fname), "rb") as f:
+            files[fname] = f.read()
+    # Версия CSS/JS — в ссылках страницы: хэш index.html учитывает и их
+    for fname, url, _, _, immutable in ASSETS:
+        if immutable:
+            hashes[fname] = _hash(files[fname])
+    html = files["index.html"]
+    for fname, url, _, _, immutable in ASSETS:
+        if immutable:
+            for q in (b'"', b"'"):
+                html = html.replace(q + url.encode() + q,
+                                    q + url.encode() + b"?v=" + hashes[fname].encode() + q)
+    files["index.html"] = html
+    hashes["index.html"] = _hash(html)
+
+    out = [
+        "#ifndef WEB_ASSETS_H\n#define WEB_ASSETS_H\n\n",
+        "// Сгенерировано tools/gen_web_assets.py из BeehiveScale/web/ — не править вручную.\n",
+        "// Файлы веб-интерфейса сжаты gzip; etag — хэш несжатого содержимого.\n\n",
+        "#include <Arduino.h>\n\n",
+        "struct WebAsset {\n",
+        "  const char    *path;       // URL (без ?v=)\n",
+        "  const char    *type;       // Content-Type\n",
+        "  const uint8_t *gz;         // содержимое в gzip (PROGMEM)\n",
+        "  uint32_t       len;        // длина gz\n",
+        "  const char    *etag;       // \"хэш\" в кавычках, как в заголовке\n",
+        "  bool           immutable;  // версия в URL — кэшировать без перепроверки\n",
+        "};\n\n",
+    ]
+    total = raw = 0
+    for fname, url, ctype, name, immutable in ASSETS:
+        gz = gzip.compress(files[fname], 9, mtime=0)
+        total += len(gz)
+        raw += len(files[fname])
+        out.append("// %s: %d байт, в gzip %d\n" % (fname, len(files[fname]), len(gz)))
+        out.append(_c_array(name, gz))
+        out.append("\n")
+    out.append("static const WebAsset WEB_ASSETS[] = {\n")
+    for fname, url, ctype, name, immutable in ASSETS:
+        out.append('  { "%s", "%s", %s, sizeof(%s), "\\"%s\\"", %s },\n'
+                   % (url, ctype, name, name, hashes[fname], "true" if immutable else "false"))
+    out.append("};\n")
+    out.append("#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))\n")
+    out.append("#define WEB_ASSET_INDEX (WEB_ASSET_COUNT - 1)  // index.html — последний\n\n")
+    out.append("#endif\n")
+    with open(OUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(out))
+    print("WebAssets.h: %d байт -> %d в gzip" % (raw, total))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,22 @@
+#!/bin/bash
+# Все тесты на ПК: Logger во всех трёх форматах, веб-сервер на заглушках
+# Arduino/ESP8266 (include/, src/). ФС устройства — каталог /tmp/mockfs.
+# Печатает FAIL по каждому упавшему тесту и в конце "done"; код выхода 1 при ошибках
+cd "$(dirname "$0")"
+mkdir -p build
+FLAGS="-std=gnu++17 -DESP8266 -g -O0 -Iinclude -I../../BeehiveScale"
+g++ $FLAGS -c src/mock_core.cpp -o build/mock_core.o || exit 1
+g++ $FLAGS -c src/web_stubs.cpp -o build/web_stubs.o || exit 1
+failed=0
+r() { out=$("$@" 2>&1 | tail -1); echo "$out" | grep -q PASSED || { failed=1; echo "FAIL: $*"; "$@" 2>&1 | grep -v '^\[' | grep "FAIL\|error" | head; }; }
+LOG="Logger.cpp ZipStream.cpp GzipStream.cpp"
+WEB="WebServerModule.cpp Logger.cpp Memory.cpp GzipStream.cpp ZipStream.cpp JsonWriter.cpp JsonReader.cpp"
+for t in test_logger test_tail test_fallback test_wb; do r ./run.sh $t $LOG; done
+for t in test_logger_bin test_wb test_recover_bin; do XFLAGS=-DLOG_FORMAT_BINARY r ./run.sh $t $LOG; done
+for t in test_packed test_wb; do XFLAGS=-DLOG_FORMAT_PACKED r ./run.sh $t $LOG; done
+for x in "" "-DLOG_FORMAT_BINARY" "-DLOG_FORMAT_PACKED"; do XFLAGS="$x" EXTRA_OBJS=build/web_stubs.o r ./run.sh test_web $WEB; done
+XFLAGS=-DMOCK_NO_RAW EXTRA_OBJS=build/web_stubs.o r ./run.sh test_web $WEB
+for x in "" "-DLOG_FORMAT_BINARY" "-DLOG_FORMAT_PACKED"; do XFLAGS="$x" r ./run.sh test_compact $LOG; done
+LIBS=-lz r ./run.sh test_gzip GzipStream.cpp
+echo done
+exit $failed
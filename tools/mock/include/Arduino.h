@@ -0,0 +1,212 @@
+// Host-side mock of the Arduino core (subset used by BeehiveScale).
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cctype>
+#include <cstdarg>
+#include <string>
+#include <algorithm>
+#include <functional>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+#define PSTR(s) (s)
+#define PROGMEM
+#define PGM_P const char *
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcpy_P strcpy
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+using std::min;
+using std::max;
+template <class T, class L, class H> static inline T constrain(T x, L lo, H hi) { return x < lo ? lo : (x > hi ? hi : x); }
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long);
+void delayMicroseconds(unsigned int);
+void yield();
+void mock_advance_ms(unsigned long ms);
+
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define HIGH 1
+#define LOW 0
+#define A0 17
+#define FALLING 2
+#define CHANGE 3
+inline void pinMode(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+inline void digitalWrite(int, int) {}
+inline int analogRead(int) { return 600; }
+inline void attachInterrupt(int, void (*)(), int) {}
+inline int digitalPinToInterrupt(int p) { return p; }
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *sout);
+
+class String {
+ public:
+  std::string s;
+  String() {}
+  String(const char *c) : s(c ? c : "") {}
+  String(const __FlashStringHelper *c) : s(c ? (const char *)c : "") {}
+  String(const std::string &x) : s(x) {}
+  String(char c) : s(1, c) {}
+  String(int v) : s(std::to_string(v)) {}
+  String(unsigned v) : s(std::to_string(v)) {}
+  String(long v) : s(std::to_string(v)) {}
+  String(unsigned long v) : s(std::to_string(v)) {}
+  String(long long v) : s(std::to_string(v)) {}
+  String(unsigned long long v) : s(std::to_string(v)) {}
+  String(float v, unsigned char d = 2) { char b[48]; snprintf(b, sizeof(b), "%.*f", d, (double)v); s = b; }
+  String(double v, unsigned char d = 2) { char b[48]; snprintf(b, sizeof(b), "%.*f", d, v); s = b; }
+  const char *c_str() const { return s.c_str(); }
+  unsigned int length() const { return (unsigned)s.size(); }
+  bool isEmpty() const { return s.empty(); }
+  unsigned char reserve(unsigned int n) { s.reserve(n); return 1; }
+  char charAt(unsigned i) const { return i < s.size() ? s[i] : 0; }
+  char operator[](unsigned i) const { return i < s.size() ? s[i] : 0; }
+  char &operator[](unsigned i) { return s[i]; }
+  String substring(unsigned from) const { return from >= s.size() ? String() : String(s.substr(from)); }
+  String substring(unsigned from, unsigned to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= s.size()) return String();
+    if (to > s.size()) to = (unsigned)s.size();
+    return String(s.substr(from, to - from));
+  }
+  int indexOf(char c, unsigned from = 0) const { auto p = s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const String &x, unsigned from = 0) const { auto p = s.find(x.s, from); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(char c) const { auto p = s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+  bool startsWith(const String &x) const { return s.compare(0, x.s.size(), x.s) == 0; }
+  bool endsWith(const String &x) const { return s.size() >= x.s.size() && s.compare(s.size() - x.s.size(), x.s.size(), x.s) == 0; }
+  bool equals(const String &x) const { return s == x.s; }
+  bool equalsIgnoreCase(const String &x) const { return strcasecmp(s.c_str(), x.s.c_str()) == 0; }
+  long toInt() const { return atol(s.c_str()); }
+  float toFloat() const { return (float)atof(s.c_str()); }
+  void trim() { size_t a = s.find_first_not_of(" \t\r\n"); if (a == std::string::npos) { s.clear(); return; } size_t b = s.find_last_not_of(" \t\r\n"); s = s.substr(a, b - a + 1); }
+  void toLowerCase() { for (auto &c : s) c = (char)tolower(c); }
+  void toUpperCase() { for (auto &c : s) c = (char)toupper(c); }
+  void remove(unsigned i) { if (i < s.size()) s.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < s.size()) s.erase(i, n); }
+  void replace(const String &a, const String &b) { size_t p = 0; while ((p = s.find(a.s, p)) != std::string::npos) { s.replace(p, a.s.size(), b.s); p += b.s.size(); } }
+  bool concat(const char *c, unsigned n) { s.append(c, n); return true; }
+  bool concat(const String &x) { s += x.s; return true; }
+  bool concat(char c) { s += c; return true; }
+  String &operator+=(const String &x) { s += x.s; return *this; }
+  String &operator+=(const char *x) { s += x; return *this; }
+  String &operator+=(const __FlashStringHelper *x) { s += (const char *)x; return *this; }
+  String &operator+=(char c) { s += c; return *this; }
+  String &operator+=(int v) { s += std::to_string(v); return *this; }
+  String &operator+=(unsigned v) { s += std::to_string(v); return *this; }
+  String &operator+=(long v) { s += std::to_string(v); return *this; }
+  String &operator+=(unsigned long v) { s += std::to_string(v); return *this; }
+  String &operator+=(float v) { s += String(v).s; return *this; }
+  String &operator+=(double v) { s += String(v).s; return *this; }
+  bool operator==(const String &x) const { return s == x.s; }
+  bool operator==(const char *x) const { return s == x; }
+  bool operator!=(const String &x) const { return s != x.s; }
+  bool operator!=(const char *x) const { return s != x; }
+  bool operator<(const String &x) const { return s < x.s; }
+  explicit operator bool() const { return true; }
+  void getBytes(unsigned char *buf, unsigned n) const { strncpy((char *)buf, s.c_str(), n); }
+  void toCharArray(char *buf, unsigned n) const { strncpy(buf, s.c_str(), n); if (n) buf[n - 1] = 0; }
+};
+inline String operator+(const String &a, const String &b) { return String(a.s + b.s); }
+inline String operator+(const String &a, const char *b) { return String(a.s + b); }
+inline String operator+(const char *a, const String &b) { return String(std::string(a) + b.s); }
+inline String operator+(const String &a, char b) { return String(a.s + b); }
+inline String operator+(const String &a, int b) { return String(a.s + std::to_string(b)); }
+inline String operator+(const String &a, unsigned long b) { return String(a.s + std::to_string(b)); }
+inline String operator+(const String &a, const __FlashStringHelper *b) { return String(a.s + (const char *)b); }
+
+#define DEC 10
+#define HEX 16
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *b, size_t n) { size_t r = 0; while (n--) r += write(*b++); return r; }
+  size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t write(const char *s, size_t n) { return write((const uint8_t *)s, n); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const __FlashStringHelper *s) { return print((const char *)s); }
+  size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return print(String(base == HEX ? (long)v : (long)v)); }
+  size_t print(unsigned v, int base = DEC) { (void)base; return print(String(v)); }
+  size_t print(long v, int base = DEC) { (void)base; return print(String(v)); }
+  size_t print(unsigned long v, int base = DEC) { (void)base; return print(String(v)); }
+  size_t print(long long v) { return print(String(v)); }
+  size_t print(unsigned long long v) { return print(String(v)); }
+  size_t print(double v, int d = 2) { return print(String(v, (unsigned char)d)); }
+  template <class T> size_t println(const T &v) { size_t n = print(v); return n + print("\r\n"); }
+  template <class T> size_t println(const T &v, int d) { size_t n = print(v, d); return n + print("\r\n"); }
+  size_t println() { return print("\r\n"); }
+  size_t printf(const char *fmt, ...) {
+    char b[512]; va_list ap; va_start(ap, fmt); int n = vsnprintf(b, sizeof(b), fmt, ap); va_end(ap);
+    return write((const uint8_t *)b, n < 0 ? 0 : std::min<size_t>(n, sizeof(b) - 1));
+  }
+};
+
+class Stream : public Print {
+ public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long) {}
+  size_t readBytes(char *b, size_t n) { size_t i = 0; while (i < n) { int c = read(); if (c < 0) break; b[i++] = (char)c; } return i; }
+  size_t readBytes(uint8_t *b, size_t n) { return readBytes((char *)b, n); }
+  String readString() { String r; int c; while ((c = read()) >= 0) r += (char)c; return r; }
+  String readStringUntil(char t) { String r; int c; while ((c = read()) >= 0 && c != t) r += (char)c; return r; }
+};
+
+class HardwareSerial : public Stream {
+ public:
+  bool enabled = false;
+  void begin(unsigned long) {}
+  void end() {}
+  size_t write(uint8_t c) override { if (enabled) fputc(c, stderr); return 1; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+class EspClass {
+ public:
+  void wdtFeed() {}
+  void wdtDisable() {}
+  void wdtEnable(uint32_t) {}
+  void restart();
+  void reset() { restart(); }
+  uint32_t getFreeHeap() { return 30000; }
+  uint32_t getMaxFreeBlockSize() { return 20000; }
+  uint8_t getHeapFragmentation() { return 5; }
+  uint32_t getChipId() { return 0x123456; }
+  bool rtcUserMemoryRead(uint32_t off, uint32_t *data, size_t size);
+  bool rtcUserMemoryWrite(uint32_t off, uint32_t *data, size_t size);
+  void deepSleep(uint64_t) {}
+  uint32_t getCycleCount() { return (uint32_t)micros() * 80; }
+};
+extern EspClass ESP;
+
+long random(long);
+long random(long, long);
+void randomSeed(unsigned long);
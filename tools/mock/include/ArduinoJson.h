@@ -0,0 +1,167 @@
+#pragma once
+// Small functional stand-in for ArduinoJson v6 (subset used by BeehiveScale).
+#include <Arduino.h>
+#include <map>
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+struct JsonNode {
+  enum T { NUL, BOOL, INT, UINT, FLT, STR, ARR, OBJ } t = NUL;
+  bool b = false; long long i = 0; unsigned long long u = 0; double f = 0; std::string s;
+  std::vector<std::shared_ptr<JsonNode>> a;
+  std::vector<std::pair<std::string, std::shared_ptr<JsonNode>>> o;
+  std::shared_ptr<JsonNode> get(const std::string &k) { for (auto &p : o) if (p.first == k) return p.second; return nullptr; }
+  std::shared_ptr<JsonNode> getOrAdd(const std::string &k) { auto n = get(k); if (n) return n; if (t != OBJ) { t = OBJ; o.clear(); } n = std::make_shared<JsonNode>(); o.push_back({k, n}); return n; }
+};
+
+class JsonArray;
+class JsonObject;
+class JsonVariant {
+ public:
+  std::shared_ptr<JsonNode> n;
+  std::shared_ptr<JsonNode> parent; std::string key;  // lazy creation for doc["x"]
+  JsonVariant() {}
+  JsonVariant(std::shared_ptr<JsonNode> x) : n(x) {}
+  JsonVariant(std::shared_ptr<JsonNode> p, const std::string &k) : n(p ? p->get(k) : nullptr), parent(p), key(k) {}
+  JsonNode &w() { if (!n) n = parent->getOrAdd(key); return *n; }
+  template <class V> JsonVariant &operator=(V v) { set(v); return *this; }
+  JsonVariant &operator=(const JsonVariant &v) { if (v.n) { auto &d = w(); d = *v.n; } return *this; }
+  void set(bool v) { auto &d = w(); d.t = JsonNode::BOOL; d.b = v; }
+  template <class V> typename std::enable_if<std::is_integral<V>::value && std::is_signed<V>::value>::type set(V v) { auto &d = w(); d.t = JsonNode::INT; d.i = v; }
+  template <class V> typename std::enable_if<std::is_integral<V>::value && !std::is_signed<V>::value && !std::is_same<V, bool>::value>::type set(V v) { auto &d = w(); d.t = JsonNode::UINT; d.u = v; }
+  void set(float v) { auto &d = w(); d.t = JsonNode::FLT; d.f = v; }
+  void set(double v) { auto &d = w(); d.t = JsonNode::FLT; d.f = v; }
+  void set(const char *v) { auto &d = w(); if (!v) { d.t = JsonNode::NUL; return; } d.t = JsonNode::STR; d.s = v; }
+  void set(char *v) { set((const char *)v); }
+  void set(const String &v) { set(v.c_str()); }
+  void set(const __FlashStringHelper *v) { set((const char *)v); }
+  template <class V> typename std::enable_if<std::is_same<V, const char *>::value, V>::type as() const { return n && n->t == JsonNode::STR ? n->s.c_str() : nullptr; }
+  template <class V> typename std::enable_if<std::is_same<V, String>::value, V>::type as() const { return n && n->t == JsonNode::STR ? String(n->s.c_str()) : String("null"); }
+  template <class V> typename std::enable_if<std::is_arithmetic<V>::value, V>::type as() const {
+    if (!n) return 0;
+    switch (n->t) { case JsonNode::BOOL: return (V)n->b; case JsonNode::INT: return (V)n->i; case JsonNode::UINT: return (V)n->u; case JsonNode::FLT: return (V)n->f; case JsonNode::STR: return (V)atof(n->s.c_str()); default: return 0; }
+  }
+  template <class V> typename std::enable_if<std::is_same<V, JsonArray>::value, V>::type as() const;
+  template <class V> typename std::enable_if<std::is_same<V, JsonObject>::value, V>::type as() const;
+  template <class V> bool is() const;
+  bool isNull() const { return !n || n->t == JsonNode::NUL; }
+  template <class V> operator V() const { return as<V>(); }
+  const char *operator|(const char *d) const { return n && n->t == JsonNode::STR ? n->s.c_str() : d; }
+  template <class V> typename std::enable_if<std::is_arithmetic<V>::value, V>::type operator|(V d) const { return (n && n->t >= JsonNode::BOOL && n->t <= JsonNode::FLT) ? as<V>() : d; }
+  JsonVariant operator[](const char *k) { auto &d = w(); if (d.t != JsonNode::OBJ) { d.t = JsonNode::OBJ; } return JsonVariant(n, k); }
+  JsonVariant operator[](const String &k) { return (*this)[k.c_str()]; }
+  JsonVariant operator[](int i) { return n && n->t == JsonNode::ARR && i < (int)n->a.size() ? JsonVariant(n->a[i]) : JsonVariant(); }
+  bool containsKey(const char *k) const { return n && n->t == JsonNode::OBJ && n->get(k); }
+  size_t size() const { return !n ? 0 : n->t == JsonNode::ARR ? n->a.size() : n->t == JsonNode::OBJ ? n->o.size() : 0; }
+  JsonArray createNestedArray(const char *k);
+  JsonObject createNestedObject(const char *k);
+  template <class V> bool add(V v);
+  JsonObject createNestedObject();
+};
+
+class JsonArray : public JsonVariant {
+ public:
+  JsonArray() {}
+  JsonArray(std::shared_ptr<JsonNode> x) : JsonVariant(x) {}
+  struct It { std::shared_ptr<JsonNode> n; size_t i; JsonVariant operator*() const { return JsonVariant(n->a[i]); } It &operator++() { i++; return *this; } bool operator!=(const It &o) const { return i != o.i; } };
+  It begin() const { return {n, 0}; }
+  It end() const { return {n, n ? n->a.size() : 0}; }
+};
+class JsonObject : public JsonVariant {
+ public:
+  JsonObject() {}
+  JsonObject(std::shared_ptr<JsonNode> x) : JsonVariant(x) {}
+};
+template <class V> typename std::enable_if<std::is_same<V, JsonArray>::value, V>::type JsonVariant::as() const { return n && n->t == JsonNode::ARR ? JsonArray(n) : JsonArray(); }
+template <class V> typename std::enable_if<std::is_same<V, JsonObject>::value, V>::type JsonVariant::as() const { return n && n->t == JsonNode::OBJ ? JsonObject(n) : JsonObject(); }
+template <class V> bool JsonVariant::is() const {
+  if (!n) return false;
+  if (std::is_same<V, JsonArray>::value) return n->t == JsonNode::ARR;
+  if (std::is_same<V, JsonObject>::value) return n->t == JsonNode::OBJ;
+  if (std::is_same<V, const char *>::value || std::is_same<V, String>::value) return n->t == JsonNode::STR;
+  if (std::is_same<V, bool>::value) return n->t == JsonNode::BOOL;
+  if (std::is_floating_point<V>::value) return n->t >= JsonNode::INT && n->t <= JsonNode::FLT;
+  if (std::is_integral<V>::value) return n->t == JsonNode::INT || n->t == JsonNode::UINT;
+  return false;
+}
+inline JsonArray JsonVariant::createNestedArray(const char *k) { JsonVariant v = (*this)[k]; auto &d = v.w(); d.t = JsonNode::ARR; return JsonArray(v.n); }
+inline JsonObject JsonVariant::createNestedObject(const char *k) { JsonVariant v = (*this)[k]; auto &d = v.w(); d.t = JsonNode::OBJ; return JsonObject(v.n); }
+template <class V> bool JsonVariant::add(V v) { auto &d = w(); d.t = JsonNode::ARR; auto c = std::make_shared<JsonNode>(); d.a.push_back(c); JsonVariant(c).set(v); return true; }
+inline JsonObject JsonVariant::createNestedObject() { auto &d = w(); d.t = JsonNode::ARR; auto c = std::make_shared<JsonNode>(); c->t = JsonNode::OBJ; d.a.push_back(c); return JsonObject(c); }
+
+class JsonDocument : public JsonVariant {
+ public:
+  size_t cap;
+  JsonDocument(size_t c) : JsonVariant(std::make_shared<JsonNode>()), cap(c) {}
+  void clear() { *n = JsonNode(); }
+  JsonObject to_obj() { n->t = JsonNode::OBJ; return JsonObject(n); }
+  template <class V> V to() { n->t = std::is_same<V, JsonArray>::value ? JsonNode::ARR : JsonNode::OBJ; return V(n); }
+  size_t memoryUsage() const { return 16; }
+  size_t capacity() const { return cap; }
+  bool overflowed() const { return false; }
+};
+template <size_t N> class StaticJsonDocument : public JsonDocument { public: StaticJsonDocument() : JsonDocument(N) {} };
+class DynamicJsonDocument : public JsonDocument { public: DynamicJsonDocument(size_t c) : JsonDocument(c) {} };
+
+class DeserializationError {
+ public:
+  enum Code { Ok, EmptyInput, IncompleteInput, InvalidInput, NoMemory } c;
+  DeserializationError(Code x = Ok) : c(x) {}
+  explicit operator bool() const { return c != Ok; }
+  const char *c_str() const { static const char *n[] = {"Ok", "EmptyInput", "IncompleteInput", "InvalidInput", "NoMemory"}; return n[c]; }
+  bool operator==(Code x) const { return c == x; }
+};
+
+namespace mockjson {
+inline void ser(const JsonNode &n, std::string &o) {
+  char b[40];
+  switch (n.t) {
+    case JsonNode::NUL: o += "null"; break;
+    case JsonNode::BOOL: o += n.b ? "true" : "false"; break;
+    case JsonNode::INT: o += std::to_string(n.i); break;
+    case JsonNode::UINT: o += std::to_string(n.u); break;
+    case JsonNode::FLT: if (std::isnan(n.f) || std::isinf(n.f)) o += "null"; else { snprintf(b, sizeof(b), "%.9g", n.f); o += b; } break;
+    case JsonNode::STR: o += '"'; for (char c : n.s) { if (c == '"' || c == '\\') { o += '\\'; o += c; } else if (c == '\n') o += "\\n"; else if ((unsigned char)c < 0x20) { snprintf(b, sizeof(b), "\\u%04x", c); o += b; } else o += c; } o += '"'; break;
+    case JsonNode::ARR: o += '['; for (size_t i = 0; i < n.a.size(); i++) { if (i) o += ','; ser(*n.a[i], o); } o += ']'; break;
+    case JsonNode::OBJ: o += '{'; for (size_t i = 0; i < n.o.size(); i++) { if (i) o += ','; o += '"' + n.o[i].first + "\":"; ser(*n.o[i].second, o); } o += '}'; break;
+  }
+}
+struct P {
+  const char *s, *e;
+  void ws() { while (s < e && isspace((unsigned char)*s)) s++; }
+  bool str(std::string &r) {
+    if (s >= e || *s != '"') return false; s++;
+    while (s < e && *s != '"') { if (*s == '\\' && s + 1 < e) { s++; char c = *s; r += c == 'n' ? '\n' : c == 't' ? '\t' : c; } else r += *s; s++; }
+    if (s >= e) return false; s++; return true;
+  }
+  bool val(JsonNode &n) {
+    ws(); if (s >= e) return false;
+    if (*s == '{') { s++; n.t = JsonNode::OBJ; ws(); if (s < e && *s == '}') { s++; return true; }
+      for (;;) { ws(); std::string k; if (!str(k)) return false; ws(); if (s >= e || *s != ':') return false; s++; auto c = std::make_shared<JsonNode>(); if (!val(*c)) return false; n.o.push_back({k, c}); ws(); if (s < e && *s == ',') { s++; continue; } if (s < e && *s == '}') { s++; return true; } return false; } }
+    if (*s == '[') { s++; n.t = JsonNode::ARR; ws(); if (s < e && *s == ']') { s++; return true; }
+      for (;;) { auto c = std::make_shared<JsonNode>(); if (!val(*c)) return false; n.a.push_back(c); ws(); if (s < e && *s == ',') { s++; continue; } if (s < e && *s == ']') { s++; return true; } return false; } }
+    if (*s == '"') { n.t = JsonNode::STR; return str(n.s); }
+    if (!strncmp(s, "true", 4)) { s += 4; n.t = JsonNode::BOOL; n.b = true; return true; }
+    if (!strncmp(s, "false", 5)) { s += 5; n.t = JsonNode::BOOL; n.b = false; return true; }
+    if (!strncmp(s, "null", 4)) { s += 4; n.t = JsonNode::NUL; return true; }
+    char *end; std::string tmp(s, std::min<size_t>(e - s, 64)); double d = strtod(tmp.c_str(), &end); if (end == tmp.c_str()) return false;
+    std::string num(tmp.c_str(), end - tmp.c_str()); s += num.size();
+    if (num.find_first_of(".eE") == std::string::npos) { if (num[0] == '-') { n.t = JsonNode::INT; n.i = atoll(num.c_str()); } else { n.t = JsonNode::UINT; n.u = strtoull(num.c_str(), nullptr, 10); } }
+    else { n.t = JsonNode::FLT; n.f = d; }
+    return true;
+  }
+};
+}  // namespace mockjson
+
+inline DeserializationError deserializeJson(JsonDocument &d, const char *in, size_t len) {
+  d.clear(); if (!in || !len) return DeserializationError::EmptyInput;
+  mockjson::P p{in, in + len}; if (!p.val(*d.n)) return DeserializationError::InvalidInput; return DeserializationError::Ok;
+}
+inline DeserializationError deserializeJson(JsonDocument &d, const char *in) { return deserializeJson(d, in, in ? strlen(in) : 0); }
+inline DeserializationError deserializeJson(JsonDocument &d, const String &in) { return deserializeJson(d, in.c_str(), in.length()); }
+inline DeserializationError deserializeJson(JsonDocument &d, Stream &in) { String s = in.readString(); return deserializeJson(d, s); }
+inline size_t serializeJson(const JsonVariant &v, String &out) { std::string o; if (v.n) mockjson::ser(*v.n, o); else o = "null"; out = String(o); return o.size(); }
+inline size_t serializeJson(const JsonVariant &v, Print &out) { std::string o; if (v.n) mockjson::ser(*v.n, o); else o = "null"; return out.write((const uint8_t *)o.data(), o.size()); }
+inline size_t serializeJson(const JsonVariant &v, char *buf, size_t n) { std::string o; if (v.n) mockjson::ser(*v.n, o); size_t k = std::min(o.size(), n ? n - 1 : 0); memcpy(buf, o.data(), k); if (n) buf[k] = 0; return k; }
+inline size_t measureJson(const JsonVariant &v) { std::string o; if (v.n) mockjson::ser(*v.n, o); return o.size(); }
@@ -0,0 +1,15 @@
+#pragma once
+#include <Arduino.h>
+class EEPROMClass {
+ public:
+  uint8_t mem[4096] = {0};
+  void begin(size_t) {}
+  uint8_t read(int a) { return mem[a]; }
+  void write(int a, uint8_t v) { mem[a] = v; }
+  bool commit() { return true; }
+  void end() {}
+  template <class T> T &get(int a, T &t) { memcpy(&t, mem + a, sizeof(T)); return t; }
+  template <class T> const T &put(int a, const T &t) { memcpy(mem + a, &t, sizeof(T)); return t; }
+  uint8_t &operator[](int a) { return mem[a]; }
+};
+extern EEPROMClass EEPROM;
@@ -0,0 +1,132 @@
+#pragma once
+// Minimal functional mock of ESP8266WebServer: requests are injected with
+// mock_request(); the response is collected in 'resp' (status line + headers + body).
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <FS.h>
+#include <map>
+#include <vector>
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+enum HTTPUploadStatus { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED };
+struct HTTPUpload {
+  HTTPUploadStatus status;
+  String filename, name, type;
+  size_t totalSize = 0, currentSize = 0, contentLength = 0;
+  uint8_t buf[2048];
+};
+#ifndef MOCK_NO_RAW
+#define HTTP_RAW_BUFLEN 1436
+enum HTTPRawStatus { RAW_START, RAW_WRITE, RAW_END, RAW_ABORTED };
+struct HTTPRaw {
+  HTTPRawStatus status;
+  size_t totalSize = 0, currentSize = 0;
+  uint8_t buf[HTTP_RAW_BUFLEN];
+};
+#endif
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+class ESP8266WebServer;
+extern ESP8266WebServer *g_mock_server;
+class ESP8266WebServer {
+ public:
+  typedef std::function<void(void)> THandlerFunction;
+  struct Route { String uri; HTTPMethod m; THandlerFunction fn, up; };
+  std::vector<Route> routes;
+  THandlerFunction notFound;
+  std::map<std::string, std::string> argMap, reqHeaders;
+  std::vector<std::string> collected;
+  HTTPMethod curMethod = HTTP_GET;
+  String curUri;
+  bool authOk = true;
+  size_t contentLen = CONTENT_LENGTH_NOT_SET;
+  std::string extraHeaders;
+  WiFiClient cli;
+  std::shared_ptr<MockConn> conn;
+  HTTPUpload upl;
+  int lastCode = 0;
+  ESP8266WebServer(int) { g_mock_server = this; }
+  void on(const String &u, THandlerFunction f) { routes.push_back({u, HTTP_ANY, f, nullptr}); }
+  void on(const String &u, HTTPMethod m, THandlerFunction f) { routes.push_back({u, m, f, nullptr}); }
+  void on(const String &u, HTTPMethod m, THandlerFunction f, THandlerFunction up) { routes.push_back({u, m, f, up}); }
+  void onNotFound(THandlerFunction f) { notFound = f; }
+  void begin() {}
+  void stop() {}
+  void close() {}
+  void handleClient() {}
+  bool authenticate(const char *, const char *) { return authOk; }
+  void requestAuthentication() { send(401, "text/plain", "auth"); }
+  String arg(const String &n) { auto i = argMap.find(n.s); return i == argMap.end() ? String() : String(i->second); }
+  String arg(int i) { auto it = argMap.begin(); std::advance(it, i); return String(it->second); }
+  String argName(int i) { auto it = argMap.begin(); std::advance(it, i); return String(it->first); }
+  int args() { return (int)argMap.size(); }
+  bool hasArg(const String &n) { return argMap.count(n.s) > 0; }
+  String header(const String &n) { auto i = reqHeaders.find(n.s); return i == reqHeaders.end() ? String() : String(i->second); }
+  bool hasHeader(const String &n) { return reqHeaders.count(n.s) > 0; }
+  void collectHeaders(const char *h[], size_t n) { for (size_t i = 0; i < n; i++) collected.push_back(h[i]); }
+  String uri() { return curUri; }
+  HTTPMethod method() { return curMethod; }
+  WiFiClient &client() { return cli; }
+  HTTPUpload &upload() { return upl; }
+#ifdef HTTP_RAW_BUFLEN
+  HTTPRaw rawb;
+  size_t rawChunk = HTTP_RAW_BUFLEN;  // test: smaller pieces exercise split tokens
+  HTTPRaw &raw() { return rawb; }
+#endif
+  void sendHeader(const String &n, const String &v, bool first = false) { std::string l = n.s + ": " + v.s + "\r\n"; if (first) extraHeaders = l + extraHeaders; else extraHeaders += l; }
+  void setContentLength(size_t n) { contentLen = n; }
+  void _head(int code, const String &type, size_t len) {
+    lastCode = code;
+    std::string h = "HTTP/1.1 " + std::to_string(code) + "\r\n";
+    if (type.length()) h += "Content-Type: " + type.s + "\r\n";
+    if (len != CONTENT_LENGTH_UNKNOWN && len != CONTENT_LENGTH_NOT_SET) h += "Content-Length: " + std::to_string(len) + "\r\n";
+    h += extraHeaders + "\r\n";
+    extraHeaders.clear();
+    cli.write((const uint8_t *)h.data(), h.size());
+  }
+  void send(int code, const char *type = "", const String &body = String()) {
+    size_t l = contentLen == CONTENT_LENGTH_NOT_SET ? body.length() : contentLen;
+    _head(code, type, l);
+    cli.write((const uint8_t *)body.c_str(), body.length());
+    contentLen = CONTENT_LENGTH_NOT_SET;
+  }
+  void send(int code, const String &type, const String &body) { send(code, type.c_str(), body); }
+  void send(int code, const char *type, const char *body) { send(code, type, String(body)); }
+  void send_P(int code, PGM_P type, PGM_P body) { send(code, type, String(body)); }
+  void send_P(int code, PGM_P type, PGM_P body, size_t n) { send(code, type, String(std::string(body, n))); }
+  void sendContent(const String &s) { cli.write((const uint8_t *)s.c_str(), s.length()); }
+  void sendContent(const char *s, size_t n) { cli.write((const uint8_t *)s, n); }
+  void sendContent_P(PGM_P s) { sendContent(String(s)); }
+  void sendContent_P(PGM_P s, size_t n) { sendContent(s, n); }
+  template <class T> size_t streamFile(T &f, const String &type, int code = 200) {
+    std::string nm = f.name() ? f.name() : "";
+    if (nm.size() > 3 && nm.compare(nm.size() - 3, 3, ".gz") == 0) sendHeader("Content-Encoding", "gzip");
+    _head(code, type, f.size());
+    uint8_t b[512]; size_t n, t = 0;
+    while ((n = f.read(b, sizeof(b))) > 0) { cli.write(b, n); t += n; }
+    return t;
+  }
+  // test helper
+  std::string mock_request(HTTPMethod m, const String &u, std::map<std::string, std::string> a = {}, std::map<std::string, std::string> h = {}) {
+    curMethod = m; curUri = u; argMap = a; reqHeaders = h;
+    conn = std::make_shared<MockConn>(); cli = WiFiClient(conn);
+    contentLen = CONTENT_LENGTH_NOT_SET; extraHeaders.clear(); lastCode = 0;
+    for (auto &r : routes) if (r.uri == u && (r.m == HTTP_ANY || r.m == m)) {
+#ifdef HTTP_RAW_BUFLEN
+      // like core 3.x: a non-form body goes to the upload callback as HTTPRaw, not into arg("plain")
+      auto pl = argMap.find("plain");
+      if (r.up && m != HTTP_GET && pl != argMap.end()) {
+        std::string body = pl->second; argMap.erase(pl);
+        rawb.status = RAW_START; rawb.totalSize = rawb.currentSize = 0; r.up();
+        for (size_t o = 0; o < body.size(); o += rawChunk) {
+          rawb.status = RAW_WRITE; rawb.currentSize = std::min(rawChunk, body.size() - o);
+          memcpy(rawb.buf, body.data() + o, rawb.currentSize); rawb.totalSize += rawb.currentSize; r.up();
+        }
+        rawb.status = RAW_END; r.up();
+      }
+#endif
+      r.fn(); return conn->tx;
+    }
+    if (notFound) notFound();
+    return conn->tx;
+  }
+};
@@ -0,0 +1,86 @@
+#pragma once
+#include <Arduino.h>
+#include <deque>
+#include <memory>
+class IPAddress : public String {
+ public:
+  IPAddress(const char *s = "192.168.4.1") : String(s) {}
+  IPAddress(int a, int b, int c, int d) : String((std::to_string(a) + "." + std::to_string(b) + "." + std::to_string(c) + "." + std::to_string(d)).c_str()) {}
+  String toString() const { return *this; }
+};
+// In-memory TCP connection: rx is what the client sent us, tx what we wrote back.
+struct MockConn {
+  std::string rx, tx;
+  size_t rxPos = 0;
+  bool open = true;
+  size_t txWindow = (size_t)-1;  // bytes accepted per write (simulate a small TCP window)
+  size_t txRoom = (size_t)-1;    // bytes the peer still accepts until the test refills it (slow client)
+};
+class WiFiClient : public Stream {
+ public:
+  std::shared_ptr<MockConn> c;
+  WiFiClient() {}
+  WiFiClient(std::shared_ptr<MockConn> x) : c(x) {}
+  size_t write(uint8_t b) override { return write(&b, 1); }
+  size_t write(const uint8_t *b, size_t n) override {
+    if (!c || !c->open) return 0;
+    size_t k = std::min(std::min(n, c->txWindow), c->txRoom);
+    c->tx.append((const char *)b, k);
+    if (c->txRoom != (size_t)-1) c->txRoom -= k;
+    return k;
+  }
+  int availableForWrite() override { return c && c->open ? (int)std::min<size_t>(std::min(c->txWindow, c->txRoom), 2920) : 0; }
+  int available() override { return c ? (int)(c->rx.size() - c->rxPos) : 0; }
+  int read() override { return (c && c->rxPos < c->rx.size()) ? (uint8_t)c->rx[c->rxPos++] : -1; }
+  int read(uint8_t *b, size_t n) { size_t k = std::min(n, (size_t)available()); if (k) memcpy(b, c->rx.data() + c->rxPos, k); if (c) c->rxPos += k; return (int)k; }
+  int peek() override { return (c && c->rxPos < c->rx.size()) ? (uint8_t)c->rx[c->rxPos] : -1; }
+  bool connected() { return c && (c->open || available() > 0); }
+  void stop() { if (c) c->open = false; }
+  void flush() override {}
+  void setNoDelay(bool) {}
+  void setTimeout(unsigned long) {}
+  void keepAlive(uint16_t = 0, uint16_t = 0, uint8_t = 0) {}
+  IPAddress remoteIP() { return IPAddress("192.168.4.2"); }
+  explicit operator bool() { return c != nullptr && connected(); }
+  bool operator==(const WiFiClient &o) const { return c == o.c; }
+};
+class WiFiServer {
+ public:
+  uint16_t port;
+  std::deque<std::shared_ptr<MockConn>> pending;
+  WiFiServer(uint16_t p) : port(p) {}
+  void begin() {}
+  void begin(uint16_t) {}
+  void stop() {}
+  void close() {}
+  void setNoDelay(bool) {}
+  bool hasClient() { return !pending.empty(); }
+  WiFiClient available() { if (pending.empty()) return WiFiClient(); auto c = pending.front(); pending.pop_front(); return WiFiClient(c); }
+  WiFiClient accept() { return available(); }
+  std::shared_ptr<MockConn> mock_connect(const std::string &req) { auto c = std::make_shared<MockConn>(); c->rx = req; pending.push_back(c); return c; }
+};
+#define WL_CONNECTED 3
+#define WIFI_STA 1
+#define WIFI_AP 2
+#define WIFI_AP_STA 3
+class WiFiClass {
+ public:
+  IPAddress localIP() { return IPAddress("192.168.1.50"); }
+  IPAddress softAPIP() { return IPAddress("192.168.4.1"); }
+  int status() { return WL_CONNECTED; }
+  int RSSI() { return -60; }
+  String SSID() { return "mock"; }
+  uint8_t softAPgetStationNum() { return 1; }
+  void mode(int) {}
+  int getMode() { return WIFI_STA; }
+  bool softAP(const char *, const char * = nullptr, int = 1, int = 0, int = 4) { return true; }
+  void begin(const char *, const char *) {}
+  void disconnect(bool = false) {}
+  void setAutoReconnect(bool) {}
+  void persistent(bool) {}
+  void setSleepMode(int) {}
+  void forceSleepBegin() {}
+  void forceSleepWake() {}
+  String macAddress() { return "AA:BB:CC:DD:EE:FF"; }
+};
+extern WiFiClass WiFi;
@@ -0,0 +1,118 @@
+// Host-side mock of the ESP8266 FS API backed by real directories.
+#pragma once
+#include <Arduino.h>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FileImpl {
+  FILE *fp = nullptr;
+  std::string hostPath;
+  std::string name;      // full path inside FS
+  bool isDir = false;
+  bool append = false;   // O_APPEND: writes always go to EOF
+  bool writable = false;
+  std::vector<std::string> dirEntries;
+  size_t dirPos = 0;
+  std::string fsRoot;
+  ~FileImpl() { if (fp) fclose(fp); }
+};
+
+class File : public Stream {
+ public:
+  std::shared_ptr<FileImpl> p;
+  File() {}
+  explicit File(std::shared_ptr<FileImpl> i) : p(i) {}
+  explicit operator bool() const { return p && (p->fp || p->isDir); }
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *b, size_t n) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t read(uint8_t *b, size_t n);
+  size_t read(char *b, size_t n) { return read((uint8_t *)b, n); }
+  void flush() override { if (p && p->fp) fflush(p->fp); }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  bool truncate(uint32_t size);
+  void close() { p.reset(); }
+  const char *name() const;
+  const char *fullName() const { return p ? p->name.c_str() : ""; }
+  bool isDirectory() const { return p && p->isDir; }
+  bool isFile() const { return p && !p->isDir; }
+  File openNextFile();
+  void rewindDirectory() { if (p) p->dirPos = 0; }
+  time_t getLastWrite() { return 0; }
+};
+
+class Dir {
+ public:
+  std::vector<std::string> names;
+  std::vector<bool> dirs;
+  std::vector<size_t> sizes;
+  int idx = -1;
+  std::string root, path;
+  bool next() { return ++idx < (int)names.size(); }
+  String fileName() const { return String(names[idx].c_str()); }
+  size_t fileSize() const { return sizes[idx]; }
+  bool isDirectory() const { return dirs[idx]; }
+  bool isFile() const { return !dirs[idx]; }
+  File openFile(const char *mode);
+};
+
+struct FSInfo {
+  size_t totalBytes;
+  size_t usedBytes;
+  size_t blockSize;
+  size_t pageSize;
+  size_t maxOpenFiles;
+  size_t maxPathLength;
+};
+
+class FS {
+ public:
+  std::string root;
+  bool autoMkdir;  // LittleFS creates parent directories on open("w")
+  size_t totalBytes;
+  bool mounted = false;
+  bool failBegin = false;
+  FS(const std::string &r, bool autoMk, size_t total) : root(r), autoMkdir(autoMk), totalBytes(total) {}
+  bool begin();
+  void end() { mounted = false; }
+  bool format();
+  File open(const char *path, const char *mode);
+  File open(const String &path, const char *mode) { return open(path.c_str(), mode); }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *a, const char *b);
+  bool rename(const String &a, const String &b) { return rename(a.c_str(), b.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool rmdir(const char *path);
+  bool rmdir(const String &path) { return rmdir(path.c_str()); }
+  Dir openDir(const char *path);
+  Dir openDir(const String &path) { return openDir(path.c_str()); }
+  bool info(FSInfo &i);
+  std::string host(const char *path) const { return root + (path[0] == '/' ? "" : "/") + path; }
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::Dir;
+using fs::FSInfo;
+using fs::FS;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+using fs::SeekMode;
+
+size_t mock_fs_used(const std::string &root);
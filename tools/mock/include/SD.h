@@ -0,0 +1,24 @@
+#pragma once
+#include <FS.h>
+#define FILE_READ ((uint8_t)0x01)
+#define FILE_WRITE ((uint8_t)(0x01 | 0x02 | 0x40 | 0x04))
+#define SPI_HALF_SPEED 0
+class SDClass {
+ public:
+  fs::FS fs;
+  bool failBegin = false;
+  SDClass(const std::string &root) : fs(root, false, 0) {}
+  bool begin(uint8_t cs, uint32_t cfg = SPI_HALF_SPEED) { (void)cs; (void)cfg; if (failBegin) return false; return fs.begin(); }
+  void end() { fs.end(); }
+  File open(const char *path, uint8_t mode = FILE_READ) { return fs.open(path, mode == FILE_READ ? "r" : "a+"); }
+  File open(const String &path, uint8_t mode = FILE_READ) { return open(path.c_str(), mode); }
+  bool exists(const char *p) { return fs.exists(p); }
+  bool exists(const String &p) { return fs.exists(p.c_str()); }
+  bool remove(const char *p) { return fs.remove(p); }
+  bool remove(const String &p) { return fs.remove(p.c_str()); }
+  bool mkdir(const char *p);  // SdFat: creates parents
+  bool mkdir(const String &p) { return mkdir(p.c_str()); }
+  bool rmdir(const char *p) { return fs.rmdir(p); }
+  bool rmdir(const String &p) { return fs.rmdir(p.c_str()); }
+};
+extern SDClass SD;
@@ -0,0 +1,4 @@
+#pragma once
+#include <Arduino.h>
+class TwoWire{public:void begin(){} void begin(int,int){} void setClock(uint32_t){} void setClockStretchLimit(uint32_t){}};
+extern TwoWire Wire;
@@ -0,0 +1,12 @@
+#pragma once
+#include <Arduino.h>
+#include "Logger.h"
+// Test helper: old String API on top of log_stream_json_tail
+static String log_to_json(int n) {
+  struct SS : public Stream { String s;
+    size_t write(uint8_t c) override { s += (char)c; return 1; }
+    size_t write(const uint8_t *b, size_t k) override { for (size_t i = 0; i < k; i++) s += (char)b[i]; return k; }
+    int available() override { return 0; } int read() override { return -1; } int peek() override { return -1; } } o;
+  log_stream_json_tail(o, n);
+  return o.s;
+}
@@ -0,0 +1,17 @@
+#!/bin/bash
+# Сборка и запуск одного теста: run.sh <тест> <исходники BeehiveScale/...>
+# XFLAGS — формат лога (-DLOG_FORMAT_BINARY/PACKED), EXTRA_OBJS, LIBS — как в all.sh
+set -e
+cd "$(dirname "$0")"
+SRC=../../BeehiveScale
+T=$1; shift
+FLAGS="-std=gnu++17 -DESP8266 ${XFLAGS} -g -O0 -Wall -Wextra -Wno-unused-parameter -Wno-unused-function -Wno-misleading-indentation -Iinclude -I$SRC"
+mkdir -p build
+OBJS="build/mock_core.o ${EXTRA_OBJS}"
+for s in "$@"; do
+  o=build/$(basename $s .cpp)${XFLAGS:+_x}.o
+  g++ $FLAGS -x c++ -c $SRC/$s -o $o
+  OBJS="$OBJS $o"
+done
+g++ $FLAGS tests/$T.cpp $OBJS -o build/$T ${LIBS}
+./build/$T
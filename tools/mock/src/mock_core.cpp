@@ -0,0 +1,214 @@
+#include <Arduino.h>
+#include <FS.h>
+#include <SD.h>
+#include <LittleFS.h>
+#include <Wire.h>
+#include <sys/stat.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <stdexcept>
+
+static unsigned long g_ms = 1000;
+unsigned long g_ms_tick = 0;  // auto-advance per millis() call (time-slice tests)
+unsigned long millis() { g_ms += g_ms_tick; return g_ms; }
+unsigned long micros() { return g_ms * 1000UL; }
+void delay(unsigned long ms) { g_ms += ms; }
+void delayMicroseconds(unsigned int) {}
+void yield() {}
+void mock_advance_ms(unsigned long ms) { g_ms += ms; }
+
+char *dtostrf(double val, signed char width, unsigned char prec, char *sout) {
+  sprintf(sout, "%*.*f", width, prec, val);
+  return sout;
+}
+
+HardwareSerial Serial;
+EspClass ESP;
+TwoWire Wire;
+struct RestartException {};
+void EspClass::restart() { throw RestartException(); }
+static uint32_t g_rtcmem[128];
+bool EspClass::rtcUserMemoryRead(uint32_t off, uint32_t *data, size_t size) { memcpy(data, g_rtcmem + off, size); return true; }
+bool EspClass::rtcUserMemoryWrite(uint32_t off, uint32_t *data, size_t size) { memcpy(g_rtcmem + off, data, size); return true; }
+long random(long m) { return m ? rand() % m : 0; }
+long random(long a, long b) { return a + random(b - a); }
+void randomSeed(unsigned long s) { srand(s); }
+
+namespace fs {
+
+size_t File::write(const uint8_t *b, size_t n) {
+  if (!p || !p->fp || !p->writable) return 0;
+  if (p->append) fseek(p->fp, 0, SEEK_END);
+  else fseek(p->fp, 0, SEEK_CUR);
+  return fwrite(b, 1, n, p->fp);
+}
+int File::available() {
+  if (!p || !p->fp) return 0;
+  long pos = ftell(p->fp);
+  return (int)(size() - pos);
+}
+int File::read() {
+  if (!p || !p->fp) return -1;
+  fseek(p->fp, 0, SEEK_CUR);
+  int c = fgetc(p->fp);
+  return c == EOF ? -1 : c;
+}
+int File::peek() {
+  int c = read();
+  if (c >= 0) fseek(p->fp, -1, SEEK_CUR);
+  return c;
+}
+size_t File::read(uint8_t *b, size_t n) {
+  if (!p || !p->fp) return 0;
+  fseek(p->fp, 0, SEEK_CUR);
+  return fread(b, 1, n, p->fp);
+}
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!p || !p->fp) return false;
+  int wh = mode == SeekSet ? SEEK_SET : mode == SeekCur ? SEEK_CUR : SEEK_END;
+  if (mode == SeekSet && pos > size()) return false;
+  return fseek(p->fp, (long)pos, wh) == 0;
+}
+size_t File::position() const { return (p && p->fp) ? (size_t)ftell(p->fp) : 0; }
+size_t File::size() const {
+  if (!p || !p->fp) return 0;
+  fflush(p->fp);
+  struct stat st;
+  if (fstat(fileno(p->fp), &st) != 0) return 0;
+  return (size_t)st.st_size;
+}
+bool File::truncate(uint32_t sz) {
+  if (!p || !p->fp || !p->writable) return false;
+  fflush(p->fp);
+  return ftruncate(fileno(p->fp), sz) == 0;
+}
+const char *File::name() const {
+  if (!p) return "";
+  size_t s = p->name.rfind('/');
+  return s == std::string::npos ? p->name.c_str() : p->name.c_str() + s + 1;
+}
+File File::openNextFile() {
+  if (!p || !p->isDir) return File();
+  while (p->dirPos < p->dirEntries.size()) {
+    std::string n = p->dirEntries[p->dirPos++];
+    std::string full = (p->name == "/" ? "" : p->name) + "/" + n;
+    auto impl = std::make_shared<FileImpl>();
+    impl->name = full;
+    impl->hostPath = p->fsRoot + full;
+    impl->fsRoot = p->fsRoot;
+    struct stat st;
+    if (stat(impl->hostPath.c_str(), &st) != 0) continue;
+    if (S_ISDIR(st.st_mode)) {
+      impl->isDir = true;
+      DIR *d = opendir(impl->hostPath.c_str());
+      if (d) { struct dirent *e; while ((e = readdir(d))) if (strcmp(e->d_name, ".") && strcmp(e->d_name, "..")) impl->dirEntries.push_back(e->d_name); closedir(d); }
+      std::sort(impl->dirEntries.begin(), impl->dirEntries.end());
+    } else {
+      impl->fp = fopen(impl->hostPath.c_str(), "rb");
+    }
+    return File(impl);
+  }
+  return File();
+}
+
+File Dir::openFile(const char *mode) {
+  std::string full = (path == "/" ? "" : path) + "/" + names[idx];
+  FS tmp(root, true, 0);
+  tmp.mounted = true;
+  return tmp.open(full.c_str(), mode);
+}
+
+static bool isdir(const std::string &h) { struct stat st; return stat(h.c_str(), &st) == 0 && S_ISDIR(st.st_mode); }
+static bool isfile(const std::string &h) { struct stat st; return stat(h.c_str(), &st) == 0 && S_ISREG(st.st_mode); }
+
+bool FS::begin() {
+  if (failBegin) return false;
+  ::mkdir(root.c_str(), 0755);
+  mounted = true;
+  return true;
+}
+bool FS::format() {
+  std::string cmd = "rm -rf '" + root + "' && mkdir -p '" + root + "'";
+  return system(cmd.c_str()) == 0;
+}
+File FS::open(const char *path, const char *mode) {
+  if (!mounted) return File();
+  auto impl = std::make_shared<FileImpl>();
+  impl->name = path;
+  impl->hostPath = host(path);
+  impl->fsRoot = root;
+  std::string m = mode;
+  if (isdir(impl->hostPath)) {
+    impl->isDir = true;
+    DIR *d = opendir(impl->hostPath.c_str());
+    if (d) { struct dirent *e; while ((e = readdir(d))) if (strcmp(e->d_name, ".") && strcmp(e->d_name, "..")) impl->dirEntries.push_back(e->d_name); closedir(d); }
+    std::sort(impl->dirEntries.begin(), impl->dirEntries.end());
+    return File(impl);
+  }
+  if (m != "r" && autoMkdir) {
+    std::string h = impl->hostPath;
+    for (size_t i = root.size() + 1; i < h.size(); i++)
+      if (h[i] == '/') ::mkdir(h.substr(0, i).c_str(), 0755);
+  }
+  const char *fm = m == "r" ? "rb" : m == "w" ? "w+b" : m == "a" ? "a+b" : m == "a+" ? "a+b" : m == "r+" ? "r+b" : m == "w+" ? "w+b" : "rb";
+  impl->fp = fopen(impl->hostPath.c_str(), fm);
+  if (!impl->fp) return File();
+  impl->writable = (m != "r");
+  impl->append = (m == "a" || m == "a+");
+  if (impl->append) fseek(impl->fp, 0, SEEK_SET);
+  return File(impl);
+}
+bool FS::exists(const char *path) { return mounted && (isfile(host(path)) || isdir(host(path))); }
+bool FS::remove(const char *path) { return mounted && isfile(host(path)) && ::unlink(host(path).c_str()) == 0; }
+bool FS::rename(const char *a, const char *b) { return mounted && ::rename(host(a).c_str(), host(b).c_str()) == 0; }
+bool FS::mkdir(const char *path) { return mounted && ::mkdir(host(path).c_str(), 0755) == 0; }
+bool FS::rmdir(const char *path) { return mounted && ::rmdir(host(path).c_str()) == 0; }
+Dir FS::openDir(const char *path) {
+  Dir d;
+  d.root = root; d.path = path;
+  std::string h = host(path);
+  DIR *dd = opendir(h.c_str());
+  if (!dd) return d;
+  struct dirent *e;
+  std::vector<std::string> v;
+  while ((e = readdir(dd))) if (strcmp(e->d_name, ".") && strcmp(e->d_name, "..")) v.push_back(e->d_name);
+  closedir(dd);
+  std::sort(v.begin(), v.end());
+  for (auto &n : v) {
+    std::string hp = h + "/" + n;
+    d.names.push_back(n);
+    d.dirs.push_back(isdir(hp));
+    struct stat st; stat(hp.c_str(), &st);
+    d.sizes.push_back(isdir(hp) ? 0 : st.st_size);
+  }
+  return d;
+}
+bool FS::info(FSInfo &i) {
+  i.totalBytes = totalBytes;
+  i.usedBytes = mock_fs_used(root);
+  i.blockSize = 4096; i.pageSize = 256; i.maxOpenFiles = 5; i.maxPathLength = 32;
+  return true;
+}
+
+}  // namespace fs
+
+size_t mock_fs_used(const std::string &root) {
+  std::string cmd = "du -sb '" + root + "' 2>/dev/null | cut -f1";
+  FILE *p = popen(cmd.c_str(), "r");
+  size_t n = 0;
+  if (p) { if (fscanf(p, "%zu", &n) != 1) n = 0; pclose(p); }
+  return n;
+}
+
+static std::string mockRoot() {
+  const char *r = getenv("MOCK_FS_ROOT");
+  return r ? r : "/tmp/mockfs";
+}
+fs::FS LittleFS(mockRoot() + "/lfs", true, 1024 * 1024);
+SDClass SD(mockRoot() + "/sd");
+bool SDClass::mkdir(const char *p) {
+  std::string h = fs.host(p);
+  for (size_t i = fs.root.size() + 1; i <= h.size(); i++)
+    if (i == h.size() || h[i] == '/') ::mkdir(h.substr(0, i).c_str(), 0755);
+  return true;
+}
@@ -0,0 +1,19 @@
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <ESP8266WiFi.h>
+EEPROMClass EEPROM;
+WiFiClass WiFi;
+unsigned long lastActivityTime = 0;
+bool ntp_sync_time() { return true; }
+bool tg_send_message(const String &) { return true; }
+#include <ESP8266WebServer.h>
+ESP8266WebServer *g_mock_server = nullptr;
+#include "Connectivity.h"
+static uint8_t g_tg = TG_SEND_IDLE;
+bool tg_send_begin(const char *) { g_tg = TG_SEND_BUSY; return true; }
+uint8_t tg_send_poll() { if (g_tg == TG_SEND_BUSY) g_tg = TG_SEND_OK; return g_tg; }
+uint8_t tg_send_state() { return g_tg; }
+static uint8_t g_ntp = NTP_SYNC_IDLE;
+bool ntp_sync_begin() { g_ntp = NTP_SYNC_BUSY; return true; }
+uint8_t ntp_sync_poll() { if (g_ntp == NTP_SYNC_BUSY) g_ntp = NTP_SYNC_OK; return g_ntp; }
+uint8_t ntp_sync_state() { return g_ntp; }
@@ -0,0 +1,21 @@
+#include <Arduino.h>
+#include <SD.h>
+#include <LittleFS.h>
+#include "Logger.h"
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  SD.failBegin = true;
+  CHECK(log_init() && log_using_fallback());
+  log_append("01.01.2026 00:00:00", 10.0f, 5.0f, -99.0f, 4.0f, 90);
+  log_append("01.02.2026 00:00:00", 11.0f, 5.0f, -99.0f, 4.0f, 90);
+  log_flush();
+  CHECK(LittleFS.exists("/logs/2026/01.csv") && LittleFS.exists("/logs/2026/02.csv"));
+  CHECK(log_day_stat("01.01.2026").count == 1);
+  CHECK(log_size() > 0);
+  log_clear();
+  CHECK(!LittleFS.exists("/logs") && log_size() == 0);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails;
+}
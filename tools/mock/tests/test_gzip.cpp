@@ -0,0 +1,45 @@
+#include <Arduino.h>
+#include "GzipStream.h"
+#include <zlib.h>
+#include <string>
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+struct Sink : public Stream {
+  std::string s;
+  size_t write(uint8_t c) override { s += (char)c; return 1; }
+  size_t write(const uint8_t *b, size_t n) override { s.append((const char*)b, n); return n; }
+  int available() override { return 0; } int read() override { return -1; } int peek() override { return -1; }
+};
+static std::string gunzip(const std::string &in) {
+  z_stream z = {}; inflateInit2(&z, 16 + 15);
+  z.next_in = (Bytef*)in.data(); z.avail_in = in.size();
+  std::string out; char buf[65536];
+  int rc;
+  do { z.next_out = (Bytef*)buf; z.avail_out = sizeof(buf); rc = inflate(&z, Z_NO_FLUSH); out.append(buf, sizeof(buf) - z.avail_out); } while (rc == Z_OK);
+  if (rc != Z_STREAM_END) out = "<ERR " + std::to_string(rc) + ">";
+  inflateEnd(&z); return out;
+}
+static void roundtrip(const std::string &data, size_t chunk, const char *name) {
+  Sink k; GzipStream g(k); CHECK(g.begin());
+  for (size_t i = 0; i < data.size(); i += chunk) g.write((const uint8_t*)data.data() + i, std::min(chunk, data.size() - i));
+  g.end();
+  std::string back = gunzip(k.s);
+  CHECK(back == data);
+  fprintf(stderr, "%s: %zu -> %zu (%.1fx)\n", name, data.size(), k.s.size(), k.s.size() ? (double)data.size() / k.s.size() : 0);
+}
+int main() {
+  std::string csv = "datetime;weight_kg;temp_c;humidity_pct;bat_v\n";
+  for (int d = 1; d <= 20; d++) for (int m = 0; m < 1440; m += 1) {
+    char b[96]; snprintf(b, sizeof(b), "%02d.10.2026 %02d:%02d:00;%d,%02d;%d,%d;0,0;4,%02d\n", d, m / 60, m % 60, 40 + (m % 7), (m * 13) % 100, 15 + m % 10, m % 10, 10 + m % 5);
+    csv += b;
+  }
+  roundtrip(csv, 97, "csv");
+  roundtrip(csv, 1, "csv-bytewise");
+  roundtrip("", 1, "empty");
+  roundtrip("a", 1, "one");
+  roundtrip(std::string(100000, 'x'), 4096, "runs");
+  std::string rnd; uint32_t s = 1; for (int i = 0; i < 50000; i++) { s = s * 1103515245 + 12345; rnd += (char)(s >> 16); }
+  roundtrip(rnd, 333, "random");
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails;
+}
@@ -0,0 +1,193 @@
+#include <Arduino.h>
+#include <SD.h>
+#include <LittleFS.h>
+#include "Logger.h"
+#include "mock_tail_json.h"
+#include <cassert>
+#include <string>
+#include <algorithm>
+
+struct StrStream : public Stream {
+  std::string s;
+  size_t write(uint8_t c) override { s += (char)c; return 1; }
+  size_t write(const uint8_t *b, size_t n) override { s.append((const char *)b, n); return n; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+};
+
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+
+static void dt(char *b, int d, int m, int y, int hh, int mm) {
+  sprintf(b, "%02d.%02d.%04d %02d:%02d:00", d, m, y, hh, mm);
+}
+
+int main(int argc, char **argv) {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  if (getenv("VERBOSE")) Serial.enabled = true;
+  CHECK(log_init());
+  char b[24];
+  // 3 days × 100 rows
+  for (int d = 15; d <= 17; d++)
+    for (int i = 0; i < 100; i++) {
+      dt(b, d, 10, 2026, i / 60, i % 60);
+      log_append(String(b), 30.0f + d + i * 0.01f, 20.0f + (i % 10), -99.0f, 4.1f, 90);
+    }
+  StrStream s;
+  size_t n = log_stream_csv_date(s, "2026-10-16");
+  CHECK(n == 100);
+  CHECK(s.s.find("16.10.2026 00:00:00;46,00;20,0;0,0;4,10\n") != std::string::npos);
+  CHECK(s.s.find("15.10.2026") == std::string::npos);
+  char fd[12];
+  CHECK(log_first_date(fd, sizeof(fd)));
+  CHECK(strcmp(fd, "15.10.2026") == 0);
+  DayStat ds = log_day_stat("17.10.2026");
+  CHECK(ds.valid && ds.count == 100);
+  CHECK(fabsf(ds.wMin - 47.0f) < 0.001f && fabsf(ds.wMax - 47.99f) < 0.001f);
+  CHECK(fabsf(ds.tMin - 20.0f) < 0.001f && fabsf(ds.tMax - 29.0f) < 0.001f);
+  String js = log_to_json(50);
+  CHECK(js.startsWith("[{\"dt\":\"17.10.2026 00:50:00\""));
+  CHECK(js.endsWith("\"b\":4.10}]"));
+  StrStream all;
+  CHECK(log_stream_csv_date(all, "") == 300);
+  {
+    String j3 = log_to_json(3);
+    CHECK(j3 == "[{\"dt\":\"17.10.2026 01:37:00\",\"w\":47.97,\"t\":27.0,\"h\":0.0,\"b\":4.10},"
+                "{\"dt\":\"17.10.2026 01:38:00\",\"w\":47.98,\"t\":28.0,\"h\":0.0,\"b\":4.10},"
+                "{\"dt\":\"17.10.2026 01:39:00\",\"w\":47.99,\"t\":29.0,\"h\":0.0,\"b\":4.10}]");
+    String j500 = log_to_json(500);  // capped to 50
+    int n = 0; for (unsigned i = 0; i < j500.length(); i++) if (j500[i] == '{') n++;
+    CHECK(n == 50);
+  }
+  // index present and consistent after restart
+  CHECK(SD.exists("/logs/2026/10.idx"));
+  log_init();
+  { StrStream s2; CHECK(log_stream_csv_date(s2, "17.10.2026") == 100); }
+  // index removed → rebuilt
+  SD.remove("/logs/2026/10.idx");
+  log_init();
+  { StrStream s2; CHECK(log_stream_csv_date(s2, "15.10.2026") == 100); }
+  CHECK(log_day_stat("16.10.2026").count == 100);
+  // append after reinit extends open run, new day after that
+  dt(b, 17, 10, 2026, 5, 0); log_append(String(b), 50.0f, 21.0f, -99.0f, 4.1f, 90);
+  dt(b, 18, 10, 2026, 0, 0); log_append(String(b), 51.0f, 21.0f, -99.0f, 4.1f, 90);
+  CHECK(log_day_stat("17.10.2026").count == 101);
+  CHECK(log_day_stat("2026-10-18").count == 1);
+  // rollups: closed days come from /days.bin, survive index loss and reboot
+  CHECK(SD.exists(LOG_DAYS_FILE));
+  {
+    DayStat r = log_day_stat("15.10.2026");
+    CHECK(r.valid && r.count == 100 && fabsf(r.wMin - 45.0f) < 0.001f);
+    CHECK(fabsf(r.wAvg - (45.0f + 0.495f)) < 0.01f && fabsf(r.tAvg - 24.5f) < 0.01f);
+    SD.remove("/logs/2026/10.idx");
+    system("printf 'garbage' > /tmp/mockfs/sd/logs/2026/10.idx");
+    log_init();
+    CHECK(log_day_stat("15.10.2026").count == 100);
+    CHECK(log_day_stat("18.10.2026").count == 1);      // open day rebuilt after reboot
+    dt(b, 18, 10, 2026, 1, 0); log_append(String(b), 53.0f, -99.0f, -99.0f, 4.1f, 90);
+    DayStat t = log_day_stat("18.10.2026");
+    CHECK(t.count == 2 && fabsf(t.wAvg - 52.0f) < 0.001f && fabsf(t.tAvg - 21.0f) < 0.001f);
+    // day gap: 21st closes 18th, lookups of missing days are invalid
+    dt(b, 21, 10, 2026, 0, 0); log_append(String(b), 40.0f, 10.0f, -99.0f, 4.1f, 90);
+    CHECK(!log_day_stat("19.10.2026").valid);
+    CHECK(log_day_stat("18.10.2026").count == 2);
+    FILE *fp = fopen("/tmp/mockfs/sd/days.bin", "rb"); fseek(fp, 0, SEEK_END);
+    CHECK(ftell(fp) == 8 + 4 * 32); fclose(fp);
+    // summaries survive deleting the log days (rotation)
+    system("head -c 40 /tmp/mockfs/sd/logs/2026/10.csv > /tmp/x; mv /tmp/x /tmp/mockfs/sd/logs/2026/10.csv");
+    log_init();
+    CHECK(log_day_stat("16.10.2026").count == 100);
+    CHECK(log_first_date(fd, sizeof(fd)) && strcmp(fd, "15.10.2026") == 0);
+  }
+  // stale index (log replaced by shorter one) → rebuilt
+  system("head -c 120 /tmp/mockfs/sd/logs/2026/10.csv > /tmp/x && printf '15.10.2026 09:00:00;1,00;2,0;0,0;4,10\n' >> /tmp/x; mv /tmp/x /tmp/mockfs/sd/logs/2026/10.csv");
+  log_init();
+  CHECK(log_day_stat("17.10.2026").count == 101);  // from summaries
+  CHECK(log_first_date(fd, sizeof(fd)) && strcmp(fd, "15.10.2026") == 0);
+  // month boundary → new partition, no copying
+  {
+    size_t before = log_size();
+    dt(b, 31, 10, 2026, 23, 58); log_append(String(b), 60.0f, 15.0f, -99.0f, 4.1f, 90);
+    dt(b, 31, 10, 2026, 23, 59); log_append(String(b), 61.0f, 15.0f, -99.0f, 4.1f, 90);
+    dt(b, 1, 11, 2026, 0, 0);    log_append(String(b), 62.0f, 15.0f, -99.0f, 4.1f, 90);
+    log_flush();
+    CHECK(SD.exists("/logs/2026/11.csv"));
+    CHECK(log_size() > before);
+    StrStream s31; CHECK(log_stream_csv_date(s31, "31.10.2026") == 2);
+    StrStream s01; CHECK(log_stream_csv_date(s01, "2026-11-01") == 1);
+    CHECK(s01.s.find("31.10") == std::string::npos);
+    String j = log_to_json(3);
+    CHECK(j.startsWith("[{\"dt\":\"31.10.2026 23:58:00\"") && j.indexOf("01.11.2026 00:00:00") > 0);
+    CHECK(log_record_count() == 1);
+    StrStream sa; size_t na = log_stream_csv_date(sa, "");
+    CHECK(na >= 3 && na == (size_t)std::count(sa.s.begin(), sa.s.end(), '\n') - 1 && sa.s.find("datetime", 4) == std::string::npos);  // one header
+    CHECK(log_day_stat("31.10.2026").count == 2);   // closed by 01.11
+    log_init();                                      // current = newest partition
+    CHECK(log_record_count() == 1);
+    CHECK(log_day_stat("31.10.2026").count == 2);
+    SD.remove(LOG_DAYS_FILE); log_init();            // summaries rebuilt across partitions
+    CHECK(log_day_stat("31.10.2026").count == 2 && log_day_stat("01.11.2026").count == 1);
+    CHECK(SD.exists("/logs/2026/10.idx"));
+    // catalog: October closed, November current
+    CHECK(SD.exists(LOG_CAT_FILE));
+    FILE *cf = fopen("/tmp/mockfs/sd/logs/catalog.bin", "rb"); fseek(cf, 0, SEEK_END);
+    CHECK(ftell(cf) == 4 + 20); fclose(cf);
+    StrStream rg; CHECK(log_stream_csv_range(rg, "2026-10-31", "2026-11-01") == 3);
+    CHECK(rg.s.find("31.10.2026 23:58:00") != std::string::npos && rg.s.find("01.11.2026 00:00:00") != std::string::npos);
+    StrStream rg2; CHECK(log_stream_csv_range(rg2, "2026-11-02", "2026-12-01") == 0);
+    StrStream rg3; CHECK(log_stream_csv_range(rg3, "2026-11-02", "2026-10-01") == 0);
+    // catalog lost / stale → rebuilt at init
+    SD.remove(LOG_CAT_FILE); log_init();
+    CHECK(SD.exists(LOG_CAT_FILE));
+    { StrStream r4; CHECK(log_stream_csv_range(r4, "31.10.2026", "01.11.2026") == 3); }
+    // clock jumped back into October → catalog stays ordered, no duplicates
+    dt(b, 31, 10, 2026, 23, 59); log_append(String(b), 61.5f, 15.0f, -99.0f, 4.1f, 90);
+    dt(b, 1, 11, 2026, 0, 5);    log_append(String(b), 62.5f, 15.0f, -99.0f, 4.1f, 90);
+    log_flush();
+    cf = fopen("/tmp/mockfs/sd/logs/catalog.bin", "rb"); fseek(cf, 0, SEEK_END);
+    CHECK(ftell(cf) == 4 + 20); fclose(cf);
+    { StrStream r5; CHECK(log_stream_csv_range(r5, "31.10.2026", "01.11.2026") == 5); }
+  }
+  // legacy single-file log migrated into partitions (idempotent after power loss)
+  {
+    log_clear();
+    CHECK(!SD.exists("/logs"));
+    system("printf '\357\273\277datetime;weight_kg;temp_c;humidity_pct;bat_v\n"
+           "30.09.2026 10:00:00;10,00;5,0;0,0;4,10\n01.10.2026 10:00:00;11,00;6,0;0,0;4,10\n"
+           "02.10.2026 10:00:00;12,00;7,0;0,0;4,10\n' > /tmp/mockfs/sd/log.csv");
+    system("mkdir -p /tmp/mockfs/sd/logs/2026 && printf '\357\273\277datetime;weight_kg;temp_c;humidity_pct;bat_v\n"
+           "01.10.2026 10:00:00;11,00;6,0;0,0;4,10\n' > /tmp/mockfs/sd/logs/2026/10.csv");
+    CHECK(log_init());
+    CHECK(!SD.exists(LOG_FILE));
+    StrStream m; CHECK(log_stream_csv_date(m, "") == 3);
+    CHECK(m.s.find("30.09.2026 10:00:00;10,00;5,0;0,0;4,10") != std::string::npos);
+    CHECK(log_first_date(fd, sizeof(fd)) && strcmp(fd, "30.09.2026") == 0);
+    CHECK(log_day_stat("02.10.2026").count == 1);
+  }
+  // legacy rotated archives are migrated in time order
+  {
+    log_clear();
+    system("printf 'datetime;w\n05.08.2026 10:00:00;5,00;5,0;0,0;4,10\n' > /tmp/mockfs/sd/log_260805_1000.csv");
+    system("printf 'datetime;w\n01.07.2026 10:00:00;4,00;5,0;0,0;4,10\n' > /tmp/mockfs/sd/log_260701_1000.csv");
+    system("printf 'datetime;w\n06.08.2026 10:00:00;6,00;5,0;0,0;4,10\n' > /tmp/mockfs/sd/log.csv");
+    CHECK(log_init());
+    CHECK(!SD.exists("/log_260805_1000.csv") && !SD.exists("/log_260701_1000.csv"));
+    StrStream m; CHECK(log_stream_csv_date(m, "") == 3);
+    CHECK(m.s.find("01.07.2026") < m.s.find("05.08.2026") && m.s.find("05.08.2026") < m.s.find("06.08.2026"));
+    StrStream d; CHECK(log_stream_csv_date(d, "2026-07-01") == 1);
+  }
+  // cleanup is not limited by a fixed array
+  {
+    for (int i = 0; i < 25; i++) {
+      char cmd[96]; sprintf(cmd, "touch /tmp/mockfs/sd/log_2601%02d_1200.csv", i + 1); system(cmd);
+    }
+    log_clear();
+    CHECK(system("ls /tmp/mockfs/sd | grep -q '^log_'") != 0);
+  }
+  log_clear();
+  CHECK(!log_first_date(fd, sizeof(fd)));
+  CHECK(log_stream_csv_date(all, "") == 0);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}
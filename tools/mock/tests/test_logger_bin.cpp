@@ -0,0 +1,75 @@
+#include <Arduino.h>
+#include <SD.h>
+#include "Logger.h"
+#include "mock_tail_json.h"
+#include <string>
+struct StrStream : public Stream {
+  std::string s;
+  size_t write(uint8_t c) override { s += (char)c; return 1; }
+  size_t write(const uint8_t *b, size_t n) override { s.append((const char *)b, n); return n; }
+  int available() override { return 0; } int read() override { return -1; } int peek() override { return -1; }
+};
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+static long fsize(const char *p) { FILE *f = fopen(p, "rb"); if (!f) return -1; fseek(f, 0, SEEK_END); long n = ftell(f); fclose(f); return n; }
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  if (getenv("VERBOSE")) Serial.enabled = true;
+  CHECK(log_init());
+  char b[24];
+  for (int d = 15; d <= 17; d++) for (int i = 0; i < 100; i++) {
+    sprintf(b, "%02d.10.2026 %02d:%02d:00", d, i / 60, i % 60);
+    log_append(String(b), 30.0f + d + i * 0.01f, (i == 5) ? -99.0f : 20.0f + (i % 10), -99.0f, 4.1f, 90);
+  }
+  log_flush();
+  CHECK(fsize("/tmp/mockfs/sd/logs/2026/10.bin") == 16 + 300 * 16);
+  CHECK(log_record_count() == 300);
+  LogRecord r;
+  CHECK(log_read_record(150, r) && fabsf(r.weight - 46.50f) < 0.001f);
+  CHECK(log_read_record(105, r) && r.tempC < -90.0f);
+  StrStream s;
+  CHECK(log_stream_csv_date(s, "16.10.2026") == 100);
+  CHECK(s.s.find("16.10.2026 00:00:00;46,00;20,0;0,0;4,10\n") != std::string::npos);
+  CHECK(s.s.find("16.10.2026 01:39:00;46,99;29,0;0,0;4,10\n") != std::string::npos);
+  CHECK(s.s.find("16.10.2026 00:05:00;46,05;0,0;0,0;4,10\n") != std::string::npos);
+  DayStat ds = log_day_stat("15.10.2026");
+  CHECK(ds.valid && ds.count == 100 && fabsf(ds.wMax - 45.99f) < 0.001f);
+  String js = log_to_json(50);
+  CHECK(js.startsWith("[{\"dt\":\"17.10.2026 00:50:00\",\"w\":47.50"));
+  CHECK(js.endsWith("\"b\":4.10}]"));
+  StrStream all;
+  CHECK(log_stream_csv_date(all, "") == 300);
+  // torn write + corrupted record
+  system("printf 'xxxxx' >> /tmp/mockfs/sd/logs/2026/10.bin");
+  system("printf '\\377' | dd of=/tmp/mockfs/sd/logs/2026/10.bin bs=1 seek=$((16+16*10+4)) conv=notrunc 2>/dev/null");
+  log_init();
+  CHECK(fsize("/tmp/mockfs/sd/logs/2026/10.bin") == 16 + 300 * 16);
+  { StrStream s2; CHECK(log_stream_csv_date(s2, "") == 300); }
+  sprintf(b, "17.10.2026 05:00:00");
+  log_append(String(b), 50.0f, 21.0f, 40.0f, 4.1f, 90);
+  CHECK(log_record_count() == 301);
+  CHECK(log_read_record(300, r) && fabsf(r.humidity - 40.0f) < 0.01f);
+  CHECK(log_day_stat("17.10.2026").count == 101);
+  // next month → new partition; tail spans both
+  log_append("01.11.2026 00:00:00", 52.0f, 21.0f, 40.0f, 4.1f, 90);
+  log_flush();
+  CHECK(fsize("/tmp/mockfs/sd/logs/2026/11.bin") == 32 && log_record_count() == 1);
+  { String j = log_to_json(2); CHECK(j.startsWith("[{\"dt\":\"17.10.2026 05:00:00\"") && j.indexOf("01.11.2026") > 0); }
+  { StrStream s3; CHECK(log_stream_csv_date(s3, "") == 302); }
+  CHECK(log_day_stat("17.10.2026").count == 101);
+  // legacy /log.bin migrated
+  log_clear();
+  {
+    FILE *fp = fopen("/tmp/mockfs/sd/logs/2026/11.bin", "rb"); CHECK(!fp); if (fp) fclose(fp);
+  }
+  log_append("01.09.2026 00:00:00", 1.0f, 2.0f, 3.0f, 4.1f, 90);
+  log_append("02.10.2026 00:00:00", 2.0f, 2.0f, 3.0f, 4.1f, 90);
+  log_flush();
+  system("cat /tmp/mockfs/sd/logs/2026/09.bin > /tmp/mockfs/sd/log.bin && tail -c 16 /tmp/mockfs/sd/logs/2026/10.bin >> /tmp/mockfs/sd/log.bin && rm -rf /tmp/mockfs/sd/logs /tmp/mockfs/sd/days.bin");
+  CHECK(log_init());
+  CHECK(fsize("/tmp/mockfs/sd/logs/2026/09.bin") == 32 && fsize("/tmp/mockfs/sd/logs/2026/10.bin") == 32);
+  { StrStream s4; CHECK(log_stream_csv_date(s4, "") == 2); }
+  CHECK(log_day_stat("01.09.2026").count == 1);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,56 @@
+#include <Arduino.h>
+#include <sys/stat.h>
+#include "Logger.h"
+#include "mock_tail_json.h"
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+static long fsize(const char *p) { struct stat st; return stat(p, &st) ? -1 : st.st_size; }
+#define P "/tmp/mockfs/sd/logs/2026/10.pak"
+struct CS : Stream { String s; size_t write(uint8_t c) override { s += (char)c; return 1; }
+  size_t write(const uint8_t *b, size_t n) override { for (size_t i=0;i<n;i++) s+=(char)b[i]; return n; }
+  int available() override {return 0;} int read() override {return -1;} int peek() override {return -1;} };
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs/sd");
+  // legacy CSV to migrate
+  FILE *lf = fopen("/tmp/mockfs/sd/log.csv", "w");
+  fprintf(lf, "datetime;weight_kg;temp_c;humidity_pct;bat_v\n01.09.2026 10:00:00;12.50;18.0;55.0;4.05\n01.09.2026 10:01:00;12.60;18.1;55.0;4.05\n");
+  fclose(lf);
+  log_init();
+  CHECK(fsize("/tmp/mockfs/sd/log.csv") < 0);
+  CHECK(fsize("/tmp/mockfs/sd/logs/2026/09.pak") > 16);
+  char b[24];
+  int N = 3000;
+  for (int i = 0; i < N; i++) {
+    int d = 10 + i / 1440, m = i % 1440;
+    sprintf(b, "%02d.10.2026 %02d:%02d:00", d, m / 60, m % 60);
+    log_append(String(b), 30.0f + (i % 7) * 0.01f, 20.0f + (i % 3) * 0.1f, 40.0f, 4.1f, 90);
+  }
+  log_flush();
+  long sz = fsize(P);
+  fprintf(stderr, "pak size %ld for %d rows (%.2f B/row)\n", sz, N, (double)sz / N);
+  CHECK(sz > 4096 && sz < N * 8);
+  CHECK(log_record_count() == (uint32_t)N);
+  LogRecord r;
+  CHECK(log_read_record(N - 1, r));
+  CHECK(log_read_record(1500, r) && fabsf(r.weight - (30.0f + (1500 % 7) * 0.01f)) < 0.006f);
+  // range read
+  CS cs; log_stream_csv_range(cs, "11.10.2026", "11.10.2026");
+  int lines = 0; for (size_t i = 0; i < cs.s.length(); i++) if (cs.s[i] == '\n') lines++;
+  CHECK(lines == 1440 + 1);
+  CS c9; log_stream_csv_date(c9, "01.09.2026");
+  fprintf(stderr, "c9: %s\n", c9.s.c_str()); CHECK(c9.s.indexOf("10:01:00") > 0);
+  String j = log_to_json(5);
+  fprintf(stderr, "json: %s\n", j.c_str());
+  CHECK(j.indexOf("12.10.2026 01:59") > 0);
+  // torn tail
+  system("truncate -s -3 " P);
+  log_init();
+  CHECK(log_record_count() < (uint32_t)N && log_record_count() > (uint32_t)N - 40);
+  uint32_t c = log_record_count();
+  log_append("12.10.2026 05:00:00", 50.0f, 20.0f, 40.0f, 4.1f, 90); log_flush();
+  CHECK(log_record_count() == c + 1 && log_read_record(c, r) && fabsf(r.weight - 50.0f) < 0.01f);
+  log_init();
+  CHECK(log_record_count() == c + 1);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+#include <Arduino.h>
+#include <sys/stat.h>
+#include "Logger.h"
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+static long fsize(const char *p) { struct stat st; return stat(p, &st) ? -1 : st.st_size; }
+#define P "/tmp/mockfs/sd/logs/2026/10.bin"
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  log_init();
+  char b[24];
+  for (int i = 0; i < 100; i++) {
+    sprintf(b, "15.10.2026 %02d:%02d:00", i / 60, i % 60);
+    log_append(String(b), 30.0f + i * 0.01f, 20.0f, 40.0f, 4.1f, 90);
+  }
+  log_flush();
+  CHECK(fsize(P) == 16 + 100 * 16);
+  // last two records garbled + torn half record → 98 remain
+  system("dd if=/dev/urandom of=" P " bs=1 seek=$((16+98*16)) count=40 conv=notrunc 2>/dev/null");
+  log_init();
+  CHECK(fsize(P) == 16 + 98 * 16);
+  CHECK(log_record_count() == 98);
+  // stale record copied to another offset (seq mismatch) → dropped
+  system("dd if=" P " of=/tmp/rec bs=16 skip=1 count=1 2>/dev/null && cat /tmp/rec >> " P);
+  log_init();
+  CHECK(fsize(P) == 16 + 98 * 16);
+  log_append("15.10.2026 05:00:00", 50.0f, 20.0f, 40.0f, 4.1f, 90); log_flush();
+  LogRecord r;
+  CHECK(log_record_count() == 99 && log_read_record(98, r) && fabsf(r.weight - 50.0f) < 0.01f);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include <SD.h>
+#include <LittleFS.h>
+#include <sys/stat.h>
+#include "Logger.h"
+#include <string>
+struct StrStream : public Stream {
+  std::string s;
+  size_t write(uint8_t c) override { s += (char)c; return 1; }
+  size_t write(const uint8_t *b, size_t n) override { s.append((const char*)b, n); return n; }
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+};
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+static long fsize(const char *p) { struct stat st; return stat(p, &st) ? -1 : st.st_size; }
+#ifdef LOG_FORMAT_BINARY
+#define P "/tmp/mockfs/sd/logs/2026/10.bin"
+#elif defined(LOG_FORMAT_PACKED)
+#define P "/tmp/mockfs/sd/logs/2026/10.pak"
+#else
+#define P "/tmp/mockfs/sd/logs/2026/10.csv"
+#endif
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  CHECK(log_init());
+  char b[24];
+  // count trigger
+  for (int i = 0; i < LOG_WB_MAX_ROWS - 1; i++) {
+    sprintf(b, "15.10.2026 00:%02d:00", i);
+    log_append(String(b), 30.0f, 20.0f, -99.0f, 4.1f, 90);
+  }
+  CHECK(fsize(P) == -1);
+  CHECK(log_exists() && log_size() > 0);
+  CHECK(log_day_stat("15.10.2026").count == LOG_WB_MAX_ROWS - 1);  // summaries without flush
+  sprintf(b, "15.10.2026 00:%02d:00", LOG_WB_MAX_ROWS - 1);
+  log_append(String(b), 30.0f, 20.0f, -99.0f, 4.1f, 90);
+  long s1 = fsize(P);
+  CHECK(s1 > 0);
+  { StrStream s; CHECK(log_stream_csv_date(s, "15.10.2026") == LOG_WB_MAX_ROWS); }
+  // age trigger
+  log_append("15.10.2026 01:00:00", 31.0f, 20.0f, -99.0f, 4.1f, 90);
+CHECK(fsize(P) == s1);
+  log_tick(); CHECK(fsize(P) == s1);
+  delay(LOG_WB_MAX_AGE_MS);
+  log_tick(); CHECK(fsize(P) > s1);
+  // low battery trigger
+  long s2 = fsize(P);
+  log_append("15.10.2026 02:00:00", 32.0f, 20.0f, -99.0f, 4.1f, LOG_WB_LOW_BAT_PCT - 1);
+  CHECK(fsize(P) > s2);
+  // readers flush; index stays correct
+  log_append("16.10.2026 00:00:00", 33.0f, 20.0f, -99.0f, 4.1f, 90);
+  { StrStream s; CHECK(log_stream_csv_date(s, "16.10.2026") == 1); }
+  { StrStream s; CHECK(log_stream_csv_date(s, "15.10.2026") == LOG_WB_MAX_ROWS + 2); }
+  log_init();
+  { StrStream s; CHECK(log_stream_csv_date(s, "") == LOG_WB_MAX_ROWS + 3); }
+  // since: pending rows served from RAM, no flush; cursor carries the count
+  {
+    auto since = [](const std::string &cur, uint16_t lim, std::string &next) {
+      StrStream s; size_t n = log_stream_since(s, String(cur.c_str()), lim);
+      size_t p = s.s.find("\"next\":\"") + 8;
+      next = s.s.substr(p, s.s.find('"', p) - p);
+      return n;
+    };
+    std::string c0, c1, c2, c3;
+    CHECK(since("end", 100, c0) == 0 && c0.find('.', 7) == std::string::npos);
+    long sz = fsize(P);
+    log_append("18.10.2026 00:00:00", 40.0f, 20.0f, -99.0f, 4.1f, 90);
+    log_append("18.10.2026 00:01:00", 41.0f, 20.0f, -99.0f, 4.1f, 90);
+    log_append("18.10.2026 00:02:00", 42.0f, 20.0f, -99.0f, 4.1f, 90);
+    CHECK(since(c0, 100, c1) == 3 && fsize(P) == sz && c1 == c0 + ".3");
+    CHECK(since(c1, 100, c2) == 0 && c2 == c1 && fsize(P) == sz);
+    { std::string e; CHECK(since("end", 100, e) == 0 && e == c1); }
+    log_append("18.10.2026 00:03:00", 43.0f, 20.0f, -99.0f, 4.1f, 90);
+    { StrStream s; log_stream_since(s, String(c1.c_str()), 100);
+      CHECK(s.s.find("00:03:00") != std::string::npos && s.s.find("00:02:00") == std::string::npos); }
+    CHECK(since(c1, 100, c2) == 1 && c2 == c0 + ".4" && fsize(P) == sz);
+    log_flush();                                    // flushed rows already sent are skipped
+    CHECK(fsize(P) > sz);
+    CHECK(since(c2, 100, c3) == 0 && c3 == "202610." + std::to_string(fsize(P)));
+    log_append("18.10.2026 00:04:00", 44.0f, 20.0f, -99.0f, 4.1f, 90);
+    log_append("18.10.2026 00:05:00", 45.0f, 20.0f, -99.0f, 4.1f, 90);
+    CHECK(since(c2, 100, c1) == 2 && c1 == c3 + ".2");   // old cursor: flushed part + buffer
+    log_append("18.10.2026 00:06:00", 46.0f, 20.0f, -99.0f, 4.1f, 90);
+    CHECK(since(c3, 2, c1) == 2 && c1 == c3 + ".2");     // limit inside the buffer
+    CHECK(since(c1, 2, c2) == 1 && c2 == c3 + ".3");
+    // new month lives only in the buffer: its file does not exist yet
+    log_append("01.11.2026 00:00:00", 47.0f, 20.0f, -99.0f, 4.1f, 90);
+    const char *nov = P;
+    std::string novPath(nov); novPath.replace(novPath.find("/10."), 4, "/11.");
+    CHECK(fsize(novPath.c_str()) == -1);
+    CHECK(since(c2, 100, c1) == 1 && c1 == "202611.0.1");
+    log_append("01.11.2026 00:01:00", 48.0f, 20.0f, -99.0f, 4.1f, 90);
+    CHECK(since(c1, 100, c3) == 1 && c3 == "202611.0.2" && fsize(novPath.c_str()) == -1);
+    log_flush();
+    CHECK(since(c3, 100, c1) == 0 && c1 == "202611." + std::to_string(fsize(novPath.c_str())));
+  }
+  // clear drops pending rows
+  log_append("17.10.2026 00:00:00", 34.0f, 20.0f, -99.0f, 4.1f, 90);
+  log_clear(); log_flush();
+  CHECK(!log_exists() && fsize(P) == -1);
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}
@@ -0,0 +1,464 @@
+#include <Arduino.h>
+#include <ESP8266WebServer.h>
+#include <EEPROM.h>
+#include <LittleFS.h>
+#include "JsonWriter.h"
+#include "JsonReader.h"
+#include "WebServerModule.h"
+#include "Logger.h"
+#include "Memory.h"
+#include <cassert>
+static int fails = 0;
+#define CHECK(c) do { if (!(c)) { fprintf(stderr, "FAIL %s:%d %s\n", __FILE__, __LINE__, #c); fails++; } } while (0)
+static float w = 42.5f, lsw = 40.0f, t = 21.0f, h = 55.0f, rt = 22.0f, cf = 1.0f, pw = 41.0f, bv = 4.0f;
+static long ofs = 0; static bool ready = true, wok = true; static String dtm = "18.10.2026 12:00:00";
+static uint32_t wake = 0; static int bp = 80;
+static bool has(const std::string &r, const char *s) { return r.find(s) != std::string::npos; }
+static bool validJson(const std::string &js) {
+  FILE *fp = fopen("/tmp/mock_json.json", "wb"); fwrite(js.data(), 1, js.size(), fp); fclose(fp);
+  return system("python3 -c \"import json;json.load(open('/tmp/mock_json.json',encoding='utf-8'))\"") == 0;
+}
+static std::string body(const std::string &r) { size_t p = r.find("\r\n\r\n"); return p == std::string::npos ? "" : r.substr(p + 4); }
+int main() {
+  system("rm -rf /tmp/mockfs && mkdir -p /tmp/mockfs");
+  if (getenv("VERBOSE")) Serial.enabled = true;
+  log_init();
+  char b[24];
+  for (int d = 15; d <= 18; d++) for (int i = 0; i < 60; i++) {
+    sprintf(b, "%02d.10.2026 %02d:%02d:00", d, i / 60, i % 60);
+    log_append(String(b), 30.0f + d + i * 0.01f, 20.0f + (i % 10), -99.0f, 4.1f, 90);
+  }
+  WebData wd = {&w, &lsw, &t, &h, &rt, &cf, &ofs, &ready, &wok, &dtm, &wake, &bv, &bp, &pw};
+  WebActions wa = {nullptr, nullptr, nullptr, nullptr, nullptr};
+  webserver_init(wd, wa);
+  ESP8266WebServer &S = *g_mock_server;
+  // Background responses (log downloads): pump webserver_handle() until the job closes the socket
+  auto RQ = [&](HTTPMethod m, const char *u, std::map<std::string, std::string> a = {}, std::map<std::string, std::string> h = {}) {
+    S.mock_request(m, u, a, h);
+    auto c = S.conn;
+    if (S.lastCode == 0) {
+      for (int i = 0; i < 100000 && c->open; i++) webserver_handle();
+      if (c->tx.compare(0, 9, "HTTP/1.1 ") == 0) S.lastCode = atoi(c->tx.c_str() + 9);
+    }
+    return c->tx;
+  };
+  { // UI assets: gzip, ETag, 304, immutable CSS/JS
+    std::string r = S.mock_request(HTTP_GET, "/");
+    CHECK(S.lastCode == 200 && has(r, "Content-Encoding: gzip") && has(r, "Cache-Control: no-cache") && (uint8_t)body(r)[0] == 0x1F);
+    size_t p = r.find("ETag: "); std::string et = r.substr(p + 6, r.find("\r\n", p) - p - 6);
+    FILE *fp = fopen("/tmp/mock_idx.gz", "wb"); std::string gb = body(r); fwrite(gb.data(), 1, gb.size(), fp); fclose(fp);
+    CHECK(system("gzip -dc /tmp/mock_idx.gz | grep -q 'app.js?v='") == 0);
+    r = S.mock_request(HTTP_GET, "/chart", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 304 && body(r).empty());
+    r = S.mock_request(HTTP_GET, "/app.js");
+    CHECK(S.lastCode == 200 && has(r, "immutable") && has(r, "javascript"));
+    r = S.mock_request(HTTP_GET, "/app.css");
+    CHECK(S.lastCode == 200 && has(r, "text/css"));
+  }
+  { // UI files in LittleFS override the built-in ones
+    auto upload = [&](const char *name, const std::string &data, bool auth = true) {
+      S.authOk = auth;
+      S.upl.filename = name; S.upl.status = UPLOAD_FILE_START;
+      for (auto &rt : S.routes) if (rt.uri == "/api/www/upload") {
+        rt.up();
+        S.upl.status = UPLOAD_FILE_WRITE; memcpy(S.upl.buf, data.data(), data.size()); S.upl.currentSize = data.size(); rt.up();
+        S.upl.status = UPLOAD_FILE_END; rt.up();
+      }
+      std::string rr = S.mock_request(HTTP_POST, "/api/www/upload");
+      S.authOk = true;
+      return rr;
+    };
+    std::string r = upload("app.js", "console.log(1)");
+    CHECK(has(r, "\"ok\":true"));
+    r = S.mock_request(HTTP_GET, "/app.js");
+    CHECK(S.lastCode == 200 && body(r) == "console.log(1)" && !has(r, "Content-Encoding") && has(r, "no-cache"));
+    size_t p = r.find("ETag: "); std::string et = r.substr(p + 6, r.find("\r\n", p) - p - 6);
+    r = S.mock_request(HTTP_GET, "/app.js", {{"v", "1"}}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 304 && has(r, "immutable"));
+    r = upload("app.js.gz", "\x1f\x8bzz");
+    CHECK(has(r, "\"ok\":true"));
+    r = S.mock_request(HTTP_GET, "/app.js", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 200 && has(r, "Content-Encoding: gzip") && body(r) == "\x1f\x8bzz");
+    r = upload("bad name.js", "x");
+    CHECK(has(r, "\"ok\":false"));
+    r = upload("x.js", "x", false);
+    CHECK(S.lastCode == 401 && !LittleFS.exists("/www/x.js"));
+    r = S.mock_request(HTTP_GET, "/api/www");
+    CHECK(has(r, "\"name\":\"app.js.gz\"") && !has(r, "\"app.js\"") && has(r, "\"builtin\":true"));
+    { File f = LittleFS.open("/www/a\"b\\.txt", "w"); f.print("q"); f.close(); }
+    r = S.mock_request(HTTP_GET, "/api/www");
+    CHECK(S.lastCode == 200 && validJson(body(r)) && has(r, "\"name\":\"a\\\"b\\\\.txt\",\"size\":1"));
+    r = S.mock_request(HTTP_GET, "/nothing.txt");
+    CHECK(S.lastCode == 404);
+    r = S.mock_request(HTTP_POST, "/api/www/delete", {{"name", "*"}});
+    CHECK(has(r, "\"ok\":true"));
+    r = S.mock_request(HTTP_GET, "/app.js");
+    CHECK(S.lastCode == 200 && has(r, "Content-Encoding: gzip") && has(r, "immutable"));
+  }
+  { // SSE: full snapshot first, then only changed fields
+    S.mock_request(HTTP_GET, "/api/events");
+    auto c1 = S.conn;
+    CHECK(has(c1->tx, "text/event-stream") && has(c1->tx, "retry:"));
+    c1->tx.clear();
+    webserver_handle();
+    CHECK(has(c1->tx, "data: {\"weight\":42.500,") && has(c1->tx, "\"sensor\":true}\n\n"));
+    c1->tx.clear();
+    webserver_notify(WEB_EV_TEMP);
+    webserver_handle();
+    CHECK(c1->tx.empty());
+    w = 42.6f; webserver_notify(WEB_EV_WEIGHT); webserver_handle();
+    CHECK(c1->tx == "data: {\"weight\":42.600}\n\n");
+    c1->tx.clear();
+    S.mock_request(HTTP_GET, "/api/events"); auto c2 = S.conn;
+    S.mock_request(HTTP_GET, "/api/events"); auto c3 = S.conn;
+    S.mock_request(HTTP_GET, "/api/events");
+    CHECK(S.lastCode == 503);
+    t = 22.5f; webserver_notify(WEB_EV_TEMP); webserver_handle();
+    CHECK(c1->tx == "data: {\"temp\":22.5}\n\n" && has(c2->tx, "\"weight\":42.600") && has(c3->tx, "\"temp\":22.5"));
+    c2->open = false; c3->open = false;
+    webserver_handle();
+    S.mock_request(HTTP_GET, "/api/events");
+    CHECK(S.lastCode != 503 && has(S.conn->tx, "event-stream"));
+    c1->txWindow = 4; c1->tx.clear();   // full TCP buffer -> dropped
+    w = 42.7f; webserver_notify(WEB_EV_WEIGHT); webserver_handle();
+    CHECK(c1->tx.empty() && !c1->open);
+    webserver_stop();
+    w = 42.5f; t = 21.0f;
+  }
+  std::string r = S.mock_request(HTTP_GET, "/api/daystat", {{"date", "2026-10-16"}});
+  CHECK(has(r, "\"count\":60"));
+  CHECK(has(r, "\"daysSinceStart\":1"));
+  r = S.mock_request(HTTP_GET, "/api/daystat");
+  CHECK(has(r, "\"count\":60") && has(r, "\"date\":\"18.10.2026\""));
+  CHECK(has(r, "\"daysSinceStart\":3"));
+  r = RQ(HTTP_GET, "/api/log");
+  CHECK(S.lastCode == 200 && has(r, "15.10.2026 00:00:00;45,00;20,0;0,0;4,10\n") && has(r, "datetime;weight_kg"));
+  // ETag / 304 / Range
+  std::string etag0;
+  { std::string full = body(r);
+    size_t p = r.find("ETag: "); CHECK(p != std::string::npos);
+    std::string et = r.substr(p + 6, r.find("\r\n", p) - p - 6);
+    p = r.find("Last-Modified: "); std::string lm = r.substr(p + 15, r.find("\r\n", p) - p - 15);
+    if (getenv("VERBOSE")) fprintf(stderr, "etag=%s lm=%s len=%zu\n", et.c_str(), lm.c_str(), full.size());
+    r = RQ(HTTP_GET, "/api/log", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 304 && body(r).empty());
+    r = RQ(HTTP_GET, "/api/log", {}, {{"If-Modified-Since", lm}});
+    CHECK(S.lastCode == 304);
+    r = RQ(HTTP_GET, "/api/log", {}, {{"If-None-Match", "\"x\""}});
+    CHECK(S.lastCode == 200 && body(r) == full && has(r, ("Content-Length: " + std::to_string(full.size())).c_str()));
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Accept-Encoding", "gzip, deflate"}});
+    { std::string gzb = body(r);
+      CHECK(S.lastCode == 200 && has(r, "Content-Encoding: gzip") && has(r, "-gz\"") && (uint8_t)gzb[0] == 0x1F);
+      if (getenv("VERBOSE")) fprintf(stderr, "gzip %zu -> %zu\n", full.size(), gzb.size());
+      FILE *fp = fopen("/tmp/mockfs_gz.gz", "wb"); fwrite(gzb.data(), 1, gzb.size(), fp); fclose(fp);
+      CHECK(system("gzip -dc /tmp/mockfs_gz.gz > /tmp/mockfs_gz.csv") == 0);
+      fp = fopen("/tmp/mockfs_gz.csv", "rb"); std::string un; char bb[4096]; size_t k;
+      while ((k = fread(bb, 1, sizeof(bb), fp)) > 0) un.append(bb, k); fclose(fp);
+      CHECK(un == full); }
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Accept-Encoding", "gzip"}, {"If-None-Match", et}});
+    CHECK(S.lastCode == 304 && has(r, "-gz\""));
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=100-199"}});
+    CHECK(S.lastCode == 206 && body(r) == full.substr(100, 100));
+    CHECK(has(r, ("Content-Range: bytes 100-199/" + std::to_string(full.size())).c_str()));
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=5000-"}, {"If-Range", et}});
+    CHECK(S.lastCode == 206 && body(r) == full.substr(5000));
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=-10"}});
+    CHECK(S.lastCode == 206 && body(r) == full.substr(full.size() - 10));
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=999999-"}});
+    CHECK(S.lastCode == 416);
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=0-9"}, {"If-Range", "\"old\""}});
+    CHECK(S.lastCode == 200 && body(r) == full);
+    r = RQ(HTTP_GET, "/api/log", {{"date", "2026-10-16"}}, {{"Range", "bytes=10-"}});
+    CHECK(S.lastCode == 206 && !has(body(r), "17.10.2026") && has(body(r), "16.10.2026 00:59"));
+    // Cold Range: the length is counted by the job, not in the handler
+    S.mock_request(HTTP_GET, "/api/log", {{"date", "2026-10-17"}}, {{"Range", "bytes=-20"}});
+    CHECK(S.lastCode == 0 && S.conn->tx.empty());
+    r = RQ(HTTP_GET, "/api/log", {{"date", "2026-10-15"}}, {{"Range", "bytes=99999-"}});
+    CHECK(S.lastCode == 416 && has(r, "Content-Range: bytes */") && has(r, "Range Not Satisfiable"));
+    for (int i = 0; i < 1000; i++) webserver_handle();
+    r = RQ(HTTP_GET, "/api/log", {{"date", "2026-10-17"}}, {{"Range", "bytes=-20"}});
+    CHECK(S.lastCode == 206 && body(r).size() == 20);
+    { std::string whole = body(RQ(HTTP_GET, "/api/log", {{"date", "2026-10-17"}}));
+      CHECK(body(r) == whole.substr(whole.size() - 20)); }
+    r = RQ(HTTP_GET, "/api/query", {{"from", "2026-10-16"}, {"to", "2026-10-16"}}, {{"Accept-Encoding", "gzip"}});
+    { std::string gzb = body(r);
+      FILE *fp = fopen("/tmp/mock_q.gz", "wb"); fwrite(gzb.data(), 1, gzb.size(), fp); fclose(fp);
+      CHECK(S.lastCode == 200 && has(r, "Content-Encoding: gzip") && system("gzip -dc /tmp/mock_q.gz | grep -q '16.10.2026 00:00:00'") == 0); }
+    etag0 = et; }
+  r = RQ(HTTP_GET, "/api/log", {{"date", "2026-10-17"}});
+  CHECK(has(r, "17.10.2026 00:59:00;47,59;29,0;0,0;4,10\n") && !has(r, "16.10.2026"));
+  r = RQ(HTTP_GET, "/api/log", {{"from", "2026-10-16"}, {"to", "2026-10-17"}});
+  CHECK(r.find("beehive_2026-10-16_2026-10-17.csv") != std::string::npos && r.find("16.10.2026") != std::string::npos);
+  r = RQ(HTTP_GET, "/api/log", {{"from", "2026-10-16"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/query", {{"field", "weight"}, {"from", "2026-10-15"}, {"to", "2026-10-18"}, {"bucket", "1d"}, {"agg", "min,max,mean,count"}});
+  if (getenv("VERBOSE")) fprintf(stderr, "%s\n", body(r).c_str());
+  CHECK(S.lastCode == 200 && has(r, "{\"dt\":\"15.10.2026 00:00:00\",\"min\":45.000,\"max\":45.590,\"mean\":45.295,\"n\":60}"));
+  CHECK(has(r, "\"dt\":\"18.10.2026 00:00:00\""));
+  r = RQ(HTTP_GET, "/api/query", {{"field", "temp"}, {"from", "16.10.2026"}, {"to", "16.10.2026"}, {"bucket", "15m"}, {"agg", "max"}});
+  if (getenv("VERBOSE")) fprintf(stderr, "%s\n", body(r).c_str());
+  CHECK(S.lastCode == 200 && has(r, "[{\"dt\":\"16.10.2026 00:00:00\",\"max\":29.0},{\"dt\":\"16.10.2026 00:15:00\",\"max\":29.0}"));
+  r = RQ(HTTP_GET, "/api/query", {{"field", "hum"}, {"from", "2026-10-16"}, {"to", "2026-10-16"}});
+  CHECK(S.lastCode == 200 && has(body(r), "[]"));
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-10-16"}, {"to", "2026-10-16"}, {"bucket", "7m"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2025-10-16"}, {"to", "2026-10-16"}, {"bucket", "1m"}});
+  CHECK(S.lastCode == 400);
+  // Day span across month/year ends: real day numbers, order by YYYYMMDD
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2025-12-31"}, {"to", "2026-01-01"}});
+  CHECK(S.lastCode == 200 && body(r) == "[]");
+  r = RQ(HTTP_GET, "/api/query", {{"from", "31.12.2025"}, {"to", "01.01.2026"}, {"bucket", "2m"}});
+  CHECK(S.lastCode == 200 && body(r) == "[]");              // 2 days of 2m = 1440 buckets
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-02-01"}, {"to", "2026-01-31"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-01-31"}, {"to", "2026-02-01"}, {"bucket", "2m"}});
+  CHECK(S.lastCode == 200);                                 // 2 days, not 1 or 0
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-02-28"}, {"to", "2026-03-01"}, {"bucket", "2m"}});
+  CHECK(S.lastCode == 200);                                 // 2 days, not 4 (2880 buckets)
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-02-28"}, {"to", "2026-03-02"}, {"bucket", "2m"}});
+  CHECK(S.lastCode == 400);                                 // 3 days = 2160 buckets
+  r = RQ(HTTP_GET, "/api/query", {{"from", "2026-10-16"}, {"to", "2026-10-16"}, {"agg", "median"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/log/json", {{"from", "2026-10-01"}, {"to", "2026-10-31"}, {"points", "20"}});
+  { std::string bd = body(r); size_t n = 0; for (size_t p = 0; (p = bd.find("{\"dt\"", p)) != std::string::npos; p++) n++;
+    if (getenv("VERBOSE")) fprintf(stderr, "%s\n", bd.c_str());
+    CHECK(S.lastCode == 200 && n == 20);
+    CHECK(has(bd, "[{\"dt\":\"15.10.2026 00:00:00\"") && has(bd, "{\"dt\":\"18.10.2026 00:59:00\",\"w\":48.59"));
+    CHECK(has(bd, "\"w\":48.59") && has(bd, "\"w\":45.00")); }
+  r = RQ(HTTP_GET, "/api/log/json", {{"from", "2026-10-16"}, {"to", "2026-10-16"}, {"points", "500"}});
+  { std::string bd = body(r); size_t n = 0; for (size_t p = 0; (p = bd.find("{\"dt\"", p)) != std::string::npos; p++) n++;
+    CHECK(n == 60); }
+  r = RQ(HTTP_GET, "/api/log/json", {{"from", "2026-10-16"}, {"to", "2026-10-16"}, {"points", "2"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/log/json");
+  CHECK(S.lastCode == 200 && has(r, "\"dt\":\"18.10.2026 00:59:00\""));
+  r = RQ(HTTP_GET, "/api/log/bin", {{"points", "100"}});
+  { std::string bd = body(r); uint32_t n = 0; memcpy(&n, bd.data(), 4);
+    CHECK(S.lastCode == 200 && n == 100 && bd.size() == 4 + 100 * 10);
+    uint32_t ts0, tsL; int16_t w0, wL, tL; uint16_t bL;
+    memcpy(&ts0, bd.data() + 4, 4); memcpy(&tsL, bd.data() + 4 + 99 * 4, 4);
+    memcpy(&w0, bd.data() + 4 + 400, 2); memcpy(&wL, bd.data() + 4 + 400 + 99 * 2, 2);
+    memcpy(&tL, bd.data() + 4 + 600 + 99 * 2, 2); memcpy(&bL, bd.data() + 4 + 800 + 99 * 2, 2);
+    CHECK(tsL % 86400 == 59 * 60 && wL == 4859 && tL == 290 && bL == 4100);
+    CHECK(w0 == 4720 && tsL - ts0 == 86400 + 39 * 60); }
+  r = RQ(HTTP_GET, "/api/log/bin", {{"from", "2026-10-01"}, {"to", "2026-10-31"}, {"points", "20"}});
+  { std::string bd = body(r); uint32_t n = 0; memcpy(&n, bd.data(), 4); int16_t w0;
+    memcpy(&w0, bd.data() + 4 + 80, 2);
+    CHECK(S.lastCode == 200 && n == 20 && bd.size() == 204 && w0 == 4500); }
+  r = RQ(HTTP_GET, "/api/log/bin", {{"from", "2026-10-01"}});
+  CHECK(S.lastCode == 400);
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", "end"}});
+  std::string bd = body(r);
+  CHECK(S.lastCode == 200 && has(bd, "{\"rows\":[],\"next\":\"202610.") && has(bd, "\"reset\":false}"));
+  std::string cur = bd.substr(bd.find("\"next\":\"") + 8); cur = cur.substr(0, cur.find('"'));
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", cur}});
+  CHECK(has(body(r), "\"rows\":[]") && has(body(r), cur.c_str()));
+  log_append("18.10.2026 01:00:00", 50.0f, 21.0f, -99.0f, 4.1f, 90);
+  log_append("18.10.2026 01:01:00", 50.5f, 21.0f, -99.0f, 4.1f, 90);
+  r = RQ(HTTP_GET, "/api/log", {}, {{"If-None-Match", etag0}});
+  CHECK(S.lastCode == 200 && !has(r, etag0.c_str()));
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", cur}});
+  bd = body(r);
+  if (getenv("VERBOSE")) fprintf(stderr, "%s\n", bd.c_str());
+  CHECK(has(bd, "{\"rows\":[{\"dt\":\"18.10.2026 01:00:00\",\"w\":50.00") && has(bd, "01:01:00\",\"w\":50.50"));
+  CHECK(!has(bd, "00:59:00") && !has(bd, cur.c_str()));
+  // Вся история страницами по 100
+  { std::string c; size_t total = 0; int pages = 0;
+    for (;;) {
+      r = RQ(HTTP_GET, "/api/log/since", {{"cursor", c}, {"limit", "100"}});
+      bd = body(r);
+      size_t n = 0; for (size_t p = 0; (p = bd.find("{\"dt\"", p)) != std::string::npos; p++) n++;
+      std::string nc = bd.substr(bd.find("\"next\":\"") + 8); nc = nc.substr(0, nc.find('"'));
+      total += n; pages++;
+      if (n == 0 || pages > 20) break;
+      CHECK(n <= 100 || n < 200);
+      c = nc;
+    }
+    if (getenv("VERBOSE")) fprintf(stderr, "since pages=%d total=%zu\n", pages, total);
+    CHECK(total == 242); }
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", "202610.99999999"}});
+  CHECK(has(body(r), "\"reset\":true") && has(body(r), "15.10.2026 00:00:00"));
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", "end"}});
+  bd = body(r); cur = bd.substr(bd.find("\"next\":\"") + 8); cur = cur.substr(0, cur.find('"'));
+  log_append("01.11.2026 00:00:00", 51.0f, 21.0f, -99.0f, 4.1f, 90);
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", cur}});
+  bd = body(r);
+  if (getenv("VERBOSE")) fprintf(stderr, "%s\n", bd.c_str());
+  CHECK(has(bd, "[{\"dt\":\"01.11.2026 00:00:00\"") && has(bd, "\"next\":\"202611.") && has(bd, "\"reset\":false"));
+  r = RQ(HTTP_GET, "/api/log/since", {{"cursor", "x"}});
+  CHECK(S.lastCode == 400);
+  for (const char *cmp : {"1", "0"}) {
+    r = RQ(HTTP_GET, "/api/log/export", {{"from", "2026-10-14"}, {"to", "2026-10-17"}, {"compress", cmp}});
+    std::string zb = body(r);
+    CHECK(S.lastCode == 200 && has(r, "application/zip") && zb.size() > 100);
+    FILE *fp = fopen("/tmp/mock_export.zip", "wb"); fwrite(zb.data(), 1, zb.size(), fp); fclose(fp);
+    CHECK(system("python3 -c \"import zipfile,sys;z=zipfile.ZipFile('/tmp/mock_export.zip');assert z.testzip() is None;n=z.namelist();print(n,[len(z.read(x)) for x in n]);"
+                 "assert n==['2026-10-15.csv','2026-10-16.csv','2026-10-17.csv'],n;d=z.read('2026-10-16.csv').decode('utf-8-sig').splitlines();"
+                 "assert d[0].startswith('datetime;') and len(d)==61 and d[1]=='16.10.2026 00:00:00;46,00;20,0;0,0;4,10',d[:2]\"") == 0);
+  }
+  r = RQ(HTTP_GET, "/api/log/export", {{"from", "2026-10-14"}});
+  CHECK(S.lastCode == 400);
+  { // Background downloads: slow clients are paced, the server keeps serving others
+    std::string full = body(RQ(HTTP_GET, "/api/log"));
+    S.mock_request(HTTP_GET, "/api/log"); auto c1 = S.conn; c1->txRoom = 100;
+    S.mock_request(HTTP_GET, "/api/log", {{"date", "2026-10-16"}}); auto c2 = S.conn; c2->txRoom = 100;
+    CHECK(S.lastCode == 0 && c1->tx.empty() && c2->tx.empty());
+    r = S.mock_request(HTTP_GET, "/api/log");
+    CHECK(S.lastCode == 503);                          // both slots busy
+    r = S.mock_request(HTTP_GET, "/api/query", {{"from", "2026-10-16"}, {"to", "2026-10-16"}});
+    CHECK(S.lastCode == 200 && has(r, "{\"dt\":\"16.10.2026 00:00:00\""));  // no slot: answered in the handler
+    webserver_handle();
+    CHECK(c1->tx.size() == 100 && c2->tx.size() == 100);  // one window each per call
+    r = S.mock_request(HTTP_GET, "/api/data");
+    CHECK(S.lastCode == 200 && has(r, "\"weight\""));
+    for (int i = 0; i < 1000 && (c1->open || c2->open); i++) { c1->txRoom = c2->txRoom = 300; webserver_handle(); }
+    CHECK(!c1->open && body(c1->tx) == full);
+    CHECK(!c2->open && has(body(c2->tx), "16.10.2026 00:59") && !has(body(c2->tx), "17.10.2026"));
+    S.mock_request(HTTP_GET, "/api/log/export", {{"from", "2026-10-15"}, {"to", "2026-10-18"}}); auto c3 = S.conn;
+    c3->open = false;                                  // client went away mid-download
+    webserver_handle();
+    r = RQ(HTTP_GET, "/api/log", {}, {{"Range", "bytes=-10"}});
+    CHECK(S.lastCode == 206 && body(r) == full.substr(full.size() - 10)); }
+  { // Generator jobs give the same bytes when every step runs out of time slice
+    extern unsigned long g_ms_tick;
+    std::vector<std::pair<const char *, std::map<std::string, std::string>>> qs = {
+      {"/api/log/json", {{"from", "2026-10-01"}, {"to", "2026-10-31"}, {"points", "20"}}},
+      {"/api/log/bin",  {{"from", "2026-10-01"}, {"to", "2026-10-31"}, {"points", "30"}}},
+      {"/api/query",    {{"from", "2026-10-15"}, {"to", "2026-10-18"}, {"bucket", "15m"}, {"agg", "min,max,mean,count"}}},
+      {"/api/log/since", {{"limit", "300"}}}};
+    for (auto &q : qs) {
+      std::string a = body(RQ(HTTP_GET, q.first, q.second));
+      g_ms_tick = 7;
+      S.mock_request(HTTP_GET, q.first, q.second); auto c = S.conn;
+      int calls = 0;
+      for (; calls < 100000 && c->open; calls++) webserver_handle();
+      g_ms_tick = 0;
+      if (getenv("VERBOSE")) fprintf(stderr, "%s: %zu bytes, %d calls\n", q.first, a.size(), calls);
+      CHECK(!c->open && body(c->tx) == a && a.size() > 20 && calls > 3);
+    } }
+  r = S.mock_request(HTTP_POST, "/api/tg/test");
+  CHECK(S.lastCode == 200 && has(r, "\"pending\":true"));
+  webserver_handle();
+  r = S.mock_request(HTTP_GET, "/api/tg/test");
+  CHECK(has(r, "\"pending\":false") && has(r, "отправлено"));
+  r = S.mock_request(HTTP_GET, "/api/ntp");
+  CHECK(S.lastCode == 200 && has(r, "\"pending\":false") && has(r, "не запускалась"));
+  r = S.mock_request(HTTP_POST, "/api/ntp");
+  CHECK(S.lastCode == 200 && has(r, "\"pending\":true"));
+  webserver_handle();
+  r = S.mock_request(HTTP_GET, "/api/ntp");
+  CHECK(has(r, "\"pending\":false") && has(r, "\"ok\":true") && has(r, "синхронизировано"));
+  { // JSON writer: escaping, numbers, nesting; every JSON endpoint parses
+    struct P : public Print { std::string s; size_t write(uint8_t c) override { s += (char)c; return 1; }
+      size_t write(const uint8_t *b, size_t n) override { s.append((const char *)b, n); return n; } } o;
+    JsonWriter j(o);
+    j.beginObject(); j.add("s", "a\"b\\c\n\x01й"); j.add("f", 4.1f, 2); j.add("z", -0.0001, 3); j.add("n", (double)NAN);
+    j.add("i", -5); j.add("u", 4000000000UL); j.beginArray("a"); j.add(nullptr, 1); j.beginObject(); j.endObject(); j.endArray();
+    j.add("b", false); j.endObject();
+    CHECK(o.s == "{\"s\":\"a\\\"b\\\\c\\n\\u0001й\",\"f\":4.1,\"z\":0,\"n\":null,\"i\":-5,\"u\":4000000000,\"a\":[1,{}],\"b\":false}");
+    for (const char *u : {"/api/data", "/api/config", "/api/daystat", "/api/backup", "/api/tg/test"}) {
+      r = S.mock_request(HTTP_GET, u);
+      CHECK(S.lastCode == 200 && validJson(body(r)));
+    }
+    CHECK(has(r, "\"pending\":false"));
+    r = S.mock_request(HTTP_GET, "/api/backup");
+    CHECK(has(body(r), "{\"_type\":\"BeehiveScale_backup\"") && has(r, "beehive_backup.json") && has(body(r), "\"schedTimes\":["));
+    std::string saved = log_read_backup().c_str();
+    CHECK(validJson(saved) && has(saved, "\"calibFactor\":")); }
+  r = S.mock_request(HTTP_GET, "/api/dashboard");
+  CHECK(S.lastCode == 200 && has(body(r), "{\"data\":{\"weight\":") && has(body(r), ",\"day\":{\"date\":\"18.10.2026\"") && !has(r, "config"));
+  CHECK(has(body(r), "\"valid\":true") && body(r).back() == '}');
+  r = S.mock_request(HTTP_GET, "/api/dashboard", {{"fields", "config"}, {"date", "2026-10-16"}});
+  CHECK(S.lastCode == 200 && body(r).compare(0, 11, "{\"config\":{") == 0 && has(r, "\"schedTimes\":[") && !has(r, "\"weight\""));
+  r = S.mock_request(HTTP_GET, "/api/dashboard", {{"fields", "day,data"}, {"date", "2026-10-16"}});
+  CHECK(has(r, "\"day\":{\"date\":\"16.10.2026\"") && has(r, "\"data\":{") && !has(r, "config"));
+  r = S.mock_request(HTTP_GET, "/api/dashboard", {{"fields", ""}});
+  CHECK(S.lastCode == 200 && body(r) == "{}");
+  r = S.mock_request(HTTP_GET, "/api/dashboard", {{"date", "x<y"}});
+  CHECK(S.lastCode == 400);
+  r = S.mock_request(HTTP_GET, "/api/data");
+  CHECK(S.lastCode == 200 && has(r, "\"weight\""));
+  { // streaming JSON reader: byte-by-byte feed, escapes, nesting, errors
+    struct Ev { std::string k, v; int t, d; bool o; };
+    std::vector<Ev> ev;
+    auto cb = [](const JsonField &f, void *c) { ((std::vector<Ev>*)c)->push_back({f.key, f.val, f.type, f.depth, f.overflow}); };
+    std::string doc = "{ \"a\" : -1.5e2, \"s\":\"x\\\"\\u00e9\\ud83d\\ude00\\n\", \"n\":{\"q\":[1,{\"z\":null}]},\"b\":true,\"e\":[], \"l\":\"" + std::string(100, 'L') + "\", \"t\":\"ok\"}  ";
+    JsonReader rd; rd.begin(cb, &ev);
+    for (char c : doc) CHECK(rd.feed(&c, 1));
+    CHECK(rd.finish() && ev.size() == 11);
+    CHECK(ev[0].k == "a" && ev[0].v == "-1.5e2" && ev[0].t == JSON_NUMBER && ev[0].d == 1);
+    CHECK(ev[1].k == "s" && ev[1].v == "x\"\xc3\xa9\xf0\x9f\x98\x80\n" && ev[1].t == JSON_STRING);
+    CHECK(ev[2].k == "n" && ev[2].t == JSON_OBJECT && ev[3].t == JSON_ARRAY && ev[3].d == 2 && ev[4].v == "1" && ev[4].d == 3);
+    CHECK(ev[5].t == JSON_OBJECT && ev[6].t == JSON_NULL && ev[6].k == "n" && ev[6].d == 4);
+    CHECK(ev[7].k == "b" && ev[7].t == JSON_BOOL && ev[8].t == JSON_ARRAY && ev[9].o && ev[10].v == "ok" && !ev[10].o);
+    for (const char *bad : {"", "[1]", "{\"a\":}", "{\"a\":1,}", "{\"a\":01x}", "{\"a\":[}", "{\"a\":1}}", "{\"a\":\"\x01\"}", "{\"a\":tru}", "{'a':1}"}) {
+      JsonReader r2; r2.begin(nullptr, nullptr); r2.feed(bad, strlen(bad));
+      CHECK(!r2.finish());
+    }
+    std::string deep = "{\"d\":" + std::string(20, '[') + std::string(20, ']') + "}";
+    JsonReader r3; r3.begin(nullptr, nullptr); CHECK(!r3.feed(deep.data(), deep.size()));
+  }
+  { // POST bodies are parsed from raw chunks; unknown and bad fields are reported
+#ifdef HTTP_RAW_BUFLEN
+    S.rawChunk = 3;
+#endif
+    r = S.mock_request(HTTP_POST, "/api/settings", {{"plain", "{\"alertDelta\":2.5,\"schedTimes\":[\"06:30\",\"bad\",\"21:05\"],\"futureKey\":{\"x\":[1]},\"tgToken\":\"t\"}"}});
+    CHECK(S.lastCode == 200 && has(r, "\"ok\":true") && has(r, "\"skipped\":[\"futureKey\",\"tgToken\"]"));
+    CHECK(fabs(web_get_alert_delta() - 2.5f) < 1e-6);
+    uint16_t times[8]; uint8_t tc = 0; get_sched_times(times, tc); CHECK(tc == 2 && times[0] == 390 && times[1] == 1265);
+    r = S.mock_request(HTTP_POST, "/api/settings", {{"plain", "{\"emaAlpha\":\"0.3\"}"}});
+    CHECK(S.lastCode == 400 && has(r, "Неверное значение: emaAlpha"));
+    r = S.mock_request(HTTP_POST, "/api/settings", {{"plain", "{\"emaAlpha\":0.3"}});
+    CHECK(S.lastCode == 400 && has(r, "Ошибка JSON"));
+    r = S.mock_request(HTTP_POST, "/api/settings");
+    CHECK(S.lastCode == 400 && has(r, "Ошибка JSON"));
+    r = S.mock_request(HTTP_POST, "/api/tg/settings", {{"plain", "{\"token\":\"12345:abcdef\",\"chatId\":\"777\",\"reportInt\":120}"}});
+    char cid[16]; get_tg_chatid(cid, sizeof(cid));
+    CHECK(S.lastCode == 200 && has(r, "\"skipped\":[]") && !strcmp(cid, "777") && get_tg_report_interval_min() == 120);
+    r = S.mock_request(HTTP_POST, "/api/calib/set", {{"plain", "{\"offset\":null}"}});
+    CHECK(S.lastCode == 400 && has(r, "offset"));
+    // backup round trip: masked secrets and unknown/oversized fields are listed, the rest applied
+    std::string bk = body(S.mock_request(HTTP_GET, "/api/backup"));
+    bk.pop_back();
+    bk += ",\"newSection\":{\"a\":[1,2,{\"b\":\"c\"}]},\"huge\":\"" + std::string(10000, 'h') + "\"}";
+#ifdef HTTP_RAW_BUFLEN
+    S.rawChunk = 700;
+#endif
+    r = S.mock_request(HTTP_POST, "/api/backup/restore", {{"plain", bk}});
+    CHECK(S.lastCode == 200 && has(r, "Восстановлено") && has(r, "\"newSection\"") && has(r, "\"huge\"") && has(r, "\"tgToken\""));
+    CHECK(fabs(web_get_alert_delta() - 2.5f) < 1e-6);
+    r = S.mock_request(HTTP_POST, "/api/backup/restore", {{"plain", "{\"alertDelta\":3}"}});
+    CHECK(S.lastCode == 400 && has(r, "Неверный формат бэкапа"));
+#ifdef HTTP_RAW_BUFLEN
+    S.rawChunk = HTTP_RAW_BUFLEN;
+#endif
+  }
+  { // /api/data: cached snapshot, ETag, 304, rebuilt only when readings change
+    auto tag = [](const std::string &r) { size_t p = r.find("ETag: "); return p == std::string::npos ? std::string() : r.substr(p + 6, r.find("\r\n", p) - p - 6); };
+    r = S.mock_request(HTTP_GET, "/api/data");
+    std::string et = tag(r), d1 = body(r);
+    CHECK(S.lastCode == 200 && et.size() == 10 && validJson(d1) && has(r, ("Content-Length: " + std::to_string(d1.size())).c_str()));
+    r = S.mock_request(HTTP_GET, "/api/data");
+    CHECK(tag(r) == et && body(r) == d1);
+    r = S.mock_request(HTTP_GET, "/api/data", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 304 && body(r).empty());
+    w += 0.0002f;                                   // below display precision: same snapshot
+    webserver_notify(WEB_EV_WEIGHT);
+    r = S.mock_request(HTTP_GET, "/api/data", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 304);
+    w += 0.5f;
+    webserver_notify(WEB_EV_WEIGHT);
+    r = S.mock_request(HTTP_GET, "/api/data", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 200 && tag(r) != et && body(r) != d1);
+    et = tag(r); d1 = body(r);
+    r = S.mock_request(HTTP_GET, "/api/dashboard", {{"fields", "data"}});
+    CHECK(body(r) == "{\"data\":" + d1 + "}");
+    dtm = "19.10.2026 00:00:10";                    // RTC tick
+    webserver_notify(WEB_EV_TEMP);
+    r = S.mock_request(HTTP_GET, "/api/data", {}, {{"If-None-Match", et}});
+    CHECK(S.lastCode == 200 && has(r, "19.10.2026 00:00:10"));
+  }
+  if (getenv("VERBOSE")) fprintf(stderr, "%s\n", r.c_str());
+  fprintf(stderr, "%s (%d failures)\n", fails ? "FAILED" : "PASSED", fails);
+  return fails ? 1 : 0;
+}